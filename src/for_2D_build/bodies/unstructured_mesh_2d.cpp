@@ -223,6 +223,7 @@ void InnerRelationInFVM::searchNeighborsByParticles(size_t total_particles, Base
 //=================================================================================================//
 void InnerRelationInFVM::updateConfiguration()
 {
+    ++total_configuration_updates_;
     resetNeighborhoodCurrentSize();
     searchNeighborsByParticles(base_particles_.TotalRealParticles(),
                                base_particles_, inner_configuration_,
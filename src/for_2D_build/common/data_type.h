@@ -32,12 +32,14 @@
 #include "base_data_type.h"
 #include "geometric_primitive.h"
 #include "scalar_functions.h"
+#include "symmetric_matrix.h"
 
 namespace SPH
 {
 using Arrayi = Array2i;
 using Vecd = Vec2d;
 using Matd = Mat2d;
+using SymMatd = SymMat2d;
 using AngularVecd = Real;
 using Rotation = Rotation2d;
 using BoundingBox = BaseBoundingBox<Vec2d>;
@@ -65,6 +67,7 @@ const Vecd ZeroVecd = Vec2d::Zero();
 
 inline Vecd degradeToVecd(const Vec3d &input) { return Vecd(input[0], input[1]); };
 inline Matd degradeToMatd(const Mat3d &input) { return input.block<2, 2>(0, 0); };
+inline Matd degradeToMatd(const SymMat3d &input) { return input.toMatrix().block<2, 2>(0, 0); };
 
 } // namespace SPH
 
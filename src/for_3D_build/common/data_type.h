@@ -31,12 +31,14 @@
 #include "base_data_type.h"
 #include "geometric_primitive.h"
 #include "scalar_functions.h"
+#include "symmetric_matrix.h"
 
 namespace SPH
 {
 using Arrayi = Array3i;
 using Vecd = Vec3d;
 using Matd = Mat3d;
+using SymMatd = SymMat3d;
 using AngularVecd = Vec3d;
 using Rotation = Rotation3d;
 using BoundingBox = BaseBoundingBox<Vec3d>;
@@ -65,5 +67,6 @@ const Vecd ZeroVecd = Vec3d::Zero();
 
 inline Vecd degradeToVecd(const Vec3d &input) { return input; };
 inline Matd degradeToMatd(const Mat3d &input) { return input; };
+inline Matd degradeToMatd(const SymMat3d &input) { return input.toMatrix(); };
 } // namespace SPH
 #endif // DATA_TYPE_3D_H
\ No newline at end of file
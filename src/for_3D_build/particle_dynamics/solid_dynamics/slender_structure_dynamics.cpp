@@ -43,7 +43,7 @@ Real BarAcousticTimeStepSize::reduce(size_t index_i, Real dt)
 BarCorrectConfiguration::
     BarCorrectConfiguration(BaseInnerRelation &inner_relation)
     : LocalDynamics(inner_relation.getSPHBody()), DataDelegateInner(inner_relation),
-      Vol_(particles_->getVariableDataByName<Real>("VolumetricMeasure")),
+      Vol_(particles_->getVariableDataByName<StorageReal>("VolumetricMeasure")),
       B_(particles_->registerStateVariable<Matd>("LinearGradientCorrectionMatrix", IdentityMatrix<Matd>::value)),
       n0_(particles_->registerStateVariableFrom<Vecd>("InitialNormalDirection", "NormalDirection")),
       transformation_matrix0_(particles_->getVariableDataByName<Matd>("TransformationMatrix")) {}
@@ -51,7 +51,7 @@ BarCorrectConfiguration::
 BarDeformationGradientTensor::
     BarDeformationGradientTensor(BaseInnerRelation &inner_relation)
     : LocalDynamics(inner_relation.getSPHBody()), DataDelegateInner(inner_relation),
-      Vol_(particles_->getVariableDataByName<Real>("VolumetricMeasure")),
+      Vol_(particles_->getVariableDataByName<StorageReal>("VolumetricMeasure")),
       pos_(particles_->getVariableDataByName<Vecd>("Position")),
       pseudo_n_(particles_->registerStateVariableFrom<Vecd>("PseudoNormal", "NormalDirection")),
       n0_(particles_->registerStateVariableFrom<Vecd>("InitialNormalDirection", "NormalDirection")),
@@ -65,7 +65,7 @@ BarDeformationGradientTensor::
 //=================================================================================================//
 BaseBarRelaxation::BaseBarRelaxation(BaseInnerRelation &inner_relation)
     : LocalDynamics(inner_relation.getSPHBody()), DataDelegateInner(inner_relation),
-      Vol_(particles_->getVariableDataByName<Real>("VolumetricMeasure")),
+      Vol_(particles_->getVariableDataByName<StorageReal>("VolumetricMeasure")),
       thickness_(particles_->getVariableDataByName<Real>("Thickness")),
       width_(particles_->getVariableDataByName<Real>("Width")),
       pos_(particles_->getVariableDataByName<Vecd>("Position")),
@@ -102,7 +102,7 @@ BarStressRelaxationFirstHalf::
       rho0_(elastic_solid_.ReferenceDensity()), inv_rho0_(1.0 / rho0_),
       smoothing_length_(sph_body_.sph_adaptation_->ReferenceSmoothingLength()),
       numerical_damping_scaling_matrix_(Matd::Identity() * smoothing_length_),
-      rho_(particles_->getVariableDataByName<Real>("Density")),
+      rho_(particles_->getVariableDataByName<StorageReal>("Density")),
       mass_(particles_->getVariableDataByName<Real>("Mass")),
       global_stress_(particles_->registerStateVariable<Matd>("GlobalStress")),
       global_moment_(particles_->registerStateVariable<Matd>("GlobalMoment")),
@@ -94,7 +94,7 @@ class BarCorrectConfiguration : public LocalDynamics, public DataDelegateInner
     };
 
   protected:
-    Real *Vol_;
+    StorageReal *Vol_;
     Matd *B_;
     Vecd *n0_;
     Matd *transformation_matrix0_;
@@ -138,7 +138,7 @@ class BarDeformationGradientTensor : public LocalDynamics, public DataDelegateIn
     };
 
   protected:
-    Real *Vol_;
+    StorageReal *Vol_;
     Vecd *pos_, *pseudo_n_, *n0_;
     Matd *B_, *F_, *F_bending_;
     Matd *transformation_matrix0_;
@@ -157,7 +157,8 @@ class BaseBarRelaxation : public LocalDynamics, public DataDelegateInner
     virtual ~BaseBarRelaxation(){};
 
   protected:
-    Real *Vol_, *thickness_, *width_;
+    StorageReal *Vol_;
+    Real *thickness_, *width_;
     Vecd *pos_, *vel_, *force_, *force_prior_;
     Vecd *n0_, *pseudo_n_, *dpseudo_n_dt_, *dpseudo_n_d2t_, *rotation_,
         *angular_vel_, *dangular_vel_dt_;
@@ -226,7 +227,8 @@ class BarStressRelaxationFirstHalf : public BaseBarRelaxation
     Real rho0_, inv_rho0_;
     Real smoothing_length_;
     Matd numerical_damping_scaling_matrix_;
-    Real *rho_, *mass_;
+    StorageReal *rho_;
+    Real *mass_;
     Matd *global_stress_, *global_moment_, *mid_surface_cauchy_stress_;
     Vecd *global_shear_stress_, *n_;
 
@@ -2,6 +2,7 @@
 
 #include "base_body_relation.h"
 #include "base_particles.hpp"
+#include "relation_ck.h"
 #include "sph_system.h"
 
 namespace SPH
@@ -100,6 +101,29 @@ void SPHBody::writeToXmlForReloadParticle(std::string &filefullpath)
     base_particles_->writeToXmlForReloadParticle(filefullpath);
 }
 //=================================================================================================//
+void SPHBody::reportMemoryFootprint(MemoryRegistry &registry)
+{
+    if (base_particles_ != nullptr)
+    {
+        base_particles_->reportMemoryFootprint(registry);
+    }
+
+    for (size_t k = 0; k != body_relations_.size(); ++k)
+    {
+        body_relations_[k]->reportMemoryFootprint(registry);
+    }
+
+    for (size_t k = 0; k != body_relations_ck_.size(); ++k)
+    {
+        body_relations_ck_[k]->reportMemoryFootprint(registry);
+    }
+
+    for (size_t k = 0; k != level_set_shapes_.size(); ++k)
+    {
+        level_set_shapes_[k]->reportMemoryFootprint(registry, body_name_);
+    }
+}
+//=================================================================================================//
 BaseCellLinkedList &RealBody::getCellLinkedList()
 {
     if (!cell_linked_list_created_)
@@ -116,4 +140,13 @@ void RealBody::updateCellLinkedList()
     getCellLinkedList().UpdateCellLists(*base_particles_);
 }
 //=================================================================================================//
+void RealBody::reportMemoryFootprint(MemoryRegistry &registry)
+{
+    SPHBody::reportMemoryFootprint(registry);
+    if (cell_linked_list_created_)
+    {
+        cell_linked_list_ptr_->reportMemoryFootprint(registry, body_name_);
+    }
+}
+//=================================================================================================//
 } // namespace SPH
@@ -46,6 +46,7 @@
 #include "sph_system.h"
 #include "sphinxsys_containers.h"
 
+#include <algorithm>
 #include <string>
 
 namespace SPH
@@ -53,6 +54,9 @@ namespace SPH
 class SPHRelation;
 class BodySurface;
 
+template <typename...>
+class Relation;
+
 /**
  * @class SPHBody
  * @brief SPHBody is a base body with basic data and functions.
@@ -81,7 +85,9 @@ class SPHBody
   public:
     SPHAdaptation *sph_adaptation_;        /**< numerical adaptation policy */
     BaseMaterial *base_material_;          /**< base material for dynamic cast in DataDelegate */
-    StdVec<SPHRelation *> body_relations_; /**< all contact relations centered from this body **/
+    StdVec<SPHRelation *> body_relations_;       /**< all contact relations centered from this body **/
+    StdVec<Relation<Base> *> body_relations_ck_; /**< all relations for computing kernels centered from this body **/
+    StdVec<LevelSetShape *> level_set_shapes_;   /**< all level-set shapes defined for this body **/
 
     SPHBody(SPHSystem &sph_system, Shape &shape, const std::string &name);
     SPHBody(SPHSystem &sph_system, Shape &shape);
@@ -109,6 +115,8 @@ class SPHBody
     BoundingBox getSPHSystemBounds();
     int getNewBodyPartID();
     int getTotalBodyParts() { return total_body_parts_; };
+    /** report particle variables, relations and level-set shapes with the body name as owner */
+    virtual void reportMemoryFootprint(MemoryRegistry &registry);
     //----------------------------------------------------------------------
     //		Object factory template functions
     //----------------------------------------------------------------------
@@ -125,16 +133,23 @@ class SPHBody
     LevelSetShape *defineComponentLevelSetShape(const std::string &shape_name, Args &&...args)
     {
         ComplexShape *complex_shape = DynamicCast<ComplexShape>(this, initial_shape_);
-        return complex_shape->defineLevelSetShape(*this, shape_name, std::forward<Args>(args)...);
+        LevelSetShape *level_set_shape =
+            complex_shape->defineLevelSetShape(*this, shape_name, std::forward<Args>(args)...);
+        level_set_shapes_.push_back(level_set_shape);
+        return level_set_shape;
     };
 
     template <typename... Args>
     LevelSetShape *defineBodyLevelSetShape(Args &&...args)
     {
+        // a previously defined body level-set shape is released by the reset below
+        level_set_shapes_.erase(std::remove(level_set_shapes_.begin(), level_set_shapes_.end(), initial_shape_),
+                                level_set_shapes_.end());
         LevelSetShape *level_set_shape =
             shape_ptr_keeper_.resetPtr<LevelSetShape>(*this, *initial_shape_, std::forward<Args>(args)...);
 
         initial_shape_ = level_set_shape;
+        level_set_shapes_.push_back(level_set_shape);
         return level_set_shape;
     };
 
@@ -202,6 +217,25 @@ class RealBody : public SPHBody
     virtual ~RealBody(){};
     BaseCellLinkedList &getCellLinkedList();
     void updateCellLinkedList();
+    /** the cell linked list is reported in addition if it has been created */
+    virtual void reportMemoryFootprint(MemoryRegistry &registry) override;
+
+    /** Define a cell linked list other than the one created by the adaptation,
+     * such as SparseCellLinkedList. Should be called after particles are generated
+     * and before the cell linked list is used. */
+    template <class CellLinkedListType>
+    void defineCellLinkedList()
+    {
+        if (cell_linked_list_created_)
+        {
+            std::cout << "\n Error: the cell linked list of " << getName() << " has been created already!" << std::endl;
+            std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+            exit(1);
+        }
+        cell_linked_list_ptr_ = makeUnique<CellLinkedListType>(
+            getSPHSystemBounds(), sph_adaptation_->getKernel()->CutOffRadius(), *base_particles_, *sph_adaptation_);
+        cell_linked_list_created_ = true;
+    };
 };
 } // namespace SPH
 #endif // BASE_BODY_H
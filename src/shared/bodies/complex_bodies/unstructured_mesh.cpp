@@ -11,7 +11,7 @@ BaseInnerRelationInFVM::BaseInnerRelationInFVM(RealBody &real_body, ANSYSMesh &a
       node_coordinates_(ansys_mesh.node_coordinates_),
       mesh_topology_(ansys_mesh.mesh_topology_),
       pos_(base_particles_.getVariableDataByName<Vecd>("Position")),
-      Vol_(base_particles_.getVariableDataByName<Real>("VolumetricMeasure"))
+      Vol_(base_particles_.getVariableDataByName<StorageReal>("VolumetricMeasure"))
 {
     subscribeToBody();
     inner_configuration_.resize(base_particles_.RealParticlesBound(), Neighborhood());
@@ -74,7 +74,7 @@ class BaseInnerRelationInFVM : public BaseInnerRelation
 
   protected:
     Vecd *pos_;
-    Real *Vol_;
+    StorageReal *Vol_;
     virtual void resetNeighborhoodCurrentSize() override;
 };
 
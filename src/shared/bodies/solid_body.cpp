@@ -11,7 +11,7 @@ SolidBodyPartForSimbody::
     SolidBodyPartForSimbody(SPHBody &body, Shape &body_part_shape)
     : BodyRegionByParticle(body, body_part_shape),
       rho0_(DynamicCast<Solid>(this, body.base_material_)->ReferenceDensity()),
-      Vol_(base_particles_.getVariableDataByName<Real>("VolumetricMeasure")),
+      Vol_(base_particles_.getVariableDataByName<StorageReal>("VolumetricMeasure")),
       pos_(base_particles_.getVariableDataByName<Vecd>("Position"))
 {
     setMassProperties();
@@ -78,7 +78,7 @@ class SolidBodyPartForSimbody : public BodyRegionByParticle
 
   protected:
     Real rho0_;
-    Real *Vol_;
+    StorageReal *Vol_;
     Vecd *pos_;
 
   private:
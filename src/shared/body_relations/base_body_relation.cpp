@@ -21,7 +21,7 @@ SPHRelation::SPHRelation(SPHBody &sph_body)
       base_particles_(sph_body.getBaseParticles()) {}
 //=================================================================================================//
 BaseInnerRelation::BaseInnerRelation(RealBody &real_body)
-    : SPHRelation(real_body), real_body_(&real_body)
+    : SPHRelation(real_body), real_body_(&real_body), total_configuration_updates_(0)
 {
     subscribeToBody();
     inner_configuration_.resize(base_particles_.RealParticlesBound(), Neighborhood());
@@ -41,6 +41,16 @@ void BaseInnerRelation::resetNeighborhoodCurrentSize()
         ap);
 }
 //=================================================================================================//
+void BaseInnerRelation::reportMemoryFootprint(MemoryRegistry &registry)
+{
+    size_t bytes = 0;
+    for (size_t i = 0; i != inner_configuration_.size(); ++i)
+    {
+        bytes += inner_configuration_[i].MemoryBytes();
+    }
+    registry.registerMemory(sph_body_.getName(), "ParticleConfiguration", "Inner", bytes);
+}
+//=================================================================================================//
 BaseContactRelation::BaseContactRelation(SPHBody &sph_body, RealBodyVector contact_sph_bodies)
     : SPHRelation(sph_body), contact_bodies_(contact_sph_bodies)
 {
@@ -72,4 +82,18 @@ void BaseContactRelation::resetNeighborhoodCurrentSize()
     }
 }
 //=================================================================================================//
+void BaseContactRelation::reportMemoryFootprint(MemoryRegistry &registry)
+{
+    for (size_t k = 0; k != contact_bodies_.size(); ++k)
+    {
+        size_t bytes = 0;
+        for (size_t i = 0; i != contact_configuration_[k].size(); ++i)
+        {
+            bytes += contact_configuration_[k][i].MemoryBytes();
+        }
+        registry.registerMemory(sph_body_.getName(), "ParticleConfiguration",
+                                "Contact" + contact_bodies_[k]->getName(), bytes);
+    }
+}
+//=================================================================================================//
 } // namespace SPH
@@ -113,6 +113,7 @@ class SPHRelation
 
     void subscribeToBody() { sph_body_.body_relations_.push_back(this); };
     virtual void updateConfiguration() = 0;
+    virtual void reportMemoryFootprint(MemoryRegistry &registry){};
 
   protected:
     SPHBody &sph_body_;
@@ -131,8 +132,12 @@ class BaseInnerRelation : public SPHRelation
     explicit BaseInnerRelation(RealBody &real_body);
     virtual ~BaseInnerRelation(){};
     BaseInnerRelation &getRelation() { return *this; };
+    virtual void reportMemoryFootprint(MemoryRegistry &registry) override;
+    /** the number of configuration updates, by which data derived from the configuration are refreshed only when needed */
+    UnsignedInt TotalConfigurationUpdates() { return total_configuration_updates_; };
 
   protected:
+    UnsignedInt total_configuration_updates_;
     virtual void resetNeighborhoodCurrentSize();
 };
 
@@ -156,6 +161,7 @@ class BaseContactRelation : public SPHRelation
         : BaseContactRelation(sph_body, BodyPartsToRealBodies(contact_body_parts)){};
     virtual ~BaseContactRelation(){};
     BaseContactRelation &getRelation() { return *this; };
+    virtual void reportMemoryFootprint(MemoryRegistry &registry) override;
     RealBodyVector getContactBodies() { return contact_bodies_; };
     StdVec<BaseParticles *> getContactParticles() { return contact_particles_; };
     StdVec<SPHAdaptation *> getContactAdaptations() { return contact_adaptations_; };
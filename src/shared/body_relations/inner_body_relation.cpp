@@ -13,12 +13,20 @@ InnerRelation::InnerRelation(RealBody &real_body)
 //=================================================================================================//
 void InnerRelation::updateConfiguration()
 {
+    ++total_configuration_updates_;
     resetNeighborhoodCurrentSize();
     cell_linked_list_.searchNeighborsByParticles(
         sph_body_, inner_configuration_,
         get_single_search_depth_, get_inner_neighbor_);
 }
 //=================================================================================================//
+void InnerRelationByCellPairs::updateConfiguration()
+{
+    ++total_configuration_updates_;
+    resetNeighborhoodCurrentSize();
+    cell_linked_list_.searchNeighborPairsByCells(inner_configuration_, get_inner_neighbor_);
+}
+//=================================================================================================//
 AdaptiveInnerRelation::
     AdaptiveInnerRelation(RealBody &real_body)
     : BaseInnerRelation(real_body), total_levels_(0),
@@ -38,6 +46,7 @@ AdaptiveInnerRelation::
 //=================================================================================================//
 void AdaptiveInnerRelation::updateConfiguration()
 {
+    ++total_configuration_updates_;
     resetNeighborhoodCurrentSize();
     for (size_t l = 0; l != total_levels_; ++l)
     {
@@ -66,6 +75,7 @@ void SelfSurfaceContactRelation::resetNeighborhoodCurrentSize()
 //=================================================================================================//
 void SelfSurfaceContactRelation::updateConfiguration()
 {
+    ++total_configuration_updates_;
     resetNeighborhoodCurrentSize();
     cell_linked_list_.searchNeighborsByParticles(
         body_surface_layer_, inner_configuration_,
@@ -78,6 +88,7 @@ TreeInnerRelation::TreeInnerRelation(RealBody &real_body)
 //=================================================================================================//
 void TreeInnerRelation::updateConfiguration()
 {
+    ++total_configuration_updates_;
     generative_tree_.buildParticleConfiguration(inner_configuration_);
 }
 //=================================================================================================//
@@ -89,6 +100,7 @@ ShellInnerRelationWithContactKernel::ShellInnerRelationWithContactKernel(RealBod
 //=================================================================================================//
 void ShellInnerRelationWithContactKernel::updateConfiguration()
 {
+    ++total_configuration_updates_;
     resetNeighborhoodCurrentSize();
     cell_linked_list_.searchNeighborsByParticles(
         sph_body_, inner_configuration_,
@@ -103,6 +115,7 @@ ShellSelfContactRelation::
 //=================================================================================================//
 void ShellSelfContactRelation::updateConfiguration()
 {
+    ++total_configuration_updates_;
     resetNeighborhoodCurrentSize();
 
     cell_linked_list_.searchNeighborsByParticles(
@@ -112,6 +125,7 @@ void ShellSelfContactRelation::updateConfiguration()
 //=================================================================================================//
 void AdaptiveSplittingInnerRelation::updateConfiguration()
 {
+    ++total_configuration_updates_;
     resetNeighborhoodCurrentSize();
     for (size_t l = 0; l != total_levels_; ++l)
     {
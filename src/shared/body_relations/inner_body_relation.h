@@ -52,6 +52,21 @@ class InnerRelation : public BaseInnerRelation
     virtual void updateConfiguration() override;
 };
 
+/**
+ * @class InnerRelationByCellPairs
+ * @brief The inner relation built by the cell-centric search,
+ * in which each pair of neighboring cells is visited only once.
+ * Note that the order of the neighbors differs from that of InnerRelation.
+ */
+class InnerRelationByCellPairs : public InnerRelation
+{
+  public:
+    explicit InnerRelationByCellPairs(RealBody &real_body) : InnerRelation(real_body){};
+    virtual ~InnerRelationByCellPairs(){};
+
+    virtual void updateConfiguration() override;
+};
+
 /**
  * @class AdaptiveInnerRelation
  * @brief The relation within a SPH body with smoothing length adaptation
@@ -61,7 +61,14 @@ using DataAssemble = std::tuple<KeeperType<ContainerType<UnsignedInt>>,
                                 KeeperType<ContainerType<Vec2d>>,
                                 KeeperType<ContainerType<Mat2d>>,
                                 KeeperType<ContainerType<Vec3d>>,
-                                KeeperType<ContainerType<Mat3d>>>;
+                                KeeperType<ContainerType<Mat3d>>,
+                                KeeperType<ContainerType<SymMat2d>>,
+#if SPHINXSYS_USE_MIXED_PRECISION
+                                KeeperType<ContainerType<SymMat3d>>,
+                                KeeperType<ContainerType<StorageReal>>>;
+#else
+                                KeeperType<ContainerType<SymMat3d>>>;
+#endif // SPHINXSYS_USE_MIXED_PRECISION
 /** Generalized data container assemble type */
 template <template <typename> typename ContainerType>
 using DataContainerAssemble = DataAssemble<DataContainerKeeper, ContainerType>;
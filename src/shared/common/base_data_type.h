@@ -33,6 +33,7 @@
 #include <cassert>
 #include <climits>
 #include <cmath>
+#include <cstdint>
 #include <iostream>
 #include <limits>
 #include <map>
@@ -61,6 +62,17 @@ using Real = double;
 using UnsignedInt = size_t;
 #endif // SPHINXSYS_USE_FLOAT
 
+#if SPHINXSYS_USE_MIXED_PRECISION
+/** Floating-point type for storing bandwidth-bound particle variables in single precision.
+ *  The data are converted to Real when loaded so that the computation is still in Real. */
+using StorageReal = float;
+#else
+using StorageReal = Real;
+#endif // SPHINXSYS_USE_MIXED_PRECISION
+
+/** Compact neighbor index saved as the offset to the particle index. */
+using NeighborDelta = std::int16_t;
+
 /** Vector with integers. */
 using Array2i = Eigen::Array<int, 2, 1>;
 using Array3i = Eigen::Array<int, 3, 1>;
@@ -90,6 +102,13 @@ struct ZeroData<Real>
 {
     static inline Real value = Real(0);
 };
+#if SPHINXSYS_USE_MIXED_PRECISION
+template <>
+struct ZeroData<StorageReal>
+{
+    static inline StorageReal value = StorageReal(0);
+};
+#endif // SPHINXSYS_USE_MIXED_PRECISION
 template <>
 struct ZeroData<int>
 {
@@ -149,6 +168,14 @@ struct DataTypeIndex<Mat3d>
 {
     static constexpr int value = 6;
 };
+#if SPHINXSYS_USE_MIXED_PRECISION
+/** after the symmetric matrices, see symmetric_matrix.h */
+template <>
+struct DataTypeIndex<StorageReal>
+{
+    static constexpr int value = 9;
+};
+#endif // SPHINXSYS_USE_MIXED_PRECISION
 
 /** Verbal boolean for positive and negative axis directions. */
 const int xAxis = 0;
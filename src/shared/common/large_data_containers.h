@@ -43,7 +43,8 @@
 namespace SPH
 {
 
-static tbb::affinity_partitioner ap;
+/** per thread, so that loops started concurrently, e.g. by a DynamicsGraph, do not share a partitioner. */
+static thread_local tbb::affinity_partitioner ap;
 typedef tbb::blocked_range<size_t> IndexRange;
 typedef tbb::blocked_range2d<size_t> IndexRange2d;
 typedef tbb::blocked_range3d<size_t> IndexRange3d;
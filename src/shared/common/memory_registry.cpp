@@ -0,0 +1,140 @@
+#include "memory_registry.h"
+
+#include <algorithm>
+#include <iomanip>
+
+namespace SPH
+{
+//=================================================================================================//
+void MemoryRegistry::registerMemory(const std::string &owner, const std::string &category,
+                                    const std::string &name, size_t bytes)
+{
+    entries_.push_back(MemoryEntry{owner, category, name, bytes});
+}
+//=================================================================================================//
+void MemoryRegistry::registerParticles(const std::string &owner, size_t total_real_particles)
+{
+    for (auto &owner_particles : owner_particles_)
+    {
+        if (owner_particles.first == owner)
+        {
+            owner_particles.second = total_real_particles;
+            return;
+        }
+    }
+    owner_particles_.push_back(std::make_pair(owner, total_real_particles));
+}
+//=================================================================================================//
+void MemoryRegistry::clear()
+{
+    entries_.clear();
+    owner_particles_.clear();
+}
+//=================================================================================================//
+StdVec<std::string> MemoryRegistry::Owners()
+{
+    StdVec<std::string> owners;
+    for (auto &owner_particles : owner_particles_)
+    {
+        owners.push_back(owner_particles.first);
+    }
+    for (auto &entry : entries_)
+    {
+        if (std::find(owners.begin(), owners.end(), entry.owner_) == owners.end())
+        {
+            owners.push_back(entry.owner_);
+        }
+    }
+    return owners;
+}
+//=================================================================================================//
+size_t MemoryRegistry::TotalBytes()
+{
+    size_t total_bytes = 0;
+    for (auto &entry : entries_)
+    {
+        total_bytes += entry.bytes_;
+    }
+    return total_bytes;
+}
+//=================================================================================================//
+size_t MemoryRegistry::TotalBytes(const std::string &owner)
+{
+    size_t total_bytes = 0;
+    for (auto &entry : entries_)
+    {
+        if (entry.owner_ == owner)
+        {
+            total_bytes += entry.bytes_;
+        }
+    }
+    return total_bytes;
+}
+//=================================================================================================//
+size_t MemoryRegistry::CategoryBytes(const std::string &owner, const std::string &category)
+{
+    size_t category_bytes = 0;
+    for (auto &entry : entries_)
+    {
+        if (entry.owner_ == owner && entry.category_ == category)
+        {
+            category_bytes += entry.bytes_;
+        }
+    }
+    return category_bytes;
+}
+//=================================================================================================//
+size_t MemoryRegistry::TotalRealParticles(const std::string &owner)
+{
+    for (auto &owner_particles : owner_particles_)
+    {
+        if (owner_particles.first == owner)
+        {
+            return owner_particles.second;
+        }
+    }
+    return 0;
+}
+//=================================================================================================//
+Real MemoryRegistry::BytesPerParticle(const std::string &owner)
+{
+    size_t total_real_particles = TotalRealParticles(owner);
+    return total_real_particles == 0 ? Real(0) : Real(TotalBytes(owner)) / Real(total_real_particles);
+}
+//=================================================================================================//
+void MemoryRegistry::printTable(std::ostream &output)
+{
+    const Real mega_bytes = 1024.0 * 1024.0;
+    std::ios_base::fmtflags original_flags = output.flags();
+    std::streamsize original_precision = output.precision();
+    output << std::fixed;
+    for (auto &owner : Owners())
+    {
+        size_t total_real_particles = TotalRealParticles(owner);
+        output << "\n Memory footprint of " << owner << " with "
+               << total_real_particles << " real particles:\n";
+        output << std::left << "  " << std::setw(24) << "Category" << std::setw(40) << "Name"
+               << std::right << std::setw(14) << "MB" << std::setw(16) << "Bytes/particle" << "\n";
+        for (auto &entry : entries_)
+        {
+            if (entry.owner_ == owner)
+            {
+                Real bytes_per_particle = total_real_particles == 0
+                                              ? Real(0)
+                                              : Real(entry.bytes_) / Real(total_real_particles);
+                output << std::left << "  " << std::setw(24) << entry.category_ << std::setw(40) << entry.name_
+                       << std::right << std::setprecision(3) << std::setw(14) << Real(entry.bytes_) / mega_bytes
+                       << std::setprecision(1) << std::setw(16) << bytes_per_particle << "\n";
+            }
+        }
+        output << std::left << "  " << std::setw(64) << "Total"
+               << std::right << std::setprecision(3) << std::setw(14) << Real(TotalBytes(owner)) / mega_bytes
+               << std::setprecision(1) << std::setw(16) << BytesPerParticle(owner) << "\n";
+    }
+    output << "\n Memory footprint of all bodies: "
+           << std::setprecision(3) << Real(TotalBytes()) / mega_bytes << " MB\n";
+    output.flags(original_flags);
+    output.precision(original_precision);
+}
+//=================================================================================================//
+} // namespace SPH
@@ -0,0 +1,82 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2023 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file memory_registry.h
+ * @brief Registry of the memory footprint of bodies, variables and relations.
+ * @details The containers allocated by a body, such as particle variables,
+ * the particle reserve for buffer and ghost particles, cell linked lists,
+ * neighbor lists and level-set data packages, report their allocated bytes to the registry.
+ * Together with the number of real particles of each body,
+ * the bytes per particle are given for estimating the memory at higher resolution.
+ */
+
+#ifndef MEMORY_REGISTRY_H
+#define MEMORY_REGISTRY_H
+
+#include "base_data_type.h"
+#include "sphinxsys_containers.h"
+
+#include <iostream>
+
+namespace SPH
+{
+/**
+ * @class MemoryRegistry
+ * @brief Memory entries given by owner, i.e. the body name, category and container name.
+ */
+class MemoryRegistry
+{
+  public:
+    struct MemoryEntry
+    {
+        std::string owner_;
+        std::string category_;
+        std::string name_;
+        size_t bytes_;
+    };
+
+    MemoryRegistry(){};
+    ~MemoryRegistry(){};
+
+    void registerMemory(const std::string &owner, const std::string &category,
+                        const std::string &name, size_t bytes);
+    void registerParticles(const std::string &owner, size_t total_real_particles);
+    void clear();
+
+    StdVec<MemoryEntry> &Entries() { return entries_; };
+    StdVec<std::string> Owners();
+    size_t TotalBytes();
+    size_t TotalBytes(const std::string &owner);
+    size_t CategoryBytes(const std::string &owner, const std::string &category);
+    size_t TotalRealParticles(const std::string &owner);
+    /** zero if the owner has no real particles */
+    Real BytesPerParticle(const std::string &owner);
+    /** table of all entries grouped by owner with the bytes per particle */
+    void printTable(std::ostream &output = std::cout);
+
+  protected:
+    StdVec<MemoryEntry> entries_;
+    StdVec<std::pair<std::string, size_t>> owner_particles_;
+};
+} // namespace SPH
+#endif // MEMORY_REGISTRY_H
@@ -70,6 +70,21 @@ CastingType &DynamicCast(OwnerType *owner, CastedType &casted)
     return *tmp;
 }
 
+/** Casting to the exact dynamic type, used where the casted type is dispatched statically
+ * and a derived type with different behavior must not be accepted. */
+template <class CastingType, class OwnerType, class CastedType>
+CastingType &ExactCast(OwnerType *owner, CastedType &casted)
+{
+    if (typeid(casted) != typeid(CastingType))
+    {
+        std::cout << "\n Error: reference ExactCasting " << typeid(casted).name() << " to "
+                  << typeid(CastingType).name() << " is not an exact type match! \n";
+        std::cout << "\n This error locates in " << typeid(*owner).name() << '\n';
+        exit(1);
+    }
+    return static_cast<CastingType &>(casted);
+}
+
 template <class T>
 using UniquePtr = std::unique_ptr<T>;
 
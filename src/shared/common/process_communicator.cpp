@@ -0,0 +1,149 @@
+#include "process_communicator.h"
+
+#if SPHINXSYS_USE_MPI
+#include <mpi.h>
+#endif
+
+namespace SPH
+{
+#if SPHINXSYS_USE_MPI
+namespace
+{
+MPI_Datatype RealType()
+{
+    return sizeof(Real) == sizeof(float) ? MPI_FLOAT : MPI_DOUBLE;
+}
+} // namespace
+//=================================================================================================//
+ProcessCommunicator::ProcessCommunicator()
+    : rank_(0), size_(1), is_initialized_here_(false)
+{
+    int is_initialized = 0;
+    MPI_Initialized(&is_initialized);
+    if (!is_initialized)
+    {
+        MPI_Init(nullptr, nullptr);
+        is_initialized_here_ = true;
+    }
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank_);
+    MPI_Comm_size(MPI_COMM_WORLD, &size_);
+}
+//=================================================================================================//
+ProcessCommunicator::~ProcessCommunicator()
+{
+    int is_finalized = 0;
+    MPI_Finalized(&is_finalized);
+    if (is_initialized_here_ && !is_finalized)
+    {
+        MPI_Finalize();
+    }
+}
+//=================================================================================================//
+void ProcessCommunicator::barrier()
+{
+    MPI_Barrier(MPI_COMM_WORLD);
+}
+//=================================================================================================//
+Real ProcessCommunicator::allReduceMin(Real local_value)
+{
+    Real global_value = local_value;
+    MPI_Allreduce(&local_value, &global_value, 1, RealType(), MPI_MIN, MPI_COMM_WORLD);
+    return global_value;
+}
+//=================================================================================================//
+Real ProcessCommunicator::allReduceMax(Real local_value)
+{
+    Real global_value = local_value;
+    MPI_Allreduce(&local_value, &global_value, 1, RealType(), MPI_MAX, MPI_COMM_WORLD);
+    return global_value;
+}
+//=================================================================================================//
+Real ProcessCommunicator::allReduceSum(Real local_value)
+{
+    Real global_value = local_value;
+    MPI_Allreduce(&local_value, &global_value, 1, RealType(), MPI_SUM, MPI_COMM_WORLD);
+    return global_value;
+}
+//=================================================================================================//
+std::uint64_t ProcessCommunicator::allReduceSum(std::uint64_t local_value)
+{
+    std::uint64_t global_value = local_value;
+    MPI_Allreduce(&local_value, &global_value, 1, MPI_UINT64_T, MPI_SUM, MPI_COMM_WORLD);
+    return global_value;
+}
+//=================================================================================================//
+void ProcessCommunicator::allReduceSum(StdVec<std::uint64_t> &values)
+{
+    MPI_Allreduce(MPI_IN_PLACE, values.data(), int(values.size()), MPI_UINT64_T, MPI_SUM, MPI_COMM_WORLD);
+}
+//=================================================================================================//
+ProcessBuffers ProcessCommunicator::exchangeBuffers(const ProcessBuffers &send_buffers)
+{
+    StdVec<int> send_counts(size_, 0), send_offsets(size_, 0);
+    StdVec<int> receive_counts(size_, 0), receive_offsets(size_, 0);
+    StdVec<char> send_data;
+    for (int k = 0; k != size_; ++k)
+    {
+        send_counts[k] = int(send_buffers[k].size());
+        send_offsets[k] = int(send_data.size());
+        send_data.insert(send_data.end(), send_buffers[k].begin(), send_buffers[k].end());
+    }
+    MPI_Alltoall(send_counts.data(), 1, MPI_INT, receive_counts.data(), 1, MPI_INT, MPI_COMM_WORLD);
+
+    int total_receive_count = 0;
+    for (int k = 0; k != size_; ++k)
+    {
+        receive_offsets[k] = total_receive_count;
+        total_receive_count += receive_counts[k];
+    }
+    StdVec<char> receive_data(total_receive_count);
+    MPI_Alltoallv(send_data.data(), send_counts.data(), send_offsets.data(), MPI_CHAR,
+                  receive_data.data(), receive_counts.data(), receive_offsets.data(), MPI_CHAR, MPI_COMM_WORLD);
+
+    ProcessBuffers receive_buffers(size_);
+    for (int k = 0; k != size_; ++k)
+    {
+        receive_buffers[k].assign(receive_data.begin() + receive_offsets[k],
+                                  receive_data.begin() + receive_offsets[k] + receive_counts[k]);
+    }
+    return receive_buffers;
+}
+//=================================================================================================//
+#else
+//=================================================================================================//
+ProcessCommunicator::ProcessCommunicator()
+    : rank_(0), size_(1), is_initialized_here_(false) {}
+//=================================================================================================//
+ProcessCommunicator::~ProcessCommunicator() {}
+//=================================================================================================//
+void ProcessCommunicator::barrier() {}
+//=================================================================================================//
+Real ProcessCommunicator::allReduceMin(Real local_value)
+{
+    return local_value;
+}
+//=================================================================================================//
+Real ProcessCommunicator::allReduceMax(Real local_value)
+{
+    return local_value;
+}
+//=================================================================================================//
+Real ProcessCommunicator::allReduceSum(Real local_value)
+{
+    return local_value;
+}
+//=================================================================================================//
+std::uint64_t ProcessCommunicator::allReduceSum(std::uint64_t local_value)
+{
+    return local_value;
+}
+//=================================================================================================//
+void ProcessCommunicator::allReduceSum(StdVec<std::uint64_t> &values) {}
+//=================================================================================================//
+ProcessBuffers ProcessCommunicator::exchangeBuffers(const ProcessBuffers &send_buffers)
+{
+    return send_buffers;
+}
+//=================================================================================================//
+#endif
+} // namespace SPH
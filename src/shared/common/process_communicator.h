@@ -0,0 +1,77 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2023 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file process_communicator.h
+ * @brief Communication between the processes of a distributed simulation.
+ * @details With SPHINXSYS_USE_MPI, each process is an MPI rank of MPI_COMM_WORLD.
+ * Otherwise, there is only one process and the communication is trivial,
+ * so that the distributed algorithms also run in a shared-memory build.
+ * The communicator is one per process and given by SPHSystem::getProcessCommunicator.
+ */
+
+#ifndef PROCESS_COMMUNICATOR_H
+#define PROCESS_COMMUNICATOR_H
+
+#include "base_data_type.h"
+#include "large_data_containers.h"
+
+#include <cstdint>
+
+namespace SPH
+{
+/** Byte buffers, one for each process. */
+using ProcessBuffers = StdVec<StdVec<char>>;
+
+/**
+ * @class ProcessCommunicator
+ * @brief Global reductions and buffer exchanges among all processes.
+ * All functions are collective, i.e. they are called by all processes in the same order.
+ */
+class ProcessCommunicator
+{
+  public:
+    ProcessCommunicator();
+    ~ProcessCommunicator();
+
+    int Rank() const { return rank_; };
+    int Size() const { return size_; };
+    bool isDistributed() const { return size_ > 1; };
+
+    void barrier();
+    Real allReduceMin(Real local_value);
+    Real allReduceMax(Real local_value);
+    Real allReduceSum(Real local_value);
+    std::uint64_t allReduceSum(std::uint64_t local_value);
+    /** element-wise sum of the local values, such as histograms */
+    void allReduceSum(StdVec<std::uint64_t> &values);
+    /** Sends the k-th buffer to the process of rank k
+     * and returns the buffers received from all processes in the order of rank. */
+    ProcessBuffers exchangeBuffers(const ProcessBuffers &send_buffers);
+
+  protected:
+    int rank_;
+    int size_;
+    bool is_initialized_here_; /**< MPI is finalized by the communicator which initialized it */
+};
+} // namespace SPH
+#endif // PROCESS_COMMUNICATOR_H
@@ -0,0 +1,340 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2023 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file 	small_matrix_batch.h
+ * @brief 	Small matrices of a batch of particles, saved component by component
+ *          so that the operations are vectorized across the particles.
+ * @details Each component of a batch matrix is an Eigen array with a lane for a particle,
+ *          and the width of the batch is given by the 256-bit SIMD register.
+ *          The operations are branch free: a condition is evaluated for all lanes
+ *          and the results are selected lane by lane.
+ * @author	Xiangyu Hu
+ */
+
+#ifndef SMALL_MATRIX_BATCH_H
+#define SMALL_MATRIX_BATCH_H
+
+#include "base_data_type.h"
+#include "symmetric_matrix.h"
+
+namespace SPH
+{
+/** number of particles in a batch */
+constexpr UnsignedInt BatchLanes = 32 / sizeof(Real);
+using RealBatch = Eigen::Array<Real, BatchLanes, 1>;
+using BoolBatch = Eigen::Array<bool, BatchLanes, 1>;
+
+template <int N>
+class MatrixBatch
+{
+    using MatrixType = Eigen::Matrix<Real, N, N>;
+
+  public:
+    MatrixBatch(){};
+
+    static MatrixBatch Zero()
+    {
+        MatrixBatch zero;
+        for (int k = 0; k != N * N; ++k)
+            zero.data_[k] = RealBatch::Zero();
+        return zero;
+    };
+
+    static MatrixBatch Identity()
+    {
+        MatrixBatch identity = Zero();
+        for (int k = 0; k != N; ++k)
+            identity(k, k) = RealBatch::Ones();
+        return identity;
+    };
+
+    RealBatch &operator()(int i, int j) { return data_[i * N + j]; };
+    const RealBatch &operator()(int i, int j) const { return data_[i * N + j]; };
+
+    MatrixType lane(UnsignedInt l) const
+    {
+        MatrixType matrix;
+        for (int i = 0; i != N; ++i)
+            for (int j = 0; j != N; ++j)
+                matrix(i, j) = (*this)(i, j)[l];
+        return matrix;
+    };
+
+    void setLane(UnsignedInt l, const MatrixType &matrix)
+    {
+        for (int i = 0; i != N; ++i)
+            for (int j = 0; j != N; ++j)
+                (*this)(i, j)[l] = matrix(i, j);
+    };
+
+    /** gather from the particle data, the lanes beyond the given number are set to identity */
+    void load(const MatrixType *data, UnsignedInt index_begin, UnsignedInt lanes)
+    {
+        for (UnsignedInt l = 0; l != BatchLanes; ++l)
+            setLane(l, l < lanes ? data[index_begin + l] : MatrixType::Identity());
+    };
+
+    void store(MatrixType *data, UnsignedInt index_begin, UnsignedInt lanes) const
+    {
+        for (UnsignedInt l = 0; l != lanes; ++l)
+            data[index_begin + l] = lane(l);
+    };
+
+    /** the particle data saved as symmetric matrices, only the symmetric part is stored back */
+    void load(const SymmetricMatrix<N> *data, UnsignedInt index_begin, UnsignedInt lanes)
+    {
+        for (UnsignedInt l = 0; l != BatchLanes; ++l)
+            setLane(l, l < lanes ? data[index_begin + l].toMatrix() : MatrixType::Identity());
+    };
+
+    void store(SymmetricMatrix<N> *data, UnsignedInt index_begin, UnsignedInt lanes) const
+    {
+        for (UnsignedInt l = 0; l != lanes; ++l)
+            data[index_begin + l] = SymmetricMatrix<N>(lane(l));
+    };
+
+    MatrixBatch &operator+=(const MatrixBatch &other)
+    {
+        for (int k = 0; k != N * N; ++k)
+            data_[k] += other.data_[k];
+        return *this;
+    };
+
+    MatrixBatch &operator-=(const MatrixBatch &other)
+    {
+        for (int k = 0; k != N * N; ++k)
+            data_[k] -= other.data_[k];
+        return *this;
+    };
+
+    MatrixBatch operator+(const MatrixBatch &other) const { return MatrixBatch(*this) += other; };
+    MatrixBatch operator-(const MatrixBatch &other) const { return MatrixBatch(*this) -= other; };
+
+    MatrixBatch operator*(const RealBatch &scale) const
+    {
+        MatrixBatch scaled;
+        for (int k = 0; k != N * N; ++k)
+            scaled.data_[k] = data_[k] * scale;
+        return scaled;
+    };
+
+    MatrixBatch operator*(Real scale) const
+    {
+        MatrixBatch scaled;
+        for (int k = 0; k != N * N; ++k)
+            scaled.data_[k] = data_[k] * scale;
+        return scaled;
+    };
+
+    MatrixBatch operator/(const RealBatch &scale) const { return *this * scale.inverse(); };
+
+    MatrixBatch operator*(const MatrixBatch &other) const
+    {
+        MatrixBatch product = Zero();
+        for (int i = 0; i != N; ++i)
+            for (int k = 0; k != N; ++k)
+                for (int j = 0; j != N; ++j)
+                    product(i, j) += (*this)(i, k) * other(k, j);
+        return product;
+    };
+
+    MatrixBatch transpose() const
+    {
+        MatrixBatch transposed;
+        for (int i = 0; i != N; ++i)
+            for (int j = 0; j != N; ++j)
+                transposed(i, j) = (*this)(j, i);
+        return transposed;
+    };
+
+    RealBatch trace() const
+    {
+        RealBatch sum = data_[0];
+        for (int k = 1; k != N; ++k)
+            sum += (*this)(k, k);
+        return sum;
+    };
+
+    /** sum of the component-wise products, i.e. the double contraction A:B */
+    RealBatch cwiseProductSum(const MatrixBatch &other) const
+    {
+        RealBatch sum = data_[0] * other.data_[0];
+        for (int k = 1; k != N * N; ++k)
+            sum += data_[k] * other.data_[k];
+        return sum;
+    };
+
+    RealBatch norm() const { return cwiseProductSum(*this).sqrt(); };
+
+    RealBatch determinant() const
+    {
+        static_assert(N == 2 || N == 3, "Only 2x2 and 3x3 matrices are supported!");
+        const MatrixBatch &A = *this;
+        if constexpr (N == 2)
+        {
+            return A(0, 0) * A(1, 1) - A(0, 1) * A(1, 0);
+        }
+        else
+        {
+            return A(0, 0) * (A(1, 1) * A(2, 2) - A(1, 2) * A(2, 1)) -
+                   A(0, 1) * (A(1, 0) * A(2, 2) - A(1, 2) * A(2, 0)) +
+                   A(0, 2) * (A(1, 0) * A(2, 1) - A(1, 1) * A(2, 0));
+        }
+    };
+
+    /** by the adjugate matrix, note that a singular lane gives non-finite values */
+    MatrixBatch inverse() const
+    {
+        static_assert(N == 2 || N == 3, "Only 2x2 and 3x3 matrices are supported!");
+        const MatrixBatch &A = *this;
+        MatrixBatch adjugate;
+        if constexpr (N == 2)
+        {
+            adjugate(0, 0) = A(1, 1);
+            adjugate(0, 1) = -A(0, 1);
+            adjugate(1, 0) = -A(1, 0);
+            adjugate(1, 1) = A(0, 0);
+        }
+        else
+        {
+            adjugate(0, 0) = A(1, 1) * A(2, 2) - A(1, 2) * A(2, 1);
+            adjugate(0, 1) = A(0, 2) * A(2, 1) - A(0, 1) * A(2, 2);
+            adjugate(0, 2) = A(0, 1) * A(1, 2) - A(0, 2) * A(1, 1);
+            adjugate(1, 0) = A(1, 2) * A(2, 0) - A(1, 0) * A(2, 2);
+            adjugate(1, 1) = A(0, 0) * A(2, 2) - A(0, 2) * A(2, 0);
+            adjugate(1, 2) = A(0, 2) * A(1, 0) - A(0, 0) * A(1, 2);
+            adjugate(2, 0) = A(1, 0) * A(2, 1) - A(1, 1) * A(2, 0);
+            adjugate(2, 1) = A(0, 1) * A(2, 0) - A(0, 0) * A(2, 1);
+            adjugate(2, 2) = A(0, 0) * A(1, 1) - A(0, 1) * A(1, 0);
+        }
+        return adjugate / determinant();
+    };
+
+  protected:
+    RealBatch data_[N * N];
+};
+
+template <int N>
+inline MatrixBatch<N> operator*(Real scale, const MatrixBatch<N> &matrix) { return matrix * scale; };
+template <int N>
+inline MatrixBatch<N> operator*(const RealBatch &scale, const MatrixBatch<N> &matrix) { return matrix * scale; };
+
+/** scaled identity matrix with a diagonal value for each lane */
+template <int N>
+inline MatrixBatch<N> diagonalBatch(const RealBatch &diagonal)
+{
+    MatrixBatch<N> matrix = MatrixBatch<N>::Zero();
+    for (int k = 0; k != N; ++k)
+        matrix(k, k) = diagonal;
+    return matrix;
+};
+
+/** select lane by lane, the first matrix for a true condition and the second otherwise */
+template <int N>
+inline MatrixBatch<N> selectBatch(const BoolBatch &condition, const MatrixBatch<N> &then_matrix,
+                                  const MatrixBatch<N> &else_matrix)
+{
+    MatrixBatch<N> selected;
+    for (int i = 0; i != N; ++i)
+        for (int j = 0; j != N; ++j)
+            selected(i, j) = condition.select(then_matrix(i, j), else_matrix(i, j));
+    return selected;
+};
+
+inline MatrixBatch<3> upgradeToMat3d(const MatrixBatch<2> &input)
+{
+    MatrixBatch<3> output = MatrixBatch<3>::Zero();
+    for (int i = 0; i != 2; ++i)
+        for (int j = 0; j != 2; ++j)
+            output(i, j) = input(i, j);
+    return output;
+};
+inline MatrixBatch<3> upgradeToMat3d(const MatrixBatch<3> &input) { return input; };
+
+/** the second invariant J2 of a deviatoric tensor */
+template <int N>
+inline RealBatch secondInvariant(const MatrixBatch<N> &deviatoric)
+{
+    return 0.5 * deviatoric.cwiseProductSum(deviatoric.transpose());
+};
+
+/**
+ * Eigen decomposition of symmetric matrices by cyclic Jacobi rotations with a fixed number of sweeps,
+ * so that all lanes carry out the same operations. The eigenvalues are not sorted.
+ */
+template <int N>
+void symmetricEigenDecomposition(const MatrixBatch<N> &symmetric_matrix,
+                                 MatrixBatch<N> &eigenvectors, RealBatch (&eigenvalues)[N])
+{
+    constexpr int sweeps = N == 2 ? 1 : 6;
+    MatrixBatch<N> diagonalized = symmetric_matrix;
+    eigenvectors = MatrixBatch<N>::Identity();
+    for (int sweep = 0; sweep != sweeps; ++sweep)
+    {
+        for (int p = 0; p != N - 1; ++p)
+            for (int q = p + 1; q != N; ++q)
+            {
+                const RealBatch &a_pq = diagonalized(p, q);
+                BoolBatch is_rotated = a_pq.abs() > TinyReal;
+                RealBatch theta = (diagonalized(q, q) - diagonalized(p, p)) /
+                                  (2.0 * is_rotated.select(a_pq, RealBatch::Ones()));
+                RealBatch sign = (theta < 0.0).select(-RealBatch::Ones(), RealBatch::Ones());
+                RealBatch t = is_rotated.select(sign / (theta.abs() + (theta.square() + 1.0).sqrt()),
+                                                RealBatch::Zero());
+                RealBatch c = (t.square() + 1.0).rsqrt();
+                RealBatch s = t * c;
+
+                MatrixBatch<N> rotation = MatrixBatch<N>::Identity();
+                rotation(p, p) = c;
+                rotation(q, q) = c;
+                rotation(p, q) = s;
+                rotation(q, p) = -s;
+                diagonalized = rotation.transpose() * diagonalized * rotation;
+                eigenvectors = eigenvectors * rotation;
+            }
+    }
+
+    for (int k = 0; k != N; ++k)
+        eigenvalues[k] = diagonalized(k, k);
+};
+
+/** polar decomposition F = R * U with the rotation R and the symmetric right stretch U */
+template <int N>
+void polarDecomposition(const MatrixBatch<N> &F, MatrixBatch<N> &rotation, MatrixBatch<N> &stretch)
+{
+    MatrixBatch<N> eigenvectors;
+    RealBatch eigenvalues[N];
+    symmetricEigenDecomposition(F.transpose() * F, eigenvectors, eigenvalues);
+
+    MatrixBatch<N> principal_stretch = MatrixBatch<N>::Zero();
+    MatrixBatch<N> inverse_principal_stretch = MatrixBatch<N>::Zero();
+    for (int k = 0; k != N; ++k)
+    {
+        principal_stretch(k, k) = eigenvalues[k].max(0.0).sqrt();
+        inverse_principal_stretch(k, k) = principal_stretch(k, k).inverse();
+    }
+    stretch = eigenvectors * principal_stretch * eigenvectors.transpose();
+    rotation = F * eigenvectors * inverse_principal_stretch * eigenvectors.transpose();
+};
+} // namespace SPH
+#endif // SMALL_MATRIX_BATCH_H
@@ -135,6 +135,7 @@ class DiscreteVariable : public Entity
 
     bool isDataDelegated() { return device_data_field_ != nullptr; };
     size_t getDataSize() { return data_size_; }
+    size_t MemoryBytes() { return data_size_ * sizeof(DataType); };
     void setDeviceData(DataType *data_field) { device_data_field_ = data_field; };
 
     template <class ExecutionPolicy>
@@ -175,16 +176,19 @@ class MeshVariable : public Entity
   public:
     using PackageData = PackageDataMatrix<DataType, 4>;
     MeshVariable(const std::string &name, size_t data_size)
-        : Entity(name), data_field_(nullptr){};
+        : Entity(name), data_size_(0), data_field_(nullptr){};
     ~MeshVariable() { delete[] data_field_; };
 
     PackageData *Data() { return data_field_; };
     void allocateAllMeshVariableData(const size_t size)
     {
+        data_size_ = size;
         data_field_ = new PackageData[size];
     }
+    size_t MemoryBytes() { return data_size_ * sizeof(PackageData); };
 
   private:
+    size_t data_size_;
     PackageData *data_field_;
 };
 
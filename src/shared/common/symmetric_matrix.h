@@ -0,0 +1,181 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2023 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file 	symmetric_matrix.h
+ * @brief 	Small symmetric matrix saved by its independent components,
+ *          for the symmetric tensors of the particle states, such as stress and strain.
+ * @details The diagonal components are saved first and then the off-diagonal ones,
+ *          i.e. xx, yy, xy in 2D and xx, yy, zz, xy, xz, yz in 3D.
+ *          The arithmetic not closed for symmetric matrices is carried out
+ *          with the full matrix given by toMatrix().
+ * @author	Xiangyu Hu
+ */
+
+#ifndef SYMMETRIC_MATRIX_H
+#define SYMMETRIC_MATRIX_H
+
+#include "base_data_type.h"
+
+namespace SPH
+{
+template <int N>
+class SymmetricMatrix
+{
+  public:
+    static constexpr int Components = N * (N + 1) / 2;
+    using FullMatrix = Eigen::Matrix<Real, N, N>;
+    using ComponentVector = Eigen::Matrix<Real, Components, 1>;
+
+    SymmetricMatrix(){};
+    explicit SymmetricMatrix(const ComponentVector &components) : components_(components){};
+    /** from the symmetric part of a full matrix */
+    explicit SymmetricMatrix(const FullMatrix &matrix)
+    {
+        for (int i = 0; i != N; ++i)
+        {
+            components_[i] = matrix(i, i);
+            for (int j = i + 1; j != N; ++j)
+                components_[index(i, j)] = 0.5 * (matrix(i, j) + matrix(j, i));
+        }
+    };
+
+    static SymmetricMatrix Zero() { return SymmetricMatrix(ComponentVector(ComponentVector::Zero())); };
+    static SymmetricMatrix Identity()
+    {
+        SymmetricMatrix identity = Zero();
+        identity.components_.template head<N>().setOnes();
+        return identity;
+    };
+
+    static constexpr int index(int i, int j) { return i == j ? i : N + i + j - 1; };
+    Real &operator()(int i, int j) { return components_[index(i, j)]; };
+    Real operator()(int i, int j) const { return components_[index(i, j)]; };
+    ComponentVector &components() { return components_; };
+    const ComponentVector &components() const { return components_; };
+
+    FullMatrix toMatrix() const
+    {
+        FullMatrix matrix;
+        for (int i = 0; i != N; ++i)
+            for (int j = 0; j != N; ++j)
+                matrix(i, j) = (*this)(i, j);
+        return matrix;
+    };
+
+    Real trace() const { return components_.template head<N>().sum(); };
+    /** double contraction A:B */
+    Real doubleDot(const SymmetricMatrix &other) const
+    {
+        return components_.template head<N>().dot(other.components_.template head<N>()) +
+               2.0 * components_.template tail<Components - N>().dot(other.components_.template tail<Components - N>());
+    };
+    Real doubleDot(const FullMatrix &other) const { return toMatrix().cwiseProduct(other).sum(); };
+    Real squaredNorm() const { return doubleDot(*this); };
+    Real norm() const { return sqrt(squaredNorm()); };
+    SymmetricMatrix deviatoric() const
+    {
+        SymmetricMatrix deviatoric_part = *this;
+        deviatoric_part.components_.template head<N>().array() -= trace() / Real(N);
+        return deviatoric_part;
+    };
+
+    SymmetricMatrix &operator+=(const SymmetricMatrix &other)
+    {
+        components_ += other.components_;
+        return *this;
+    };
+    SymmetricMatrix &operator-=(const SymmetricMatrix &other)
+    {
+        components_ -= other.components_;
+        return *this;
+    };
+    SymmetricMatrix &operator*=(Real scale)
+    {
+        components_ *= scale;
+        return *this;
+    };
+    SymmetricMatrix &operator/=(Real scale)
+    {
+        components_ /= scale;
+        return *this;
+    };
+    SymmetricMatrix operator+(const SymmetricMatrix &other) const { return SymmetricMatrix(*this) += other; };
+    SymmetricMatrix operator-(const SymmetricMatrix &other) const { return SymmetricMatrix(*this) -= other; };
+    SymmetricMatrix operator-() const { return SymmetricMatrix(ComponentVector(-components_)); };
+    SymmetricMatrix operator*(Real scale) const { return SymmetricMatrix(*this) *= scale; };
+    SymmetricMatrix operator/(Real scale) const { return SymmetricMatrix(*this) /= scale; };
+    bool operator==(const SymmetricMatrix &other) const { return components_ == other.components_; };
+
+  protected:
+    ComponentVector components_;
+};
+
+template <int N>
+inline SymmetricMatrix<N> operator*(Real scale, const SymmetricMatrix<N> &matrix) { return matrix * scale; };
+
+/** the components separated by commas, as the Eigen matrices are written into xml files */
+template <int N>
+std::ostream &operator<<(std::ostream &out, const SymmetricMatrix<N> &matrix)
+{
+    for (int k = 0; k != SymmetricMatrix<N>::Components; ++k)
+        out << (k == 0 ? "" : ", ") << matrix.components()[k];
+    return out;
+};
+
+template <int N>
+std::istream &operator>>(std::istream &in, SymmetricMatrix<N> &matrix)
+{
+    for (int k = 0; k != SymmetricMatrix<N>::Components; ++k)
+    {
+        if (k != 0)
+            in.ignore(std::numeric_limits<std::streamsize>::max(), ',');
+        in >> matrix.components()[k];
+    }
+    return in;
+};
+
+using SymMat2d = SymmetricMatrix<2>;
+using SymMat3d = SymmetricMatrix<3>;
+
+inline SymMat3d upgradeToSymMat3d(const SymMat2d &input)
+{
+    SymMat3d output = SymMat3d::Zero();
+    output(0, 0) = input(0, 0);
+    output(1, 1) = input(1, 1);
+    output(0, 1) = input(0, 1);
+    return output;
+};
+inline SymMat3d upgradeToSymMat3d(const SymMat3d &input) { return input; };
+
+template <>
+struct DataTypeIndex<SymMat2d>
+{
+    static constexpr int value = 7;
+};
+template <>
+struct DataTypeIndex<SymMat3d>
+{
+    static constexpr int value = 8;
+};
+} // namespace SPH
+#endif // SYMMETRIC_MATRIX_H
@@ -31,6 +31,16 @@ void LevelSetShape::writeLevelSet(SPHSystem &sph_system)
     write_level_set_to_plt.writeToFile(0);
 }
 //=================================================================================================//
+void LevelSetShape::reportMemoryFootprint(MemoryRegistry &registry, const std::string &owner)
+{
+    StdVec<MeshWithGridDataPackagesType *> mesh_levels = level_set_.getMeshLevels();
+    for (size_t l = 0; l != mesh_levels.size(); ++l)
+    {
+        registry.registerMemory(owner, "LevelSet", getName() + "Level" + std::to_string(l),
+                                mesh_levels[l]->MemoryBytes());
+    }
+}
+//=================================================================================================//
 LevelSetShape *LevelSetShape::cleanLevelSet(Real small_shift_factor)
 {
     level_set_.cleanInterface(small_shift_factor);
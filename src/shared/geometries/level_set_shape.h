@@ -31,6 +31,7 @@
 
 #include "base_geometry.h"
 #include "level_set.h"
+#include "memory_registry.h"
 
 #include <string>
 
@@ -66,6 +67,8 @@ class LevelSetShape : public Shape
     /** required to build level set from triangular mesh in stl file format. */
     LevelSetShape *correctLevelSetSign(Real small_shift_factor = 1.0);
     void writeLevelSet(SPHSystem &sph_system);
+    /** report the data packages of all levels */
+    void reportMemoryFootprint(MemoryRegistry &registry, const std::string &owner);
 
   protected:
     MultilevelLevelSet &level_set_; /**< narrow bounded level set mesh. */
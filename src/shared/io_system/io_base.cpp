@@ -63,9 +63,14 @@ RestartIO::RestartIO(SPHSystem &sph_system)
     : BaseIO(sph_system), bodies_(sph_system.getRealBodies()),
       overall_file_path_(io_environment_.restart_folder_ + "/Restart_time_")
 {
+    /** each process writes and reads the restart files of its own particles */
+    ProcessCommunicator &process_communicator = sph_system.getProcessCommunicator();
+    std::string rank_suffix = process_communicator.isDistributed()
+                                  ? "rank_" + std::to_string(process_communicator.Rank()) + "_"
+                                  : "";
     for (size_t i = 0; i < bodies_.size(); ++i)
     {
-        file_names_.push_back(io_environment_.restart_folder_ + "/" + bodies_[i]->getName() + "_rst_");
+        file_names_.push_back(io_environment_.restart_folder_ + "/" + bodies_[i]->getName() + "_rst_" + rank_suffix);
 
         // basic variable for write to restart file
         BaseParticles &particles = bodies_[i]->getBaseParticles();
@@ -78,14 +83,17 @@ RestartIO::RestartIO(SPHSystem &sph_system)
 //=============================================================================================//
 void RestartIO::writeToFile(size_t iteration_step)
 {
-    std::string overall_filefullpath = overall_file_path_ + padValueWithZeros(iteration_step) + ".dat";
-    if (fs::exists(overall_filefullpath))
+    if (sph_system_.getProcessCommunicator().Rank() == 0)
     {
-        fs::remove(overall_filefullpath);
+        std::string overall_filefullpath = overall_file_path_ + padValueWithZeros(iteration_step) + ".dat";
+        if (fs::exists(overall_filefullpath))
+        {
+            fs::remove(overall_filefullpath);
+        }
+        std::ofstream out_file(overall_filefullpath.c_str(), std::ios::app);
+        out_file << std::fixed << std::setprecision(9) << sv_physical_time_.getValue() << "   \n";
+        out_file.close();
     }
-    std::ofstream out_file(overall_filefullpath.c_str(), std::ios::app);
-    out_file << std::fixed << std::setprecision(9) << sv_physical_time_.getValue() << "   \n";
-    out_file.close();
 
     for (size_t i = 0; i < bodies_.size(); ++i)
     {
@@ -0,0 +1,147 @@
+#include "io_diagnostics.h"
+
+#include "sph_system.hpp"
+
+#include <numeric>
+#include <tbb/global_control.h>
+#include <tbb/task_arena.h>
+
+namespace SPH
+{
+//=============================================================================================//
+CountStatistics::CountStatistics(UnsignedInt bin_width, UnsignedInt number_of_bins)
+    : bin_width_(bin_width), min_(0), max_(0), number_of_samples_(0),
+      mean_(0.0), histogram_(number_of_bins, 0) {}
+//=============================================================================================//
+void CountStatistics::update(const StdVec<UnsignedInt> &counts)
+{
+    number_of_samples_ = counts.size();
+    min_ = number_of_samples_ == 0 ? 0 : counts[0];
+    max_ = 0;
+    std::fill(histogram_.begin(), histogram_.end(), 0);
+
+    Real sum = 0.0;
+    UnsignedInt last_bin = histogram_.size() - 1;
+    for (const UnsignedInt &count : counts)
+    {
+        min_ = SMIN(min_, count);
+        max_ = SMAX(max_, count);
+        sum += Real(count);
+        histogram_[SMIN(count / bin_width_, last_bin)]++;
+    }
+    mean_ = number_of_samples_ == 0 ? 0.0 : sum / Real(number_of_samples_);
+}
+//=============================================================================================//
+void CountStatistics::writeHeader(std::ofstream &out_file, const std::string &name)
+{
+    out_file << "\"" << name << "_min\"   \"" << name << "_mean\"   \"" << name << "_max\"   ";
+    for (size_t k = 0; k != histogram_.size(); ++k)
+    {
+        out_file << "\"" << name << "[" << k * bin_width_ << "]\"   ";
+    }
+}
+//=============================================================================================//
+void CountStatistics::writeStatistics(std::ofstream &out_file)
+{
+    out_file << min_ << "   " << mean_ << "   " << max_ << "   ";
+    for (size_t k = 0; k != histogram_.size(); ++k)
+    {
+        out_file << histogram_[k] << "   ";
+    }
+}
+//=============================================================================================//
+BaseNeighborDiagnosticsRecording::
+    BaseNeighborDiagnosticsRecording(SPHBody &sph_body, size_t interval, UnsignedInt neighbor_bin_width,
+                                     UnsignedInt cell_bin_width, UnsignedInt number_of_bins)
+    : BaseIO(sph_body.getSPHSystem()), sph_body_(sph_body),
+      particles_(sph_body.getBaseParticles()), interval_(interval),
+      neighbor_statistics_(neighbor_bin_width, number_of_bins),
+      cell_statistics_(cell_bin_width, number_of_bins), thread_work_imbalance_(1.0)
+{
+    filefullpath_output_ = io_environment_.output_folder_ + "/" + sph_body_.getName() + "_NeighborDiagnostics.dat";
+    std::ofstream out_file(filefullpath_output_.c_str(), std::ios::app);
+    out_file << "\"run_time\"   ";
+    neighbor_statistics_.writeHeader(out_file, "Neighbors");
+    out_file << "\"OccupiedCells\"   ";
+    cell_statistics_.writeHeader(out_file, "CellOccupancy");
+    out_file << "\"ThreadWorkImbalance\"";
+    out_file << "\n";
+    out_file.close();
+}
+//=============================================================================================//
+void BaseNeighborDiagnosticsRecording::computeStatistics()
+{
+    prepareNeighborCounts();
+    UnsignedInt total_real_particles = particles_.TotalRealParticles();
+    StdVec<UnsignedInt> neighbor_counts(total_real_particles);
+    StdVec<UnsignedInt> thread_work(tbb::this_task_arena::max_concurrency(), 0);
+    parallel_for(
+        IndexRange(0, total_real_particles),
+        [&](const IndexRange &r)
+        {
+            UnsignedInt work = 0;
+            for (size_t i = r.begin(); i != r.end(); ++i)
+            {
+                neighbor_counts[i] = NeighborCount(i);
+                work += neighbor_counts[i];
+            }
+            // a thread slot is used by only one thread at a time
+            thread_work[tbb::this_task_arena::current_thread_index()] += work;
+        },
+        ap);
+    neighbor_statistics_.update(neighbor_counts);
+
+    UnsignedInt total_work = std::accumulate(thread_work.begin(), thread_work.end(), UnsignedInt(0));
+    UnsignedInt max_work = *std::max_element(thread_work.begin(), thread_work.end());
+    // the mean is taken over the threads allowed to run rather than over all slots of the arena
+    UnsignedInt number_of_threads = SMIN(thread_work.size(),
+        tbb::global_control::active_value(tbb::global_control::max_allowed_parallelism));
+    thread_work_imbalance_ = total_work == 0 ? 1.0 : Real(max_work * number_of_threads) / Real(total_work);
+
+    StdVec<UnsignedInt> cell_occupancy;
+    collectCellOccupancy(cell_occupancy);
+    cell_statistics_.update(cell_occupancy);
+}
+//=============================================================================================//
+void BaseNeighborDiagnosticsRecording::writeToFile(size_t iteration_step)
+{
+    if (iteration_step % interval_ != 0)
+    {
+        return;
+    }
+
+    computeStatistics();
+    std::ofstream out_file(filefullpath_output_.c_str(), std::ios::app);
+    out_file << sv_physical_time_.getValue() << "   ";
+    neighbor_statistics_.writeStatistics(out_file);
+    out_file << cell_statistics_.NumberOfSamples() << "   ";
+    cell_statistics_.writeStatistics(out_file);
+    out_file << thread_work_imbalance_;
+    out_file << "\n";
+    out_file.close();
+}
+//=============================================================================================//
+NeighborDiagnosticsRecording::
+    NeighborDiagnosticsRecording(BaseInnerRelation &inner_relation, size_t interval,
+                                 UnsignedInt neighbor_bin_width, UnsignedInt cell_bin_width,
+                                 UnsignedInt number_of_bins)
+    : BaseNeighborDiagnosticsRecording(inner_relation.getSPHBody(), interval,
+                                       neighbor_bin_width, cell_bin_width, number_of_bins),
+      inner_configuration_(inner_relation.inner_configuration_),
+      real_body_(*inner_relation.real_body_) {}
+//=============================================================================================//
+UnsignedInt NeighborDiagnosticsRecording::NeighborCount(UnsignedInt index_i)
+{
+    return inner_configuration_[index_i].current_size_;
+}
+//=============================================================================================//
+void NeighborDiagnosticsRecording::collectCellOccupancy(StdVec<UnsignedInt> &cell_occupancy)
+{
+    StdVec<CellLinkedList *> cell_linked_list_levels = real_body_.getCellLinkedList().CellLinkedListLevels();
+    for (size_t l = 0; l != cell_linked_list_levels.size(); ++l)
+    {
+        cell_linked_list_levels[l]->collectCellOccupancy(cell_occupancy);
+    }
+}
+//=============================================================================================//
+} // namespace SPH
@@ -0,0 +1,116 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2023 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file 	io_diagnostics.h
+ * @brief 	Recording of neighbor and cell-occupancy statistics for load diagnostics.
+ * @details The minimum, mean and maximum numbers of neighbors and of particles in the occupied cells
+ *          are written together with their histograms. The last bin of a histogram counts all
+ *          values beyond the histogram range. The thread work imbalance is the ratio of the maximum
+ *          to the mean neighbor work processed by the threads in a parallel loop over the particles.
+ */
+
+#ifndef IO_DIAGNOSTICS_H
+#define IO_DIAGNOSTICS_H
+
+#include "base_body_relation.h"
+#include "io_base.h"
+
+namespace SPH
+{
+/**
+ * @class CountStatistics
+ * @brief Minimum, mean, maximum and fixed-width histogram of non-negative counts.
+ */
+class CountStatistics
+{
+  public:
+    CountStatistics(UnsignedInt bin_width, UnsignedInt number_of_bins);
+    void update(const StdVec<UnsignedInt> &counts);
+    UnsignedInt MinCount() { return min_; };
+    Real MeanCount() { return mean_; };
+    UnsignedInt MaxCount() { return max_; };
+    UnsignedInt NumberOfSamples() { return number_of_samples_; };
+    StdVec<UnsignedInt> &Histogram() { return histogram_; };
+    void writeHeader(std::ofstream &out_file, const std::string &name);
+    void writeStatistics(std::ofstream &out_file);
+
+  protected:
+    UnsignedInt bin_width_;
+    UnsignedInt min_, max_, number_of_samples_;
+    Real mean_;
+    StdVec<UnsignedInt> histogram_;
+};
+
+/**
+ * @class BaseNeighborDiagnosticsRecording
+ * @brief Neighbor and cell-occupancy statistics of a body written at a given interval of iteration steps.
+ * Only the occupied cells are included in the cell-occupancy statistics.
+ */
+class BaseNeighborDiagnosticsRecording : public BaseIO
+{
+  public:
+    BaseNeighborDiagnosticsRecording(SPHBody &sph_body, size_t interval, UnsignedInt neighbor_bin_width,
+                                     UnsignedInt cell_bin_width, UnsignedInt number_of_bins);
+    virtual ~BaseNeighborDiagnosticsRecording(){};
+
+    void computeStatistics();
+    virtual void writeToFile(size_t iteration_step = 0) override;
+    CountStatistics &NeighborStatistics() { return neighbor_statistics_; };
+    CountStatistics &CellOccupancyStatistics() { return cell_statistics_; };
+    Real ThreadWorkImbalance() { return thread_work_imbalance_; };
+
+  protected:
+    SPHBody &sph_body_;
+    BaseParticles &particles_;
+    size_t interval_;
+    CountStatistics neighbor_statistics_;
+    CountStatistics cell_statistics_;
+    Real thread_work_imbalance_;
+    std::string filefullpath_output_;
+
+    virtual void prepareNeighborCounts(){};
+    virtual UnsignedInt NeighborCount(UnsignedInt index_i) = 0;
+    virtual void collectCellOccupancy(StdVec<UnsignedInt> &cell_occupancy) = 0;
+};
+
+/**
+ * @class NeighborDiagnosticsRecording
+ * @brief Diagnostics for the inner relation and the cell lists updated without computing kernels.
+ */
+class NeighborDiagnosticsRecording : public BaseNeighborDiagnosticsRecording
+{
+  public:
+    explicit NeighborDiagnosticsRecording(BaseInnerRelation &inner_relation, size_t interval = 1,
+                                          UnsignedInt neighbor_bin_width = 8, UnsignedInt cell_bin_width = 2,
+                                          UnsignedInt number_of_bins = 16);
+    virtual ~NeighborDiagnosticsRecording(){};
+
+  protected:
+    ParticleConfiguration &inner_configuration_;
+    RealBody &real_body_;
+
+    virtual UnsignedInt NeighborCount(UnsignedInt index_i) override;
+    virtual void collectCellOccupancy(StdVec<UnsignedInt> &cell_occupancy) override;
+};
+} // namespace SPH
+#endif // IO_DIAGNOSTICS_H
@@ -11,36 +11,42 @@ IOEnvironment::IOEnvironment(SPHSystem &sph_system, bool delete_output)
       input_folder_("./input"), output_folder_("./output"),
       restart_folder_("./restart"), reload_folder_("./reload")
 {
-    if (!fs::exists(input_folder_))
+    /** The folders are shared by all processes and only prepared by the first one. */
+    ProcessCommunicator &process_communicator = sph_system.getProcessCommunicator();
+    if (process_communicator.Rank() == 0)
     {
-        fs::create_directory(input_folder_);
-    }
+        if (!fs::exists(input_folder_))
+        {
+            fs::create_directory(input_folder_);
+        }
 
-    if (!fs::exists(output_folder_))
-    {
-        fs::create_directory(output_folder_);
-    }
+        if (!fs::exists(output_folder_))
+        {
+            fs::create_directory(output_folder_);
+        }
 
-    if (!fs::exists(restart_folder_))
-    {
-        fs::create_directory(restart_folder_);
-    }
+        if (!fs::exists(restart_folder_))
+        {
+            fs::create_directory(restart_folder_);
+        }
 
-    if (!fs::exists(reload_folder_))
-    {
-        fs::create_directory(reload_folder_);
-    }
+        if (!fs::exists(reload_folder_))
+        {
+            fs::create_directory(reload_folder_);
+        }
 
-    if (sph_system.RestartStep() == 0)
-    {
-        fs::remove_all(restart_folder_);
-        fs::create_directory(restart_folder_);
-        if (delete_output == true)
+        if (sph_system.RestartStep() == 0)
         {
-            fs::remove_all(output_folder_);
-            fs::create_directory(output_folder_);
+            fs::remove_all(restart_folder_);
+            fs::create_directory(restart_folder_);
+            if (delete_output == true)
+            {
+                fs::remove_all(output_folder_);
+                fs::create_directory(output_folder_);
+            }
         }
     }
+    process_communicator.barrier();
 
     sph_system.io_environment_ = this;
 }
@@ -60,6 +60,14 @@ void BodyStatesRecordingToPlt::writePltFileHeader(
     {
         output_file << ",\"" << variable->Name() << "\"";
     };
+
+#if SPHINXSYS_USE_MIXED_PRECISION
+    constexpr int type_index_StorageReal = DataTypeIndex<StorageReal>::value;
+    for (DiscreteVariable<StorageReal> *variable : std::get<type_index_StorageReal>(variables_to_write))
+    {
+        output_file << ",\"" << variable->Name() << "\"";
+    };
+#endif // SPHINXSYS_USE_MIXED_PRECISION
 }
 //=================================================================================================//
 void BodyStatesRecordingToPlt::writePltFileParticleData(
@@ -91,6 +99,15 @@ void BodyStatesRecordingToPlt::writePltFileParticleData(
         Real *data_field = variable->Data();
         output_file << data_field[index] << " ";
     };
+
+#if SPHINXSYS_USE_MIXED_PRECISION
+    constexpr int type_index_StorageReal = DataTypeIndex<StorageReal>::value;
+    for (DiscreteVariable<StorageReal> *variable : std::get<type_index_StorageReal>(variables_to_write))
+    {
+        StorageReal *data_field = variable->Data();
+        output_file << data_field[index] << " ";
+    };
+#endif // SPHINXSYS_USE_MIXED_PRECISION
 }
 //=============================================================================================//
 void BodyStatesRecordingToPlt::writeWithFileName(const std::string &sequence)
@@ -78,6 +78,23 @@ void BodyStatesRecordingToVtp::writeParticlesToVtk(OutStreamType &output_stream,
         output_stream << "    </DataArray>\n";
     }
 
+#if SPHINXSYS_USE_MIXED_PRECISION
+    // write scalars stored in single precision
+    constexpr int type_index_StorageReal = DataTypeIndex<StorageReal>::value;
+    for (DiscreteVariable<StorageReal> *variable : std::get<type_index_StorageReal>(variables_to_write))
+    {
+        StorageReal *data_field = variable->Data();
+        output_stream << "    <DataArray Name=\"" << variable->Name() << "\" type=\"Float32\" Format=\"ascii\">\n";
+        output_stream << "    ";
+        for (size_t i = 0; i != total_real_particles; ++i)
+        {
+            output_stream << std::fixed << std::setprecision(9) << data_field[i] << " ";
+        }
+        output_stream << std::endl;
+        output_stream << "    </DataArray>\n";
+    }
+#endif // SPHINXSYS_USE_MIXED_PRECISION
+
     // write vectors
     constexpr int type_index_Vecd = DataTypeIndex<Vecd>::value;
     for (DiscreteVariable<Vecd> *variable : std::get<type_index_Vecd>(variables_to_write))
@@ -113,6 +130,28 @@ void BodyStatesRecordingToVtp::writeParticlesToVtk(OutStreamType &output_stream,
         output_stream << std::endl;
         output_stream << "    </DataArray>\n";
     }
+
+    // write symmetric matrices, in the component order XX, YY, ZZ, XY, YZ, XZ of VTK
+    auto write_symmetric_matrices = [&](auto &variables)
+    {
+        for (auto *variable : variables)
+        {
+            auto *data_field = variable->Data();
+            output_stream << "    <DataArray Name=\"" << variable->Name() << "\" type= \"Float32\"  NumberOfComponents=\"6\" Format=\"ascii\">\n";
+            output_stream << "    ";
+            for (size_t i = 0; i != total_real_particles; ++i)
+            {
+                SymMat3d matrix_value = upgradeToSymMat3d(data_field[i]);
+                output_stream << std::fixed << std::setprecision(9)
+                              << matrix_value(0, 0) << " " << matrix_value(1, 1) << " " << matrix_value(2, 2) << " "
+                              << matrix_value(0, 1) << " " << matrix_value(1, 2) << " " << matrix_value(0, 2) << " ";
+            }
+            output_stream << std::endl;
+            output_stream << "    </DataArray>\n";
+        }
+    };
+    write_symmetric_matrices(std::get<DataTypeIndex<SymMat2d>::value>(variables_to_write));
+    write_symmetric_matrices(std::get<DataTypeIndex<SymMat3d>::value>(variables_to_write));
 }
 //=============================================================================================//
 } // namespace SPH
@@ -33,6 +33,8 @@
 #define ELASTIC_SOLID_H
 
 #include "base_material.h"
+#include "small_matrix_batch.h"
+
 #include <fstream>
 
 namespace SPH
@@ -111,6 +113,32 @@ class ElasticSolid : public Solid
     /** Get average acceleration when interacting with fluid. */
     virtual DiscreteVariable<Vecd> *AverageAccelerationVariable(BaseParticles *base_particles) override;
     virtual ElasticSolid *ThisObjectPtr() override { return this; };
+
+    /** Constitutive kernel through the virtual interface, for materials only known at run time. */
+    class ConstituteKernel
+    {
+      public:
+        explicit ConstituteKernel(ElasticSolid &encloser) : elastic_solid_(encloser){};
+
+        Real ShearModulus() { return elastic_solid_.ShearModulus(); };
+        Real PairNumericalDamping(Real dE_dt_ij, Real smoothing_length)
+        {
+            return elastic_solid_.PairNumericalDamping(dE_dt_ij, smoothing_length);
+        };
+        Matd StressPK1(Matd &F, size_t index_i) { return elastic_solid_.StressPK1(F, index_i); };
+        Matd StressPK2(Matd &F, size_t index_i) { return elastic_solid_.StressPK2(F, index_i); };
+        Matd StressCauchy(Matd &almansi_strain, size_t index_i) { return elastic_solid_.StressCauchy(almansi_strain, index_i); };
+        Matd DeviatoricKirchhoff(const Matd &deviatoric_be) { return elastic_solid_.DeviatoricKirchhoff(deviatoric_be); };
+        Real VolumetricKirchhoff(Real J) { return elastic_solid_.VolumetricKirchhoff(J); };
+        template <typename ScalingType>
+        Matd NumericalDampingLeftCauchy(const Matd &F, const Matd &dF_dt, const ScalingType &scaling, size_t index_i)
+        {
+            return elastic_solid_.NumericalDampingLeftCauchy(F, dF_dt, scaling, index_i);
+        };
+
+      protected:
+        ElasticSolid &elastic_solid_;
+    };
 };
 
 /**
@@ -137,6 +165,51 @@ class LinearElasticSolid : public ElasticSolid
     Real getPoissonRatio() { return nu_; };
     Real getDensity() { return rho0_; };
 
+    /** Value-type constitutive kernel for static dispatch in computing kernels. */
+    class ConstituteKernel
+    {
+      public:
+        explicit ConstituteKernel(LinearElasticSolid &encloser)
+            : rho0_(encloser.rho0_), c0_(encloser.c0_), cs0_(encloser.cs0_),
+              lambda0_(encloser.lambda0_), G0_(encloser.G0_), K0_(encloser.K0_){};
+
+        Real ShearModulus() const { return G0_; };
+        Real PairNumericalDamping(Real dE_dt_ij, Real smoothing_length) const
+        {
+            return 0.5 * rho0_ * c0_ * dE_dt_ij * smoothing_length;
+        };
+        Matd StressPK1(const Matd &F, UnsignedInt index_i) const { return F * StressPK2(F, index_i); };
+        Matd StressPK2(const Matd &F, UnsignedInt index_i) const
+        {
+            Matd strain = 0.5 * (F.transpose() + F) - Matd::Identity();
+            return lambda0_ * strain.trace() * Matd::Identity() + 2.0 * G0_ * strain;
+        };
+        /** Batched versions. A derived kernel redefining StressPK1 hides them,
+         *  so that it is computed particle by particle unless it gives its own batched version. */
+        MatrixBatch<Dimensions> StressPK1(const MatrixBatch<Dimensions> &F) const { return F * StressPK2(F); };
+        MatrixBatch<Dimensions> StressPK2(const MatrixBatch<Dimensions> &F) const
+        {
+            MatrixBatch<Dimensions> strain = 0.5 * (F.transpose() + F) - MatrixBatch<Dimensions>::Identity();
+            return diagonalBatch<Dimensions>(lambda0_ * strain.trace()) + 2.0 * G0_ * strain;
+        };
+        Matd StressCauchy(const Matd &almansi_strain, UnsignedInt index_i) const
+        {
+            return lambda0_ * almansi_strain.trace() * Matd::Identity() + 2.0 * G0_ * almansi_strain;
+        };
+        Matd DeviatoricKirchhoff(const Matd &deviatoric_be) const { return G0_ * deviatoric_be; };
+        Real VolumetricKirchhoff(Real J) const { return K0_ * J * (J - 1); };
+        template <typename ScalingType>
+        Matd NumericalDampingLeftCauchy(const Matd &F, const Matd &dF_dt, const ScalingType &scaling, UnsignedInt index_i) const
+        {
+            Matd strain_rate = 0.5 * (dF_dt * F.transpose() + F * dF_dt.transpose());
+            Matd normal_rate = getDiagonal(strain_rate);
+            return 0.5 * rho0_ * (cs0_ * (strain_rate - normal_rate) + c0_ * normal_rate) * scaling;
+        };
+
+      protected:
+        Real rho0_, c0_, cs0_, lambda0_, G0_, K0_;
+    };
+
   protected:
     Real lambda0_; /*< first Lame parameter */
     Real getBulkModulus(Real youngs_modulus, Real poisson_ratio);
@@ -162,6 +235,26 @@ class SaintVenantKirchhoffSolid : public LinearElasticSolid
 
     /** second Piola-Kirchhoff stress related with green-lagrangian deformation tensor */
     virtual Matd StressPK2(Matd &deformation, size_t particle_index_i) override;
+
+    class ConstituteKernel : public LinearElasticSolid::ConstituteKernel
+    {
+      public:
+        explicit ConstituteKernel(SaintVenantKirchhoffSolid &encloser)
+            : LinearElasticSolid::ConstituteKernel(encloser){};
+
+        Matd StressPK1(const Matd &F, UnsignedInt index_i) const { return F * StressPK2(F, index_i); };
+        Matd StressPK2(const Matd &F, UnsignedInt index_i) const
+        {
+            Matd strain = 0.5 * (F.transpose() * F - Matd::Identity());
+            return lambda0_ * strain.trace() * Matd::Identity() + 2.0 * G0_ * strain;
+        };
+        MatrixBatch<Dimensions> StressPK1(const MatrixBatch<Dimensions> &F) const { return F * StressPK2(F); };
+        MatrixBatch<Dimensions> StressPK2(const MatrixBatch<Dimensions> &F) const
+        {
+            MatrixBatch<Dimensions> strain = 0.5 * (F.transpose() * F - MatrixBatch<Dimensions>::Identity());
+            return diagonalBatch<Dimensions>(lambda0_ * strain.trace()) + 2.0 * G0_ * strain;
+        };
+    };
 };
 
 /**
@@ -185,6 +278,38 @@ class NeoHookeanSolid : public LinearElasticSolid
     virtual Real VolumetricKirchhoff(Real J) override;
     /** Define the calculation of the stress matrix for postprocessing */
     virtual std::string getRelevantStressMeasureName() override { return "Cauchy"; };
+
+    class ConstituteKernel : public LinearElasticSolid::ConstituteKernel
+    {
+      public:
+        explicit ConstituteKernel(NeoHookeanSolid &encloser)
+            : LinearElasticSolid::ConstituteKernel(encloser){};
+
+        Matd StressPK1(const Matd &F, UnsignedInt index_i) const { return F * StressPK2(F, index_i); };
+        Matd StressPK2(const Matd &F, UnsignedInt index_i) const
+        {
+            Matd right_cauchy = F.transpose() * F;
+            Real J = F.determinant();
+            return G0_ * Matd::Identity() + (lambda0_ * (J - 1.0) - G0_) * J * right_cauchy.inverse();
+        };
+        MatrixBatch<Dimensions> StressPK1(const MatrixBatch<Dimensions> &F) const { return F * StressPK2(F); };
+        MatrixBatch<Dimensions> StressPK2(const MatrixBatch<Dimensions> &F) const
+        {
+            MatrixBatch<Dimensions> right_cauchy = F.transpose() * F;
+            RealBatch J = F.determinant();
+            return diagonalBatch<Dimensions>(RealBatch::Constant(G0_)) +
+                   (lambda0_ * (J - 1.0) - G0_) * J * right_cauchy.inverse();
+        };
+        Matd StressCauchy(const Matd &almansi_strain, UnsignedInt index_i) const
+        {
+            Matd B = (-2.0 * almansi_strain + Matd::Identity()).inverse();
+            Real J = sqrt(B.determinant());
+            return 0.5 * K0_ * (J - 1.0 / J) * Matd::Identity() +
+                   G0_ * pow(J, -2.0 * OneOverDimensions - 1.0) *
+                       (B - OneOverDimensions * B.trace() * Matd::Identity());
+        };
+        Real VolumetricKirchhoff(Real J) const { return 0.5 * K0_ * (J * J - 1); };
+    };
 };
 
 /**
@@ -295,6 +420,47 @@ class Muscle : public NeoHookeanSolid
 
     virtual Muscle *ThisObjectPtr() override { return this; };
 
+    class ConstituteKernel : public NeoHookeanSolid::ConstituteKernel
+    {
+      public:
+        explicit ConstituteKernel(Muscle &encloser)
+            : NeoHookeanSolid::ConstituteKernel(encloser),
+              f0_(encloser.f0_), s0_(encloser.s0_),
+              f0f0_(encloser.f0f0_), s0s0_(encloser.s0s0_), f0s0_(encloser.f0s0_)
+        {
+            std::copy(encloser.a0_, encloser.a0_ + 4, a0_);
+            std::copy(encloser.b0_, encloser.b0_ + 4, b0_);
+        };
+
+        Matd StressPK1(const Matd &F, UnsignedInt index_i) const { return F * StressPK2(F, index_i); };
+        Matd StressPK2(const Matd &F, UnsignedInt index_i) const
+        {
+            return MusclePK2(F, f0_, s0_, f0f0_, s0s0_, f0s0_);
+        };
+        Real VolumetricKirchhoff(Real J) const { return K0_ * J * (J - 1); };
+
+      protected:
+        Vecd f0_, s0_;
+        Matd f0f0_, s0s0_, f0s0_;
+        Real a0_[4], b0_[4];
+
+        Matd MusclePK2(const Matd &F, const Vecd &f0, const Vecd &s0,
+                       const Matd &f0f0, const Matd &s0s0, const Matd &f0s0) const
+        {
+            Matd right_cauchy = F.transpose() * F;
+            Real I_ff_1 = (right_cauchy * f0).dot(f0) - 1.0;
+            Real I_ss_1 = (right_cauchy * s0).dot(s0) - 1.0;
+            Real I_fs = (right_cauchy * f0).dot(s0);
+            Real I_1_1 = right_cauchy.trace() - Real(Dimensions);
+            Real J = F.determinant();
+            return a0_[0] * exp(b0_[0] * I_1_1) * Matd::Identity() +
+                   (lambda0_ * (J - 1.0) - a0_[0]) * J * right_cauchy.inverse() +
+                   2.0 * a0_[1] * I_ff_1 * exp(b0_[1] * I_ff_1 * I_ff_1) * f0f0 +
+                   2.0 * a0_[2] * I_ss_1 * exp(b0_[2] * I_ss_1 * I_ss_1) * s0s0 +
+                   a0_[3] * I_fs * exp(b0_[3] * I_fs * I_fs) * f0s0;
+        };
+    };
+
   protected:
     Vecd f0_, s0_;            /**< Reference fiber and sheet directions as basic parameter. */
     Matd f0f0_, s0s0_, f0s0_; /**< Tensor products of fiber and sheet directions as basic parameter.. */
@@ -341,6 +507,27 @@ class LocallyOrthotropicMuscle : public Muscle
     virtual Matd StressPK2(Matd &deformation, size_t particle_index_i) override;
     /** Define the calculation of the stress matrix for postprocessing */
     virtual std::string getRelevantStressMeasureName() override { return "Cauchy"; };
+
+    /** Note that the local parameters are host data registered by the particles. */
+    class ConstituteKernel : public Muscle::ConstituteKernel
+    {
+      public:
+        explicit ConstituteKernel(LocallyOrthotropicMuscle &encloser)
+            : Muscle::ConstituteKernel(encloser),
+              local_f0f0_(encloser.local_f0f0_), local_s0s0_(encloser.local_s0s0_),
+              local_f0s0_(encloser.local_f0s0_), local_f0_(encloser.local_f0_), local_s0_(encloser.local_s0_){};
+
+        Matd StressPK1(const Matd &F, UnsignedInt index_i) const { return F * StressPK2(F, index_i); };
+        Matd StressPK2(const Matd &F, UnsignedInt index_i) const
+        {
+            return MusclePK2(F, local_f0_[index_i], local_s0_[index_i],
+                             local_f0f0_[index_i], local_s0s0_[index_i], local_f0s0_[index_i]);
+        };
+
+      protected:
+        Matd *local_f0f0_, *local_s0s0_, *local_f0s0_;
+        Vecd *local_f0_, *local_s0_;
+    };
 };
 } // namespace SPH
 #endif // ELASTIC_SOLID_H
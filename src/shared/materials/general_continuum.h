@@ -29,6 +29,7 @@
 #ifndef GENERAL_CONTINUUM_H
 #define GENERAL_CONTINUUM_H
 
+#include "small_matrix_batch.h"
 #include "weakly_compressible_fluid.h"
 
 namespace SPH
@@ -160,6 +161,45 @@ class PlasticContinuum : public GeneralContinuum
           return stress_tensor;
         };
 
+        /** batched version of ConstitutiveRelation, the plastic flow is selected by lane */
+        MatrixBatch<3> ConstitutiveRelation(const MatrixBatch<3> &velocity_gradient, const MatrixBatch<3> &stress_tensor)
+        {
+            MatrixBatch<3> strain_rate = 0.5 * (velocity_gradient + velocity_gradient.transpose());
+            MatrixBatch<3> spin_rate = 0.5 * (velocity_gradient - velocity_gradient.transpose());
+            RealBatch strain_rate_trace = strain_rate.trace();
+            RealBatch stress_tensor_trace = stress_tensor.trace();
+            MatrixBatch<3> deviatoric_strain_rate = strain_rate - diagonalBatch<3>((1.0 / stress_dimension_) * strain_rate_trace);
+            MatrixBatch<3> stress_rate_elastic = 2.0 * G_ * deviatoric_strain_rate + diagonalBatch<3>(K_ * strain_rate_trace) +
+                                                 stress_tensor * spin_rate.transpose() + spin_rate * stress_tensor;
+            MatrixBatch<3> deviatoric_stress_tensor = stress_tensor - diagonalBatch<3>((1.0 / stress_dimension_) * stress_tensor_trace);
+            RealBatch stress_tensor_J2 = secondInvariant(deviatoric_stress_tensor);
+            RealBatch f = stress_tensor_J2.sqrt() + alpha_phi_ * stress_tensor_trace - k_c_;
+            Real dilatancy_constant = getDPConstantsA(psi_);
+            RealBatch deviatoric_stress_times_strain_rate = deviatoric_stress_tensor.cwiseProductSum(strain_rate);
+            RealBatch lambda_dot = (3.0 * alpha_phi_ * K_ * strain_rate_trace +
+                                    (G_ / (stress_tensor_J2.sqrt() + TinyReal)) * deviatoric_stress_times_strain_rate) /
+                                   (9.0 * alpha_phi_ * K_ * dilatancy_constant + G_);
+            lambda_dot = (f >= TinyReal).select(lambda_dot, RealBatch::Zero());
+            MatrixBatch<3> g = lambda_dot * (diagonalBatch<3>(RealBatch::Constant(3.0 * K_ * dilatancy_constant)) +
+                                             deviatoric_stress_tensor * (G_ / (stress_tensor_J2 + TinyReal).sqrt()));
+            return stress_rate_elastic - g;
+        };
+
+        /** batched version of ReturnMapping */
+        MatrixBatch<3> ReturnMapping(const MatrixBatch<3> &stress_tensor)
+        {
+            RealBatch stress_tensor_I1 = stress_tensor.trace();
+            RealBatch tension_cutoff = (-alpha_phi_ * stress_tensor_I1 + k_c_ < 0.0)
+                                           .select((1.0 / stress_dimension_) * (stress_tensor_I1 - k_c_ / alpha_phi_), RealBatch::Zero());
+            MatrixBatch<3> mapped_stress_tensor = stress_tensor - diagonalBatch<3>(tension_cutoff);
+            stress_tensor_I1 = mapped_stress_tensor.trace();
+            MatrixBatch<3> deviatoric_stress_tensor = mapped_stress_tensor - diagonalBatch<3>((1.0 / stress_dimension_) * stress_tensor_I1);
+            RealBatch stress_tensor_J2_sqrt = secondInvariant(deviatoric_stress_tensor).sqrt();
+            RealBatch yield_limit = -alpha_phi_ * stress_tensor_I1 + k_c_;
+            RealBatch r = yield_limit / (stress_tensor_J2_sqrt + TinyReal);
+            MatrixBatch<3> scaled_stress_tensor = r * deviatoric_stress_tensor + diagonalBatch<3>((1.0 / stress_dimension_) * stress_tensor_I1);
+            return selectBatch(yield_limit < stress_tensor_J2_sqrt, scaled_stress_tensor, mapped_stress_tensor);
+        };
 
       protected:
           Real psi_;                          /* dilatancy angle  */
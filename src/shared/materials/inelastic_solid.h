@@ -55,6 +55,22 @@ class PlasticSolid : public NeoHookeanSolid
     virtual Matd ElasticLeftCauchy(const Matd &deformation, size_t index_i, Real dt = 0.0) = 0;
 
     virtual PlasticSolid *ThisObjectPtr() override { return this; };
+
+    /** Constitutive kernel through the virtual interface, for plastic materials only known at run time. */
+    class ConstituteKernel : public ElasticSolid::ConstituteKernel
+    {
+      public:
+        explicit ConstituteKernel(PlasticSolid &encloser)
+            : ElasticSolid::ConstituteKernel(encloser), plastic_solid_(encloser){};
+
+        Matd ElasticLeftCauchy(const Matd &F, size_t index_i, Real dt = 0.0)
+        {
+            return plastic_solid_.ElasticLeftCauchy(F, index_i, dt);
+        };
+
+      protected:
+        PlasticSolid &plastic_solid_;
+    };
 };
 
 /**
@@ -85,6 +101,46 @@ class HardeningPlasticSolid : public PlasticSolid
     virtual Matd ElasticLeftCauchy(const Matd &deformation, size_t index_i, Real dt = 0.0) override;
 
     virtual HardeningPlasticSolid *ThisObjectPtr() override { return this; };
+
+    /** Note that the plastic state is host data registered by the particles. */
+    class ConstituteKernel : public NeoHookeanSolid::ConstituteKernel
+    {
+      public:
+        explicit ConstituteKernel(HardeningPlasticSolid &encloser)
+            : NeoHookeanSolid::ConstituteKernel(encloser),
+              yield_stress_(encloser.yield_stress_), hardening_modulus_(encloser.hardening_modulus_),
+              inverse_plastic_strain_(encloser.inverse_plastic_strain_),
+              hardening_parameter_(encloser.hardening_parameter_){};
+
+        Matd ElasticLeftCauchy(const Matd &F, UnsignedInt index_i, Real dt = 0.0) const
+        {
+            Matd be = F * inverse_plastic_strain_[index_i] * F.transpose();
+            Matd normalized_be = be * pow(be.determinant(), -OneOverDimensions);
+            Real normalized_be_isentropic = normalized_be.trace() * OneOverDimensions;
+            Matd deviatoric_Kirchhoff = DeviatoricKirchhoff(normalized_be - normalized_be_isentropic * Matd::Identity());
+            Real deviatoric_Kirchhoff_norm = deviatoric_Kirchhoff.norm();
+            Real trial_function = deviatoric_Kirchhoff_norm -
+                                  sqrt_2_over_3_ * (hardening_modulus_ * hardening_parameter_[index_i] + yield_stress_);
+            if (trial_function > 0.0)
+            {
+                Real renormalized_shear_modulus = normalized_be_isentropic * G0_;
+                Real relax_increment = 0.5 * trial_function / (renormalized_shear_modulus + hardening_modulus_ / 3.0);
+                hardening_parameter_[index_i] += sqrt_2_over_3_ * relax_increment;
+                deviatoric_Kirchhoff -= 2.0 * renormalized_shear_modulus * relax_increment * deviatoric_Kirchhoff / deviatoric_Kirchhoff_norm;
+                Matd relaxed_be = deviatoric_Kirchhoff / G0_ + normalized_be_isentropic * Matd::Identity();
+                normalized_be = relaxed_be * pow(relaxed_be.determinant(), -OneOverDimensions);
+            }
+            Matd inverse_F = F.inverse();
+            inverse_plastic_strain_[index_i] = inverse_F * normalized_be * inverse_F.transpose();
+            return normalized_be;
+        };
+
+      protected:
+        Real yield_stress_, hardening_modulus_;
+        Real sqrt_2_over_3_ = sqrt(2.0 / 3.0);
+        Matd *inverse_plastic_strain_;
+        Real *hardening_parameter_;
+    };
 };
 
 /**
@@ -120,6 +176,63 @@ class NonLinearHardeningPlasticSolid : public HardeningPlasticSolid
     virtual Matd ElasticLeftCauchy(const Matd &deformation, size_t index_i, Real dt = 0.0) override;
 
     virtual NonLinearHardeningPlasticSolid *ThisObjectPtr() override { return this; };
+
+    class ConstituteKernel : public HardeningPlasticSolid::ConstituteKernel
+    {
+      public:
+        explicit ConstituteKernel(NonLinearHardeningPlasticSolid &encloser)
+            : HardeningPlasticSolid::ConstituteKernel(encloser),
+              saturation_flow_stress_(encloser.saturation_flow_stress_),
+              saturation_exponent_(encloser.saturation_exponent_){};
+
+        Real NonlinearHardening(Real hardening_parameter_pre) const
+        {
+            return hardening_modulus_ * hardening_parameter_pre + yield_stress_ +
+                   (saturation_flow_stress_ - yield_stress_) * (1 - exp(-saturation_exponent_ * hardening_parameter_pre));
+        };
+
+        Real NonlinearHardeningDerivative(Real hardening_parameter_pre) const
+        {
+            return hardening_modulus_ + saturation_exponent_ * (saturation_flow_stress_ - yield_stress_) *
+                                            exp(-saturation_exponent_ * hardening_parameter_pre);
+        };
+
+        Matd ElasticLeftCauchy(const Matd &F, UnsignedInt index_i, Real dt = 0.0) const
+        {
+            Matd normalized_F = F * pow(F.determinant(), -OneOverDimensions);
+            Matd normalized_be = normalized_F * inverse_plastic_strain_[index_i] * normalized_F.transpose();
+            Real normalized_be_isentropic = normalized_be.trace() * OneOverDimensions;
+            Matd deviatoric_Kirchhoff = DeviatoricKirchhoff(normalized_be - normalized_be_isentropic * Matd::Identity());
+            Real deviatoric_Kirchhoff_norm = deviatoric_Kirchhoff.norm();
+            Real relax_increment = 0.0;
+            Real trial_function = deviatoric_Kirchhoff_norm - sqrt_2_over_3_ * NonlinearHardening(hardening_parameter_[index_i]);
+            if (trial_function > 0.0)
+            {
+                Real renormalized_shear_modulus = normalized_be_isentropic * G0_;
+                while (trial_function > 0.0)
+                {
+                    Real hardening_parameter = hardening_parameter_[index_i] + sqrt_2_over_3_ * relax_increment;
+                    Real function_relax_increment_derivative =
+                        -2.0 * renormalized_shear_modulus *
+                        (1.0 + NonlinearHardeningDerivative(hardening_parameter) / 3.0 / renormalized_shear_modulus);
+                    relax_increment -= trial_function / function_relax_increment_derivative;
+                    trial_function = deviatoric_Kirchhoff_norm -
+                                     sqrt_2_over_3_ * NonlinearHardening(hardening_parameter_[index_i] + sqrt_2_over_3_ * relax_increment) -
+                                     2.0 * renormalized_shear_modulus * relax_increment;
+                }
+                hardening_parameter_[index_i] += sqrt_2_over_3_ * relax_increment;
+                deviatoric_Kirchhoff -= 2.0 * renormalized_shear_modulus * relax_increment * deviatoric_Kirchhoff / deviatoric_Kirchhoff_norm;
+                Matd relaxed_be = deviatoric_Kirchhoff / G0_ + normalized_be_isentropic * Matd::Identity();
+                normalized_be = relaxed_be * pow(relaxed_be.determinant(), -OneOverDimensions);
+            }
+            Matd inverse_normalized_F = normalized_F.inverse();
+            inverse_plastic_strain_[index_i] = inverse_normalized_F * normalized_be * inverse_normalized_F.transpose();
+            return normalized_be;
+        };
+
+      protected:
+        Real saturation_flow_stress_, saturation_exponent_;
+    };
 };
 
 /**
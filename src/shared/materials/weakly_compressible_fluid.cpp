@@ -46,10 +46,7 @@ Real SymmetricTaitFluid::getSoundSpeed(Real p, Real rho)
 //=================================================================================================//
 Real HerschelBulkleyFluid::getViscosity(Real shear_rate)
 {
-
-    Real effective_shear_rate = SMAX(SMIN(shear_rate, max_shear_rate_), min_shear_rate_);
-    return (yield_stress_ + consistency_index_ * (std::pow(effective_shear_rate, power_index_))) /
-           effective_shear_rate;
+    return EosKernel(*this).getViscosity(shear_rate);
 }
 //=================================================================================================//
 Real CarreauFluid::getViscosity(Real shear_rate)
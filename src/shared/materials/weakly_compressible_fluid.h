@@ -56,7 +56,7 @@ class WeaklyCompressibleFluid : public Fluid
     virtual Real getSoundSpeed(Real p = 0.0, Real rho = 1.0) override;
     virtual WeaklyCompressibleFluid *ThisObjectPtr() override { return this; };
 
-    class EosKernel : Fluid::EosKernel
+    class EosKernel : public Fluid::EosKernel
     {
       public:
         EosKernel(WeaklyCompressibleFluid &encloser);
@@ -98,7 +98,7 @@ class WeaklyCompressibleFluidFreeSurface : public WeaklyCompressibleFluidType
           cutoff_pressure_(cutoff_pressure),
           cutoff_density_(WeaklyCompressibleFluidType::DensityFromPressure(cutoff_pressure))
     {
-        WeaklyCompressibleFluidType::material_type_ += "FreeSurface";
+        WeaklyCompressibleFluidType::material_type_name_ += "FreeSurface";
     };
     virtual ~WeaklyCompressibleFluidFreeSurface(){};
 
@@ -106,6 +106,22 @@ class WeaklyCompressibleFluidFreeSurface : public WeaklyCompressibleFluidType
     {
         return rho < cutoff_density_ ? cutoff_pressure_ : WeaklyCompressibleFluid::getPressure(rho);
     };
+
+    class EosKernel : public WeaklyCompressibleFluidType::EosKernel
+    {
+      public:
+        EosKernel(WeaklyCompressibleFluidFreeSurface &encloser)
+            : WeaklyCompressibleFluidType::EosKernel(encloser),
+              cutoff_pressure_(encloser.cutoff_pressure_), cutoff_density_(encloser.cutoff_density_){};
+
+        Real getPressure(Real rho)
+        {
+            return rho < cutoff_density_ ? cutoff_pressure_ : WeaklyCompressibleFluid::EosKernel::getPressure(rho);
+        };
+
+      protected:
+        Real cutoff_pressure_, cutoff_density_;
+    };
 };
 
 /**
@@ -127,6 +143,39 @@ class SymmetricTaitFluid : public WeaklyCompressibleFluid
     virtual Real getPressure(Real rho) override;
     virtual Real DensityFromPressure(Real p) override;
     virtual Real getSoundSpeed(Real p = 0.0, Real rho = 1.0) override;
+
+    class EosKernel : public WeaklyCompressibleFluid::EosKernel
+    {
+      public:
+        EosKernel(SymmetricTaitFluid &encloser)
+            : WeaklyCompressibleFluid::EosKernel(encloser), gamma_(encloser.gamma_){};
+
+        Real getPressure(Real rho)
+        {
+            Real rho_ratio = rho / rho0_;
+            return rho_ratio > 1.0
+                       ? p0_ * (pow(rho_ratio, gamma_) - 1.0) / Real(gamma_)
+                       : -p0_ * (pow(1.0 / rho_ratio, gamma_) - 1.0) / Real(gamma_);
+        };
+
+        Real DensityFromPressure(Real p)
+        {
+            return p > 0.0
+                       ? rho0_ * pow(1.0 + Real(gamma_) * p / p0_, 1.0 / Real(gamma_))
+                       : rho0_ / pow(1.0 - Real(gamma_) * p / p0_, 1.0 / Real(gamma_));
+        };
+
+        Real getSoundSpeed(Real p = 0.0, Real rho = 1.0)
+        {
+            Real rho_ratio = rho / rho0_;
+            return rho_ratio > 1.0
+                       ? sqrt((p0_ + Real(gamma_) * p) / rho)
+                       : sqrt((p0_ - Real(gamma_) * p) / rho);
+        };
+
+      protected:
+        int gamma_;
+    };
 };
 
 /**
@@ -202,6 +251,27 @@ class HerschelBulkleyFluid : public GeneralizedNewtonianFluid
 
     Real getViscosity(Real shear_rate) override;
     virtual HerschelBulkleyFluid *ThisObjectPtr() override { return this; };
+
+    /** the linear equation of state is used, but the kernel also gives the viscosity. */
+    class EosKernel : public WeaklyCompressibleFluid::EosKernel
+    {
+      public:
+        EosKernel(HerschelBulkleyFluid &encloser)
+            : WeaklyCompressibleFluid::EosKernel(encloser),
+              min_shear_rate_(encloser.min_shear_rate_), max_shear_rate_(encloser.max_shear_rate_),
+              consistency_index_(encloser.consistency_index_), power_index_(encloser.power_index_),
+              yield_stress_(encloser.yield_stress_){};
+
+        Real getViscosity(Real shear_rate) const
+        {
+            Real effective_shear_rate = SMAX(SMIN(shear_rate, max_shear_rate_), min_shear_rate_);
+            return (yield_stress_ + consistency_index_ * pow(effective_shear_rate, power_index_)) / effective_shear_rate;
+        };
+
+      protected:
+        Real min_shear_rate_, max_shear_rate_;
+        Real consistency_index_, power_index_, yield_stress_;
+    };
 };
 
 /**
@@ -62,6 +62,7 @@ class Mesh
 
     Vecd MeshLowerBound() const { return mesh_lower_bound_; };
     Real GridSpacing() const { return grid_spacing_; };
+    size_t BufferWidth() const { return buffer_width_; };
     Arrayi AllGridPoints() const { return all_grid_points_; };
     Arrayi AllCells() const { return all_cells_; };
     size_t NumberOfGridPoints() const { return transferMeshIndexTo1D(all_grid_points_, all_grid_points_); };
@@ -139,6 +140,85 @@ class Mesh
     };
 };
 
+/**
+ * @class PeriodicWrapping
+ * @brief Periodicity given to the neighbor search without ghost particles.
+ * A particle near a periodic bound is searched also at its images shifted by the period,
+ * and the displacement of a pair is given by the minimum image convention.
+ * Computing kernels only apply the minimum image convention when built with SPHINXSYS_USE_PERIODIC_NEIGHBOR.
+ * Note that the period should be larger than twice of the cut-off radius.
+ */
+class PeriodicWrapping
+{
+  public:
+    PeriodicWrapping() : lower_bound_(Vecd::Zero()), period_(Vecd::Zero()){};
+    void setPeriodicAxis(const BoundingBox &bounding_bounds, int axis)
+    {
+        lower_bound_[axis] = bounding_bounds.first_[axis];
+        period_[axis] = bounding_bounds.second_[axis] - bounding_bounds.first_[axis];
+    };
+    bool isPeriodic() const { return (period_.array() > 0).any(); };
+
+    Vecd minimumImage(const Vecd &displacement) const
+    {
+        Vecd image = displacement;
+        for (int k = 0; k != Dimensions; ++k)
+        {
+            if (period_[k] > 0)
+                image[k] -= period_[k] * std::round(displacement[k] / period_[k]);
+        }
+        return image;
+    };
+
+    Vecd wrapPosition(const Vecd &position) const
+    {
+        Vecd wrapped = position;
+        for (int k = 0; k != Dimensions; ++k)
+        {
+            if (period_[k] > 0)
+                wrapped[k] -= period_[k] * std::floor((position[k] - lower_bound_[k]) / period_[k]);
+        }
+        return wrapped;
+    };
+
+    /** apply the function to the position and to its images within the search radius to periodic bounds */
+    template <typename FunctionOnImage>
+    void forEachImage(const Vecd &position, Real search_radius, const FunctionOnImage &function) const
+    {
+        Vecd shift = Vecd::Zero();
+        int shifted_axes = 0;
+        for (int k = 0; k != Dimensions; ++k)
+        {
+            if (period_[k] > 0)
+            {
+                if (position[k] - lower_bound_[k] < search_radius)
+                    shift[k] = period_[k];
+                else if (lower_bound_[k] + period_[k] - position[k] < search_radius)
+                    shift[k] = -period_[k];
+            }
+            if (shift[k] != 0)
+                shifted_axes |= 1 << k;
+        }
+
+        function(position);
+        /** all combinations of the shifted axes, i.e. also the corner images */
+        for (int combination = shifted_axes; combination != 0; combination = (combination - 1) & shifted_axes)
+        {
+            Vecd image = position;
+            for (int k = 0; k != Dimensions; ++k)
+            {
+                if (combination & (1 << k))
+                    image[k] += shift[k];
+            }
+            function(image);
+        }
+    };
+
+  protected:
+    Vecd lower_bound_;
+    Vecd period_; /**< zero for non-periodic axis */
+};
+
 /**
  * @class BaseMeshField
  * @brief Abstract base class for the geometric or physics field.
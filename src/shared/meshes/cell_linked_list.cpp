@@ -5,6 +5,7 @@
 #include "base_particles.h"
 #include "mesh_iterators.hpp"
 #include "particle_iterators.h"
+#include "particle_iterators_ck.h"
 
 namespace SPH
 {
@@ -13,20 +14,84 @@ BaseCellLinkedList::
     BaseCellLinkedList(BaseParticles &base_particles, SPHAdaptation &sph_adaptation)
     : BaseMeshField("CellLinkedList"), kernel_(*sph_adaptation.getKernel()) {}
 //=================================================================================================//
-CellLinkedList::CellLinkedList(BoundingBox tentative_bounds, Real grid_spacing,
+void BaseCellLinkedList::reportMemoryFootprint(MemoryRegistry &registry, const std::string &owner)
+{
+    StdVec<CellLinkedList *> cell_linked_list_levels = CellLinkedListLevels();
+    for (size_t l = 0; l != cell_linked_list_levels.size(); ++l)
+    {
+        registry.registerMemory(owner, "CellLinkedList", "CellDataMatrixLevel" + std::to_string(l),
+                                cell_linked_list_levels[l]->CellDataMatrixBytes());
+    }
+    // the particle index lists are registered by name, thus shared by all levels
+    cell_linked_list_levels[0]->reportMeshDataVariables(registry, owner);
+}
+//=================================================================================================//
+void CellLinkedList::reportMeshDataVariables(MemoryRegistry &registry, const std::string &owner)
+{
+    registry.registerMemory(owner, "CellLinkedList", dv_particle_index_->Name(), dv_particle_index_->MemoryBytes());
+    registry.registerMemory(owner, "CellLinkedList", dv_cell_offset_->Name(), dv_cell_offset_->MemoryBytes());
+}
+//=================================================================================================//
+CellLinkedList::CellLinkedList(BoundingBox tentative_bounds, Real grid_spacing, UnsignedInt cell_offset_list_size,
                                BaseParticles &base_particles, SPHAdaptation &sph_adaptation)
     : BaseCellLinkedList(base_particles, sph_adaptation), Mesh(tentative_bounds, grid_spacing, 2),
-      cell_offset_list_size_(NumberOfCells() + 1),
+      cell_offset_list_size_(cell_offset_list_size),
       index_list_size_(SMAX(base_particles.ParticlesBound(), cell_offset_list_size_)),
       dv_particle_index_(base_particles.registerDiscreteVariableOnly<UnsignedInt>("ParticleIndex", index_list_size_)),
       dv_cell_offset_(base_particles.registerDiscreteVariableOnly<UnsignedInt>("CellOffset", cell_offset_list_size_)),
+      dv_occupied_cell_(nullptr), sv_number_of_occupied_cells_(nullptr),
       cell_index_lists_(nullptr), cell_data_lists_(nullptr),
       number_of_split_cell_lists_(static_cast<size_t>(pow(3, Dimensions)))
 {
-    allocateMeshDataMatrix();
+    base_particles.addVariableToMeshData(dv_particle_index_);
+    base_particles.addVariableToMeshData(dv_cell_offset_);
     single_cell_linked_list_level_.push_back(this);
 }
 //=================================================================================================//
+CellLinkedList::CellLinkedList(BoundingBox tentative_bounds, Real grid_spacing,
+                               BaseParticles &base_particles, SPHAdaptation &sph_adaptation)
+    : CellLinkedList(tentative_bounds, grid_spacing,
+                     Mesh(tentative_bounds, grid_spacing, 2).NumberOfCells() + 1,
+                     base_particles, sph_adaptation)
+{
+    allocateMeshDataMatrix();
+}
+//=================================================================================================//
+void CellLinkedList::resetMesh(const BoundingBox &tentative_bounds)
+{
+    deleteMeshDataMatrix();
+    Mesh::operator=(Mesh(tentative_bounds, grid_spacing_, buffer_width_));
+    allocateMeshDataMatrix();
+    cell_offset_list_size_ = NumberOfCells() + 1;
+    index_list_size_ = SMAX(index_list_size_, cell_offset_list_size_);
+}
+//=================================================================================================//
+BoundingBox CellLinkedList::MeshInnerBounds() const
+{
+    Vecd mesh_buffer = Real(buffer_width_) * grid_spacing_ * Vecd::Ones();
+    Vecd mesh_upper_bound = mesh_lower_bound_ + all_cells_.cast<Real>().matrix() * grid_spacing_;
+    return BoundingBox(mesh_lower_bound_ + mesh_buffer, mesh_upper_bound - mesh_buffer);
+}
+//=================================================================================================//
+void CellLinkedList::setPeriodicAxis(const BoundingBox &bounding_bounds, int axis)
+{
+    periodic_wrapping_.setPeriodicAxis(bounding_bounds, axis);
+    resetComputingKernelUpdated();
+}
+//=================================================================================================//
+void CellLinkedList::registerComputingKernel(execution::Implementation<Base> *implementation)
+{
+    all_mesh_computing_kernels_.push_back(implementation);
+}
+//=================================================================================================//
+void CellLinkedList::resetComputingKernelUpdated()
+{
+    for (size_t k = 0; k != all_mesh_computing_kernels_.size(); ++k)
+    {
+        all_mesh_computing_kernels_[k]->resetUpdated();
+    }
+}
+//=================================================================================================//
 void CellLinkedList ::allocateMeshDataMatrix()
 {
     size_t number_of_all_cells = transferMeshIndexTo1D(all_cells_, all_cells_);
@@ -34,6 +99,51 @@ void CellLinkedList ::allocateMeshDataMatrix()
     cell_data_lists_ = new ListDataVector[number_of_all_cells];
 }
 //=================================================================================================//
+size_t CellLinkedList::CellDataMatrixBytes()
+{
+    if (cell_index_lists_ == nullptr) // not allocated by sparse cell linked list
+    {
+        return 0;
+    }
+
+    size_t number_of_all_cells = transferMeshIndexTo1D(all_cells_, all_cells_);
+    size_t bytes = number_of_all_cells * (sizeof(ConcurrentIndexVector) + sizeof(ListDataVector));
+    for (size_t i = 0; i != number_of_all_cells; ++i)
+    {
+        bytes += cell_index_lists_[i].capacity() * sizeof(size_t) +
+                 cell_data_lists_[i].capacity() * sizeof(ListData);
+    }
+    return bytes;
+}
+//=================================================================================================//
+void CellLinkedList::collectCellOccupancy(StdVec<UnsignedInt> &cell_occupancy)
+{
+    if (cell_index_lists_ == nullptr) // not allocated by sparse cell linked list
+    {
+        return;
+    }
+
+    size_t number_of_all_cells = transferMeshIndexTo1D(all_cells_, all_cells_);
+    for (size_t i = 0; i != number_of_all_cells; ++i)
+    {
+        if (!cell_index_lists_[i].empty())
+        {
+            cell_occupancy.push_back(cell_index_lists_[i].size());
+        }
+    }
+}
+//=================================================================================================//
+void CellLinkedList::checkCellDataMatrix(const std::string &method_name)
+{
+    if (cell_index_lists_ == nullptr)
+    {
+        std::cout << "\n Error: " << method_name << " requires the cell data matrix, "
+                  << "which is not allocated by SparseCellLinkedList!" << std::endl;
+        std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+        exit(1);
+    }
+}
+//=================================================================================================//
 void CellLinkedList ::deleteMeshDataMatrix()
 {
     delete[] cell_index_lists_;
@@ -42,6 +152,7 @@ void CellLinkedList ::deleteMeshDataMatrix()
 //=================================================================================================//
 void CellLinkedList::clearCellLists()
 {
+    checkCellDataMatrix("clearCellLists");
     mesh_parallel_for(MeshRange(Arrayi::Zero(), all_cells_),
                       [&](const Arrayi &cell_index)
                       {
@@ -51,6 +162,7 @@ void CellLinkedList::clearCellLists()
 //=================================================================================================//
 void CellLinkedList::UpdateCellListData(BaseParticles &base_particles)
 {
+    checkCellDataMatrix("UpdateCellListData");
     Vecd *pos = base_particles.ParticlePositions();
     mesh_parallel_for(
         MeshRange(Arrayi::Zero(), all_cells_),
@@ -152,6 +264,188 @@ UnsignedInt CellLinkedList::computingSequence(Vecd &position, size_t index_i)
     return transferMeshIndexToMortonOrder(CellIndexFromPosition(position));
 }
 //=================================================================================================//
+SparseCellLinkedList::SparseCellLinkedList(BoundingBox tentative_bounds, Real grid_spacing,
+                                           BaseParticles &base_particles, SPHAdaptation &sph_adaptation)
+    : CellLinkedList(tentative_bounds, grid_spacing, base_particles.ParticlesBound() + 1,
+                     base_particles, sph_adaptation),
+      dv_cell_key_(base_particles.registerDiscreteVariableOnly<UnsignedInt>(
+          "CellKey", base_particles.ParticlesBound())),
+      dv_cell_position_(base_particles.registerDiscreteVariableOnly<UnsignedInt>(
+          "CellPosition", base_particles.ParticlesBound() + 1))
+{
+    dv_occupied_cell_ = base_particles.registerDiscreteVariableOnly<UnsignedInt>(
+        "OccupiedCell", base_particles.ParticlesBound());
+    sv_number_of_occupied_cells_ = base_particles.registerSingularVariable<UnsignedInt>("NumberOfOccupiedCells");
+    base_particles.addVariableToMeshData(dv_cell_key_);
+    base_particles.addVariableToMeshData(dv_cell_position_);
+    base_particles.addVariableToMeshData(dv_occupied_cell_);
+    checkNumberOfCells();
+}
+//=================================================================================================//
+void SparseCellLinkedList::reportMeshDataVariables(MemoryRegistry &registry, const std::string &owner)
+{
+    CellLinkedList::reportMeshDataVariables(registry, owner);
+    registry.registerMemory(owner, "CellLinkedList", dv_cell_key_->Name(), dv_cell_key_->MemoryBytes());
+    registry.registerMemory(owner, "CellLinkedList", dv_cell_position_->Name(), dv_cell_position_->MemoryBytes());
+    registry.registerMemory(owner, "CellLinkedList", dv_occupied_cell_->Name(), dv_occupied_cell_->MemoryBytes());
+}
+//=================================================================================================//
+void SparseCellLinkedList::checkNumberOfCells()
+{
+    if (NumberOfCells() >= static_cast<size_t>(std::numeric_limits<UnsignedInt>::max()))
+    {
+        std::cout << "\n Error: the number of cells " << NumberOfCells()
+                  << " exceeds the range of the linear cell index of SparseCellLinkedList!" << std::endl;
+        std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+        exit(1);
+    }
+}
+//=================================================================================================//
+void SparseCellLinkedList::UpdateCellLists(BaseParticles &base_particles)
+{
+    Vecd *pos = base_particles.ParticlePositions();
+    UnsignedInt total_real_particles = base_particles.TotalRealParticles();
+    UnsignedInt *particle_index = dv_particle_index_->Data();
+    UnsignedInt *cell_offset = dv_cell_offset_->Data();
+    UnsignedInt *occupied_cell = dv_occupied_cell_->Data();
+    UnsignedInt *cell_key = dv_cell_key_->Data();
+    UnsignedInt *cell_position = dv_cell_position_->Data();
+
+    // cell_position is used as temporary storage for the cell index of unsorted particles
+    parallel_for(
+        IndexRange(0, total_real_particles),
+        [&](const IndexRange &r)
+        {
+            for (size_t i = r.begin(); i != r.end(); ++i)
+            {
+                cell_position[i] = LinearCellIndexFromPosition(pos[i]);
+                particle_index[i] = i;
+            }
+        },
+        ap);
+
+    tbb::parallel_sort(particle_index, particle_index + total_real_particles,
+                       [&](const UnsignedInt &a, const UnsignedInt &b)
+                       {
+                           return cell_position[a] != cell_position[b] ? cell_position[a] < cell_position[b] : a < b;
+                       });
+
+    // cell_offset is used as temporary storage for the flags of the first particle in a cell
+    parallel_for(
+        IndexRange(0, total_real_particles),
+        [&](const IndexRange &r)
+        {
+            for (size_t n = r.begin(); n != r.end(); ++n)
+            {
+                cell_key[n] = cell_position[particle_index[n]];
+            }
+        },
+        ap);
+
+    parallel_for(
+        IndexRange(0, total_real_particles),
+        [&](const IndexRange &r)
+        {
+            for (size_t n = r.begin(); n != r.end(); ++n)
+            {
+                cell_offset[n] = (n == 0 || cell_key[n] != cell_key[n - 1]) ? 1 : 0;
+            }
+        },
+        ap);
+
+    UnsignedInt number_of_occupied_cells =
+        exclusive_scan(execution::par, cell_offset, cell_position, total_real_particles + 1,
+                       std::plus<UnsignedInt>());
+
+    parallel_for(
+        IndexRange(0, total_real_particles),
+        [&](const IndexRange &r)
+        {
+            for (size_t n = r.begin(); n != r.end(); ++n)
+            {
+                if (n == 0 || cell_key[n] != cell_key[n - 1])
+                {
+                    occupied_cell[cell_position[n]] = cell_key[n];
+                    cell_offset[cell_position[n]] = n;
+                }
+            }
+        },
+        ap);
+    cell_offset[number_of_occupied_cells] = total_real_particles;
+    sv_number_of_occupied_cells_->setValue(number_of_occupied_cells);
+}
+//=================================================================================================//
+void SparseCellLinkedList::resetMesh(const BoundingBox &tentative_bounds)
+{
+    // Only the mesh is reset as the lists are sized by the number of particles.
+    Mesh::operator=(Mesh(tentative_bounds, grid_spacing_, buffer_width_));
+    checkNumberOfCells();
+}
+//=================================================================================================//
+void SparseCellLinkedList::reportNotSupported(const std::string &method_name)
+{
+    std::cout << "\n Error: " << method_name << " is not supported by SparseCellLinkedList!" << std::endl;
+    std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+    exit(1);
+}
+//=================================================================================================//
+void SparseCellLinkedList::insertParticleIndex(size_t particle_index, const Vecd &particle_position)
+{
+    reportNotSupported("insertParticleIndex");
+}
+//=================================================================================================//
+void SparseCellLinkedList::InsertListDataEntry(size_t particle_index, const Vecd &particle_position)
+{
+    reportNotSupported("InsertListDataEntry");
+}
+//=================================================================================================//
+ListData SparseCellLinkedList::findNearestListDataEntry(const Vecd &position)
+{
+    reportNotSupported("findNearestListDataEntry");
+    return ListData(0, Vecd::Zero());
+}
+//=================================================================================================//
+void SparseCellLinkedList::
+    tagBodyPartByCell(ConcurrentCellLists &cell_lists, std::function<bool(Vecd, Real)> &check_included)
+{
+    reportNotSupported("tagBodyPartByCell");
+}
+//=================================================================================================//
+void SparseCellLinkedList::
+    tagBoundingCells(StdVec<CellLists> &cell_data_lists, const BoundingBox &bounding_bounds, int axis)
+{
+    reportNotSupported("tagBoundingCells");
+}
+//=================================================================================================//
+void SparseCellLinkedList::writeMeshFieldToPlt(std::ofstream &output_file)
+{
+    UnsignedInt number_of_occupied_cells = sv_number_of_occupied_cells_->getValue();
+    UnsignedInt *occupied_cell = dv_occupied_cell_->Data();
+    UnsignedInt *cell_offset = dv_cell_offset_->Data();
+
+    output_file << "\n";
+    output_file << "title='View'"
+                << "\n";
+    output_file << "variables= "
+                << "x, "
+                << "y, "
+                << (Dimensions == 3 ? "z, " : "")
+                << "particles_in_cell "
+                << "\n";
+    output_file << "zone i=" << number_of_occupied_cells << "  j=" << 1 << "  k=" << 1
+                << "  DATAPACKING=POINT  SOLUTIONTIME=" << 0 << "\n";
+
+    for (UnsignedInt k = 0; k != number_of_occupied_cells; ++k)
+    {
+        Vecd data_position = CellPositionFromIndex(transfer1DtoMeshIndex(all_cells_, occupied_cell[k]));
+        for (int d = 0; d != Dimensions; ++d)
+        {
+            output_file << data_position[d] << " ";
+        }
+        output_file << cell_offset[k + 1] - cell_offset[k] << " \n";
+    }
+}
+//=================================================================================================//
 MultilevelCellLinkedList::MultilevelCellLinkedList(BoundingBox tentative_bounds,
                                                    Real reference_grid_spacing, size_t total_levels,
                                                    BaseParticles &base_particles, SPHAdaptation &sph_adaptation)
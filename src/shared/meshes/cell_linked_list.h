@@ -32,8 +32,10 @@
 #ifndef MESH_CELL_LINKED_LIST_H
 #define MESH_CELL_LINKED_LIST_H
 
+#include "base_implementation.h"
 #include "base_mesh.h"
 #include "execution_policy.h"
+#include "memory_registry.h"
 #include "neighborhood.h"
 
 namespace SPH
@@ -72,6 +74,8 @@ class BaseCellLinkedList : public BaseMeshField
     virtual void tagBodyPartByCell(ConcurrentCellLists &cell_lists, std::function<bool(Vecd, Real)> &check_included) = 0;
     /** Tag domain bounding cells in an axis direction, called by domain bounding classes */
     virtual void tagBoundingCells(StdVec<CellLists> &cell_data_lists, const BoundingBox &bounding_bounds, int axis) = 0;
+    /** report the cell-based data matrices of all levels */
+    void reportMemoryFootprint(MemoryRegistry &registry, const std::string &owner);
 };
 
 class NeighborSearch : public Mesh
@@ -87,9 +91,19 @@ class NeighborSearch : public Mesh
 
   protected:
     Real grid_spacing_squared_;
+    PeriodicWrapping periodic_wrapping_;
     Vecd *pos_;
     UnsignedInt *particle_index_;
     UnsignedInt *cell_offset_;
+    UnsignedInt *occupied_cell_;            /**< sorted occupied cells, only for sparse cell linked list */
+    UnsignedInt *number_of_occupied_cells_; /**< only for sparse cell linked list */
+
+    /** find the range [first, last) in the particle index list for a cell */
+    template <bool IsSparse>
+    void findCellRange(UnsignedInt linear_index, UnsignedInt &first, UnsignedInt &last) const;
+    /** search the cells around particle i with the storage of the cell linked list given at compile time */
+    template <bool IsSparse, typename FunctionOnEach>
+    void searchInCells(UnsignedInt index_i, const Vecd *source_pos, const FunctionOnEach &function) const;
 };
 
 /**
@@ -101,26 +115,38 @@ class CellLinkedList : public BaseCellLinkedList, public Mesh
 {
     StdVec<CellLinkedList *> single_cell_linked_list_level_;
 
+  protected:
     UnsignedInt cell_offset_list_size_;
     UnsignedInt index_list_size_; // at least number_of_cells_pluse_one_
     DiscreteVariable<UnsignedInt> *dv_particle_index_;
     DiscreteVariable<UnsignedInt> *dv_cell_offset_;
+    DiscreteVariable<UnsignedInt> *dv_occupied_cell_;            /**< nullptr if all cells are stored */
+    SingularVariable<UnsignedInt> *sv_number_of_occupied_cells_; /**< nullptr if all cells are stored */
 
-  protected:
     /** using concurrent vectors due to writing conflicts when building the list */
     ConcurrentIndexVector *cell_index_lists_;
     /** non-concurrent list data rewritten for building neighbor list */
     ListDataVector *cell_data_lists_;
     /**< number of split cell lists */
     size_t number_of_split_cell_lists_;
+    /** computing kernels depending on the mesh, rebuilt after re-meshing */
+    StdVec<execution::Implementation<Base> *> all_mesh_computing_kernels_;
+    PeriodicWrapping periodic_wrapping_;
 
     void allocateMeshDataMatrix(); /**< allocate memories for addresses of data packages. */
     void deleteMeshDataMatrix();   /**< delete memories for addresses of data packages. */
+    /** exit with an error if the cell-based data matrix required by a method is not allocated */
+    void checkCellDataMatrix(const std::string &method_name);
     template <typename DataListsType>
     DataListsType &getCellDataList(DataListsType *data_lists, const Arrayi &cell_index)
     {
         return data_lists[transferMeshIndexTo1D(all_cells_, cell_index)];
     };
+    /** constructor without allocating the cell-based data matrix */
+    CellLinkedList(BoundingBox tentative_bounds, Real grid_spacing, UnsignedInt cell_offset_list_size,
+                   BaseParticles &base_particles, SPHAdaptation &sph_adaptation);
+    /** reset the mesh and the cell-based data matrix for new bounds, the grid spacing is kept */
+    virtual void resetMesh(const BoundingBox &tentative_bounds);
 
   public:
     CellLinkedList(BoundingBox tentative_bounds, Real grid_spacing,
@@ -143,12 +169,43 @@ class CellLinkedList : public BaseCellLinkedList, public Mesh
     template <class DynamicsRange, typename GetSearchDepth, typename GetNeighborRelation>
     void searchNeighborsByParticles(DynamicsRange &dynamics_range, ParticleConfiguration &particle_configuration,
                                     GetSearchDepth &get_search_depth, GetNeighborRelation &get_neighbor_relation);
+    /** cell-centric particle search for symmetric relations with search depth one.
+     *  Each pair of neighboring cells is visited once by a half stencil
+     *  and the neighbor relations of both particles of a pair are created together
+     *  by the pair operator of the neighbor builder, e.g. NeighborBuilderInner.
+     *  Periodic axes are not supported by this search. */
+    template <typename GetNeighborRelation>
+    void searchNeighborPairsByCells(ParticleConfiguration &particle_configuration,
+                                    GetNeighborRelation &get_neighbor_relation);
 
     template <class ExecutionPolicy>
     NeighborSearch createNeighborSearch(const ExecutionPolicy &ex_policy, DiscreteVariable<Vecd> *pos);
     UnsignedInt getCellOffsetListSize() { return cell_offset_list_size_; };
+    /** bytes of the cell index and list data vectors including their current capacities */
+    size_t CellDataMatrixBytes();
+    /** report the particle index lists, which are allocated as discrete variables of the particles */
+    virtual void reportMeshDataVariables(MemoryRegistry &registry, const std::string &owner);
+    /** append the particle numbers of the occupied cells in the cell lists */
+    void collectCellOccupancy(StdVec<UnsignedInt> &cell_occupancy);
     DiscreteVariable<UnsignedInt> *getParticleIndex() { return dv_particle_index_; };
     DiscreteVariable<UnsignedInt> *getCellOffset() { return dv_cell_offset_; };
+    DiscreteVariable<UnsignedInt> *getOccupiedCell() { return dv_occupied_cell_; };
+    SingularVariable<UnsignedInt> *getNumberOfOccupiedCells() { return sv_number_of_occupied_cells_; };
+    /** the bounds covered by the mesh without the buffer cells */
+    BoundingBox MeshInnerBounds() const;
+    /** set a periodic axis so that neighbors are searched across the bounds without ghost particles.
+     *  The bounds should be within the mesh inner bounds and the particle positions
+     *  should be wrapped into the bounds, e.g. by PeriodicPositionWrappingCK. */
+    void setPeriodicAxis(const BoundingBox &bounding_bounds, int axis);
+    const PeriodicWrapping &getPeriodicWrapping() const { return periodic_wrapping_; };
+    /** re-mesh for new bounds, the computing kernels registered are reset to be rebuilt.
+     * Note that the cell lists need to be updated afterwards
+     * and body parts tagged by cells before re-meshing are not valid anymore. */
+    template <class ExecutionPolicy>
+    void resizeMesh(const ExecutionPolicy &ex_policy, const BoundingBox &tentative_bounds);
+    void registerComputingKernel(execution::Implementation<Base> *implementation);
+    bool hasComputingKernels() { return !all_mesh_computing_kernels_.empty(); };
+    void resetComputingKernelUpdated();
 
     /** split algorithm */;
     template <class LocalDynamicsFunction>
@@ -167,6 +224,46 @@ class RefinedMesh<CellLinkedList> : public CellLinkedList
                          base_particles, sph_adaptation){};
 };
 
+/**
+ * @class SparseCellLinkedList
+ * @brief Cell linked list only saving the cells occupied by particles.
+ * @details The particles are sorted by their linear cell index so that
+ * the occupied cells are given by a sorted list together with the offsets
+ * of their particle ranges. The cell of a position is then found by binary search.
+ * The memory scales with the number of particles instead of the number of cells
+ * in the domain, which is beneficial for large and mostly empty domains.
+ * Note that only the neighbor search by computing kernels (NeighborSearch) is supported.
+ * The cell-based methods used by the legacy relations and the split algorithm exit with an error.
+ * As the linear cell index is saved as UnsignedInt, the total number of cells is checked against its range.
+ */
+class SparseCellLinkedList : public CellLinkedList
+{
+    DiscreteVariable<UnsignedInt> *dv_cell_key_;       /**< linear cell index of the sorted particles */
+    DiscreteVariable<UnsignedInt> *dv_cell_position_; /**< position of a cell in the occupied cell list */
+
+  public:
+    SparseCellLinkedList(BoundingBox tentative_bounds, Real grid_spacing,
+                         BaseParticles &base_particles, SPHAdaptation &sph_adaptation);
+    virtual ~SparseCellLinkedList(){};
+
+    virtual void UpdateCellLists(BaseParticles &base_particles) override;
+    void insertParticleIndex(size_t particle_index, const Vecd &particle_position) override;
+    void InsertListDataEntry(size_t particle_index, const Vecd &particle_position) override;
+    virtual ListData findNearestListDataEntry(const Vecd &position) override;
+    virtual void tagBodyPartByCell(ConcurrentCellLists &cell_lists, std::function<bool(Vecd, Real)> &check_included) override;
+    virtual void tagBoundingCells(StdVec<CellLists> &cell_data_lists, const BoundingBox &bounding_bounds, int axis) override;
+    virtual void writeMeshFieldToPlt(std::ofstream &output_file) override;
+    virtual void reportMeshDataVariables(MemoryRegistry &registry, const std::string &owner) override;
+
+    DiscreteVariable<UnsignedInt> *getCellKey() { return dv_cell_key_; };
+    DiscreteVariable<UnsignedInt> *getCellPosition() { return dv_cell_position_; };
+
+  protected:
+    virtual void resetMesh(const BoundingBox &tentative_bounds) override;
+    void reportNotSupported(const std::string &method_name);
+    void checkNumberOfCells();
+};
+
 /**
  * @class MultilevelCellLinkedList
  * @brief Defining a multilevel mesh cell linked list for a body
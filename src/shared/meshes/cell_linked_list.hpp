@@ -21,34 +21,95 @@ template <class ExecutionPolicy>
 NeighborSearch::NeighborSearch(
     const ExecutionPolicy &ex_policy, CellLinkedList &cell_linked_list, DiscreteVariable<Vecd> *pos)
     : Mesh(cell_linked_list), grid_spacing_squared_(grid_spacing_ * grid_spacing_),
+      periodic_wrapping_(cell_linked_list.getPeriodicWrapping()),
       pos_(pos->DelegatedData(ex_policy)),
       particle_index_(cell_linked_list.getParticleIndex()->DelegatedData(ex_policy)),
-      cell_offset_(cell_linked_list.getCellOffset()->DelegatedData(ex_policy)) {}
+      cell_offset_(cell_linked_list.getCellOffset()->DelegatedData(ex_policy)),
+      occupied_cell_(nullptr), number_of_occupied_cells_(nullptr)
+{
+    if (cell_linked_list.getOccupiedCell() != nullptr)
+    {
+        occupied_cell_ = cell_linked_list.getOccupiedCell()->DelegatedData(ex_policy);
+        number_of_occupied_cells_ = cell_linked_list.getNumberOfOccupiedCells()->DelegatedData(ex_policy);
+    }
+}
 //=================================================================================================//
-template <typename FunctionOnEach>
-void NeighborSearch::forEachSearch(UnsignedInt index_i, const Vecd *source_pos,
-                                   const FunctionOnEach &function) const
+template <bool IsSparse>
+inline void NeighborSearch::findCellRange(UnsignedInt linear_index, UnsignedInt &first, UnsignedInt &last) const
 {
-    const Arrayi target_cell_index = CellIndexFromPosition(source_pos[index_i]);
-    mesh_for_each(
-        Arrayi::Zero().max(target_cell_index - Arrayi::Ones()),
-        all_cells_.min(target_cell_index + 2 * Arrayi::Ones()),
-        [&](const Arrayi &cell_index)
+    if constexpr (!IsSparse)
+    {
+        // Since offset_cell_size_ has linear_cell_size_+1 elements, no boundary checks are needed.
+        // offset_cell_size_[0] == 0 && offset_cell_size_[linear_cell_size_] == total_real_particles_
+        first = cell_offset_[linear_index];
+        last = cell_offset_[linear_index + 1];
+    }
+    else
+    {
+        // binary search in the sorted occupied cells, an empty range is given for an empty cell
+        UnsignedInt lower = 0;
+        UnsignedInt upper = *number_of_occupied_cells_;
+        while (lower < upper)
         {
-            const UnsignedInt linear_index = LinearCellIndexFromCellIndex(cell_index);
-            // Since offset_cell_size_ has linear_cell_size_+1 elements, no boundary checks are needed.
-            // offset_cell_size_[0] == 0 && offset_cell_size_[linear_cell_size_] == total_real_particles_
-            for (UnsignedInt n = cell_offset_[linear_index]; n < cell_offset_[linear_index + 1]; ++n)
+            const UnsignedInt middle = lower + (upper - lower) / 2;
+            if (occupied_cell_[middle] < linear_index)
             {
-                const UnsignedInt index_j = particle_index_[n];
-                if ((source_pos[index_i] - pos_[index_j]).squaredNorm() < grid_spacing_squared_)
-                {
-                    function(index_j);
-                }
+                lower = middle + 1;
+            }
+            else
+            {
+                upper = middle;
             }
+        }
+        const bool is_occupied = lower < *number_of_occupied_cells_ && occupied_cell_[lower] == linear_index;
+        first = is_occupied ? cell_offset_[lower] : 0;
+        last = is_occupied ? cell_offset_[lower + 1] : 0;
+    }
+}
+//=================================================================================================//
+template <bool IsSparse, typename FunctionOnEach>
+void NeighborSearch::searchInCells(UnsignedInt index_i, const Vecd *source_pos,
+                                   const FunctionOnEach &function) const
+{
+    periodic_wrapping_.forEachImage(
+        source_pos[index_i], grid_spacing_,
+        [&](const Vecd &source_image)
+        {
+            const Arrayi target_cell_index = CellIndexFromPosition(source_image);
+            mesh_for_each(
+                Arrayi::Zero().max(target_cell_index - Arrayi::Ones()),
+                all_cells_.min(target_cell_index + 2 * Arrayi::Ones()),
+                [&](const Arrayi &cell_index)
+                {
+                    UnsignedInt first = 0, last = 0;
+                    findCellRange<IsSparse>(LinearCellIndexFromCellIndex(cell_index), first, last);
+                    for (UnsignedInt n = first; n < last; ++n)
+                    {
+                        const UnsignedInt index_j = particle_index_[n];
+                        if ((source_image - pos_[index_j]).squaredNorm() < grid_spacing_squared_)
+                        {
+                            function(index_j);
+                        }
+                    }
+                });
         });
 }
 //=================================================================================================//
+template <typename FunctionOnEach>
+void NeighborSearch::forEachSearch(UnsignedInt index_i, const Vecd *source_pos,
+                                   const FunctionOnEach &function) const
+{
+    // the storage of the cell linked list is chosen once per search, not per cell
+    if (occupied_cell_ == nullptr)
+    {
+        searchInCells<false>(index_i, source_pos, function);
+    }
+    else
+    {
+        searchInCells<true>(index_i, source_pos, function);
+    }
+}
+//=================================================================================================//
 template <class ExecutionPolicy>
 NeighborSearch CellLinkedList::createNeighborSearch(
     const ExecutionPolicy &ex_policy, DiscreteVariable<Vecd> *pos)
@@ -56,36 +117,126 @@ NeighborSearch CellLinkedList::createNeighborSearch(
     return NeighborSearch(ex_policy, *this, pos);
 }
 //=================================================================================================//
+template <class ExecutionPolicy>
+void CellLinkedList::resizeMesh(const ExecutionPolicy &ex_policy, const BoundingBox &tentative_bounds)
+{
+    resetMesh(tentative_bounds);
+    dv_particle_index_->reallocateData(ex_policy, index_list_size_);
+    dv_cell_offset_->reallocateData(ex_policy, cell_offset_list_size_);
+    resetComputingKernelUpdated();
+}
+//=================================================================================================//
 template <class DynamicsRange, typename GetSearchDepth, typename GetNeighborRelation>
 void CellLinkedList::searchNeighborsByParticles(
     DynamicsRange &dynamics_range, ParticleConfiguration &particle_configuration,
     GetSearchDepth &get_search_depth, GetNeighborRelation &get_neighbor_relation)
 {
+    checkCellDataMatrix("searchNeighborsByParticles");
     Vecd *pos = dynamics_range.getBaseParticles().ParticlePositions();
     particle_for(execution::ParallelPolicy(), dynamics_range.LoopRange(),
                  [&](size_t index_i)
                  {
                      int search_depth = get_search_depth(index_i);
-                     Arrayi target_cell_index = CellIndexFromPosition(pos[index_i]);
 
                      Neighborhood &neighborhood = particle_configuration[index_i];
-                     mesh_for_each(
-                         Arrayi::Zero().max(target_cell_index - search_depth * Arrayi::Ones()),
-                         all_cells_.min(target_cell_index + (search_depth + 1) * Arrayi::Ones()),
-                         [&](const Arrayi &cell_index)
+                     periodic_wrapping_.forEachImage(
+                         pos[index_i], search_depth * grid_spacing_,
+                         [&](const Vecd &image_i)
                          {
-                             ListDataVector &target_particles = getCellDataList(cell_data_lists_, cell_index);
-                             for (const ListData &data_list : target_particles)
-                             {
-                                 get_neighbor_relation(neighborhood, pos[index_i], index_i, data_list);
-                             }
+                             Arrayi target_cell_index = CellIndexFromPosition(image_i);
+                             mesh_for_each(
+                                 Arrayi::Zero().max(target_cell_index - search_depth * Arrayi::Ones()),
+                                 all_cells_.min(target_cell_index + (search_depth + 1) * Arrayi::Ones()),
+                                 [&](const Arrayi &cell_index)
+                                 {
+                                     ListDataVector &target_particles = getCellDataList(cell_data_lists_, cell_index);
+                                     for (const ListData &data_list : target_particles)
+                                     {
+                                         get_neighbor_relation(neighborhood, image_i, index_i, data_list);
+                                     }
+                                 });
                          });
                  });
 }
 //=================================================================================================//
+template <typename GetNeighborRelation>
+void CellLinkedList::searchNeighborPairsByCells(
+    ParticleConfiguration &particle_configuration, GetNeighborRelation &get_neighbor_relation)
+{
+    checkCellDataMatrix("searchNeighborPairsByCells");
+    if (periodic_wrapping_.isPeriodic())
+    {
+        std::cout << "\n Error: the cell-centric pair search does not support periodic axes!" << std::endl;
+        std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+        exit(1);
+    }
+
+    // the half stencil includes the neighbor cells after the center cell in linear order
+    const Arrayi stencil_size = 3 * Arrayi::Ones();
+    const size_t stencil_center = transferMeshIndexTo1D(stencil_size, Arrayi::Ones());
+    StdVec<Arrayi> half_stencil;
+    for (size_t n = stencil_center + 1; n != number_of_split_cell_lists_; ++n)
+    {
+        half_stencil.push_back(transfer1DtoMeshIndex(stencil_size, n) - Arrayi::Ones());
+    }
+
+    auto search_pair = [&](const ListData &list_data_i, const ListData &list_data_j)
+    {
+        get_neighbor_relation(particle_configuration[list_data_i.first],
+                              particle_configuration[list_data_j.first], list_data_i, list_data_j);
+    };
+
+    // The cells of a split cell list are at least 3 cells away from each other
+    // so that no particle is written by two cells at the same time.
+    for (size_t k = 0; k < number_of_split_cell_lists_; k++)
+    {
+        const Arrayi split_cell_index = transfer1DtoMeshIndex(stencil_size, k);
+        const Arrayi all_cells_k = (all_cells_ - split_cell_index - Arrayi::Ones()) / 3 + Arrayi::Ones();
+        const size_t number_of_cells = all_cells_k.prod();
+
+        parallel_for(
+            IndexRange(0, number_of_cells),
+            [&](const IndexRange &r)
+            {
+                for (size_t l = r.begin(); l < r.end(); ++l)
+                {
+                    const Arrayi cell_index = split_cell_index + 3 * transfer1DtoMeshIndex(all_cells_k, l);
+                    // the list data of a cell is a contiguous tile of particle indexes and positions
+                    const ListDataVector &cell_data_list = getCellDataList(cell_data_lists_, cell_index);
+                    for (size_t m = 0; m < cell_data_list.size(); ++m)
+                    {
+                        for (size_t n = m + 1; n < cell_data_list.size(); ++n)
+                        {
+                            search_pair(cell_data_list[m], cell_data_list[n]);
+                        }
+                    }
+
+                    for (const Arrayi &offset : half_stencil)
+                    {
+                        const Arrayi neighbor_cell_index = cell_index + offset;
+                        if ((neighbor_cell_index >= 0).all() && (neighbor_cell_index < all_cells_).all())
+                        {
+                            const ListDataVector &neighbor_cell_data_list =
+                                getCellDataList(cell_data_lists_, neighbor_cell_index);
+                            for (const ListData &list_data_i : cell_data_list)
+                            {
+                                for (const ListData &list_data_j : neighbor_cell_data_list)
+                                {
+                                    search_pair(list_data_i, list_data_j);
+                                }
+                            }
+                        }
+                    }
+                }
+            },
+            ap);
+    }
+}
+//=================================================================================================//
 template <class LocalDynamicsFunction>
 void CellLinkedList::particle_for_split(const execution::SequencedPolicy &, const LocalDynamicsFunction &local_dynamics_function)
 {
+    checkCellDataMatrix("particle_for_split");
     // foward sweeping
     for (size_t k = 0; k < number_of_split_cell_lists_; k++)
     {
@@ -138,6 +289,7 @@ void CellLinkedList::particle_for_split(const execution::SequencedPolicy &, cons
 template <class LocalDynamicsFunction>
 void CellLinkedList::particle_for_split(const execution::ParallelPolicy &, const LocalDynamicsFunction &local_dynamics_function)
 {
+    checkCellDataMatrix("particle_for_split");
     // foward sweeping
     for (size_t k = 0; k < number_of_split_cell_lists_; k++)
     {
@@ -124,6 +124,20 @@ class MeshWithGridDataPackages : public Mesh
     };
     OperationOnDataAssemble<MeshVariableAssemble, ResizeMeshVariableData> resize_mesh_variable_data_{all_mesh_variables_};
 
+    /** sum the bytes of the data packages of all mesh variables */
+    struct SumMeshVariableBytes
+    {
+        template <typename DataType>
+        void operator()(DataContainerAddressKeeper<MeshVariable<DataType>> &all_mesh_variables_, size_t &bytes)
+        {
+            for (size_t l = 0; l != all_mesh_variables_.size(); ++l)
+            {
+                bytes += all_mesh_variables_[l]->MemoryBytes();
+            }
+        }
+    };
+    OperationOnDataAssemble<MeshVariableAssemble, SumMeshVariableBytes> sum_mesh_variable_bytes_{all_mesh_variables_};
+
     /** probe by applying bi and tri-linear interpolation within the package. */
     template <class DataType>
     DataType probeDataPackage(MeshVariable<DataType> &mesh_variable, size_t package_index, const Arrayi &cell_index, const Vecd &position);
@@ -178,6 +192,14 @@ class MeshWithGridDataPackages : public Mesh
     {
         resize_mesh_variable_data_(num_grid_pkgs_);
     }
+    /** bytes of the data packages, the package metadata and the index matrix */
+    size_t MemoryBytes()
+    {
+        size_t bytes = 0;
+        sum_mesh_variable_bytes_(bytes);
+        return bytes + num_grid_pkgs_ * (sizeof(CellNeighborhood) + sizeof(std::pair<Arrayi, int>)) +
+               all_cells_.prod() * sizeof(size_t);
+    }
 
     template <typename DataType>
     MeshVariable<DataType> *getMeshVariable(const std::string &variable_name)
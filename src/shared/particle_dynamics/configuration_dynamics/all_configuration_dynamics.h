@@ -29,6 +29,7 @@
 #ifndef ALL_CONFIGURATION_DYNAMICS_H
 #define ALL_CONFIGURATION_DYNAMICS_H
 
+#include "domain_decomposition.hpp"
 #include "particle_sorting.hpp"
 #include "update_body_relation.hpp"
 #include "update_cell_linked_list.hpp"
@@ -0,0 +1,317 @@
+#include "domain_decomposition.hpp"
+
+#include "base_particle_dynamics.h"
+#include "cell_linked_list.h"
+#include "mesh_iterators.hpp"
+#include "sph_system.h"
+
+#include <algorithm>
+
+namespace SPH
+{
+//=================================================================================================//
+SpaceFillingCurvePartition::SpaceFillingCurvePartition(const Mesh &mesh, UnsignedInt max_bins)
+    : mesh_(mesh), bin_shift_(0), number_of_bins_(1)
+{
+    /** Morton keys are given by 10 bits in each dimension. */
+    Arrayi max_cell_index = (mesh_.AllCells() - Arrayi::Ones()).min(Arrayi::Constant(1023));
+    size_t max_key = mesh_.transferMeshIndexToMortonOrder(max_cell_index);
+    while ((max_key >> bin_shift_) >= max_bins)
+    {
+        bin_shift_++;
+    }
+    number_of_bins_ = (max_key >> bin_shift_) + 1;
+    splitters_ = {0, number_of_bins_};
+}
+//=================================================================================================//
+UnsignedInt SpaceFillingCurvePartition::BinIndex(const Arrayi &cell_index) const
+{
+    return mesh_.transferMeshIndexToMortonOrder(cell_index) >> bin_shift_;
+}
+//=================================================================================================//
+int SpaceFillingCurvePartition::OwnerRank(const Arrayi &cell_index) const
+{
+    UnsignedInt bin = BinIndex(cell_index);
+    int rank = std::upper_bound(splitters_.begin(), splitters_.end(), bin) - splitters_.begin() - 1;
+    return SMIN(rank, NumberOfRanks() - 1);
+}
+//=================================================================================================//
+int SpaceFillingCurvePartition::OwnerRank(const Vecd &position) const
+{
+    return OwnerRank(mesh_.CellIndexFromPosition(position));
+}
+//=================================================================================================//
+void SpaceFillingCurvePartition::
+    addToHistogram(const Vecd *pos, UnsignedInt total_particles, StdVec<std::uint64_t> &histogram) const
+{
+    histogram.resize(number_of_bins_, 0);
+    for (UnsignedInt i = 0; i != total_particles; ++i)
+    {
+        histogram[BinIndex(mesh_.CellIndexFromPosition(pos[i]))]++;
+    }
+}
+//=================================================================================================//
+void SpaceFillingCurvePartition::setSplitters(const StdVec<std::uint64_t> &histogram, int number_of_ranks)
+{
+    std::uint64_t total_particles = 0;
+    for (const std::uint64_t &count : histogram)
+    {
+        total_particles += count;
+    }
+
+    splitters_.assign(number_of_ranks + 1, number_of_bins_);
+    splitters_[0] = 0;
+    std::uint64_t accumulated = 0;
+    int rank = 1;
+    for (UnsignedInt bin = 0; bin != number_of_bins_ && rank != number_of_ranks; ++bin)
+    {
+        while (rank != number_of_ranks && accumulated * number_of_ranks >= total_particles * rank)
+        {
+            splitters_[rank] = bin;
+            rank++;
+        }
+        accumulated += histogram[bin];
+    }
+}
+//=================================================================================================//
+void SpaceFillingCurvePartition::findHaloRanks(const Vecd &position, int rank, StdVec<int> &halo_ranks) const
+{
+    halo_ranks.clear();
+    const Arrayi cell_index = mesh_.CellIndexFromPosition(position);
+    mesh_for_each(
+        Arrayi::Zero().max(cell_index - Arrayi::Ones()),
+        mesh_.AllCells().min(cell_index + 2 * Arrayi::Ones()),
+        [&](const Arrayi &neighbor_cell_index)
+        {
+            int owner_rank = OwnerRank(neighbor_cell_index);
+            if (owner_rank != rank &&
+                std::find(halo_ranks.begin(), halo_ranks.end(), owner_rank) == halo_ranks.end())
+            {
+                halo_ranks.push_back(owner_rank);
+            }
+        });
+}
+//=================================================================================================//
+DomainDecomposition::DomainDecomposition(RealBody &real_body, Ghost<ReserveSizeFactor> &halo_ghost)
+    : process_communicator_(real_body.getSPHSystem().getProcessCommunicator()),
+      particles_(real_body.getBaseParticles()),
+      cell_linked_list_(real_body.getCellLinkedList()),
+      halo_ghost_(halo_ghost), halo_bound_(halo_ghost.GhostBound()),
+      partition_(DynamicCast<CellLinkedList>(this, real_body.getCellLinkedList())),
+      dv_global_id_(particles_.registerDiscreteVariableOnly<UnsignedInt>(
+          "GlobalID", particles_.ParticlesBound())),
+      halo_send_indices_(process_communicator_.Size()),
+      halo_receive_offsets_(process_communicator_.Size() + 1, halo_bound_.first)
+{
+    halo_ghost_.checkParticlesReserved();
+    halo_bound_.second = halo_bound_.first;
+    particles_.addVariableToSort<UnsignedInt>("GlobalID");
+    particles_.addVariableToRestart<UnsignedInt>("GlobalID");
+    particles_.addVariableToList<Vecd>(variables_to_exchange_, "Position");
+}
+//=================================================================================================//
+void DomainDecomposition::initializePartition(bool is_replicated)
+{
+    if (is_replicated)
+    {
+        UnsignedInt *global_id = dv_global_id_->Data();
+        UnsignedInt *original_id = particles_.ParticleOriginalIds();
+        for (UnsignedInt i = 0; i != particles_.TotalRealParticles(); ++i)
+        {
+            global_id[i] = original_id[i];
+        }
+    }
+    updatePartition();
+
+    if (is_replicated)
+    {
+        removeParticlesNotOwned(nullptr);
+        renumberParticleIds();
+    }
+    else
+    {
+        migrateParticles();
+    }
+}
+//=================================================================================================//
+void DomainDecomposition::updatePartition()
+{
+    removeHaloParticles();
+    StdVec<std::uint64_t> histogram;
+    partition_.addToHistogram(particles_.ParticlePositions(), particles_.TotalRealParticles(), histogram);
+    process_communicator_.allReduceSum(histogram);
+    partition_.setSplitters(histogram, process_communicator_.Size());
+}
+//=================================================================================================//
+void DomainDecomposition::removeHaloParticles()
+{
+    halo_bound_.second = halo_bound_.first;
+    for (auto &send_indices : halo_send_indices_)
+    {
+        send_indices.clear();
+    }
+    halo_receive_offsets_.assign(process_communicator_.Size() + 1, halo_bound_.first);
+}
+//=================================================================================================//
+void DomainDecomposition::removeParticlesNotOwned(ProcessBuffers *send_buffers)
+{
+    const int rank = process_communicator_.Rank();
+    Vecd *pos = particles_.ParticlePositions();
+    OperationOnDataAssemble<ParticleVariables, PackParticleVariables>
+        pack_particle_variables(particles_.VariablesToSort());
+    OperationOnDataAssemble<ParticleVariables, CopyParticleVariables>
+        copy_particle_variables(particles_.VariablesToSort());
+    /** From the last particle, so that the one moved into the index has been checked already. */
+    for (UnsignedInt i = particles_.TotalRealParticles(); i != 0; --i)
+    {
+        UnsignedInt index = i - 1;
+        int owner_rank = partition_.OwnerRank(pos[index]);
+        if (owner_rank != rank)
+        {
+            if (send_buffers != nullptr)
+            {
+                pack_particle_variables((*send_buffers)[owner_rank], index);
+            }
+            UnsignedInt last_real_particle_index = particles_.TotalRealParticles() - 1;
+            if (index < last_real_particle_index)
+            {
+                copy_particle_variables(index, last_real_particle_index);
+            }
+            particles_.decrementTotalRealParticles();
+        }
+    }
+}
+//=================================================================================================//
+void DomainDecomposition::appendReceivedParticles(const ProcessBuffers &receive_buffers)
+{
+    size_t particle_bytes = 0;
+    OperationOnDataAssemble<ParticleVariables, ParticleVariableBytes>
+        particle_variable_bytes(particles_.VariablesToSort());
+    particle_variable_bytes(particle_bytes);
+    OperationOnDataAssemble<ParticleVariables, UnpackParticleVariables>
+        unpack_particle_variables(particles_.VariablesToSort());
+
+    for (size_t k = 0; k != receive_buffers.size(); ++k)
+    {
+        UnsignedInt received_particles = receive_buffers[k].size() / particle_bytes;
+        if (particles_.TotalRealParticles() + received_particles > particles_.RealParticlesBound())
+        {
+            std::cout << "\n Error: the particles received from other processes exceed the particle bound! \n";
+            std::cout << " Please reserve more buffer particles for the body. \n";
+            std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+            exit(1);
+        }
+
+        const char *buffer = receive_buffers[k].data();
+        for (UnsignedInt n = 0; n != received_particles; ++n)
+        {
+            unpack_particle_variables(buffer, particles_.TotalRealParticles());
+            particles_.incrementTotalRealParticles();
+        }
+    }
+}
+//=================================================================================================//
+StdVec<UnsignedInt> DomainDecomposition::receiveHaloParticles(const ProcessBuffers &receive_buffers)
+{
+    size_t particle_bytes = 0;
+    OperationOnDataAssemble<ParticleVariables, ParticleVariableBytes>
+        particle_variable_bytes(particles_.VariablesToSort());
+    particle_variable_bytes(particle_bytes);
+    OperationOnDataAssemble<ParticleVariables, UnpackParticleVariables>
+        unpack_particle_variables(particles_.VariablesToSort());
+
+    Vecd *pos = particles_.ParticlePositions();
+    StdVec<UnsignedInt> offsets(receive_buffers.size() + 1, halo_bound_.first);
+    for (size_t k = 0; k != receive_buffers.size(); ++k)
+    {
+        UnsignedInt received_particles = receive_buffers[k].size() / particle_bytes;
+        halo_bound_.second += received_particles;
+        halo_ghost_.checkWithinGhostSize(halo_bound_);
+
+        const char *buffer = receive_buffers[k].data();
+        for (UnsignedInt index = offsets[k]; index != halo_bound_.second; ++index)
+        {
+            unpack_particle_variables(buffer, index);
+            cell_linked_list_.InsertListDataEntry(index, pos[index]);
+        }
+        offsets[k + 1] = halo_bound_.second;
+    }
+    return offsets;
+}
+//=================================================================================================//
+void DomainDecomposition::renumberParticleIds()
+{
+    UnsignedInt *original_id = particles_.ParticleOriginalIds();
+    UnsignedInt *sorted_id = particles_.ParticleSortedIds();
+    UnsignedInt total_real_particles = particles_.TotalRealParticles();
+    for (UnsignedInt i = 0; i != total_real_particles; ++i)
+    {
+        original_id[i] = i;
+        sorted_id[i] = i;
+    }
+}
+//=================================================================================================//
+void DomainDecomposition::migrateParticles()
+{
+    removeHaloParticles();
+    ProcessBuffers send_buffers(process_communicator_.Size());
+    removeParticlesNotOwned(&send_buffers);
+    appendReceivedParticles(process_communicator_.exchangeBuffers(send_buffers));
+    renumberParticleIds();
+}
+//=================================================================================================//
+void DomainDecomposition::exchangeHaloParticles()
+{
+    if (DynamicCast<CellLinkedList>(this, cell_linked_list_).hasComputingKernels())
+    {
+        std::cout << "\n Error: halo particles are only inserted into the legacy cell linked list, "
+                  << "but the cell linked list is updated by computing kernels which do not see them!" << std::endl;
+        std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+        exit(1);
+    }
+    removeHaloParticles();
+    const int rank = process_communicator_.Rank();
+    Vecd *pos = particles_.ParticlePositions();
+    ProcessBuffers send_buffers(process_communicator_.Size());
+    OperationOnDataAssemble<ParticleVariables, PackParticleVariables>
+        pack_particle_variables(particles_.VariablesToSort());
+    StdVec<int> halo_ranks;
+    for (UnsignedInt i = 0; i != particles_.TotalRealParticles(); ++i)
+    {
+        partition_.findHaloRanks(pos[i], rank, halo_ranks);
+        for (const int &halo_rank : halo_ranks)
+        {
+            halo_send_indices_[halo_rank].push_back(i);
+            pack_particle_variables(send_buffers[halo_rank], i);
+        }
+    }
+    halo_receive_offsets_ = receiveHaloParticles(process_communicator_.exchangeBuffers(send_buffers));
+}
+//=================================================================================================//
+void DomainDecomposition::updateHaloVariables()
+{
+    ProcessBuffers send_buffers(process_communicator_.Size());
+    OperationOnDataAssemble<ParticleVariables, PackParticleVariables>
+        pack_particle_variables(variables_to_exchange_);
+    for (size_t k = 0; k != halo_send_indices_.size(); ++k)
+    {
+        for (const UnsignedInt &index : halo_send_indices_[k])
+        {
+            pack_particle_variables(send_buffers[k], index);
+        }
+    }
+
+    ProcessBuffers receive_buffers = process_communicator_.exchangeBuffers(send_buffers);
+    OperationOnDataAssemble<ParticleVariables, UnpackParticleVariables>
+        unpack_particle_variables(variables_to_exchange_);
+    for (size_t k = 0; k != receive_buffers.size(); ++k)
+    {
+        const char *buffer = receive_buffers[k].data();
+        for (UnsignedInt index = halo_receive_offsets_[k]; index != halo_receive_offsets_[k + 1]; ++index)
+        {
+            unpack_particle_variables(buffer, index);
+        }
+    }
+}
+//=================================================================================================//
+} // namespace SPH
@@ -0,0 +1,194 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2023 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file domain_decomposition.h
+ * @brief Distributing the particles of a body over processes
+ * with migration of particles and exchange of halo particles.
+ * @details The cells of the cell linked list are ordered along the Morton curve,
+ * which is divided into consecutive ranges with about the same number of particles.
+ * A process owns the particles in its range, and receives as halo particles
+ * the particles of other processes within one cell, i.e. one cut-off radius.
+ * Similar to periodic ghost particles, halo particles are kept in a reserved ghost range
+ * after the real particles and inserted into the cell linked list,
+ * so that they are found as neighbors but excluded from the particle dynamics,
+ * reductions and output which only run over the owned, i.e. real, particles.
+ * Migrating and new halo particles carry the variables to sort,
+ * while only the variables to exchange, by default the position, are refreshed on halo particles.
+ * A typical advection step is:
+ * migrateParticles, particle sorting (optional), cell linked list update, exchangeHaloParticles,
+ * relation update, and then the dynamics
+ * with updateHaloVariables after the variables read by neighbors have been changed.
+ * As for periodic ghost particles, only the legacy cell linked list update and relations see the halo particles.
+ * The computing-kernel cell linked list update, relations and particle sorting run over the real particles only,
+ * so the halo exchange exits with an error if the cell linked list is updated by computing kernels.
+ * The particle data are accessed on host.
+ * @author	Xiangyu Hu
+ */
+
+#ifndef DOMAIN_DECOMPOSITION_H
+#define DOMAIN_DECOMPOSITION_H
+
+#include "base_body.h"
+#include "base_particles.hpp"
+#include "particle_reserve.h"
+#include "process_communicator.h"
+#include "sph_system.h"
+
+namespace SPH
+{
+/**
+ * @class SpaceFillingCurvePartition
+ * @brief Partition of the cells of a mesh along the Morton curve.
+ * The curve is divided into bins and consecutive bins are assigned to processes.
+ */
+class SpaceFillingCurvePartition
+{
+  public:
+    explicit SpaceFillingCurvePartition(const Mesh &mesh, UnsignedInt max_bins = 65536);
+    ~SpaceFillingCurvePartition(){};
+
+    UnsignedInt NumberOfBins() const { return number_of_bins_; };
+    int NumberOfRanks() const { return int(splitters_.size()) - 1; };
+    UnsignedInt BinIndex(const Arrayi &cell_index) const;
+    int OwnerRank(const Arrayi &cell_index) const;
+    int OwnerRank(const Vecd &position) const;
+    /** add the number of particles in each bin to the histogram */
+    void addToHistogram(const Vecd *pos, UnsignedInt total_particles, StdVec<std::uint64_t> &histogram) const;
+    /** assign consecutive bins to the ranks with about the same number of particles */
+    void setSplitters(const StdVec<std::uint64_t> &histogram, int number_of_ranks);
+    /** the ranks other than the given one owning the cells within one cell of the position */
+    void findHaloRanks(const Vecd &position, int rank, StdVec<int> &halo_ranks) const;
+
+  protected:
+    Mesh mesh_;
+    UnsignedInt bin_shift_;
+    UnsignedInt number_of_bins_;
+    StdVec<UnsignedInt> splitters_; /**< the first bin of each rank and the number of bins at last */
+};
+
+/**
+ * @class DomainDecomposition
+ * @brief Owned and halo particles of a body on this process.
+ * All functions are collective, i.e. called by all processes in the same order.
+ */
+class DomainDecomposition
+{
+  public:
+    DomainDecomposition(RealBody &real_body, Ghost<ReserveSizeFactor> &halo_ghost);
+    virtual ~DomainDecomposition(){};
+
+    /** Set up the partition and keep the owned particles. If replicated, all processes
+     * have generated the same particles which are identified by the original ids,
+     * otherwise, e.g. after reading the restart files, the particles are migrated to their owners. */
+    void initializePartition(bool is_replicated = true);
+    /** re-balance the partition with the current particle distribution */
+    void updatePartition();
+    /** remove the halo particles and send the particles moved out of the range to their owners */
+    void migrateParticles();
+    /** receive the particles of the other processes within one cell as halo particles,
+     * called after the update of the legacy cell linked list */
+    void exchangeHaloParticles();
+    /** refresh the variables to exchange on the halo particles */
+    void updateHaloVariables();
+    template <typename DataType>
+    void addVariableToExchange(const std::string &name);
+
+    UnsignedInt OwnedParticles() { return particles_.TotalRealParticles(); };
+    UnsignedInt HaloParticles() { return halo_bound_.second - halo_bound_.first; };
+    IndexRange HaloParticleRange() { return halo_ghost_.getGhostParticleRange(halo_bound_); };
+    std::uint64_t GlobalParticles() { return process_communicator_.allReduceSum(std::uint64_t(OwnedParticles())); };
+    SpaceFillingCurvePartition &getPartition() { return partition_; };
+
+  protected:
+    ProcessCommunicator &process_communicator_;
+    BaseParticles &particles_;
+    BaseCellLinkedList &cell_linked_list_;
+    Ghost<ReserveSizeFactor> &halo_ghost_;
+    ParticlesBound &halo_bound_;
+    SpaceFillingCurvePartition partition_;
+    DiscreteVariable<UnsignedInt> *dv_global_id_;
+    StdVec<StdVec<UnsignedInt>> halo_send_indices_;
+    StdVec<UnsignedInt> halo_receive_offsets_;
+    ParticleVariables variables_to_exchange_;
+
+    struct ParticleVariableBytes
+    {
+        template <typename DataType>
+        void operator()(DataContainerAddressKeeper<DiscreteVariable<DataType>> &variables, size_t &bytes);
+    };
+
+    struct PackParticleVariables
+    {
+        template <typename DataType>
+        void operator()(DataContainerAddressKeeper<DiscreteVariable<DataType>> &variables,
+                        StdVec<char> &buffer, UnsignedInt index);
+    };
+
+    struct UnpackParticleVariables
+    {
+        template <typename DataType>
+        void operator()(DataContainerAddressKeeper<DiscreteVariable<DataType>> &variables,
+                        const char *&buffer, UnsignedInt index);
+    };
+
+    struct CopyParticleVariables
+    {
+        template <typename DataType>
+        void operator()(DataContainerAddressKeeper<DiscreteVariable<DataType>> &variables,
+                        UnsignedInt index, UnsignedInt another_index);
+    };
+
+    void removeHaloParticles();
+    /** the particles moved out are replaced by the last particle with its sortable variables */
+    void removeParticlesNotOwned(ProcessBuffers *send_buffers);
+    /** append the received particles after the real particles */
+    void appendReceivedParticles(const ProcessBuffers &receive_buffers);
+    /** place the received particles in the halo range and return the offsets by ranks */
+    StdVec<UnsignedInt> receiveHaloParticles(const ProcessBuffers &receive_buffers);
+    void renumberParticleIds();
+};
+
+/**
+ * @class GlobalTimeStep
+ * @brief The smallest time step among all processes.
+ */
+template <class TimeStepDynamicsType>
+class GlobalTimeStep : public TimeStepDynamicsType
+{
+  public:
+    template <typename... Args>
+    GlobalTimeStep(Args &&...args)
+        : TimeStepDynamicsType(std::forward<Args>(args)...),
+          process_communicator_(this->getSPHBody().getSPHSystem().getProcessCommunicator()){};
+    virtual ~GlobalTimeStep(){};
+
+    virtual Real exec(Real dt = 0.0) override
+    {
+        return process_communicator_.allReduceMin(TimeStepDynamicsType::exec(dt));
+    };
+
+  protected:
+    ProcessCommunicator &process_communicator_;
+};
+} // namespace SPH
+#endif // DOMAIN_DECOMPOSITION_H
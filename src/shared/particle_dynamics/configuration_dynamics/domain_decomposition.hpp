@@ -0,0 +1,61 @@
+#ifndef DOMAIN_DECOMPOSITION_HPP
+#define DOMAIN_DECOMPOSITION_HPP
+
+#include "domain_decomposition.h"
+
+#include <cstring>
+
+namespace SPH
+{
+//=================================================================================================//
+template <typename DataType>
+void DomainDecomposition::addVariableToExchange(const std::string &name)
+{
+    particles_.addVariableToList<DataType>(variables_to_exchange_, name);
+}
+//=================================================================================================//
+template <typename DataType>
+void DomainDecomposition::ParticleVariableBytes::
+operator()(DataContainerAddressKeeper<DiscreteVariable<DataType>> &variables, size_t &bytes)
+{
+    bytes += variables.size() * sizeof(DataType);
+}
+//=================================================================================================//
+template <typename DataType>
+void DomainDecomposition::PackParticleVariables::
+operator()(DataContainerAddressKeeper<DiscreteVariable<DataType>> &variables,
+           StdVec<char> &buffer, UnsignedInt index)
+{
+    for (size_t k = 0; k != variables.size(); ++k)
+    {
+        const char *data = reinterpret_cast<const char *>(variables[k]->Data() + index);
+        buffer.insert(buffer.end(), data, data + sizeof(DataType));
+    }
+}
+//=================================================================================================//
+template <typename DataType>
+void DomainDecomposition::UnpackParticleVariables::
+operator()(DataContainerAddressKeeper<DiscreteVariable<DataType>> &variables,
+           const char *&buffer, UnsignedInt index)
+{
+    for (size_t k = 0; k != variables.size(); ++k)
+    {
+        std::memcpy(reinterpret_cast<char *>(variables[k]->Data() + index), buffer, sizeof(DataType));
+        buffer += sizeof(DataType);
+    }
+}
+//=================================================================================================//
+template <typename DataType>
+void DomainDecomposition::CopyParticleVariables::
+operator()(DataContainerAddressKeeper<DiscreteVariable<DataType>> &variables,
+           UnsignedInt index, UnsignedInt another_index)
+{
+    for (size_t k = 0; k != variables.size(); ++k)
+    {
+        DataType *data_field = variables[k]->Data();
+        data_field[index] = data_field[another_index];
+    }
+}
+//=================================================================================================//
+} // namespace SPH
+#endif // DOMAIN_DECOMPOSITION_HPP
@@ -27,7 +27,7 @@ void VonMisesStrain::update(size_t index_i, Real dt)
 //=============================================================================================//
 VerticalStress::VerticalStress(SPHBody &sph_body)
     : BaseDerivedVariable<Real>(sph_body, "VerticalStress"),
-      stress_tensor_3D_(particles_->getVariableDataByName<Mat3d>("StressTensor3D")) {}
+      stress_tensor_3D_(particles_->getVariableDataByName<SymMat3d>("StressTensor3D")) {}
 //=============================================================================================//
 void VerticalStress::update(size_t index_i, Real dt)
 {
@@ -37,19 +37,19 @@ void VerticalStress::update(size_t index_i, Real dt)
 AccDeviatoricPlasticStrain::AccDeviatoricPlasticStrain(SPHBody &sph_body)
     : BaseDerivedVariable<Real>(sph_body, "AccDeviatoricPlasticStrain"),
       plastic_continuum_(DynamicCast<PlasticContinuum>(this, sph_body_.getBaseMaterial())),
-      stress_tensor_3D_(particles_->getVariableDataByName<Mat3d>("StressTensor3D")),
-      strain_tensor_3D_(particles_->getVariableDataByName<Mat3d>("StrainTensor3D")),
+      stress_tensor_3D_(particles_->getVariableDataByName<SymMat3d>("StressTensor3D")),
+      strain_tensor_3D_(particles_->getVariableDataByName<SymMat3d>("StrainTensor3D")),
       E_(plastic_continuum_.getYoungsModulus()), nu_(plastic_continuum_.getPoissonRatio()) {}
 //=============================================================================================//
 void AccDeviatoricPlasticStrain::update(size_t index_i, Real dt)
 {
-    Mat3d deviatoric_stress = stress_tensor_3D_[index_i] - (1.0 / 3.0) * stress_tensor_3D_[index_i].trace() * Mat3d::Identity();
+    SymMat3d deviatoric_stress = stress_tensor_3D_[index_i].deviatoric();
     Real hydrostatic_pressure = (1.0 / 3.0) * stress_tensor_3D_[index_i].trace();
-    Mat3d elastic_strain_tensor_3D = deviatoric_stress / (2.0 * plastic_continuum_.getShearModulus(E_, nu_)) +
-                                     hydrostatic_pressure * Mat3d::Identity() / (9.0 * plastic_continuum_.getBulkModulus(E_, nu_));
-    Mat3d plastic_strain_tensor_3D = strain_tensor_3D_[index_i] - elastic_strain_tensor_3D;
-    Mat3d deviatoric_strain_tensor = plastic_strain_tensor_3D - (1.0 / (Real)Dimensions) * plastic_strain_tensor_3D.trace() * Mat3d::Identity();
-    Real sum = (deviatoric_strain_tensor.cwiseProduct(deviatoric_strain_tensor)).sum();
+    SymMat3d elastic_strain_tensor_3D = deviatoric_stress / (2.0 * plastic_continuum_.getShearModulus(E_, nu_)) +
+                                        SymMat3d::Identity() * hydrostatic_pressure / (9.0 * plastic_continuum_.getBulkModulus(E_, nu_));
+    SymMat3d plastic_strain_tensor_3D = strain_tensor_3D_[index_i] - elastic_strain_tensor_3D;
+    SymMat3d deviatoric_strain_tensor = plastic_strain_tensor_3D - SymMat3d::Identity() * plastic_strain_tensor_3D.trace() / (Real)Dimensions;
+    Real sum = deviatoric_strain_tensor.squaredNorm();
     derived_variable_[index_i] = sqrt(sum * 2.0 / 3.0);
 }
 //=================================================================================================//
@@ -77,7 +77,7 @@ class VerticalStress : public BaseDerivedVariable<Real>
     void update(size_t index_i, Real dt = 0.0);
 
   protected:
-    Mat3d *stress_tensor_3D_;
+    SymMat3d *stress_tensor_3D_;
 };
 /**
  * @class AccumulatedDeviatoricPlasticStrain
@@ -91,7 +91,7 @@ class AccDeviatoricPlasticStrain : public BaseDerivedVariable<Real>
 
   protected:
     PlasticContinuum &plastic_continuum_;
-    Mat3d *stress_tensor_3D_, *strain_tensor_3D_;
+    SymMat3d *stress_tensor_3D_, *strain_tensor_3D_;
     Real E_, nu_;
 };
 } // namespace continuum_dynamics
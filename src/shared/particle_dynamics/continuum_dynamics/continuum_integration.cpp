@@ -9,12 +9,12 @@ ContinuumInitialCondition::ContinuumInitialCondition(SPHBody &sph_body)
     : LocalDynamics(sph_body),
       pos_(particles_->getVariableDataByName<Vecd>("Position")),
       vel_(particles_->registerStateVariable<Vecd>("Velocity")),
-      stress_tensor_3D_(particles_->registerStateVariable<Mat3d>("StressTensor3D")) {}
+      stress_tensor_3D_(particles_->registerStateVariable<SymMat3d>("StressTensor3D")) {}
 //=================================================================================================//
 AcousticTimeStep::AcousticTimeStep(SPHBody &sph_body, Real acousticCFL)
     : LocalDynamicsReduce<ReduceMax>(sph_body),
       fluid_(DynamicCast<Fluid>(this, particles_->getBaseMaterial())),
-      rho_(particles_->getVariableDataByName<Real>("Density")),
+      rho_(particles_->getVariableDataByName<StorageReal>("Density")),
       p_(particles_->getVariableDataByName<Real>("Pressure")),
       vel_(particles_->getVariableDataByName<Vecd>("Velocity")),
       smoothing_length_min_(sph_body.sph_adaptation_->MinimumSmoothingLength()),
@@ -41,8 +41,8 @@ void StressDiffusion::interaction(size_t index_i, Real dt)
     Vecd acc_prior_i = force_prior_[index_i] / mass_[index_i];
     Real gravity = abs(acc_prior_i(1, 0));
     Real density = plastic_continuum_.getDensity();
-    Mat3d diffusion_stress_rate = Mat3d::Zero();
-    Mat3d diffusion_stress = Mat3d::Zero();
+    SymMat3d diffusion_stress_rate = SymMat3d::Zero();
+    SymMat3d diffusion_stress = SymMat3d::Zero();
     Neighborhood &inner_neighborhood = inner_configuration_[index_i];
     for (size_t n = 0; n != inner_neighborhood.current_size_; ++n)
     {
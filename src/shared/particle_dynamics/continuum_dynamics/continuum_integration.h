@@ -46,7 +46,7 @@ class ContinuumInitialCondition : public LocalDynamics
 
   protected:
     Vecd *pos_, *vel_;
-    Mat3d *stress_tensor_3D_;
+    SymMat3d *stress_tensor_3D_;
 };
 
 class AcousticTimeStep : public LocalDynamicsReduce<ReduceMax>
@@ -59,7 +59,8 @@ class AcousticTimeStep : public LocalDynamicsReduce<ReduceMax>
 
   protected:
     Fluid &fluid_;
-    Real *rho_, *p_;
+    StorageReal *rho_;
+    Real *p_;
     Vecd *vel_;
     Real smoothing_length_min_;
     Real acousticCFL_;
@@ -89,7 +90,7 @@ class BasePlasticIntegration : public fluid_dynamics::BaseIntegration<DataDelega
 
   protected:
     PlasticContinuum &plastic_continuum_;
-    Mat3d *stress_tensor_3D_, *strain_tensor_3D_, *stress_rate_3D_, *strain_rate_3D_;
+    SymMat3d *stress_tensor_3D_, *strain_tensor_3D_, *stress_rate_3D_, *strain_rate_3D_;
     Matd *velocity_gradient_;
 };
 
@@ -151,7 +152,8 @@ class PlasticIntegration2ndHalf<Inner<>, RiemannSolverType>
 
   protected:
     RiemannSolverType riemann_solver_;
-    Real *Vol_, *mass_;
+    StorageReal *Vol_;
+    Real *mass_;
 };
 using PlasticIntegration2ndHalfInnerNoRiemann = PlasticIntegration2ndHalf<Inner<>, NoRiemannSolver>;
 using PlasticIntegration2ndHalfInnerRiemann = PlasticIntegration2ndHalf<Inner<>, AcousticRiemannSolver>;
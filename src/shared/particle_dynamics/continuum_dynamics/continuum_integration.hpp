@@ -22,16 +22,16 @@ template <class BaseRelationType>
 BasePlasticIntegration<DataDelegationType>::BasePlasticIntegration(BaseRelationType &base_relation)
     : fluid_dynamics::BaseIntegration<DataDelegationType>(base_relation),
       plastic_continuum_(DynamicCast<PlasticContinuum>(this, this->particles_->getBaseMaterial())),
-      stress_tensor_3D_(this->particles_->template registerStateVariable<Mat3d>("StressTensor3D")),
-      strain_tensor_3D_(this->particles_->template registerStateVariable<Mat3d>("StrainTensor3D")),
-      stress_rate_3D_(this->particles_->template registerStateVariable<Mat3d>("StressRate3D")),
-      strain_rate_3D_(this->particles_->template registerStateVariable<Mat3d>("StrainRate3D")),
+      stress_tensor_3D_(this->particles_->template registerStateVariable<SymMat3d>("StressTensor3D")),
+      strain_tensor_3D_(this->particles_->template registerStateVariable<SymMat3d>("StrainTensor3D")),
+      stress_rate_3D_(this->particles_->template registerStateVariable<SymMat3d>("StressRate3D")),
+      strain_rate_3D_(this->particles_->template registerStateVariable<SymMat3d>("StrainRate3D")),
       velocity_gradient_(this->particles_->template registerStateVariable<Matd>("VelocityGradient"))
 {
-    this->particles_->template addVariableToSort<Mat3d>("StrainTensor3D");
-    this->particles_->template addVariableToSort<Mat3d>("StressTensor3D");
-    this->particles_->template addVariableToSort<Mat3d>("StrainRate3D");
-    this->particles_->template addVariableToSort<Mat3d>("StressRate3D");
+    this->particles_->template addVariableToSort<SymMat3d>("StrainTensor3D");
+    this->particles_->template addVariableToSort<SymMat3d>("StressTensor3D");
+    this->particles_->template addVariableToSort<SymMat3d>("StrainRate3D");
+    this->particles_->template addVariableToSort<SymMat3d>("StressRate3D");
 }
 //=================================================================================================//
 template <class RiemannSolverType>
@@ -108,7 +108,7 @@ void PlasticIntegration1stHalf<Contact<Wall>, RiemannSolverType>::interaction(si
     for (size_t k = 0; k < this->contact_configuration_.size(); ++k)
     {
         Vecd *wall_acc_ave_k = wall_acc_ave_[k];
-        Real *wall_Vol_k = wall_Vol_[k];
+        StorageReal *wall_Vol_k = wall_Vol_[k];
         Neighborhood &wall_neighborhood = (*contact_configuration_[k])[index_i];
         for (size_t n = 0; n != wall_neighborhood.current_size_; ++n)
         {
@@ -136,7 +136,7 @@ template <class RiemannSolverType>
 PlasticIntegration2ndHalf<Inner<>, RiemannSolverType>::PlasticIntegration2ndHalf(BaseInnerRelation &inner_relation)
     : BasePlasticIntegration<DataDelegateInner>(inner_relation),
       riemann_solver_(plastic_continuum_, plastic_continuum_, 20.0 * (Real)Dimensions),
-      Vol_(particles_->getVariableDataByName<Real>("VolumetricMeasure")),
+      Vol_(particles_->getVariableDataByName<StorageReal>("VolumetricMeasure")),
       mass_(particles_->getVariableDataByName<Real>("Mass")) {}
 //=================================================================================================//
 template <class RiemannSolverType>
@@ -173,12 +173,13 @@ void PlasticIntegration2ndHalf<Inner<>, RiemannSolverType>::update(size_t index_
     rho_[index_i] += drho_dt_[index_i] * dt * 0.5;
     Vol_[index_i] = mass_[index_i] / rho_[index_i];
     Mat3d velocity_gradient = upgradeToMat3d(velocity_gradient_[index_i]);
-    Mat3d stress_tensor_rate_3D_ = plastic_continuum_.ConstitutiveRelation(velocity_gradient, stress_tensor_3D_[index_i]);
-    stress_rate_3D_[index_i] += stress_tensor_rate_3D_;
-    stress_tensor_3D_[index_i] += stress_rate_3D_[index_i] * dt;
+    Mat3d stress_tensor = stress_tensor_3D_[index_i].toMatrix();
+    Mat3d stress_tensor_rate_3D_ = plastic_continuum_.ConstitutiveRelation(velocity_gradient, stress_tensor);
+    stress_rate_3D_[index_i] += SymMat3d(stress_tensor_rate_3D_);
+    stress_tensor += stress_rate_3D_[index_i].toMatrix() * dt;
     /*return mapping*/
-    stress_tensor_3D_[index_i] = plastic_continuum_.ReturnMapping(stress_tensor_3D_[index_i]);
-    strain_rate_3D_[index_i] = 0.5 * (velocity_gradient + velocity_gradient.transpose());
+    stress_tensor_3D_[index_i] = SymMat3d(plastic_continuum_.ReturnMapping(stress_tensor));
+    strain_rate_3D_[index_i] = SymMat3d(velocity_gradient); // the symmetric part
     strain_tensor_3D_[index_i] += strain_rate_3D_[index_i] * dt;
 }
 //=================================================================================================//
@@ -199,7 +200,7 @@ void PlasticIntegration2ndHalf<Contact<Wall>, RiemannSolverType>::interaction(si
     {
         Vecd *vel_ave_k = wall_vel_ave_[k];
         Vecd *n_k = wall_n_[k];
-        Real *wall_Vol_k = wall_Vol_[k];
+        StorageReal *wall_Vol_k = wall_Vol_[k];
         Neighborhood &wall_neighborhood = (*contact_configuration_[k])[index_i];
         for (size_t n = 0; n != wall_neighborhood.current_size_; ++n)
         {
@@ -51,7 +51,8 @@ class OptimizationBySplittingAlgorithmBase
 
   protected:
     LocalIsotropicDiffusion &diffusion_;
-    Real *Vol_, *mass_;
+    StorageReal *Vol_;
+    Real *mass_;
     Vecd *normal_vector_;
     DataType *variable_;
     Real *heat_flux_, *heat_source_;
@@ -16,7 +16,7 @@ OptimizationBySplittingAlgorithmBase<DataType>::
     OptimizationBySplittingAlgorithmBase(BaseInnerRelation &inner_relation, const std::string &variable_name)
     : LocalDynamics(inner_relation.getSPHBody()), DataDelegateInner(inner_relation),
       diffusion_(DynamicCast<LocalIsotropicDiffusion>(this, sph_body_.getBaseMaterial())),
-      Vol_(this->particles_->template getVariableDataByName<Real>("VolumetricMeasure")),
+      Vol_(this->particles_->template getVariableDataByName<StorageReal>("VolumetricMeasure")),
       mass_(this->particles_->template getVariableDataByName<Real>("Mass")),
       normal_vector_(this->particles_->template getVariableDataByName<Vecd>("NormalDirection")),
       variable_(this->particles_->template registerStateVariable<DataType>(variable_name)),
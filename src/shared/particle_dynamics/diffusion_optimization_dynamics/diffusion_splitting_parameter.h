@@ -71,7 +71,8 @@ class ParameterSplittingByPDEWithBoundary
 
   protected:
     StdVec<Vecd *> boundary_normal_vector_;
-    StdVec<Real *> boundary_heat_flux_, boundary_Vol_;
+    StdVec<Real *> boundary_heat_flux_;
+    StdVec<StorageReal *> boundary_Vol_;
     StdVec<Real *> boundary_species_;
     virtual ErrorAndParameters<DataType> computeErrorAndParameters(size_t index_i, Real dt = 0.0) override;
 };
@@ -139,7 +139,7 @@ ParameterSplittingByPDEWithBoundary<DataType>::
     const std::string &species_name = this->diffusion_.DiffusionSpeciesName();
     for (size_t k = 0; k != this->contact_particles_.size(); ++k)
     {
-        boundary_Vol_.push_back(this->contact_particles_[k]->template registerStateVariable<Real>("VolumetricMeasure"));
+        boundary_Vol_.push_back(this->contact_particles_[k]->template registerStateVariable<StorageReal>("VolumetricMeasure"));
         boundary_normal_vector_.push_back(this->contact_particles_[k]->template getVariableDataByName<Vecd>("NormalDirection"));
         boundary_species_.push_back(this->contact_particles_[k]->template registerStateVariable<Real>(species_name));
         boundary_heat_flux_.push_back(this->contact_particles_[k]->template registerStateVariable<Real>("HeatFlux"));
@@ -158,7 +158,7 @@ ErrorAndParameters<DataType> ParameterSplittingByPDEWithBoundary<DataType>::
     {
         Real *heat_flux_k = this->boundary_heat_flux_[k];
         Vecd *normal_vector_k = this->boundary_normal_vector_[k];
-        Real *Vol_k = this->boundary_Vol_[k];
+        StorageReal *Vol_k = this->boundary_Vol_[k];
         Real *species_k = boundary_species_[k];
 
         Neighborhood &contact_neighborhood = (*this->contact_configuration_[k])[index_i];
@@ -72,7 +72,8 @@ class TemperatureSplittingByPDEWithBoundary
 
   protected:
     StdVec<DataType *> boundary_variable_;
-    StdVec<Real *> boundary_heat_flux_, boundary_Vol_;
+    StdVec<Real *> boundary_heat_flux_;
+    StdVec<StorageReal *> boundary_Vol_;
     StdVec<Vecd *> boundary_normal_vector_;
     virtual ErrorAndParameters<DataType> computeErrorAndParameters(size_t index_i, Real dt = 0.0) override;
 };
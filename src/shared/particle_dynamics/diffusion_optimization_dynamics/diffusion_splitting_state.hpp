@@ -83,7 +83,7 @@ TemperatureSplittingByPDEWithBoundary<DataType>::
     boundary_heat_flux_.resize(this->contact_particles_.size());
     for (size_t k = 0; k != this->contact_particles_.size(); ++k)
     {
-        boundary_Vol_.push_back(this->contact_particles_[k]->template registerStateVariable<Real>("VolumetricMeasure"));
+        boundary_Vol_.push_back(this->contact_particles_[k]->template registerStateVariable<StorageReal>("VolumetricMeasure"));
         boundary_normal_vector_.push_back(this->contact_particles_[k]->template getVariableDataByName<Vecd>("NormalDirection"));
         boundary_variable_.push_back(this->contact_particles_[k]->template registerStateVariable<DataType>(variable_name));
         boundary_heat_flux_[k] = this->contact_particles_[k]->template registerStateVariable<Real>("HeatFlux");
@@ -101,7 +101,7 @@ ErrorAndParameters<DataType> TemperatureSplittingByPDEWithBoundary<DataType>::
     /* contact interaction. */
     for (size_t k = 0; k < this->contact_configuration_.size(); ++k)
     {
-        Real *Vol_k = this->boundary_Vol_[k];
+        StorageReal *Vol_k = this->boundary_Vol_[k];
         Real *heat_flux_k = this->boundary_heat_flux_[k];
         Vecd *normal_vector_k = this->boundary_normal_vector_[k];
         DataType *variable_k = this->boundary_variable_[k];
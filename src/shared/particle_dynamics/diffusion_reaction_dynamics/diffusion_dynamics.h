@@ -60,7 +60,7 @@ class DiffusionRelaxation<DataDelegationType, DiffusionType>
 {
   protected:
     StdVec<DiffusionType *> diffusions_;
-    Real *Vol_;
+    StorageReal *Vol_;
     StdVec<Real *> diffusion_species_;
     StdVec<Real *> gradient_species_;
     StdVec<Real *> diffusion_dt_;
@@ -124,6 +124,8 @@ class DiffusionRelaxation<Inner<KernelGradientType>, DiffusionType>
 
     virtual ~DiffusionRelaxation(){};
     inline void interaction(size_t index_i, Real dt = 0.0);
+    /** The diagonal coefficient of the discrete operator, used for preconditioning implicit steps. */
+    Real getDiagonalCoefficient(size_t index_i, size_t m);
 };
 
 class KernelGradientContact
@@ -157,7 +159,7 @@ class DiffusionRelaxation<Contact<ContactKernelGradientType>, DiffusionType>
 {
   protected:
     StdVec<ContactKernelGradientType> contact_kernel_gradients_;
-    StdVec<Real *> contact_Vol_;
+    StdVec<StorageReal *> contact_Vol_;
     StdVec<StdVec<Real *>> contact_transfer_;
 
     void resetContactTransfer(size_t index_i);
@@ -310,6 +312,99 @@ class DiffusionRelaxationRK2 : public BaseDynamics<void>
     virtual void exec(Real dt = 0.0) override;
 };
 
+/** Whether the corrected kernel gradient, which gives a non-symmetric operator, is used in an interaction. */
+template <class T>
+struct uses_corrected_kernel_gradient : std::false_type
+{
+};
+
+template <>
+struct uses_corrected_kernel_gradient<CorrectedKernelGradientInner> : std::true_type
+{
+};
+
+template <>
+struct uses_corrected_kernel_gradient<CorrectedKernelGradientContact> : std::true_type
+{
+};
+
+template <template <typename...> class InteractionName, typename... Parameters>
+struct uses_corrected_kernel_gradient<InteractionName<Parameters...>>
+    : std::disjunction<uses_corrected_kernel_gradient<Parameters>...>
+{
+};
+
+/**
+ * @class ImplicitDiffusionStep
+ * @brief The matrix-free operator for implicit diffusion integration.
+ * @details The diffusion relaxation is reused as the discrete operator R(phi),
+ * which is affine in the species, i.e. R(phi) = J phi + b with b = R(0).
+ * The work variables of the preconditioned conjugate gradient iteration are registered here.
+ * As the operator is applied by overwriting the species,
+ * the diffusion species and the gradient species are required to be the same.
+ * The operator is required to be symmetric, so that the corrected kernel gradient is not allowed.
+ */
+template <class DiffusionRelaxationType>
+class ImplicitDiffusionStep : public DiffusionRelaxationType
+{
+    static_assert(!uses_corrected_kernel_gradient<DiffusionRelaxationType>::value,
+                  "ImplicitDiffusionStep: the conjugate gradient method requires a symmetric operator, "
+                  "which is not given by the corrected kernel gradient.");
+
+  protected:
+    StdVec<Real *> solution_;
+    StdVec<Real *> right_hand_side_;
+    StdVec<Real *> residual_;
+    StdVec<Real *> preconditioned_residual_;
+    StdVec<Real *> search_direction_;
+    StdVec<Real *> boundary_rate_;
+    StdVec<Real *> diagonal_;
+
+  public:
+    template <typename... Args>
+    ImplicitDiffusionStep(Args &&... args);
+    virtual ~ImplicitDiffusionStep(){};
+};
+
+/**
+ * @class DiffusionRelaxationImplicit
+ * @brief The implicit theta scheme for diffusion, which is not limited by the explicit time step size.
+ * @details The system (I - theta dt J) phi^{n+1} = phi^n + (1 - theta) dt R(phi^n) + theta dt b
+ * is solved by a Jacobi preconditioned conjugate gradient method with volume-weighted inner products,
+ * in which the operator is symmetric. Theta is 1 for backward Euler and 0.5 for Crank-Nicolson.
+ * The Jacobi diagonal is obtained from the inner interaction and from R(1) - R(0) for boundary conditions,
+ * so that the first interaction of DiffusionRelaxationType should be the inner one.
+ */
+template <class DiffusionRelaxationType, class ExecutionPolicy = ParallelPolicy>
+class DiffusionRelaxationImplicit
+    : public Dynamics1Level<ImplicitDiffusionStep<DiffusionRelaxationType>, ExecutionPolicy>
+{
+  protected:
+    Real theta_;
+    Real tolerance_;
+    UnsignedInt max_iterations_;
+    UnsignedInt iterations_; /**< the number of iterations of the last step */
+    bool is_converged_;      /**< whether all species converged in the last step */
+
+    void evaluateChangeRate(Real dt);
+    void assignSpecies(Real value);
+    void assignSpecies(StdVec<Real *> &species);
+    Real weightedDotProduct(Real *variable_a, Real *variable_b);
+
+  public:
+    template <typename... Args>
+    explicit DiffusionRelaxationImplicit(Args &&... args);
+    virtual ~DiffusionRelaxationImplicit(){};
+
+    void setTheta(Real theta) { theta_ = theta; };
+    void setTolerance(Real tolerance) { tolerance_ = tolerance; };
+    void setMaxIterations(UnsignedInt max_iterations) { max_iterations_ = max_iterations; };
+    UnsignedInt Iterations() { return iterations_; };
+    bool isConverged() { return is_converged_; };
+
+    virtual void exec(Real dt = 0.0) override;
+};
+
 template <class DiffusionType, class KernelGradientType, class ContactKernelGradientType,
           template <typename... Parameters> typename... ContactInteractionTypes>
 class DiffusionBodyRelaxationComplex
@@ -327,5 +422,12 @@ class DiffusionBodyRelaxationComplex
                                  DiffusionType>>(first_arg, std::forward<OtherArgs>(other_args)...){};
     virtual ~DiffusionBodyRelaxationComplex(){};
 };
+
+template <class DiffusionType, class KernelGradientType, class ContactKernelGradientType,
+          template <typename... Parameters> typename... ContactInteractionTypes>
+using DiffusionBodyRelaxationComplexImplicit =
+    DiffusionRelaxationImplicit<ComplexInteraction<DiffusionRelaxation<
+                                                       Inner<KernelGradientType>, ContactInteractionTypes<ContactKernelGradientType>...>,
+                                                   DiffusionType>>;
 } // namespace SPH
 #endif // DIFFUSION_DYNAMICS_H
@@ -27,7 +27,7 @@ DiffusionRelaxation<DataDelegationType, DiffusionType>::
     DiffusionRelaxation(BodyRelationType &body_relation, StdVec<DiffusionType *> diffusions)
     : LocalDynamics(body_relation.getSPHBody()), DataDelegationType(body_relation),
       diffusions_(diffusions),
-      Vol_(this->particles_->template getVariableDataByName<Real>("VolumetricMeasure"))
+      Vol_(this->particles_->template getVariableDataByName<StorageReal>("VolumetricMeasure"))
 {
     for (auto &diffusion : diffusions_)
     {
@@ -106,6 +106,26 @@ void DiffusionRelaxation<Inner<KernelGradientType>, DiffusionType>::interaction(
     }
 }
 //=================================================================================================//
+template <class KernelGradientType, class DiffusionType>
+Real DiffusionRelaxation<Inner<KernelGradientType>, DiffusionType>::
+    getDiagonalCoefficient(size_t index_i, size_t m)
+{
+    auto diffusion_m = this->diffusions_[m];
+    Real diagonal = 0.0;
+    Neighborhood &inner_neighborhood = this->inner_configuration_[index_i];
+    for (size_t n = 0; n != inner_neighborhood.current_size_; ++n)
+    {
+        size_t index_j = inner_neighborhood.j_[n];
+        Real dW_ijV_j = inner_neighborhood.dW_ij_[n] * this->Vol_[index_j];
+        Vecd &e_ij = inner_neighborhood.e_ij_[n];
+
+        Real diff_coeff_ij = diffusion_m->getInterParticleDiffusionCoeff(index_i, index_j, e_ij);
+        const Vecd &grad_ijV_j = this->kernel_gradient_(index_i, index_j, dW_ijV_j, e_ij);
+        diagonal += diff_coeff_ij * 2.0 * grad_ijV_j.dot(e_ij) / inner_neighborhood.r_ij_[n];
+    }
+    return diagonal;
+}
+//=================================================================================================//
 template <class ContactKernelGradientType, class DiffusionType>
 template <typename... Args>
 DiffusionRelaxation<Contact<ContactKernelGradientType>, DiffusionType>::
@@ -118,7 +138,7 @@ DiffusionRelaxation<Contact<ContactKernelGradientType>, DiffusionType>::
     {
         BaseParticles *contact_particles_k = this->contact_particles_[k];
         contact_kernel_gradients_.push_back(ContactKernelGradientType(this->particles_, contact_particles_k));
-        contact_Vol_.push_back(contact_particles_k->template registerStateVariable<Real>("VolumetricMeasure"));
+        contact_Vol_.push_back(contact_particles_k->template registerStateVariable<StorageReal>("VolumetricMeasure"));
 
         std::string diffusion_direction = "From" + this->contact_bodies_[k]->getName();
         for (auto &diffusion : this->diffusions_)
@@ -197,7 +217,7 @@ void DiffusionRelaxation<Dirichlet<ContactKernelGradientType>, DiffusionType>::
     for (size_t k = 0; k < this->contact_configuration_.size(); ++k)
     {
         StdVec<Real *> &gradient_species_k = this->contact_gradient_species_[k];
-        Real *wall_Vol_k = this->contact_Vol_[k];
+        StorageReal *wall_Vol_k = this->contact_Vol_[k];
         Neighborhood &contact_neighborhood = (*this->contact_configuration_[k])[index_i];
         for (size_t n = 0; n != contact_neighborhood.current_size_; ++n)
         {
@@ -256,7 +276,7 @@ void DiffusionRelaxation<Neumann<ContactKernelGradientType>, DiffusionType>::
     {
         StdVec<Real *> &diffusive_flux_k = contact_diffusive_flux_[k];
         Vecd *n_k = contact_n_[k];
-        Real *Vol_k = this->contact_Vol_[k];
+        StorageReal *Vol_k = this->contact_Vol_[k];
         Neighborhood &contact_neighborhood = (*this->contact_configuration_[k])[index_i];
         for (size_t n = 0; n != contact_neighborhood.current_size_; ++n)
         {
@@ -323,7 +343,7 @@ void DiffusionRelaxation<Robin<ContactKernelGradientType>, DiffusionType>::
     for (size_t k = 0; k < this->contact_configuration_.size(); ++k)
     {
         Vecd *n_k = contact_n_[k];
-        Real *Vol_k = this->contact_Vol_[k];
+        StorageReal *Vol_k = this->contact_Vol_[k];
         StdVec<Real *> &transfer_k = this->contact_transfer_[k];
         StdVec<Real *> &convection_k = contact_convection_[k];
         StdVec<Real *> &species_infinity_k = contact_species_infinity_[k];
@@ -404,5 +424,211 @@ void DiffusionRelaxationRK2<DiffusionRelaxationType>::exec(Real dt)
     rk2_2nd_stage_.exec(dt);
 }
 //=================================================================================================//
+template <class DiffusionRelaxationType>
+template <typename... Args>
+ImplicitDiffusionStep<DiffusionRelaxationType>::ImplicitDiffusionStep(Args &&...args)
+    : DiffusionRelaxationType(std::forward<Args>(args)...)
+{
+    for (auto &diffusion : this->diffusions_)
+    {
+        std::string diffusion_species_name = diffusion->DiffusionSpeciesName();
+        if (diffusion_species_name != diffusion->GradientSpeciesName())
+        {
+            std::cout << "\n Error: implicit diffusion requires the same diffusion and gradient species, "
+                      << diffusion_species_name << " and " << diffusion->GradientSpeciesName() << "!" << std::endl;
+            std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+            exit(1);
+        }
+        solution_.push_back(
+            this->particles_->template registerStateVariable<Real>(diffusion_species_name + "ImplicitSolution"));
+        right_hand_side_.push_back(
+            this->particles_->template registerStateVariable<Real>(diffusion_species_name + "RightHandSide"));
+        residual_.push_back(
+            this->particles_->template registerStateVariable<Real>(diffusion_species_name + "Residual"));
+        preconditioned_residual_.push_back(
+            this->particles_->template registerStateVariable<Real>(diffusion_species_name + "PreconditionedResidual"));
+        search_direction_.push_back(
+            this->particles_->template registerStateVariable<Real>(diffusion_species_name + "SearchDirection"));
+        boundary_rate_.push_back(
+            this->particles_->template registerStateVariable<Real>(diffusion_species_name + "BoundaryChangeRate"));
+        diagonal_.push_back(
+            this->particles_->template registerStateVariable<Real>(diffusion_species_name + "JacobiDiagonal"));
+    }
+}
+//=================================================================================================//
+template <class DiffusionRelaxationType, class ExecutionPolicy>
+template <typename... Args>
+DiffusionRelaxationImplicit<DiffusionRelaxationType, ExecutionPolicy>::
+    DiffusionRelaxationImplicit(Args &&...args)
+    : Dynamics1Level<ImplicitDiffusionStep<DiffusionRelaxationType>, ExecutionPolicy>(
+          std::forward<Args>(args)...),
+      theta_(1.0), tolerance_(1.0e-8), max_iterations_(100), iterations_(0), is_converged_(true) {}
+//=================================================================================================//
+template <class DiffusionRelaxationType, class ExecutionPolicy>
+void DiffusionRelaxationImplicit<DiffusionRelaxationType, ExecutionPolicy>::evaluateChangeRate(Real dt)
+{
+    particle_for(ExecutionPolicy(), this->identifier_.LoopRange(),
+                 [&](size_t i)
+                 { this->initialization(i, dt); });
+    this->runInteraction(dt);
+}
+//=================================================================================================//
+template <class DiffusionRelaxationType, class ExecutionPolicy>
+void DiffusionRelaxationImplicit<DiffusionRelaxationType, ExecutionPolicy>::assignSpecies(Real value)
+{
+    particle_for(ExecutionPolicy(), this->identifier_.LoopRange(),
+                 [&](size_t i)
+                 {
+                     for (size_t m = 0; m < this->diffusions_.size(); ++m)
+                         this->diffusion_species_[m][i] = value;
+                 });
+}
+//=================================================================================================//
+template <class DiffusionRelaxationType, class ExecutionPolicy>
+void DiffusionRelaxationImplicit<DiffusionRelaxationType, ExecutionPolicy>::
+    assignSpecies(StdVec<Real *> &species)
+{
+    particle_for(ExecutionPolicy(), this->identifier_.LoopRange(),
+                 [&](size_t i)
+                 {
+                     for (size_t m = 0; m < this->diffusions_.size(); ++m)
+                         this->diffusion_species_[m][i] = species[m][i];
+                 });
+}
+//=================================================================================================//
+template <class DiffusionRelaxationType, class ExecutionPolicy>
+Real DiffusionRelaxationImplicit<DiffusionRelaxationType, ExecutionPolicy>::
+    weightedDotProduct(Real *variable_a, Real *variable_b)
+{
+    return particle_reduce(ExecutionPolicy(), this->identifier_.LoopRange(), Real(0), ReduceSum<Real>(),
+                           [&](size_t i) -> Real
+                           { return this->Vol_[i] * variable_a[i] * variable_b[i]; });
+}
+//=================================================================================================//
+template <class DiffusionRelaxationType, class ExecutionPolicy>
+void DiffusionRelaxationImplicit<DiffusionRelaxationType, ExecutionPolicy>::exec(Real dt)
+{
+    this->setUpdated(this->identifier_.getSPHBody());
+    this->setupDynamics(dt);
+
+    size_t number_of_species = this->diffusions_.size();
+    Real theta_dt = theta_ * dt;
+    Real explicit_dt = (1.0 - theta_) * dt;
+    /** The explicit part of the right hand side, with R(phi^n) kept in the residual. */
+    evaluateChangeRate(dt);
+    particle_for(ExecutionPolicy(), this->identifier_.LoopRange(),
+                 [&](size_t i)
+                 {
+                     for (size_t m = 0; m < number_of_species; ++m)
+                     {
+                         this->solution_[m][i] = this->diffusion_species_[m][i];
+                         this->residual_[m][i] = this->diffusion_dt_[m][i];
+                         this->right_hand_side_[m][i] =
+                             this->diffusion_species_[m][i] + explicit_dt * this->diffusion_dt_[m][i];
+                     }
+                 });
+    /** The boundary diagonal from R(1) - R(0) and the affine part b = R(0). */
+    assignSpecies(1.0);
+    evaluateChangeRate(dt);
+    particle_for(ExecutionPolicy(), this->identifier_.LoopRange(),
+                 [&](size_t i)
+                 {
+                     for (size_t m = 0; m < number_of_species; ++m)
+                         this->diagonal_[m][i] = this->diffusion_dt_[m][i];
+                 });
+    assignSpecies(0.0);
+    evaluateChangeRate(dt);
+    particle_for(ExecutionPolicy(), this->identifier_.LoopRange(),
+                 [&](size_t i)
+                 {
+                     for (size_t m = 0; m < number_of_species; ++m)
+                     {
+                         Real boundary_rate = this->diffusion_dt_[m][i];
+                         this->boundary_rate_[m][i] = boundary_rate;
+                         this->diagonal_[m][i] = 1.0 - theta_dt * (this->diagonal_[m][i] - boundary_rate +
+                                                                   this->getDiagonalCoefficient(i, m));
+                         this->right_hand_side_[m][i] += theta_dt * boundary_rate;
+                         Real operator_solution = this->solution_[m][i] -
+                                                  theta_dt * (this->residual_[m][i] - boundary_rate);
+                         Real residual = this->right_hand_side_[m][i] - operator_solution;
+                         this->residual_[m][i] = residual;
+                         this->preconditioned_residual_[m][i] = residual / this->diagonal_[m][i];
+                         this->search_direction_[m][i] = this->preconditioned_residual_[m][i];
+                     }
+                 });
+
+    StdVec<Real> residual_dot_preconditioned(number_of_species);
+    StdVec<Real> criterion(number_of_species);
+    StdVec<bool> is_converged(number_of_species);
+    for (size_t m = 0; m < number_of_species; ++m)
+    {
+        residual_dot_preconditioned[m] = weightedDotProduct(this->residual_[m], this->preconditioned_residual_[m]);
+        Real rhs_norm = sqrt(weightedDotProduct(this->right_hand_side_[m], this->right_hand_side_[m]));
+        criterion[m] = tolerance_ * SMAX(rhs_norm, TinyReal);
+        is_converged[m] = sqrt(weightedDotProduct(this->residual_[m], this->residual_[m])) < criterion[m];
+    }
+
+    iterations_ = 0;
+    while (iterations_ < max_iterations_ &&
+           std::find(is_converged.begin(), is_converged.end(), false) != is_converged.end())
+    {
+        /** The operator applied to the search direction is kept in the change rate. */
+        assignSpecies(this->search_direction_);
+        evaluateChangeRate(dt);
+        particle_for(ExecutionPolicy(), this->identifier_.LoopRange(),
+                     [&](size_t i)
+                     {
+                         for (size_t m = 0; m < number_of_species; ++m)
+                         {
+                             this->diffusion_dt_[m][i] = this->search_direction_[m][i] -
+                                                         theta_dt * (this->diffusion_dt_[m][i] - this->boundary_rate_[m][i]);
+                         }
+                     });
+
+        for (size_t m = 0; m < number_of_species; ++m)
+        {
+            if (is_converged[m])
+                continue;
+
+            Real *solution = this->solution_[m];
+            Real *residual = this->residual_[m];
+            Real *preconditioned_residual = this->preconditioned_residual_[m];
+            Real *search_direction = this->search_direction_[m];
+            Real *operator_direction = this->diffusion_dt_[m];
+            Real *diagonal = this->diagonal_[m];
+
+            Real alpha = residual_dot_preconditioned[m] /
+                         (weightedDotProduct(search_direction, operator_direction) + TinyReal);
+            particle_for(ExecutionPolicy(), this->identifier_.LoopRange(),
+                         [&](size_t i)
+                         {
+                             solution[i] += alpha * search_direction[i];
+                             residual[i] -= alpha * operator_direction[i];
+                             preconditioned_residual[i] = residual[i] / diagonal[i];
+                         });
+
+            is_converged[m] = sqrt(weightedDotProduct(residual, residual)) < criterion[m];
+            if (!is_converged[m])
+            {
+                Real new_residual_dot_preconditioned = weightedDotProduct(residual, preconditioned_residual);
+                Real beta = new_residual_dot_preconditioned / residual_dot_preconditioned[m];
+                residual_dot_preconditioned[m] = new_residual_dot_preconditioned;
+                particle_for(ExecutionPolicy(), this->identifier_.LoopRange(),
+                             [&](size_t i)
+                             { search_direction[i] = preconditioned_residual[i] + beta * search_direction[i]; });
+            }
+        }
+        iterations_++;
+    }
+
+    is_converged_ = std::find(is_converged.begin(), is_converged.end(), false) == is_converged.end();
+    if (!is_converged_)
+    {
+        std::cout << "\n Warning: implicit diffusion of " << this->identifier_.getName()
+                  << " is not converged within " << max_iterations_ << " iterations!" << std::endl;
+    }
+    assignSpecies(this->solution_);
+}
+//=================================================================================================//
 } // namespace SPH
 #endif // DIFFUSION_DYNAMICS_HPP
\ No newline at end of file
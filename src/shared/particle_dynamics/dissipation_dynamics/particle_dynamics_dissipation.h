@@ -94,7 +94,7 @@ class Damping<Base, DataType, DampingRateType, DataDelegationType>
     typedef DataType DampingVariable;
     std::string name_;
     DampingRateType damping_;
-    Real *Vol_;
+    StorageReal *Vol_;
     DataType *data_field_;
 };
 
@@ -143,6 +143,29 @@ class Damping<Inner<Pairwise>, DataType, DampingRateType>
 template <typename DataType, typename DampingRateType>
 using DampingPairwiseInner = Damping<Inner<Pairwise>, DataType, DampingRateType>;
 
+/**
+ * @class Jacobi
+ * @brief Particle-wise operator splitting method solving for particle i with its neighbors fixed.
+ * As only particle i is updated, all particles of the same color are relaxed simultaneously
+ * as in a Jacobi iteration, while the colors are swept in Gauss-Seidel order.
+ * It is to be used with InteractionMultiColorSplit.
+ * Note that, different from the pairwise method, it is not strictly conservative.
+ */
+class Jacobi;
+template <typename DataType, typename DampingRateType>
+class Damping<Inner<Jacobi>, DataType, DampingRateType>
+    : public Damping<Base, DataType, DampingRateType, DataDelegateInner>
+{
+  public:
+    template <typename... Args>
+    Damping(Args &&...args)
+        : Damping<Base, DataType, DampingRateType, DataDelegateInner>(std::forward<Args>(args)...){};
+    virtual ~Damping(){};
+    void interaction(size_t index_i, Real dt = 0.0);
+};
+template <typename DataType, typename DampingRateType>
+using DampingJacobiInner = Damping<Inner<Jacobi>, DataType, DampingRateType>;
+
 template <typename DataType, typename DampingRateType>
 class Damping<Contact<Pairwise>, DataType, DampingRateType>
     : public Damping<Base, DataType, DampingRateType, DataDelegateContact>
@@ -153,7 +176,7 @@ class Damping<Contact<Pairwise>, DataType, DampingRateType>
     virtual ~Damping(){};
 
   protected:
-    StdVec<Real *> contact_Vol_;
+    StdVec<StorageReal *> contact_Vol_;
     StdVec<DataType *> contact_data_field_;
 };
 template <typename DataType, typename DampingRateType>
@@ -12,7 +12,7 @@ Damping<Base, DataType, DampingRateType, DataDelegationType>::
     Damping(BaseRelationType &base_relation, const std::string &name, Args &&...args)
     : LocalDynamics(base_relation.getSPHBody()), DataDelegationType(base_relation), OperatorSplitting(),
       name_(name), damping_(this->particles_, std::forward<Args>(args)...),
-      Vol_(this->particles_->template getVariableDataByName<Real>("VolumetricMeasure")),
+      Vol_(this->particles_->template getVariableDataByName<StorageReal>("VolumetricMeasure")),
       data_field_(this->particles_->template getVariableDataByName<DataType>(name)) {}
 //=================================================================================================//
 template <typename DataType, typename DampingRateType>
@@ -76,7 +76,7 @@ Damping<Contact<Pairwise>, DataType, DampingRateType>::Damping(Args &&...args)
 {
     for (auto &particles : this->contact_particles_)
     {
-        contact_Vol_.push_back(particles->template getVariableDataByName<Real>("VolumetricMeasure"));
+        contact_Vol_.push_back(particles->template getVariableDataByName<StorageReal>("VolumetricMeasure"));
         contact_data_field_.push_back(particles->template getVariableDataByName<DataType>(this->name_));
     }
 }
@@ -120,6 +120,28 @@ void Damping<Inner<Pairwise>, DataType, DampingRateType>::interaction(size_t ind
 }
 //=================================================================================================//
 template <typename DataType, typename DampingRateType>
+void Damping<Inner<Jacobi>, DataType, DampingRateType>::interaction(size_t index_i, Real dt)
+{
+    Real Vol_i = this->Vol_[index_i];
+    Real capacity_i = this->damping_.Capacity(index_i);
+
+    // implicit in particle i: capacity_i * (data_i^new - data_i) = sum_j parameter_b * (data_i^new - data_j)
+    DataType weighted_sum = capacity_i * this->data_field_[index_i];
+    Real diagonal = capacity_i;
+    Neighborhood &inner_neighborhood = this->inner_configuration_[index_i];
+    for (size_t n = 0; n != inner_neighborhood.current_size_; ++n)
+    {
+        size_t index_j = inner_neighborhood.j_[n];
+        Real parameter_b = 2.0 * this->damping_.DampingRate(index_i, index_j) * inner_neighborhood.dW_ij_[n] *
+                           Vol_i * this->Vol_[index_j] * dt / inner_neighborhood.r_ij_[n];
+
+        weighted_sum -= parameter_b * this->data_field_[index_j];
+        diagonal -= parameter_b;
+    }
+    this->data_field_[index_i] = weighted_sum / diagonal;
+}
+//=================================================================================================//
+template <typename DataType, typename DampingRateType>
 void Damping<Contact<Pairwise, Wall>, DataType, DampingRateType>::interaction(size_t index_i, Real dt)
 {
 
@@ -129,7 +151,7 @@ void Damping<Contact<Pairwise, Wall>, DataType, DampingRateType>::interaction(si
     for (size_t k = 0; k < this->contact_configuration_.size(); ++k)
     {
         DataType *data_field_k = this->contact_data_field_[k];
-        Real *Vol_k = this->contact_Vol_[k];
+        StorageReal *Vol_k = this->contact_Vol_[k];
         Neighborhood &contact_neighborhood = (*this->contact_configuration_[k])[index_i];
 
         for (size_t n = 0; n != contact_neighborhood.current_size_; ++n) // forward sweep
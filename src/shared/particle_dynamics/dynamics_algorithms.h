@@ -25,10 +25,11 @@
  * @brief 	This is the classes for algorithms particle dynamics .
  * @detail	Generally, there are two types of particle dynamics algorithms.
  *			One leads to the change of particle states, the other not.
- *			There are 5 classes the first type. They are:
+ *			There are 6 classes the first type. They are:
  * 			SimpleDynamics is without particle interaction. Particles just update their states;
  *			InteractionDynamics is with particle interaction with its neighbors;
  *			InteractionSplit is InteractionDynamics but using spliting algorithm;
+ *			InteractionMultiColorSplit is InteractionSplit but sweeping over particle colors;
  *			InteractionWithUpdate is with particle interaction with its neighbors and then update their states;
  *			Dynamics1Level is the most complex dynamics, has successive three steps: initialization, interaction and update.
  *			In order to avoid misusing of the above algorithms, type traits are used to make sure that the matching between
@@ -53,6 +54,7 @@
 #include "base_local_dynamics.h"
 #include "base_particle_dynamics.h"
 #include "cell_linked_list.hpp"
+#include "particle_coloring.hpp"
 #include "particle_iterators.h"
 
 #include <type_traits>
@@ -227,6 +229,52 @@ using InteractionSplit = BaseInteractionSplit<LocalDynamicsType, CellLinkedList>
 template <class LocalDynamicsType>
 using InteractionAdaptiveSplit = BaseInteractionSplit<LocalDynamicsType, MultilevelCellLinkedList>;
 
+/**
+ * @class BaseInteractionColoredSplit
+ * @brief The splitting algorithm sweeping over the colors of the particle conflict graph
+ * built from the inner neighbor lists, instead of the 3^d split cells.
+ * The colors are updated only after the configuration of the inner relation has been updated.
+ */
+template <class LocalDynamicsType, class ParticleColoringType, class ExecutionPolicy = ParallelPolicy>
+class BaseInteractionColoredSplit : public BaseInteractionDynamics<LocalDynamicsType, ExecutionPolicy>
+{
+  protected:
+    ParticleColoringType particle_coloring_;
+    UnsignedInt colored_configuration_updates_; /**< configuration updates of the inner relation when colored */
+    bool is_colored_;
+
+  public:
+    template <typename... Args>
+    explicit BaseInteractionColoredSplit(Args &&...args)
+        : BaseInteractionDynamics<LocalDynamicsType, ExecutionPolicy>(std::forward<Args>(args)...),
+          particle_coloring_(this->inner_configuration_), colored_configuration_updates_(0), is_colored_(false)
+    {
+        static_assert(!has_initialize<LocalDynamicsType>::value &&
+                          !has_update<LocalDynamicsType>::value,
+                      "LocalDynamicsType does not fulfill InteractionMultiColorSplit requirements");
+    };
+
+    ParticleColoringType &getParticleColoring() { return particle_coloring_; };
+
+    /** run the main interaction step between particles. */
+    void runMainStep(Real dt) override
+    {
+        UnsignedInt configuration_updates = this->getBodyRelation().TotalConfigurationUpdates();
+        if (!is_colored_ || configuration_updates != colored_configuration_updates_)
+        {
+            particle_coloring_.updateColors(this->identifier_.SizeOfLoopRange());
+            colored_configuration_updates_ = configuration_updates;
+            is_colored_ = true;
+        }
+        particle_coloring_.particle_for_split(ExecutionPolicy(), [&](size_t i)
+                                              { this->interaction(i, dt * 0.5); });
+    }
+};
+
+/** For interactions updating particle i only, the multi-color Gauss-Seidel sweeping. */
+template <class LocalDynamicsType>
+using InteractionMultiColorSplit = BaseInteractionColoredSplit<LocalDynamicsType, GatherParticleColoring>;
+
 /**
  * @class InteractionDynamics
  * @brief This is the class with a single step of particle interaction with other particles
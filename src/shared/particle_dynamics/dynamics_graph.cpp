@@ -0,0 +1,92 @@
+#include "dynamics_graph.h"
+
+#include "tbb/task_arena.h"
+
+namespace SPH
+{
+//=================================================================================================//
+template <class NodeBody>
+size_t DynamicsGraph::createNode(const NodeBody &node_body,
+                                 const StdVec<Entity *> &reads, const StdVec<Entity *> &writes)
+{
+    size_t node_index = nodes_.size();
+    StdVec<size_t> predecessors;
+    for (Entity *variable : reads)
+    {
+        if (last_writer_.find(variable) != last_writer_.end())
+            addPredecessor(predecessors, last_writer_[variable]);
+    }
+    for (Entity *variable : writes)
+    {
+        if (last_writer_.find(variable) != last_writer_.end())
+            addPredecessor(predecessors, last_writer_[variable]);
+        for (size_t reader : readers_[variable])
+            addPredecessor(predecessors, reader);
+    }
+    for (Entity *variable : writes)
+    {
+        last_writer_[variable] = node_index;
+        readers_[variable].clear();
+    }
+    for (Entity *variable : reads)
+        readers_[variable].push_back(node_index);
+
+    // isolation keeps a thread waiting inside a dynamics from picking up another node of the graph
+    nodes_.push_back(flow_node_ptrs_.createPtr<FlowNode>(
+        graph_, [=](const tbb::flow::continue_msg &)
+        { tbb::this_task_arena::isolate(node_body); }));
+    for (size_t predecessor : predecessors)
+        tbb::flow::make_edge(*nodes_[predecessor], *nodes_.back());
+    predecessors_.push_back(predecessors);
+    results_.push_back(0.0);
+    return node_index;
+}
+//=================================================================================================//
+void DynamicsGraph::addPredecessor(StdVec<size_t> &predecessors, size_t node_index)
+{
+    if (std::find(predecessors.begin(), predecessors.end(), node_index) == predecessors.end())
+        predecessors.push_back(node_index);
+}
+//=================================================================================================//
+size_t DynamicsGraph::addNode(BaseDynamics<void> &dynamics,
+                              const StdVec<Entity *> &reads, const StdVec<Entity *> &writes)
+{
+    BaseDynamics<void> *dynamics_ptr = &dynamics;
+    Real *dt = &dt_;
+    return createNode([=]()
+                      { dynamics_ptr->exec(*dt); },
+                      reads, writes);
+}
+//=================================================================================================//
+size_t DynamicsGraph::addNode(BaseDynamics<Real> &dynamics,
+                              const StdVec<Entity *> &reads, const StdVec<Entity *> &writes)
+{
+    BaseDynamics<Real> *dynamics_ptr = &dynamics;
+    Real *dt = &dt_;
+    StdVec<Real> *results = &results_;
+    size_t node_index = nodes_.size();
+    return createNode([=]()
+                      { (*results)[node_index] = dynamics_ptr->exec(*dt); },
+                      reads, writes);
+}
+//=================================================================================================//
+size_t DynamicsGraph::NumberOfEdges()
+{
+    size_t number_of_edges = 0;
+    for (size_t k = 0; k != predecessors_.size(); ++k)
+        number_of_edges += predecessors_[k].size();
+    return number_of_edges;
+}
+//=================================================================================================//
+void DynamicsGraph::exec(Real dt)
+{
+    dt_ = dt;
+    for (size_t k = 0; k != nodes_.size(); ++k)
+    {
+        if (predecessors_[k].empty())
+            nodes_[k]->try_put(tbb::flow::continue_msg());
+    }
+    graph_.wait_for_all();
+}
+//=================================================================================================//
+} // namespace SPH
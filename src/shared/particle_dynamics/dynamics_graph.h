@@ -0,0 +1,78 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2023 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file 	dynamics_graph.h
+ * @brief 	Concurrent execution of particle dynamics by a task graph.
+ * @details The dynamics are added in the order of their serial execution,
+ *          together with the variables they read and write.
+ *          A dynamics depends on the last earlier writer of any variable it reads or writes,
+ *          and on the earlier readers of any variable it writes since the last write.
+ *          Independent dynamics, such as the cell linked lists of different bodies,
+ *          are executed concurrently. The graph is built once and replayed by each exec.
+ * @author	Xiangyu Hu
+ */
+
+#ifndef DYNAMICS_GRAPH_H
+#define DYNAMICS_GRAPH_H
+
+#include "base_particle_dynamics.h"
+
+#include "tbb/flow_graph.h"
+
+namespace SPH
+{
+class DynamicsGraph : public BaseDynamics<void>
+{
+    using FlowNode = tbb::flow::continue_node<tbb::flow::continue_msg>;
+
+  public:
+    DynamicsGraph() : BaseDynamics<void>(){};
+    virtual ~DynamicsGraph(){};
+
+    size_t addNode(BaseDynamics<void> &dynamics, const StdVec<Entity *> &reads, const StdVec<Entity *> &writes);
+    /** The result of the dynamics, such as a time-step size, is obtained by Result(node_index) after exec. */
+    size_t addNode(BaseDynamics<Real> &dynamics, const StdVec<Entity *> &reads, const StdVec<Entity *> &writes);
+    Real Result(size_t node_index) { return results_[node_index]; };
+    size_t NumberOfNodes() { return nodes_.size(); };
+    size_t NumberOfEdges();
+    const StdVec<size_t> &Predecessors(size_t node_index) { return predecessors_[node_index]; };
+
+    virtual void exec(Real dt = 0.0) override;
+
+  protected:
+    tbb::flow::graph graph_;
+    UniquePtrsKeeper<FlowNode> flow_node_ptrs_;
+    StdVec<FlowNode *> nodes_;
+    StdVec<StdVec<size_t>> predecessors_;
+    StdVec<Real> results_;
+    Real dt_ = 0.0;
+    /** the last writer and the readers since then for each variable */
+    std::map<Entity *, size_t> last_writer_;
+    std::map<Entity *, StdVec<size_t>> readers_;
+
+    template <class NodeBody>
+    size_t createNode(const NodeBody &node_body, const StdVec<Entity *> &reads, const StdVec<Entity *> &writes);
+    void addPredecessor(StdVec<size_t> &predecessors, size_t node_index);
+};
+} // namespace SPH
+#endif // DYNAMICS_GRAPH_H
@@ -62,6 +62,40 @@ class ElectroPhysiologyReaction : public BaseReactionModel<3>
     virtual ~ElectroPhysiologyReaction(){};
 
     void initializeElectroPhysiologyReaction();
+
+    /**
+     * Statically dispatched rates for the computing kernels.
+     * The rates are templated on the scalar type,
+     * so that they are evaluated for a single particle or for a batch of particles.
+     */
+    class ReactionKernel
+    {
+      public:
+        explicit ReactionKernel(ElectroPhysiologyReaction &reaction)
+            : k_a_(reaction.k_a_), voltage_(reaction.voltage_),
+              gate_variable_(reaction.gate_variable_),
+              active_contraction_stress_(reaction.active_contraction_stress_){};
+
+      protected:
+        Real k_a_;
+        size_t voltage_;
+        size_t gate_variable_;
+        size_t active_contraction_stress_;
+
+        template <typename ScalarType>
+        ScalarType LossRateActiveContractionStress(const std::array<ScalarType, 3> &species) const
+        {
+            ScalarType voltage_dim = species[voltage_] * 100.0 - 80.0;
+            return 0.1 + (1.0 - 0.1) * exp(-exp(-voltage_dim));
+        };
+
+        template <typename ScalarType>
+        ScalarType ProductionRateActiveContractionStress(const std::array<ScalarType, 3> &species) const
+        {
+            ScalarType voltage_dim = species[voltage_] * 100.0 - 80.0;
+            return LossRateActiveContractionStress(species) * k_a_ * (voltage_dim + 80.0);
+        };
+    };
 };
 
 /**
@@ -89,6 +123,45 @@ class AlievPanfilowModel : public ElectroPhysiologyReaction
         reaction_model_ = "AlievPanfilowModel";
     };
     virtual ~AlievPanfilowModel(){};
+
+    class ReactionKernel : public ElectroPhysiologyReaction::ReactionKernel
+    {
+      public:
+        explicit ReactionKernel(AlievPanfilowModel &model)
+            : ElectroPhysiologyReaction::ReactionKernel(model),
+              k_(model.k_), a_(model.a_), b_(model.b_), mu_1_(model.mu_1_), mu_2_(model.mu_2_),
+              epsilon_(model.epsilon_), c_m_(model.c_m_){};
+
+        template <typename ScalarType>
+        ScalarType ProductionRate(size_t k, const std::array<ScalarType, 3> &species) const
+        {
+            const ScalarType &voltage = species[voltage_];
+            if (k == voltage_)
+                return -k_ * voltage * (voltage * voltage - a_ * voltage - voltage) / c_m_;
+            if (k == gate_variable_)
+                return -LossRateGateVariable(species) * k_ * voltage * (voltage - b_ - 1.0);
+            return ProductionRateActiveContractionStress(species);
+        };
+
+        template <typename ScalarType>
+        ScalarType LossRate(size_t k, const std::array<ScalarType, 3> &species) const
+        {
+            if (k == voltage_)
+                return (k_ * a_ + species[gate_variable_]) / c_m_;
+            if (k == gate_variable_)
+                return LossRateGateVariable(species);
+            return LossRateActiveContractionStress(species);
+        };
+
+      protected:
+        Real k_, a_, b_, mu_1_, mu_2_, epsilon_, c_m_;
+
+        template <typename ScalarType>
+        ScalarType LossRateGateVariable(const std::array<ScalarType, 3> &species) const
+        {
+            return epsilon_ + mu_1_ * species[gate_variable_] / (mu_2_ + species[voltage_] + Eps);
+        };
+    };
 };
 
 /**
@@ -63,14 +63,14 @@ class InteractionWithWall : public BaseInteractionType<DataDelegateContact>
             wall_vel_ave_.push_back(solid_material.AverageVelocity(this->contact_particles_[k]));
             wall_acc_ave_.push_back(solid_material.AverageAcceleration(this->contact_particles_[k]));
             wall_n_.push_back(this->contact_particles_[k]->template getVariableDataByName<Vecd>("NormalDirection"));
-            wall_Vol_.push_back(this->contact_particles_[k]->template getVariableDataByName<Real>("VolumetricMeasure"));
+            wall_Vol_.push_back(this->contact_particles_[k]->template getVariableDataByName<StorageReal>("VolumetricMeasure"));
         }
     };
     virtual ~InteractionWithWall(){};
 
   protected:
     StdVec<Vecd *> wall_vel_ave_, wall_acc_ave_, wall_n_;
-    StdVec<Real *> wall_Vol_;
+    StdVec<StorageReal *> wall_Vol_;
 };
 
 } // namespace fluid_dynamics
@@ -7,7 +7,7 @@ namespace fluid_dynamics
 //=================================================================================================//
 BaseFlowBoundaryCondition::BaseFlowBoundaryCondition(BodyPartByCell &body_part)
     : BaseLocalDynamics<BodyPartByCell>(body_part),
-      rho_(particles_->getVariableDataByName<Real>("Density")),
+      rho_(particles_->getVariableDataByName<StorageReal>("Density")),
       p_(particles_->getVariableDataByName<Real>("Pressure")),
       pos_(particles_->getVariableDataByName<Vecd>("Position")),
       vel_(particles_->getVariableDataByName<Vecd>("Velocity")){};
@@ -39,7 +39,7 @@ EmitterInflowCondition::
       pos_(particles_->getVariableDataByName<Vecd>("Position")),
       vel_(particles_->getVariableDataByName<Vecd>("Velocity")),
       force_(particles_->getVariableDataByName<Vecd>("Force")),
-      rho_(particles_->getVariableDataByName<Real>("Density")),
+      rho_(particles_->getVariableDataByName<StorageReal>("Density")),
       p_(particles_->getVariableDataByName<Real>("Pressure")),
       drho_dt_(particles_->getVariableDataByName<Real>("DensityChangeRate")),
       inflow_pressure_(0), rho0_(fluid_.ReferenceDensity()),
@@ -65,7 +65,7 @@ EmitterInflowInjection::
       original_id_(particles_->ParticleOriginalIds()),
       sorted_id_(particles_->ParticleSortedIds()),
       pos_(particles_->getVariableDataByName<Vecd>("Position")),
-      rho_(particles_->getVariableDataByName<Real>("Density")),
+      rho_(particles_->getVariableDataByName<StorageReal>("Density")),
       p_(particles_->getVariableDataByName<Real>("Pressure")),
       buffer_(buffer), aligned_box_(aligned_box_part.getAlignedBoxShape())
 {
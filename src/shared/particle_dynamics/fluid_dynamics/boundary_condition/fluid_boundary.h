@@ -50,7 +50,8 @@ class BaseFlowBoundaryCondition : public BaseLocalDynamics<BodyPartByCell>
     virtual ~BaseFlowBoundaryCondition(){};
 
   protected:
-    Real *rho_, *p_;
+    StorageReal *rho_;
+    Real *p_;
     Vecd *pos_, *vel_;
 };
 
@@ -129,7 +130,7 @@ class FreeStreamVelocityCorrection : public LocalDynamics
   protected:
     Transform transform_;
     Real rho0_;
-    Real *rho_sum_;
+    StorageReal *rho_sum_;
     Vecd *pos_, *vel_;
     int *indicator_;
     TargetVelocity target_velocity;
@@ -139,7 +140,7 @@ class FreeStreamVelocityCorrection : public LocalDynamics
     explicit FreeStreamVelocityCorrection(SPHBody &sph_body, const Transform &transform = Transform())
         : LocalDynamics(sph_body),
           transform_(transform), rho0_(DynamicCast<Fluid>(this, particles_->getBaseMaterial()).ReferenceDensity()),
-          rho_sum_(particles_->getVariableDataByName<Real>("DensitySummation")),
+          rho_sum_(particles_->getVariableDataByName<StorageReal>("DensitySummation")),
           pos_(particles_->getVariableDataByName<Vecd>("Position")),
           vel_(particles_->getVariableDataByName<Vecd>("Velocity")),
           indicator_(particles_->getVariableDataByName<int>("Indicator")),
@@ -156,7 +157,7 @@ class FreeStreamVelocityCorrection : public LocalDynamics
             Real frame_u_stream_direction = frame_velocity[0];
             Real u_freestream = target_velocity(frame_position, frame_velocity, *physical_time_)[0];
             frame_velocity[0] = u_freestream + (frame_u_stream_direction - u_freestream) *
-                                                   SMIN(rho_sum_[index_i], rho0_) / rho0_;
+                                                   SMIN(Real(rho_sum_[index_i]), rho0_) / rho0_;
             vel_[index_i] = transform_.xformFrameVecToBase(frame_velocity);
         }
     };
@@ -200,7 +201,8 @@ class EmitterInflowCondition : public BaseLocalDynamics<BodyPartByParticle>
     Fluid &fluid_;
     UnsignedInt *sorted_id_;
     Vecd *pos_, *vel_, *force_;
-    Real *rho_, *p_, *drho_dt_;
+    StorageReal *rho_;
+    Real *p_, *drho_dt_;
     /** inflow pressure condition */
     Real inflow_pressure_;
     Real rho0_;
@@ -232,7 +234,8 @@ class EmitterInflowInjection : public BaseLocalDynamics<BodyPartByParticle>
     UnsignedInt *original_id_;
     UnsignedInt *sorted_id_;
     Vecd *pos_;
-    Real *rho_, *p_;
+    StorageReal *rho_;
+    Real *p_;
     ParticleBuffer<Base> &buffer_;
     AlignedBoxShape &aligned_box_;
 };
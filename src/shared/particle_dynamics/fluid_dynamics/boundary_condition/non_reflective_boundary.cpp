@@ -10,9 +10,9 @@ NonReflectiveBoundaryCorrection::NonReflectiveBoundaryCorrection(BaseInnerRelati
     : LocalDynamics(inner_relation.getSPHBody()), DataDelegateInner(inner_relation),
       fluid_(DynamicCast<WeaklyCompressibleFluid>(this, particles_->getBaseMaterial())),
       rho_farfield_(0.0), sound_speed_(0.0), vel_farfield_(Vecd::Zero()),
-      rho_(particles_->getVariableDataByName<Real>("Density")),
+      rho_(particles_->getVariableDataByName<StorageReal>("Density")),
       p_(particles_->getVariableDataByName<Real>("Pressure")),
-      Vol_(particles_->getVariableDataByName<Real>("VolumetricMeasure")),
+      Vol_(particles_->getVariableDataByName<StorageReal>("VolumetricMeasure")),
       mass_(particles_->getVariableDataByName<Real>("Mass")),
       vel_(particles_->getVariableDataByName<Vecd>("Velocity")),
       mom_(particles_->getVariableDataByName<Vecd>("Momentum")),
@@ -48,7 +48,10 @@ class NonReflectiveBoundaryCorrection : public LocalDynamics, public DataDelegat
     Fluid &fluid_;
     Real rho_farfield_, sound_speed_;
     Vecd vel_farfield_;
-    Real *rho_, *p_, *Vol_, *mass_;
+    StorageReal *rho_;
+    Real *p_;
+    StorageReal *Vol_;
+    Real *mass_;
     Vecd *vel_, *mom_, *pos_;
     Real *inner_weight_summation_, *rho_average_, *vel_normal_average_;
     Vecd *vel_tangential_average_, *vel_average_;
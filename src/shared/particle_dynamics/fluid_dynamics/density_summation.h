@@ -51,7 +51,9 @@ class DensitySummation<Base, DataDelegationType>
     virtual ~DensitySummation(){};
 
   protected:
-    Real *rho_, *mass_, *rho_sum_, *Vol_;
+    StorageReal *rho_;
+    Real *mass_;
+    StorageReal *rho_sum_, *Vol_;
     Real rho0_, inv_sigma0_, W0_;
 };
 
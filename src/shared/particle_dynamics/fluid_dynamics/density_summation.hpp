@@ -11,10 +11,10 @@ template <class DataDelegationType>
 template <class BaseRelationType>
 DensitySummation<Base, DataDelegationType>::DensitySummation(BaseRelationType &base_relation)
     : LocalDynamics(base_relation.getSPHBody()), DataDelegationType(base_relation),
-      rho_(this->particles_->template getVariableDataByName<Real>("Density")),
+      rho_(this->particles_->template getVariableDataByName<StorageReal>("Density")),
       mass_(this->particles_->template getVariableDataByName<Real>("Mass")),
-      rho_sum_(this->particles_->template registerStateVariable<Real>("DensitySummation")),
-      Vol_(this->particles_->template getVariableDataByName<Real>("VolumetricMeasure")),
+      rho_sum_(this->particles_->template registerStateVariable<StorageReal>("DensitySummation")),
+      Vol_(this->particles_->template getVariableDataByName<StorageReal>("VolumetricMeasure")),
       rho0_(this->sph_body_.base_material_->ReferenceDensity()),
       inv_sigma0_(1.0 / this->sph_body_.sph_adaptation_->LatticeNumberDensity()),
       W0_(this->sph_body_.sph_adaptation_->getKernel()->W0(ZeroVecd)) {}
@@ -27,7 +27,7 @@ DensitySummation<Inner<FreeSurface, SummationType...>>::DensitySummation(Args &&
 template <typename... SummationType>
 void DensitySummation<Inner<FreeSurface, SummationType...>>::update(size_t index_i, Real dt)
 {
-    this->rho_[index_i] = SMAX(this->rho_sum_[index_i], this->rho0_);
+    this->rho_[index_i] = SMAX(Real(this->rho_sum_[index_i]), this->rho0_);
 }
 //=================================================================================================//
 template <typename NearSurfaceType, typename... SummationType>
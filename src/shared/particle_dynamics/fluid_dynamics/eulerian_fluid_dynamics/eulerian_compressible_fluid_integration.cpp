@@ -8,7 +8,7 @@ namespace fluid_dynamics
 BaseIntegrationInCompressible::BaseIntegrationInCompressible(BaseInnerRelation &inner_relation)
     : BaseIntegration(inner_relation),
       compressible_fluid_(CompressibleFluid(1.0, 1.4)),
-      Vol_(particles_->getVariableDataByName<Real>("VolumetricMeasure")),
+      Vol_(particles_->getVariableDataByName<StorageReal>("VolumetricMeasure")),
       E_(particles_->registerStateVariable<Real>("TotalEnergy")),
       dE_dt_(particles_->registerStateVariable<Real>("TotalEnergyChangeRate")),
       dmass_dt_(particles_->registerStateVariable<Real>("MassChangeRate")),
@@ -19,8 +19,8 @@ BaseIntegrationInCompressible::BaseIntegrationInCompressible(BaseInnerRelation &
 CompressibleFluidInitialCondition::CompressibleFluidInitialCondition(SPHBody &sph_body)
     : FluidInitialCondition(sph_body),
       mom_(particles_->getVariableDataByName<Vecd>("Momentum")),
-      rho_(particles_->getVariableDataByName<Real>("Density")),
-      Vol_(particles_->getVariableDataByName<Real>("VolumetricMeasure")),
+      rho_(particles_->getVariableDataByName<StorageReal>("Density")),
+      Vol_(particles_->getVariableDataByName<StorageReal>("VolumetricMeasure")),
       mass_(particles_->getVariableDataByName<Real>("Mass")),
       p_(particles_->getVariableDataByName<Real>("Pressure")),
       E_(particles_->getVariableDataByName<Real>("TotalEnergy")) {}
@@ -28,7 +28,7 @@ CompressibleFluidInitialCondition::CompressibleFluidInitialCondition(SPHBody &sp
 EulerianCompressibleAcousticTimeStepSize::
     EulerianCompressibleAcousticTimeStepSize(SPHBody &sph_body, Real acousticCFL)
     : AcousticTimeStep(sph_body),
-      rho_(particles_->getVariableDataByName<Real>("Density")),
+      rho_(particles_->getVariableDataByName<StorageReal>("Density")),
       p_(particles_->getVariableDataByName<Real>("Pressure")),
       vel_(particles_->getVariableDataByName<Vecd>("Velocity")),
       smoothing_length_(sph_body.sph_adaptation_->ReferenceSmoothingLength()),
@@ -49,7 +49,8 @@ class BaseIntegrationInCompressible : public BaseIntegration<DataDelegateInner>
 
   protected:
     CompressibleFluid compressible_fluid_;
-    Real *Vol_, *E_, *dE_dt_, *dmass_dt_;
+    StorageReal *Vol_;
+    Real *E_, *dE_dt_, *dmass_dt_;
     Vecd *mom_, *force_, *force_prior_;
 };
 
@@ -92,13 +93,15 @@ class CompressibleFluidInitialCondition : public FluidInitialCondition
 
   protected:
     Vecd *mom_;
-    Real *rho_, *Vol_, *mass_, *p_, *E_;
+    StorageReal *rho_, *Vol_;
+    Real *mass_, *p_, *E_;
 };
 
 class EulerianCompressibleAcousticTimeStepSize : public AcousticTimeStep
 {
   protected:
-    Real *rho_, *p_;
+    StorageReal *rho_;
+    Real *p_;
     Vecd *vel_;
     Real smoothing_length_;
 
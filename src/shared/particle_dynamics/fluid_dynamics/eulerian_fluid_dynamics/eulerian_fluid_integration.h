@@ -45,7 +45,8 @@ class EulerianIntegration : public BaseIntegration<DataDelegationType>
 
   protected:
     Vecd *mom_, *dmom_dt_;
-    Real *dmass_dt_, *Vol_;
+    Real *dmass_dt_;
+    StorageReal *Vol_;
 };
 
 template <typename... InteractionTypes>
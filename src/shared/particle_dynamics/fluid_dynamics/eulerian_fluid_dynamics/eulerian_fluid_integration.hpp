@@ -15,7 +15,7 @@ EulerianIntegration<DataDelegationType>::EulerianIntegration(BaseRelationType &b
       mom_(this->particles_->template registerStateVariable<Vecd>("Momentum")),
       dmom_dt_(this->particles_->template registerStateVariable<Vecd>("MomentumChangeRate")),
       dmass_dt_(this->particles_->template registerStateVariable<Real>("MassChangeRate")),
-      Vol_(this->particles_->template getVariableDataByName<Real>("VolumetricMeasure")) {}
+      Vol_(this->particles_->template getVariableDataByName<StorageReal>("VolumetricMeasure")) {}
 //=================================================================================================//
 template <class RiemannSolverType>
 EulerianIntegration1stHalf<Inner<>, RiemannSolverType>::
@@ -64,7 +64,7 @@ void EulerianIntegration1stHalf<Contact<Wall>, RiemannSolverType>::interaction(s
     for (size_t k = 0; k < contact_configuration_.size(); ++k)
     {
         Vecd *n_k = wall_n_[k];
-        Real *Vol_k = wall_Vol_[k];
+        StorageReal *Vol_k = wall_Vol_[k];
         Vecd *vel_ave_k = wall_vel_ave_[k];
         Neighborhood &wall_neighborhood = (*contact_configuration_[k])[index_i];
         for (size_t n = 0; n != wall_neighborhood.current_size_; ++n)
@@ -75,7 +75,7 @@ void EulerianIntegration1stHalf<Contact<Wall>, RiemannSolverType>::interaction(s
 
             Vecd vel_in_wall = 2.0 * vel_ave_k[index_j] - state_i.vel_;
             Real p_in_wall = state_i.p_;
-            Real rho_in_wall = state_i.rho_;
+            StorageReal rho_in_wall = state_i.rho_;
             FluidStateIn state_j(rho_in_wall, vel_in_wall, p_in_wall);
             FluidStateOut interface_state = riemann_solver_.InterfaceState(state_i, state_j, n_k[index_j]);
             Matd convect_flux = interface_state.rho_ * interface_state.vel_ * interface_state.vel_.transpose();
@@ -132,7 +132,7 @@ void EulerianIntegration2ndHalf<Contact<Wall>, RiemannSolverType>::interaction(s
     for (size_t k = 0; k < contact_configuration_.size(); ++k)
     {
         Vecd *n_k = this->wall_n_[k];
-        Real *Vol_k = this->wall_Vol_[k];
+        StorageReal *Vol_k = this->wall_Vol_[k];
         Vecd *vel_ave_k = wall_vel_ave_[k];
         Neighborhood &wall_neighborhood = (*contact_configuration_[k])[index_i];
         for (size_t n = 0; n != wall_neighborhood.current_size_; ++n)
@@ -143,7 +143,7 @@ void EulerianIntegration2ndHalf<Contact<Wall>, RiemannSolverType>::interaction(s
 
             Vecd vel_in_wall = 2.0 * vel_ave_k[index_j] - state_i.vel_;
             Real p_in_wall = state_i.p_;
-            Real rho_in_wall = state_i.rho_;
+            StorageReal rho_in_wall = state_i.rho_;
 
             FluidStateIn state_j(rho_in_wall, vel_in_wall, p_in_wall);
             FluidStateOut interface_state = this->riemann_solver_.InterfaceState(state_i, state_j, n_k[index_j]);
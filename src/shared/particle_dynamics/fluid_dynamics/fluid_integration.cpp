@@ -13,9 +13,9 @@ FluidInitialCondition::
 //=================================================================================================//
 ContinuumVolumeUpdate::ContinuumVolumeUpdate(SPHBody &sph_body)
     : LocalDynamics(sph_body),
-      Vol_(particles_->getVariableDataByName<Real>("VolumetricMeasure")),
+      Vol_(particles_->getVariableDataByName<StorageReal>("VolumetricMeasure")),
       mass_(particles_->getVariableDataByName<Real>("Mass")),
-      rho_(particles_->getVariableDataByName<Real>("Density")) {}
+      rho_(particles_->getVariableDataByName<StorageReal>("Density")) {}
 //=================================================================================================//
 } // namespace fluid_dynamics
 } // namespace SPH
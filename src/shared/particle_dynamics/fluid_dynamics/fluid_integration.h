@@ -63,7 +63,9 @@ class ContinuumVolumeUpdate : public LocalDynamics
     }
 
   protected:
-    Real *Vol_, *mass_, *rho_;
+    StorageReal *Vol_;
+    Real *mass_;
+    StorageReal *rho_;
 };
 
 template <class DataDelegationType>
@@ -76,7 +78,8 @@ class BaseIntegration : public LocalDynamics, public DataDelegationType
 
   protected:
     Fluid &fluid_;
-    Real *Vol_, *rho_, *mass_, *p_, *drho_dt_;
+    StorageReal *Vol_, *rho_;
+    Real *mass_, *p_, *drho_dt_;
     Vecd *pos_, *vel_, *force_, *force_prior_;
 };
 
@@ -134,11 +137,52 @@ class Integration1stHalf<Contact<>, RiemannSolverType, KernelCorrectionType>
     StdVec<KernelCorrectionType> contact_corrections_;
     StdVec<RiemannSolverType> riemann_solvers_;
     StdVec<Real *> contact_p_;
-    StdVec<Real *> contact_Vol_;
+    StdVec<StorageReal *> contact_Vol_;
 };
 
-template <class RiemannSolverType, class KernelCorrectionType>
-using Integration1stHalfWithWall = ComplexInteraction<Integration1stHalf<Inner<>, Contact<Wall>>, RiemannSolverType, KernelCorrectionType>;
+/**
+ * @brief The specializations with the fluid type as the last parameter
+ * evaluate the pressure by the equation-of-state kernel of the fluid type,
+ * so that no virtual function is called in the particle loop.
+ */
+template <class RiemannSolverType, class KernelCorrectionType, class FluidType>
+class Integration1stHalf<Inner<>, RiemannSolverType, KernelCorrectionType, FluidType>
+    : public Integration1stHalf<Inner<>, RiemannSolverType, KernelCorrectionType>
+{
+    using EosKernel = typename FluidType::EosKernel;
+
+  public:
+    explicit Integration1stHalf(BaseInnerRelation &inner_relation);
+    virtual ~Integration1stHalf(){};
+    void initialization(size_t index_i, Real dt = 0.0);
+
+  protected:
+    EosKernel eos_;
+};
+
+template <class RiemannSolverType, class KernelCorrectionType, class FluidType>
+class Integration1stHalf<Contact<Wall>, RiemannSolverType, KernelCorrectionType, FluidType>
+    : public Integration1stHalf<Contact<Wall>, RiemannSolverType, KernelCorrectionType>
+{
+  public:
+    explicit Integration1stHalf(BaseContactRelation &wall_contact_relation)
+        : Integration1stHalf<Contact<Wall>, RiemannSolverType, KernelCorrectionType>(wall_contact_relation){};
+    virtual ~Integration1stHalf(){};
+};
+
+template <class RiemannSolverType, class KernelCorrectionType, class FluidType>
+class Integration1stHalf<Contact<>, RiemannSolverType, KernelCorrectionType, FluidType>
+    : public Integration1stHalf<Contact<>, RiemannSolverType, KernelCorrectionType>
+{
+  public:
+    explicit Integration1stHalf(BaseContactRelation &contact_relation)
+        : Integration1stHalf<Contact<>, RiemannSolverType, KernelCorrectionType>(contact_relation){};
+    virtual ~Integration1stHalf(){};
+};
+
+template <class RiemannSolverType, class KernelCorrectionType, class... FluidType>
+using Integration1stHalfWithWall =
+    ComplexInteraction<Integration1stHalf<Inner<>, Contact<Wall>>, RiemannSolverType, KernelCorrectionType, FluidType...>;
 
 using Integration1stHalfWithWallNoRiemann = Integration1stHalfWithWall<NoRiemannSolver, NoKernelCorrection>;
 using Integration1stHalfWithWallRiemann = Integration1stHalfWithWall<AcousticRiemannSolver, NoKernelCorrection>;
@@ -165,7 +209,8 @@ class Integration2ndHalf<Inner<>, RiemannSolverType>
 
   protected:
     RiemannSolverType riemann_solver_;
-    Real *mass_, *Vol_;
+    Real *mass_;
+    StorageReal *Vol_;
 };
 using Integration2ndHalfInnerRiemann = Integration2ndHalf<Inner<>, AcousticRiemannSolver>;
 using Integration2ndHalfInnerNoRiemann = Integration2ndHalf<Inner<>, NoRiemannSolver>;
@@ -195,7 +240,7 @@ class Integration2ndHalf<Contact<>, RiemannSolverType>
 
   protected:
     StdVec<RiemannSolverType> riemann_solvers_;
-    StdVec<Real *> contact_Vol_;
+    StdVec<StorageReal *> contact_Vol_;
     StdVec<Vecd *> contact_vel_;
 };
 
@@ -12,8 +12,8 @@ template <class BaseRelationType>
 BaseIntegration<DataDelegationType>::BaseIntegration(BaseRelationType &base_relation)
     : LocalDynamics(base_relation.getSPHBody()), DataDelegationType(base_relation),
       fluid_(DynamicCast<Fluid>(this, this->particles_->getBaseMaterial())),
-      Vol_(this->particles_->template getVariableDataByName<Real>("VolumetricMeasure")),
-      rho_(this->particles_->template getVariableDataByName<Real>("Density")),
+      Vol_(this->particles_->template getVariableDataByName<StorageReal>("VolumetricMeasure")),
+      rho_(this->particles_->template getVariableDataByName<StorageReal>("Density")),
       mass_(this->particles_->template getVariableDataByName<Real>("Mass")),
       p_(this->particles_->template registerStateVariable<Real>("Pressure")),
       drho_dt_(this->particles_->template registerStateVariable<Real>("DensityChangeRate")),
@@ -39,14 +39,14 @@ Integration1stHalf<Inner<>, RiemannSolverType, KernelCorrectionType>::
     particles_->addVariableToSort<Vecd>("ForcePrior");
     particles_->addVariableToSort<Vecd>("Force");
     particles_->addVariableToSort<Real>("DensityChangeRate");
-    particles_->addVariableToSort<Real>("Density");
+    particles_->addVariableToSort<StorageReal>("Density");
     particles_->addVariableToSort<Real>("Pressure");
-    particles_->addVariableToSort<Real>("VolumetricMeasure");
+    particles_->addVariableToSort<StorageReal>("VolumetricMeasure");
     //----------------------------------------------------------------------
     //		add restart output particle data
     //----------------------------------------------------------------------
     particles_->addVariableToRestart<Vecd>("Position");
-    particles_->addVariableToRestart<Real>("VolumetricMeasure");
+    particles_->addVariableToRestart<StorageReal>("VolumetricMeasure");
     particles_->addVariableToRestart<Real>("Pressure");
     particles_->addVariableToRestart<Real>("DensityChangeRate");
     particles_->addVariableToRestart<Vecd>("Velocity");
@@ -91,6 +91,21 @@ void Integration1stHalf<Inner<>, RiemannSolverType, KernelCorrectionType>::inter
     drho_dt_[index_i] = rho_dissipation * rho_[index_i];
 }
 //=================================================================================================//
+template <class RiemannSolverType, class KernelCorrectionType, class FluidType>
+Integration1stHalf<Inner<>, RiemannSolverType, KernelCorrectionType, FluidType>::
+    Integration1stHalf(BaseInnerRelation &inner_relation)
+    : Integration1stHalf<Inner<>, RiemannSolverType, KernelCorrectionType>(inner_relation),
+      eos_(ExactCast<FluidType>(this, this->fluid_)) {}
+//=================================================================================================//
+template <class RiemannSolverType, class KernelCorrectionType, class FluidType>
+void Integration1stHalf<Inner<>, RiemannSolverType, KernelCorrectionType, FluidType>::
+    initialization(size_t index_i, Real dt)
+{
+    this->rho_[index_i] += this->drho_dt_[index_i] * dt * 0.5;
+    this->p_[index_i] = eos_.getPressure(this->rho_[index_i]);
+    this->pos_[index_i] += this->vel_[index_i] * dt * 0.5;
+}
+//=================================================================================================//
 template <class RiemannSolverType, class KernelCorrectionType>
 Integration1stHalf<Contact<Wall>, RiemannSolverType, KernelCorrectionType>::
     Integration1stHalf(BaseContactRelation &wall_contact_relation)
@@ -105,7 +120,7 @@ void Integration1stHalf<Contact<Wall>, RiemannSolverType, KernelCorrectionType>:
     for (size_t k = 0; k < contact_configuration_.size(); ++k)
     {
         Vecd *wall_acc_ave_k = wall_acc_ave_[k];
-        Real *wall_Vol_k = wall_Vol_[k];
+        StorageReal *wall_Vol_k = wall_Vol_[k];
         Neighborhood &wall_neighborhood = (*contact_configuration_[k])[index_i];
         for (size_t n = 0; n != wall_neighborhood.current_size_; ++n)
         {
@@ -136,7 +151,7 @@ Integration1stHalf<Contact<>, RiemannSolverType, KernelCorrectionType>::
         Fluid &contact_fluid = DynamicCast<Fluid>(this, this->contact_particles_[k]->getBaseMaterial());
         riemann_solvers_.push_back(RiemannSolverType(this->fluid_, contact_fluid));
         contact_p_.push_back(this->contact_particles_[k]->template registerStateVariable<Real>("Pressure"));
-        contact_Vol_.push_back(this->contact_particles_[k]->template getVariableDataByName<Real>("VolumetricMeasure"));
+        contact_Vol_.push_back(this->contact_particles_[k]->template getVariableDataByName<StorageReal>("VolumetricMeasure"));
     }
 }
 //=================================================================================================//
@@ -149,7 +164,7 @@ void Integration1stHalf<Contact<>, RiemannSolverType, KernelCorrectionType>::
     for (size_t k = 0; k < this->contact_configuration_.size(); ++k)
     {
         Real *p_k = this->contact_p_[k];
-        Real *Vol_k = this->contact_Vol_[k];
+        StorageReal *Vol_k = this->contact_Vol_[k];
         KernelCorrectionType &correction_k = contact_corrections_[k];
         RiemannSolverType &riemann_solver_k = riemann_solvers_[k];
         Neighborhood &contact_neighborhood = (*this->contact_configuration_[k])[index_i];
@@ -173,7 +188,7 @@ Integration2ndHalf<Inner<>, RiemannSolverType>::
     Integration2ndHalf(BaseInnerRelation &inner_relation)
     : BaseIntegration<DataDelegateInner>(inner_relation), riemann_solver_(this->fluid_, this->fluid_),
       mass_(particles_->getVariableDataByName<Real>("Mass")),
-      Vol_(particles_->getVariableDataByName<Real>("VolumetricMeasure")) {}
+      Vol_(particles_->getVariableDataByName<StorageReal>("VolumetricMeasure")) {}
 //=================================================================================================//
 template <class RiemannSolverType>
 void Integration2ndHalf<Inner<>, RiemannSolverType>::initialization(size_t index_i, Real dt)
@@ -222,7 +237,7 @@ void Integration2ndHalf<Contact<Wall>, RiemannSolverType>::interaction(size_t in
     {
         Vecd *vel_ave_k = wall_vel_ave_[k];
         Vecd *n_k = wall_n_[k];
-        Real *wall_Vol_k = wall_Vol_[k];
+        StorageReal *wall_Vol_k = wall_Vol_[k];
         Neighborhood &wall_neighborhood = (*contact_configuration_[k])[index_i];
         for (size_t n = 0; n != wall_neighborhood.current_size_; ++n)
         {
@@ -250,7 +265,7 @@ Integration2ndHalf<Contact<>, RiemannSolverType>::
         Fluid &contact_fluid = DynamicCast<Fluid>(this, contact_particles_[k]->getBaseMaterial());
         riemann_solvers_.push_back(RiemannSolverType(fluid_, contact_fluid));
         contact_vel_.push_back(contact_particles_[k]->template registerStateVariable<Vecd>("Velocity"));
-        contact_Vol_.push_back(contact_particles_[k]->template getVariableDataByName<Real>("VolumetricMeasure"));
+        contact_Vol_.push_back(contact_particles_[k]->template getVariableDataByName<StorageReal>("VolumetricMeasure"));
     }
 }
 //=================================================================================================//
@@ -262,7 +277,7 @@ void Integration2ndHalf<Contact<>, RiemannSolverType>::interaction(size_t index_
     for (size_t k = 0; k < this->contact_configuration_.size(); ++k)
     {
         Vecd *vel_k = this->contact_vel_[k];
-        Real *Vol_k = this->contact_Vol_[k];
+        StorageReal *Vol_k = this->contact_Vol_[k];
         RiemannSolverType &riemann_solver_k = riemann_solvers_[k];
         Neighborhood &contact_neighborhood = (*this->contact_configuration_[k])[index_i];
         for (size_t n = 0; n != contact_neighborhood.current_size_; ++n)
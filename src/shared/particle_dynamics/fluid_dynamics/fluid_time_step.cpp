@@ -8,7 +8,7 @@ namespace fluid_dynamics
 AcousticTimeStep::AcousticTimeStep(SPHBody &sph_body, Real acousticCFL)
     : LocalDynamicsReduce<ReduceMax>(sph_body),
       fluid_(DynamicCast<Fluid>(this, particles_->getBaseMaterial())),
-      rho_(particles_->getVariableDataByName<Real>("Density")),
+      rho_(particles_->getVariableDataByName<StorageReal>("Density")),
       p_(particles_->getVariableDataByName<Real>("Pressure")),
       mass_(particles_->getVariableDataByName<Real>("Mass")),
       vel_(particles_->getVariableDataByName<Vecd>("Velocity")),
@@ -19,9 +19,7 @@ AcousticTimeStep::AcousticTimeStep(SPHBody &sph_body, Real acousticCFL)
 //=================================================================================================//
 Real AcousticTimeStep::reduce(size_t index_i, Real dt)
 {
-    Real acceleration_scale = 4.0 * h_min_ *
-                              (force_[index_i] + force_prior_[index_i]).norm() / mass_[index_i];
-    return SMAX(fluid_.getSoundSpeed(p_[index_i], rho_[index_i]) + vel_[index_i].norm(), acceleration_scale);
+    return reduce(index_i, dt, fluid_.getSoundSpeed(p_[index_i], rho_[index_i]));
 }
 //=================================================================================================//
 Real AcousticTimeStep::outputResult(Real reduced_value)
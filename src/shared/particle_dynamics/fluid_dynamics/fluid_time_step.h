@@ -48,16 +48,47 @@ class AcousticTimeStep : public LocalDynamicsReduce<ReduceMax>
     explicit AcousticTimeStep(SPHBody &sph_body, Real acousticCFL = 0.6);
     virtual ~AcousticTimeStep(){};
     Real reduce(size_t index_i, Real dt = 0.0);
+    /** reduce with a given sound speed, so that derived classes may evaluate it without virtual calls */
+    Real reduce(size_t index_i, Real dt, Real sound_speed)
+    {
+        Real acceleration_scale = 4.0 * h_min_ *
+                                  (force_[index_i] + force_prior_[index_i]).norm() / mass_[index_i];
+        return SMAX(sound_speed + vel_[index_i].norm(), acceleration_scale);
+    };
     virtual Real outputResult(Real reduced_value) override;
 
   protected:
     Fluid &fluid_;
-    Real *rho_, *p_, *mass_;
+    StorageReal *rho_;
+    Real *p_, *mass_;
     Vecd *vel_, *force_, *force_prior_;
     Real h_min_;
     Real acousticCFL_;
 };
 
+/**
+ * @class AcousticTimeStepEos
+ * @brief Computing the acoustic time step size with the equation-of-state kernel of the fluid type.
+ */
+template <class FluidType>
+class AcousticTimeStepEos : public AcousticTimeStep
+{
+    using EosKernel = typename FluidType::EosKernel;
+
+  public:
+    explicit AcousticTimeStepEos(SPHBody &sph_body, Real acousticCFL = 0.6)
+        : AcousticTimeStep(sph_body, acousticCFL), eos_(ExactCast<FluidType>(this, fluid_)){};
+    virtual ~AcousticTimeStepEos(){};
+
+    Real reduce(size_t index_i, Real dt = 0.0)
+    {
+        return AcousticTimeStep::reduce(index_i, dt, eos_.getSoundSpeed(p_[index_i], rho_[index_i]));
+    };
+
+  protected:
+    EosKernel eos_;
+};
+
 /**
  * @class AdvectionTimeStep
  * @brief Computing the advection time step size when viscosity is handled implicitly
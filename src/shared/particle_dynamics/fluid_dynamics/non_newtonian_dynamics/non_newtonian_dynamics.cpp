@@ -55,7 +55,7 @@ void Oldroyd_BIntegration1stHalf<Contact<Wall>>::interaction(size_t index_i, Rea
     Vecd force = Vecd::Zero();
     for (size_t k = 0; k < contact_configuration_.size(); ++k)
     {
-        Real *Vol_k = wall_Vol_[k];
+        StorageReal *Vol_k = wall_Vol_[k];
         Neighborhood &wall_neighborhood = (*contact_configuration_[k])[index_i];
         for (size_t n = 0; n != wall_neighborhood.current_size_; ++n)
         {
@@ -95,7 +95,7 @@ void Oldroyd_BIntegration2ndHalf<Inner<>>::update(size_t index_i, Real dt)
 SRDViscousTimeStepSize::SRDViscousTimeStepSize(SPHBody &sph_body, Real diffusionCFL)
     : LocalDynamicsReduce<ReduceMax>(sph_body),
       smoothing_length_(this->sph_body_.sph_adaptation_->ReferenceSmoothingLength()),
-      rho_(this->particles_->template getVariableDataByName<Real>("Density")),
+      rho_(this->particles_->template getVariableDataByName<StorageReal>("Density")),
       mu_srd_(this->particles_->getVariableDataByName<Real>("VariableViscosity")),
       diffusionCFL(diffusionCFL) {}
 //=================================================================================================//
@@ -114,7 +114,7 @@ class SRDViscousTimeStepSize : public LocalDynamicsReduce<ReduceMax>
 
   protected:
     Real smoothing_length_;
-    Real *rho_;
+    StorageReal *rho_;
     Real *mu_srd_;
     Real diffusionCFL;
     Real max_viscosity = 1e-12;
@@ -10,7 +10,7 @@ StaticConfinementDensity::StaticConfinementDensity(NearShapeSurface &near_surfac
       rho0_(sph_body_.base_material_->ReferenceDensity()),
       inv_sigma0_(1.0 / sph_body_.sph_adaptation_->LatticeNumberDensity()),
       mass_(particles_->getVariableDataByName<Real>("Mass")),
-      rho_sum_(particles_->getVariableDataByName<Real>("DensitySummation")),
+      rho_sum_(particles_->getVariableDataByName<StorageReal>("DensitySummation")),
       pos_(particles_->getVariableDataByName<Vecd>("Position")),
       level_set_shape_(&near_surface.getLevelSetShape()) {}
 //=================================================================================================//
@@ -24,7 +24,7 @@ void StaticConfinementDensity::update(size_t index_i, Real dt)
 StaticConfinementIntegration1stHalf::StaticConfinementIntegration1stHalf(NearShapeSurface &near_surface)
     : BaseLocalDynamics<BodyPartByCell>(near_surface),
       fluid_(DynamicCast<Fluid>(this, particles_->getBaseMaterial())),
-      rho_(particles_->getVariableDataByName<Real>("Density")),
+      rho_(particles_->getVariableDataByName<StorageReal>("Density")),
       p_(particles_->getVariableDataByName<Real>("Pressure")),
       mass_(particles_->getVariableDataByName<Real>("Mass")),
       pos_(particles_->getVariableDataByName<Vecd>("Position")),
@@ -42,7 +42,7 @@ void StaticConfinementIntegration1stHalf::update(size_t index_i, Real dt)
 StaticConfinementIntegration2ndHalf::StaticConfinementIntegration2ndHalf(NearShapeSurface &near_surface)
     : BaseLocalDynamics<BodyPartByCell>(near_surface),
       fluid_(DynamicCast<Fluid>(this, particles_->getBaseMaterial())),
-      rho_(particles_->getVariableDataByName<Real>("Density")),
+      rho_(particles_->getVariableDataByName<StorageReal>("Density")),
       p_(particles_->getVariableDataByName<Real>("Pressure")),
       drho_dt_(particles_->getVariableDataByName<Real>("DensityChangeRate")),
       pos_(particles_->getVariableDataByName<Vecd>("Position")),
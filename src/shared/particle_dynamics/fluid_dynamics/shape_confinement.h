@@ -51,7 +51,8 @@ class StaticConfinementDensity : public BaseLocalDynamics<BodyPartByCell>
 
   protected:
     Real rho0_, inv_sigma0_;
-    Real *mass_, *rho_sum_;
+    Real *mass_;
+    StorageReal *rho_sum_;
     Vecd *pos_;
     LevelSetShape *level_set_shape_;
 };
@@ -69,7 +70,8 @@ class StaticConfinementIntegration1stHalf : public BaseLocalDynamics<BodyPartByC
 
   protected:
     Fluid &fluid_;
-    Real *rho_, *p_, *mass_;
+    StorageReal *rho_;
+    Real *p_, *mass_;
     Vecd *pos_, *vel_, *force_;
     LevelSetShape *level_set_shape_;
     AcousticRiemannSolver riemann_solver_;
@@ -88,7 +90,8 @@ class StaticConfinementIntegration2ndHalf : public BaseLocalDynamics<BodyPartByC
 
   protected:
     Fluid &fluid_;
-    Real *rho_, *p_, *drho_dt_;
+    StorageReal *rho_;
+    Real *p_, *drho_dt_;
     Vecd *pos_, *vel_;
     LevelSetShape *level_set_shape_;
     AcousticRiemannSolver riemann_solver_;
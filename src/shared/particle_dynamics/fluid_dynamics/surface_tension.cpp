@@ -19,7 +19,7 @@ SurfaceTensionStress::
     Real rho0 = getSPHBody().base_material_->ReferenceDensity();
     for (size_t k = 0; k != contact_particles_.size(); ++k)
     {
-        contact_Vol_.push_back(contact_particles_[k]->getVariableDataByName<Real>("VolumetricMeasure"));
+        contact_Vol_.push_back(contact_particles_[k]->getVariableDataByName<StorageReal>("VolumetricMeasure"));
         contact_surface_tension_.push_back(contact_surface_tension[k]);
         Real rho0_k = contact_bodies_[k]->base_material_->ReferenceDensity();
         contact_fraction_.push_back(rho0 / (rho0 + rho0_k));
@@ -35,7 +35,7 @@ void SurfaceTensionStress::interaction(size_t index_i, Real dt)
         Vecd weighted_color_gradient = ZeroData<Vecd>::value;
         Real contact_fraction_k = contact_fraction_[k];
         Real surface_tension_k = contact_surface_tension_[k];
-        Real *Vol_k = contact_Vol_[k];
+        StorageReal *Vol_k = contact_Vol_[k];
         const Neighborhood &contact_neighborhood = (*contact_configuration_[k])[index_i];
         for (size_t n = 0; n != contact_neighborhood.current_size_; ++n)
         {
@@ -76,7 +76,7 @@ SurfaceStressForce<Contact<>>::SurfaceStressForce(BaseContactRelation &contact_r
     {
         Real rho0_k = contact_bodies_[k]->base_material_->ReferenceDensity();
         contact_fraction_.push_back(rho0 / (rho0 + rho0_k));
-        contact_Vol_.push_back(contact_particles_[k]->getVariableDataByName<Real>("VolumetricMeasure"));
+        contact_Vol_.push_back(contact_particles_[k]->getVariableDataByName<StorageReal>("VolumetricMeasure"));
         contact_color_gradient_.push_back(
             contact_particles_[k]->getVariableDataByName<Vecd>("ColorGradient"));
         contact_surface_tension_stress_.push_back(
@@ -90,7 +90,7 @@ void SurfaceStressForce<Contact<>>::interaction(size_t index_i, Real dt)
     for (size_t k = 0; k < contact_configuration_.size(); ++k)
     {
         Real contact_fraction_k = contact_fraction_[k];
-        Real *Vol_k = contact_Vol_[k];
+        StorageReal *Vol_k = contact_Vol_[k];
         Vecd *contact_color_gradient_k = contact_color_gradient_[k];
         Matd *contact_surface_tension_stress_k = contact_surface_tension_stress_[k];
         const Neighborhood &contact_neighborhood = (*contact_configuration_[k])[index_i];
@@ -49,7 +49,7 @@ class SurfaceTensionStress : public LocalDynamics, public DataDelegateContact
     Vecd *color_gradient_;
     Matd *surface_tension_stress_;
     StdVec<Real> contact_surface_tension_, contact_fraction_;
-    StdVec<Real *> contact_Vol_;
+    StdVec<StorageReal *> contact_Vol_;
 };
 
 template <typename... T>
@@ -65,7 +65,9 @@ class SurfaceStressForce<DataDelegationType>
     virtual ~SurfaceStressForce(){};
 
   protected:
-    Real *rho_, *mass_, *Vol_;
+    StorageReal *rho_;
+    Real *mass_;
+    StorageReal *Vol_;
     Vecd *color_gradient_, *surface_tension_force_;
     Matd *surface_tension_stress_;
 };
@@ -88,7 +90,7 @@ class SurfaceStressForce<Contact<>> : public SurfaceStressForce<DataDelegateCont
     void interaction(size_t index_i, Real dt = 0.0);
 
   protected:
-    StdVec<Real *> contact_Vol_;
+    StdVec<StorageReal *> contact_Vol_;
     StdVec<Vecd *> contact_color_gradient_;
     StdVec<Matd *> contact_surface_tension_stress_;
     StdVec<Real> contact_surface_tension_, contact_fraction_;
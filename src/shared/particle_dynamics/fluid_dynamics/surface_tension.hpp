@@ -12,9 +12,9 @@ template <class BaseRelationType>
 SurfaceStressForce<DataDelegationType>::SurfaceStressForce(BaseRelationType &base_relation)
     : ForcePrior(base_relation.getSPHBody(), "SurfaceTensionForce"),
       DataDelegationType(base_relation),
-      rho_(this->particles_->template getVariableDataByName<Real>("Density")),
+      rho_(this->particles_->template getVariableDataByName<StorageReal>("Density")),
       mass_(this->particles_->template getVariableDataByName<Real>("Mass")),
-      Vol_(this->particles_->template getVariableDataByName<Real>("VolumetricMeasure")),
+      Vol_(this->particles_->template getVariableDataByName<StorageReal>("VolumetricMeasure")),
       color_gradient_(this->particles_->template getVariableDataByName<Vecd>("ColorGradient")),
       surface_tension_force_(this->particles_->template registerStateVariable<Vecd>("SurfaceTensionForce")),
       surface_tension_stress_(this->particles_->template getVariableDataByName<Matd>("SurfaceTensionStress")) {}
@@ -75,7 +75,7 @@ class TransportVelocityCorrection<Inner<ResolutionType, LimiterType>, CommonCont
 
   protected:
     const Real h_ref_, correction_scaling_;
-    Real *Vol_;
+    StorageReal *Vol_;
     Vecd *pos_;
     ResolutionType h_ratio_;
     LimiterType limiter_;
@@ -94,7 +94,7 @@ class TransportVelocityCorrection<Contact<Boundary>, CommonControlTypes...>
     void interaction(size_t index_i, Real dt = 0.0);
 
   protected:
-    StdVec<Real *> wall_Vol_;
+    StdVec<StorageReal *> wall_Vol_;
 };
 
 template <class KernelCorrectionType, typename... CommonControlTypes>
@@ -108,7 +108,7 @@ class TransportVelocityCorrection<Contact<>, KernelCorrectionType, CommonControl
 
   protected:
     StdVec<KernelCorrectionType> contact_kernel_corrections_;
-    StdVec<Real *> contact_Vol_;
+    StdVec<StorageReal *> contact_Vol_;
 };
 
 template <class ResolutionType, class LimiterType, typename... CommonControlTypes>
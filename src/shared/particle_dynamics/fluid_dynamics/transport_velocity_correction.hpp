@@ -25,7 +25,7 @@ TransportVelocityCorrection<Inner<ResolutionType, LimiterType>, CommonControlTyp
     : TransportVelocityCorrection<Base, DataDelegateInner, CommonControlTypes...>(inner_relation),
       h_ref_(this->sph_body_.sph_adaptation_->ReferenceSmoothingLength()),
       correction_scaling_(coefficient * h_ref_ * h_ref_),
-      Vol_(this->particles_->template getVariableDataByName<Real>("VolumetricMeasure")),
+      Vol_(this->particles_->template getVariableDataByName<StorageReal>("VolumetricMeasure")),
       pos_(this->particles_->template getVariableDataByName<Vecd>("Position")),
       h_ratio_(this->particles_), limiter_(h_ref_ * h_ref_)
 {
@@ -72,7 +72,7 @@ TransportVelocityCorrection<Contact<Boundary>, CommonControlTypes...>::
 {
     for (size_t k = 0; k != this->contact_particles_.size(); ++k)
     {
-        wall_Vol_.push_back(this->contact_particles_[k]->template getVariableDataByName<Real>("VolumetricMeasure"));
+        wall_Vol_.push_back(this->contact_particles_[k]->template getVariableDataByName<StorageReal>("VolumetricMeasure"));
     }
 };
 //=================================================================================================//
@@ -85,7 +85,7 @@ void TransportVelocityCorrection<Contact<Boundary>, CommonControlTypes...>::
         Vecd inconsistency = Vecd::Zero();
         for (size_t k = 0; k < this->contact_configuration_.size(); ++k)
         {
-            Real *wall_Vol_k = wall_Vol_[k];
+            StorageReal *wall_Vol_k = wall_Vol_[k];
             Neighborhood &contact_neighborhood = (*this->contact_configuration_[k])[index_i];
             for (size_t n = 0; n != contact_neighborhood.current_size_; ++n)
             {
@@ -108,7 +108,7 @@ TransportVelocityCorrection<Contact<>, KernelCorrectionType, CommonControlTypes.
     for (size_t k = 0; k != this->contact_particles_.size(); ++k)
     {
         contact_kernel_corrections_.push_back(KernelCorrectionType(this->contact_particles_[k]));
-        contact_Vol_.push_back(this->contact_particles_[k]->template getVariableDataByName<Real>("VolumetricMeasure"));
+        contact_Vol_.push_back(this->contact_particles_[k]->template getVariableDataByName<StorageReal>("VolumetricMeasure"));
     }
 }
 //=================================================================================================//
@@ -121,7 +121,7 @@ void TransportVelocityCorrection<Contact<>, KernelCorrectionType, CommonControlT
         Vecd inconsistency = Vecd::Zero();
         for (size_t k = 0; k < this->contact_configuration_.size(); ++k)
         {
-            Real *Vol_k = this->contact_Vol_[k];
+            StorageReal *Vol_k = this->contact_Vol_[k];
             Neighborhood &contact_neighborhood = (*this->contact_configuration_[k])[index_i];
             KernelCorrectionType &kernel_correction_k = this->contact_kernel_corrections_[k];
             for (size_t n = 0; n != contact_neighborhood.current_size_; ++n)
@@ -16,7 +16,7 @@ void VelocityGradient<Contact<Wall>>::interaction(size_t index_i, Real dt)
     for (size_t k = 0; k < contact_configuration_.size(); ++k)
     {
         Vecd *vel_ave_k = wall_vel_ave_[k];
-        Real *Vol_k = wall_Vol_[k];
+        StorageReal *Vol_k = wall_Vol_[k];
         Neighborhood &contact_neighborhood = (*contact_configuration_[k])[index_i];
         for (size_t n = 0; n != contact_neighborhood.current_size_; ++n)
         {
@@ -49,7 +49,7 @@ class VelocityGradient<DataDelegationType>
     virtual ~VelocityGradient(){};
 
   protected:
-    Real *Vol_;
+    StorageReal *Vol_;
     Vecd *vel_;
     Matd *vel_grad_;
 };
@@ -11,7 +11,7 @@ template <class DataDelegationType>
 template <class BaseRelationType>
 VelocityGradient<DataDelegationType>::VelocityGradient(BaseRelationType &base_relation)
     : LocalDynamics(base_relation.getSPHBody()), DataDelegationType(base_relation),
-      Vol_(this->particles_->template getVariableDataByName<Real>("VolumetricMeasure")),
+      Vol_(this->particles_->template getVariableDataByName<StorageReal>("VolumetricMeasure")),
       vel_(this->particles_->template getVariableDataByName<Vecd>("Velocity")),
       vel_grad_(this->particles_->template registerStateVariable<Matd>("VelocityGradient")) {}
 //=================================================================================================//
@@ -7,7 +7,7 @@ namespace fluid_dynamics
 //=================================================================================================//
 VorticityInner::VorticityInner(BaseInnerRelation &inner_relation)
     : LocalDynamics(inner_relation.getSPHBody()), DataDelegateInner(inner_relation),
-      Vol_(particles_->getVariableDataByName<Real>("VolumetricMeasure")),
+      Vol_(particles_->getVariableDataByName<StorageReal>("VolumetricMeasure")),
       vel_(particles_->getVariableDataByName<Vecd>("Velocity")),
       vorticity_(particles_->registerStateVariable<AngularVecd>("VorticityInner"))
 {
@@ -75,7 +75,9 @@ class ViscousForce<DataDelegationType>
     virtual ~ViscousForce(){};
 
   protected:
-    Real *rho_, *mass_, *Vol_;
+    StorageReal *rho_;
+    Real *mass_;
+    StorageReal *Vol_;
     Vecd *vel_, *viscous_force_;
     Real smoothing_length_;
 };
@@ -153,7 +155,7 @@ class ViscousForce<Contact<>, ViscosityType, KernelCorrectionType>
     KernelCorrectionType kernel_correction_;
     StdVec<KernelCorrectionType> contact_kernel_corrections_;
     StdVec<Vecd *> contact_vel_;
-    StdVec<Real *> wall_Vol_;
+    StdVec<StorageReal *> wall_Vol_;
 };
 
 using ViscousForceWithWall = ComplexInteraction<ViscousForce<Inner<>, Contact<Wall>>, FixedViscosity, NoKernelCorrection>;
@@ -177,7 +179,7 @@ class VorticityInner : public LocalDynamics, public DataDelegateInner
     void interaction(size_t index_i, Real dt = 0.0);
 
   protected:
-    Real *Vol_;
+    StorageReal *Vol_;
     Vecd *vel_;
     AngularVecd *vorticity_;
 };
@@ -12,9 +12,9 @@ template <class BaseRelationType>
 ViscousForce<DataDelegationType>::ViscousForce(BaseRelationType &base_relation)
     : ForcePrior(base_relation.getSPHBody(), "ViscousForce"),
       DataDelegationType(base_relation),
-      rho_(this->particles_->template getVariableDataByName<Real>("Density")),
+      rho_(this->particles_->template getVariableDataByName<StorageReal>("Density")),
       mass_(this->particles_->template getVariableDataByName<Real>("Mass")),
-      Vol_(this->particles_->template getVariableDataByName<Real>("VolumetricMeasure")),
+      Vol_(this->particles_->template getVariableDataByName<StorageReal>("VolumetricMeasure")),
       vel_(this->particles_->template getVariableDataByName<Vecd>("Velocity")),
       viscous_force_(this->particles_->template registerStateVariable<Vecd>("ViscousForce")),
       smoothing_length_(this->sph_body_.sph_adaptation_->ReferenceSmoothingLength()) {}
@@ -94,7 +94,7 @@ void ViscousForce<Contact<Wall>, ViscosityType, KernelCorrectionType>::
     for (size_t k = 0; k < contact_configuration_.size(); ++k)
     {
         Vecd *vel_ave_k = wall_vel_ave_[k];
-        Real *wall_Vol_k = wall_Vol_[k];
+        StorageReal *wall_Vol_k = wall_Vol_[k];
         const Neighborhood &contact_neighborhood = (*contact_configuration_[k])[index_i];
         for (size_t n = 0; n != contact_neighborhood.current_size_; ++n)
         {
@@ -126,7 +126,7 @@ void ViscousForce<Contact<Wall, AngularConservative>, ViscosityType, KernelCorre
     for (size_t k = 0; k < contact_configuration_.size(); ++k)
     {
         Vecd *vel_ave_k = wall_vel_ave_[k];
-        Real *wall_Vol_k = wall_Vol_[k];
+        StorageReal *wall_Vol_k = wall_Vol_[k];
         const Neighborhood &contact_neighborhood = (*contact_configuration_[k])[index_i];
         for (size_t n = 0; n != contact_neighborhood.current_size_; ++n)
         {
@@ -156,7 +156,7 @@ ViscousForce<Contact<>, ViscosityType, KernelCorrectionType>::
         contact_mu_.emplace_back(ViscosityType(particles_, contact_particles_[k]));
         contact_kernel_corrections_.emplace_back(KernelCorrectionType(contact_particles_[k]));
         contact_vel_.push_back(contact_particles_[k]->template getVariableDataByName<Vecd>("Velocity"));
-        wall_Vol_.push_back(contact_particles_[k]->template getVariableDataByName<Real>("VolumetricMeasure"));
+        wall_Vol_.push_back(contact_particles_[k]->template getVariableDataByName<StorageReal>("VolumetricMeasure"));
     }
 }
 //=================================================================================================//
@@ -169,7 +169,7 @@ void ViscousForce<Contact<>, ViscosityType, KernelCorrectionType>::
     {
         auto &contact_mu_k = contact_mu_[k];
         Vecd *vel_k = contact_vel_[k];
-        Real *wall_Vol_k = wall_Vol_[k];
+        StorageReal *wall_Vol_k = wall_Vol_[k];
         KernelCorrectionType &kernel_correction_k = contact_kernel_corrections_[k];
         const Neighborhood &contact_neighborhood = (*contact_configuration_[k])[index_i];
         for (size_t n = 0; n != contact_neighborhood.current_size_; ++n)
@@ -39,4 +39,6 @@
 #include "general_interpolation.h"
 #include "general_reduce.h"
 #include "kernel_correction.hpp"
+#include "multi_rate_scheduler.hpp"
+#include "multi_rate_time_step.h"
 #include "particle_smoothing.hpp"
\ No newline at end of file
@@ -8,7 +8,7 @@ GhostCreationInESPH::GhostCreationInESPH(BaseInnerRelation &inner_relation, Ghos
     : LocalDynamics(inner_relation.getSPHBody()), DataDelegateInner(inner_relation),
       ghost_boundary_(ghost_boundary), get_inner_neighbor_(&inner_relation.getSPHBody()),
       indicator_(particles_->getVariableDataByName<int>("Indicator")),
-      Vol_(particles_->getVariableDataByName<Real>("VolumetricMeasure")),
+      Vol_(particles_->getVariableDataByName<StorageReal>("VolumetricMeasure")),
       pos_(particles_->getVariableDataByName<Vecd>("Position")),
       ghost_bound_(ghost_boundary.GhostBound())
 {
@@ -62,8 +62,8 @@ void GhostCreationInESPH::ghostGenerationAndAddToConfiguration()
 GhostBoundaryConditionSetupInESPH::
     GhostBoundaryConditionSetupInESPH(BaseInnerRelation &inner_relation, GhostCreationInESPH &ghost_creation)
     : LocalDynamics(inner_relation.getSPHBody()), DataDelegateInner(inner_relation),
-      rho_(particles_->getVariableDataByName<Real>("Density")),
-      Vol_(particles_->getVariableDataByName<Real>("VolumetricMeasure")),
+      rho_(particles_->getVariableDataByName<StorageReal>("Density")),
+      Vol_(particles_->getVariableDataByName<StorageReal>("VolumetricMeasure")),
       mass_(particles_->getVariableDataByName<Real>("Mass")),
       vel_(particles_->getVariableDataByName<Vecd>("Velocity")),
       pos_(particles_->getVariableDataByName<Vecd>("Position")),
@@ -116,7 +116,7 @@ void GhostBoundaryConditionSetupInESPH::resetBoundaryConditions()
 //=================================================================================================//
 GhostKernelGradientUpdate::GhostKernelGradientUpdate(BaseInnerRelation &inner_relation)
     : LocalDynamics(inner_relation.getSPHBody()), DataDelegateInner(inner_relation),
-      Vol_(particles_->getVariableDataByName<Real>("VolumetricMeasure")),
+      Vol_(particles_->getVariableDataByName<StorageReal>("VolumetricMeasure")),
       kernel_gradient_original_summation_(
           particles_->registerStateVariable<Vecd>("KernelGradientOriginalSummation")),
       indicator_(particles_->getVariableDataByName<int>("Indicator")){};
@@ -57,7 +57,7 @@ class GhostCreationInESPH : public LocalDynamics, public DataDelegateInner
     std::mutex mutex_create_ghost_particle_; /**< mutex exclusion for memory conflict */
     NeighborBuilderInnerInFVM get_inner_neighbor_;
     int *indicator_;
-    Real *Vol_;
+    StorageReal *Vol_;
     Vecd *pos_;
 
   public:
@@ -85,7 +85,8 @@ class GhostBoundaryConditionSetupInESPH : public LocalDynamics, public DataDeleg
     void resetBoundaryConditions();
 
   protected:
-    Real *rho_, *Vol_, *mass_;
+    StorageReal *rho_, *Vol_;
+    Real *mass_;
     Vecd *vel_, *pos_, *mom_;
     std::pair<size_t, size_t> &ghost_bound_;
     std::vector<RealAndGhostParticleData> real_and_ghost_particle_data_;
@@ -106,7 +107,7 @@ class GhostKernelGradientUpdate : public LocalDynamics, public DataDelegateInner
     void update(size_t index_i, Real dt = 0.0);
 
   protected:
-    Real *Vol_;
+    StorageReal *Vol_;
     Vecd *kernel_gradient_original_summation_;
     int *indicator_;
 };
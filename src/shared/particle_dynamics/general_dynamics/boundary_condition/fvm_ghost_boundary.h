@@ -52,7 +52,7 @@ class GhostCreationFromMesh : public LocalDynamics
     StdLargeVec<Vecd> &node_coordinates_;
     StdVec<StdVec<StdVec<size_t>>> &mesh_topology_;
     Vecd *pos_;
-    Real *Vol_;
+    StorageReal *Vol_;
     void addGhostParticleAndSetInConfiguration();
 
   public:
@@ -83,7 +83,8 @@ class BoundaryConditionSetupInFVM : public LocalDynamics, public DataDelegateInn
     void resetBoundaryConditions();
 
   protected:
-    Real *rho_, *Vol_, *mass_, *p_;
+    StorageReal *rho_, *Vol_;
+    Real *mass_, *p_;
     Vecd *vel_, *pos_, *mom_;
     std::pair<size_t, size_t> &ghost_bound_;
     StdVec<StdVec<size_t>> &each_boundary_type_with_all_ghosts_index_;
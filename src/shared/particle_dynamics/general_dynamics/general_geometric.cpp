@@ -53,7 +53,7 @@ NormalDirectionFromParticles::NormalDirectionFromParticles(BaseInnerRelation &in
       n0_(particles_->registerStateVariableFrom<Vecd>("InitialNormalDirection", "NormalDirection")),
       phi_(particles_->registerStateVariable<Real>("SignedDistance")),
       phi0_(particles_->registerStateVariable<Real>("InitialSignedDistance")),
-      Vol_(particles_->getVariableDataByName<Real>("VolumetricMeasure")) {}
+      Vol_(particles_->getVariableDataByName<StorageReal>("VolumetricMeasure")) {}
 //=================================================================================================//
 void NormalDirectionFromParticles::interaction(size_t index_i, Real dt)
 {
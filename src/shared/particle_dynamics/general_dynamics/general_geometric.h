@@ -79,7 +79,8 @@ class NormalDirectionFromParticles : public LocalDynamics, public DataDelegateIn
   protected:
     Shape &initial_shape_;
     Vecd *pos_, *n_, *n0_;
-    Real *phi_, *phi0_, *Vol_;
+    Real *phi_, *phi0_;
+    StorageReal *Vol_;
 };
 } // namespace SPH
 #endif // GENERAL_GEOMETRIC_H
@@ -47,7 +47,7 @@ class BaseInterpolation : public LocalDynamics, public DataDelegateContact
     {
         for (size_t k = 0; k != this->contact_particles_.size(); ++k)
         {
-            contact_Vol_.push_back(contact_particles_[k]->template getVariableDataByName<Real>("VolumetricMeasure"));
+            contact_Vol_.push_back(contact_particles_[k]->template getVariableDataByName<StorageReal>("VolumetricMeasure"));
             DataType *contact_data =
                 this->contact_particles_[k]->template getVariableDataByName<DataType>(variable_name);
             contact_data_.push_back(contact_data);
@@ -62,7 +62,7 @@ class BaseInterpolation : public LocalDynamics, public DataDelegateContact
 
         for (size_t k = 0; k < this->contact_configuration_.size(); ++k)
         {
-            Real *Vol_k = contact_Vol_[k];
+            StorageReal *Vol_k = contact_Vol_[k];
             DataType *data_k = contact_data_[k];
             Neighborhood &contact_neighborhood = (*this->contact_configuration_[k])[index_i];
             for (size_t n = 0; n != contact_neighborhood.current_size_; ++n)
@@ -80,7 +80,7 @@ class BaseInterpolation : public LocalDynamics, public DataDelegateContact
   protected:
     DiscreteVariable<DataType> *dv_interpolated_quantities_;
     DataType *interpolated_quantities_;
-    StdVec<Real *> contact_Vol_;
+    StdVec<StorageReal *> contact_Vol_;
     StdVec<DataType *> contact_data_;
 };
 
@@ -139,7 +139,7 @@ class CorrectInterpolationKernelWeights : public LocalDynamics,
 
         for (size_t k = 0; k < contact_configuration_.size(); ++k)
         {
-            Real *Vol_k = contact_Vol_[k];
+            StorageReal *Vol_k = contact_Vol_[k];
             Neighborhood &contact_neighborhood = (*contact_configuration_[k])[index_i];
             for (size_t n = 0; n != contact_neighborhood.current_size_; ++n)
             {
@@ -169,7 +169,7 @@ class CorrectInterpolationKernelWeights : public LocalDynamics,
     };
 
   protected:
-    StdVec<Real *> contact_Vol_;
+    StdVec<StorageReal *> contact_Vol_;
 };
 } // namespace SPH
 #endif // GENERAL_INTERPOLATION_H
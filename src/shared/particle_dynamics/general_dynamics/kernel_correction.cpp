@@ -34,7 +34,7 @@ LinearGradientCorrectionMatrix<Contact<>>::
     for (size_t k = 0; k != contact_particles_.size(); ++k)
     {
         contact_mass_.push_back(contact_particles_[k]->getVariableDataByName<Real>("Mass"));
-        contact_Vol_.push_back(contact_particles_[k]->getVariableDataByName<Real>("VolumetricMeasure"));
+        contact_Vol_.push_back(contact_particles_[k]->getVariableDataByName<StorageReal>("VolumetricMeasure"));
     }
 }
 //=================================================================================================//
@@ -43,7 +43,7 @@ void LinearGradientCorrectionMatrix<Contact<>>::interaction(size_t index_i, Real
     Matd local_configuration = ZeroData<Matd>::value;
     for (size_t k = 0; k < contact_configuration_.size(); ++k)
     {
-        Real *Vol_k = contact_Vol_[k];
+        StorageReal *Vol_k = contact_Vol_[k];
         Neighborhood &contact_neighborhood = (*contact_configuration_[k])[index_i];
         for (size_t n = 0; n != contact_neighborhood.current_size_; ++n)
         {
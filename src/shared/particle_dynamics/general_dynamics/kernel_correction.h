@@ -51,7 +51,7 @@ class LinearGradientCorrectionMatrix<DataDelegationType>
     virtual ~LinearGradientCorrectionMatrix(){};
 
   protected:
-    Real *Vol_;
+    StorageReal *Vol_;
     Matd *B_;
 };
 
@@ -83,7 +83,7 @@ class LinearGradientCorrectionMatrix<Contact<>>
     void interaction(size_t index_i, Real dt = 0.0);
 
   protected:
-    StdVec<Real *> contact_Vol_;
+    StdVec<StorageReal *> contact_Vol_;
     StdVec<Real *> contact_mass_;
 };
 
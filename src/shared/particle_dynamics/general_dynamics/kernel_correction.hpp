@@ -11,7 +11,7 @@ template <class BaseRelationType>
 LinearGradientCorrectionMatrix<DataDelegationType>::
     LinearGradientCorrectionMatrix(BaseRelationType &base_relation)
     : LocalDynamics(base_relation.getSPHBody()), DataDelegationType(base_relation),
-      Vol_(this->particles_->template getVariableDataByName<Real>("VolumetricMeasure")),
+      Vol_(this->particles_->template getVariableDataByName<StorageReal>("VolumetricMeasure")),
       B_(this->particles_->template registerStateVariable<Matd>(
           "LinearGradientCorrectionMatrix", IdentityMatrix<Matd>::value)) {}
 //=================================================================================================//
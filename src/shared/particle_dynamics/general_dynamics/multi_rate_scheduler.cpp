@@ -0,0 +1,116 @@
+#include "multi_rate_scheduler.hpp"
+
+namespace SPH
+{
+//=================================================================================================//
+MultiRateBody::MultiRateBody(SPHBody &sph_body, BaseDynamics<Real> &time_step)
+    : sph_body_(sph_body), time_step_(time_step) {}
+//=================================================================================================//
+MultiRateBody &MultiRateBody::addSyncStart(BaseDynamics<void> &dynamics)
+{
+    sync_start_.push_back(&dynamics);
+    return *this;
+}
+//=================================================================================================//
+MultiRateBody &MultiRateBody::addStep(BaseDynamics<void> &dynamics)
+{
+    steps_.push_back(&dynamics);
+    return *this;
+}
+//=================================================================================================//
+MultiRateBody &MultiRateBody::addSyncEnd(BaseDynamics<void> &dynamics)
+{
+    sync_end_.push_back(&dynamics);
+    return *this;
+}
+//=================================================================================================//
+MultiRateBody &MultiRateBody::addInterpolation(BaseCouplingInterpolation &interpolation)
+{
+    interpolations_.push_back(&interpolation);
+    return *this;
+}
+//=================================================================================================//
+UnsignedInt MultiRateBody::advance(Real interval, Real dt)
+{
+    for (size_t k = 0; k != sync_start_.size(); ++k)
+        sync_start_[k]->exec(interval);
+    for (size_t k = 0; k != interpolations_.size(); ++k)
+        interpolations_[k]->setTarget();
+
+    UnsignedInt sub_steps = 0;
+    Real time = 0.0;
+    while (time < interval)
+    {
+        dt = SMIN(dt, interval - time);
+        for (size_t k = 0; k != interpolations_.size(); ++k)
+            interpolations_[k]->interpolate((time + 0.5 * dt) / interval);
+        for (size_t k = 0; k != steps_.size(); ++k)
+            steps_[k]->exec(dt);
+
+        time += dt;
+        sub_steps++;
+        if (time < interval)
+            dt = time_step_.exec();
+    }
+
+    for (size_t k = 0; k != interpolations_.size(); ++k)
+        interpolations_[k]->finish();
+    for (size_t k = 0; k != sync_end_.size(); ++k)
+        sync_end_[k]->exec(interval);
+    return sub_steps;
+}
+//=================================================================================================//
+MultiRateBody &MultiRateScheduler::addBody(SPHBody &sph_body, BaseDynamics<Real> &time_step)
+{
+    bodies_.push_back(body_ptrs_.createPtr<MultiRateBody>(sph_body, time_step));
+    sub_steps_.push_back(0);
+    return *bodies_.back();
+}
+//=================================================================================================//
+Real MultiRateScheduler::exec(Real time_to_sync)
+{
+    if (bodies_.empty())
+    {
+        std::cout << "\n Error: no body is registered in the multi-rate scheduler!" << std::endl;
+        std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+        exit(1);
+    }
+
+    StdVec<Real> stable_time_steps;
+    Real largest_dt = 0.0;
+    Real smallest_dt = MaxReal;
+    for (size_t k = 0; k != bodies_.size(); ++k)
+    {
+        stable_time_steps.push_back(bodies_[k]->StableTimeStep());
+        largest_dt = SMAX(largest_dt, stable_time_steps[k]);
+        smallest_dt = SMIN(smallest_dt, stable_time_steps[k]);
+    }
+
+    Real interval = SMIN(largest_dt, time_to_sync);
+    for (size_t k = 0; k != bodies_.size(); ++k)
+    {
+        sub_steps_[k] += bodies_[k]->advance(interval, stable_time_steps[k]);
+    }
+    uniform_steps_ += bodies_.size() * UnsignedInt(std::ceil(interval / smallest_dt - Eps));
+    return interval;
+}
+//=================================================================================================//
+UnsignedInt MultiRateScheduler::TotalSubSteps()
+{
+    UnsignedInt total_sub_steps = 0;
+    for (size_t k = 0; k != sub_steps_.size(); ++k)
+        total_sub_steps += sub_steps_[k];
+    return total_sub_steps;
+}
+//=================================================================================================//
+void MultiRateScheduler::printStatistics()
+{
+    for (size_t k = 0; k != bodies_.size(); ++k)
+    {
+        std::cout << "sub_steps_of_" << bodies_[k]->Name() << " = " << sub_steps_[k] << "\n";
+    }
+    std::cout << "multi_rate_total_sub_steps = " << TotalSubSteps() << "\n";
+    std::cout << "uniform_time_step_steps = " << uniform_steps_ << "\n";
+}
+//=================================================================================================//
+} // namespace SPH
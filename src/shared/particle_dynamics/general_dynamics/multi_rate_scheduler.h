@@ -0,0 +1,138 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2023 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file 	multi_rate_scheduler.h
+ * @brief 	Sub-cycling of coupled bodies, each with its own stable time step.
+ * @details Each body registers its time-step reducer and its step sequence.
+ *          The synchronization interval is the largest stable time step among the bodies,
+ *          limited by the time to the next output. Within the interval,
+ *          the bodies are advanced one after another in the order of registration,
+ *          each sub-cycling with its own time step.
+ *          Coupling quantities produced by a body advanced earlier can be interpolated linearly
+ *          in time for the sub-steps of a body advanced later.
+ * @author	Xiangyu Hu
+ */
+
+#ifndef MULTI_RATE_SCHEDULER_H
+#define MULTI_RATE_SCHEDULER_H
+
+#include "base_general_dynamics.h"
+
+namespace SPH
+{
+/**
+ * @class BaseCouplingInterpolation
+ * @brief Interface of the time interpolation of a coupling quantity.
+ */
+class BaseCouplingInterpolation
+{
+  public:
+    BaseCouplingInterpolation(){};
+    virtual ~BaseCouplingInterpolation(){};
+    /** take the current value as the value at the end of the synchronization interval. */
+    virtual void setTarget() = 0;
+    /** the value at a fraction of the synchronization interval. */
+    virtual void interpolate(Real fraction) = 0;
+    /** recover the value at the end of the synchronization interval. */
+    virtual void finish() = 0;
+};
+
+/**
+ * @class CouplingInterpolation
+ * @brief Linear interpolation of a particle variable between two synchronization points.
+ */
+template <typename DataType>
+class CouplingInterpolation : public BaseCouplingInterpolation
+{
+  public:
+    CouplingInterpolation(SPHBody &sph_body, const std::string &variable_name);
+    virtual ~CouplingInterpolation(){};
+    virtual void setTarget() override;
+    virtual void interpolate(Real fraction) override;
+    virtual void finish() override;
+
+  protected:
+    SPHBody &sph_body_;
+    bool is_initialized_;
+    DataType *variable_, *previous_, *target_;
+};
+
+/**
+ * @class MultiRateBody
+ * @brief The time-step reducer and the step sequence of a body.
+ * The steps are executed in the order of registration with the time step of the body.
+ * The sync-start and sync-end dynamics are executed once with the synchronization interval,
+ * e.g. for initializing and updating the averaged velocity of a solid.
+ */
+class MultiRateBody
+{
+  public:
+    MultiRateBody(SPHBody &sph_body, BaseDynamics<Real> &time_step);
+    virtual ~MultiRateBody(){};
+
+    MultiRateBody &addSyncStart(BaseDynamics<void> &dynamics);
+    MultiRateBody &addStep(BaseDynamics<void> &dynamics);
+    MultiRateBody &addSyncEnd(BaseDynamics<void> &dynamics);
+    MultiRateBody &addInterpolation(BaseCouplingInterpolation &interpolation);
+
+    std::string Name() { return sph_body_.getName(); };
+    Real StableTimeStep() { return time_step_.exec(); };
+    /** advance the body over the interval starting with a given time step, and return the number of sub-steps. */
+    UnsignedInt advance(Real interval, Real dt);
+
+  protected:
+    SPHBody &sph_body_;
+    BaseDynamics<Real> &time_step_;
+    StdVec<BaseDynamics<void> *> sync_start_, steps_, sync_end_;
+    StdVec<BaseCouplingInterpolation *> interpolations_;
+};
+
+/**
+ * @class MultiRateScheduler
+ * @brief Sub-cycling the registered bodies within synchronization intervals.
+ */
+class MultiRateScheduler
+{
+  public:
+    MultiRateScheduler(){};
+    virtual ~MultiRateScheduler(){};
+
+    MultiRateBody &addBody(SPHBody &sph_body, BaseDynamics<Real> &time_step);
+    /** advance all bodies over one synchronization interval, which is returned. */
+    Real exec(Real time_to_sync = MaxReal);
+
+    UnsignedInt SubSteps(size_t body_index) { return sub_steps_[body_index]; };
+    /** sum of sub-steps of all bodies */
+    UnsignedInt TotalSubSteps();
+    /** the steps if all bodies were advanced with the smallest time step. */
+    UnsignedInt UniformSteps() { return uniform_steps_; };
+    void printStatistics();
+
+  protected:
+    UniquePtrsKeeper<MultiRateBody> body_ptrs_;
+    StdVec<MultiRateBody *> bodies_;
+    StdVec<UnsignedInt> sub_steps_;
+    UnsignedInt uniform_steps_ = 0;
+};
+} // namespace SPH
+#endif // MULTI_RATE_SCHEDULER_H
@@ -0,0 +1,56 @@
+#ifndef MULTI_RATE_SCHEDULER_HPP
+#define MULTI_RATE_SCHEDULER_HPP
+
+#include "multi_rate_scheduler.h"
+
+namespace SPH
+{
+//=================================================================================================//
+template <typename DataType>
+CouplingInterpolation<DataType>::CouplingInterpolation(SPHBody &sph_body, const std::string &variable_name)
+    : BaseCouplingInterpolation(), sph_body_(sph_body), is_initialized_(false)
+{
+    BaseParticles &base_particles = sph_body.getBaseParticles();
+    variable_ = base_particles.getVariableDataByName<DataType>(variable_name);
+    previous_ = base_particles.registerDiscreteVariableOnly<DataType>(
+                                  variable_name + "SyncPrevious", base_particles.ParticlesBound())
+                    ->Data();
+    target_ = base_particles.registerDiscreteVariableOnly<DataType>(
+                                variable_name + "SyncTarget", base_particles.ParticlesBound())
+                  ->Data();
+}
+//=================================================================================================//
+template <typename DataType>
+void CouplingInterpolation<DataType>::setTarget()
+{
+    particle_for(ParallelPolicy(), sph_body_.LoopRange(),
+                 [&](size_t i)
+                 {
+                     target_[i] = variable_[i];
+                     if (!is_initialized_)
+                         previous_[i] = variable_[i];
+                 });
+    is_initialized_ = true;
+}
+//=================================================================================================//
+template <typename DataType>
+void CouplingInterpolation<DataType>::interpolate(Real fraction)
+{
+    particle_for(ParallelPolicy(), sph_body_.LoopRange(),
+                 [&](size_t i)
+                 { variable_[i] = previous_[i] + (target_[i] - previous_[i]) * fraction; });
+}
+//=================================================================================================//
+template <typename DataType>
+void CouplingInterpolation<DataType>::finish()
+{
+    particle_for(ParallelPolicy(), sph_body_.LoopRange(),
+                 [&](size_t i)
+                 {
+                     variable_[i] = target_[i];
+                     previous_[i] = target_[i];
+                 });
+}
+//=================================================================================================//
+} // namespace SPH
+#endif // MULTI_RATE_SCHEDULER_HPP
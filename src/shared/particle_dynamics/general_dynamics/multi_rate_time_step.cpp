@@ -0,0 +1,48 @@
+#include "multi_rate_time_step.h"
+
+namespace SPH
+{
+//=================================================================================================//
+BaseMultiRateTimeStep::BaseMultiRateTimeStep(BaseParticles &base_particles, UnsignedInt max_level)
+    : max_level_(max_level), top_level_(0), sub_step_(0), dt_min_(0.0), effective_speedup_(1.0),
+      dv_time_step_level_(nullptr), dv_limited_level_(nullptr),
+      dv_pos_(base_particles.getVariableByName<Vecd>("Position")),
+      dv_vel_(base_particles.registerStateVariableOnly<Vecd>("Velocity"))
+{
+    if (findVariableByName<UnsignedInt>(base_particles.VariablesToSort(), "TimeStepLevel") != nullptr)
+    {
+        std::cout << "\n Error: the body " << base_particles.getSPHBody().getName()
+                  << " has already a multi-rate time stepping!" << std::endl;
+        std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+        exit(1);
+    }
+    dv_time_step_level_ = base_particles.registerDiscreteVariableOnly<UnsignedInt>(
+        "TimeStepLevel", base_particles.ParticlesBound());
+    dv_limited_level_ = base_particles.registerDiscreteVariableOnly<UnsignedInt>(
+        "LimitedTimeStepLevel", base_particles.ParticlesBound());
+    base_particles.addVariableToSort<UnsignedInt>("TimeStepLevel");
+
+    if (max_level_ > 16)
+    {
+        std::cout << "\n Error: the maximum time-step level " << max_level_ << " is larger than 16!" << std::endl;
+        std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+        exit(1);
+    }
+}
+//=================================================================================================//
+UnsignedInt BaseMultiRateTimeStep::TopLevel(Real time_to_sync)
+{
+    UnsignedInt top_level = 0;
+    while (top_level < max_level_ && dt_min_ * Real(2u << top_level) <= time_to_sync)
+    {
+        ++top_level;
+    }
+    return top_level;
+}
+//=================================================================================================//
+void BaseMultiRateTimeStep::setEffectiveSpeedup(Real total_particles, Real sum_of_updates)
+{
+    effective_speedup_ = total_particles * Real(NumberOfSubSteps()) / (sum_of_updates + TinyReal);
+}
+//=================================================================================================//
+} // namespace SPH
@@ -0,0 +1,261 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2023 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file 	multi_rate_time_step.h
+ * @brief 	Individual particle time stepping with power-of-two binned time-step levels.
+ * @details Particles are binned into the levels dt_min * 2^k according to their own time-step size.
+ *          Within a synchronization period of 2^top_level smallest time steps,
+ *          a particle at level k is only integrated at every 2^k-th sub-step with its own time-step size.
+ *          Its neighbors at other levels are seen with their latest states.
+ *          The level of a particle is limited to be at most one larger than those of its neighbors,
+ *          and the particles skipped at a sub-step drift with their velocities so that
+ *          the neighbors see their positions at the current sub-step.
+ * @author	Xiangyu Hu
+ */
+
+#ifndef MULTI_RATE_TIME_STEP_H
+#define MULTI_RATE_TIME_STEP_H
+
+#include "base_general_dynamics.h"
+
+namespace SPH
+{
+/**
+ * @class TimeStepLevel
+ * @brief Time-step levels of the particles at a given sub-step.
+ * It is copied into the computing kernels.
+ */
+class TimeStepLevel
+{
+  public:
+    TimeStepLevel(UnsignedInt *level, Real dt_min, UnsignedInt sub_step)
+        : level_(level), dt_min_(dt_min), sub_step_(sub_step){};
+
+    bool isActive(size_t index_i) const { return (sub_step_ & ((1u << level_[index_i]) - 1)) == 0; };
+    Real TimeStep(size_t index_i) const { return dt_min_ * Real(1u << level_[index_i]); };
+    /** Position drift time at the end of the sub-step. An active particle has been advanced with its own
+     * time step and is moved back to the end of the sub-step, a skipped particle moves forward by one sub-step. */
+    Real DriftTime(size_t index_i) const { return isActive(index_i) ? dt_min_ - TimeStep(index_i) : dt_min_; };
+
+  protected:
+    UnsignedInt *level_;
+    Real dt_min_;
+    UnsignedInt sub_step_;
+};
+
+/** The highest level not larger than top_level with dt_min * 2^level not larger than the particle time step. */
+inline UnsignedInt binTimeStepLevel(Real time_step_ratio, UnsignedInt top_level)
+{
+    UnsignedInt level = 0;
+    while (level < top_level && Real(2u << level) <= time_step_ratio)
+    {
+        ++level;
+    }
+    return level;
+}
+
+/**
+ * @class BaseMultiRateTimeStep
+ * @brief Holding the time-step levels of a body and the sub-step within the synchronization period.
+ */
+class BaseMultiRateTimeStep
+{
+  public:
+    BaseMultiRateTimeStep(BaseParticles &base_particles, UnsignedInt max_level);
+    virtual ~BaseMultiRateTimeStep(){};
+    /** drift the particle positions to the end of the current sub-step, called after the integration of the sub-step. */
+    virtual void endSubStep() = 0;
+
+    UnsignedInt NumberOfSubSteps() { return 1u << top_level_; };
+    Real SmallestTimeStep() { return dt_min_; };
+    Real SynchronizationTimeStep() { return dt_min_ * Real(NumberOfSubSteps()); };
+    void setSubStep(UnsignedInt sub_step) { sub_step_ = sub_step; };
+    /** ratio between the particle updates with the smallest time step and those with the binned time steps. */
+    Real EffectiveSpeedup() { return effective_speedup_; };
+    DiscreteVariable<UnsignedInt> *dvTimeStepLevel() { return dv_time_step_level_; };
+
+    template <class ExecutionPolicy>
+    TimeStepLevel getTimeStepLevel(const ExecutionPolicy &ex_policy)
+    {
+        return TimeStepLevel(dv_time_step_level_->DelegatedData(ex_policy), dt_min_, sub_step_);
+    };
+
+  protected:
+    UnsignedInt max_level_, top_level_, sub_step_;
+    Real dt_min_, effective_speedup_;
+    DiscreteVariable<UnsignedInt> *dv_time_step_level_, *dv_limited_level_;
+    DiscreteVariable<Vecd> *dv_pos_, *dv_vel_;
+
+    /** the top level limited by the time interval to the next synchronization. */
+    UnsignedInt TopLevel(Real time_to_sync);
+    void setEffectiveSpeedup(Real total_particles, Real sum_of_updates);
+};
+
+/**
+ * @class MultiRateTimeStep
+ * @brief Computing the smallest time step by a time-step reduce type, such as fluid_dynamics::AcousticTimeStep,
+ * and binning the particles into time-step levels limited by the inner neighbors.
+ * The argument of exec is the time interval to the next synchronization,
+ * and the returned value is the synchronization time-step size.
+ */
+template <class TimeStepType, class ExecutionPolicy = ParallelPolicy>
+class MultiRateTimeStep : public TimeStepType, public BaseMultiRateTimeStep, public BaseDynamics<Real>
+{
+  public:
+    template <typename... Args>
+    MultiRateTimeStep(BaseInnerRelation &inner_relation, UnsignedInt max_level, Args &&...args)
+        : TimeStepType(inner_relation.getSPHBody(), std::forward<Args>(args)...),
+          BaseMultiRateTimeStep(inner_relation.getSPHBody().getBaseParticles(), max_level),
+          BaseDynamics<Real>(), inner_configuration_(inner_relation.inner_configuration_){};
+    virtual ~MultiRateTimeStep(){};
+
+    virtual Real exec(Real time_to_sync = 0.0) override
+    {
+        this->setupDynamics(0.0);
+        Real reduced_value = particle_reduce(ExecutionPolicy(),
+                                             this->identifier_.LoopRange(), this->Reference(), this->getOperation(),
+                                             [&](size_t i) -> Real
+                                             { return this->reduce(i, 0.0); });
+        dt_min_ = this->outputResult(reduced_value);
+        top_level_ = TopLevel(time_to_sync);
+        sub_step_ = 0;
+
+        UnsignedInt *time_step_level = dv_time_step_level_->Data();
+        particle_for(ExecutionPolicy(),
+                     this->identifier_.LoopRange(),
+                     [&](size_t i)
+                     {
+                         Real time_step_ratio = this->outputResult(this->reduce(i, 0.0)) / dt_min_;
+                         time_step_level[i] = binTimeStepLevel(time_step_ratio, top_level_);
+                     });
+        limitTimeStepLevel();
+
+        Real sum_of_updates = particle_reduce(ExecutionPolicy(),
+                                              this->identifier_.LoopRange(), Real(0), ReduceSum<Real>(),
+                                              [&](size_t i) -> Real
+                                              { return Real(1u << (top_level_ - time_step_level[i])); });
+        setEffectiveSpeedup(Real(this->particles_->TotalRealParticles()), sum_of_updates);
+        return SynchronizationTimeStep();
+    };
+
+    virtual void endSubStep() override
+    {
+        TimeStepLevel time_step_level = getTimeStepLevel(ExecutionPolicy());
+        Vecd *pos = dv_pos_->Data();
+        Vecd *vel = dv_vel_->Data();
+        particle_for(ExecutionPolicy(),
+                     this->identifier_.LoopRange(),
+                     [&](size_t i)
+                     { pos[i] += vel[i] * time_step_level.DriftTime(i); });
+    };
+
+  protected:
+    ParticleConfiguration &inner_configuration_;
+
+    /** Each pass lowers the level of a particle to at most one larger than those of its neighbors.
+     * As the levels are not larger than the top level, top-level passes are sufficient. */
+    void limitTimeStepLevel()
+    {
+        UnsignedInt *time_step_level = dv_time_step_level_->Data();
+        UnsignedInt *limited_level = dv_limited_level_->Data();
+        for (UnsignedInt pass = 0; pass != top_level_; ++pass)
+        {
+            particle_for(ExecutionPolicy(),
+                         this->identifier_.LoopRange(),
+                         [&](size_t i)
+                         {
+                             UnsignedInt level = time_step_level[i];
+                             const Neighborhood &inner_neighborhood = inner_configuration_[i];
+                             for (size_t n = 0; n != inner_neighborhood.current_size_; ++n)
+                             {
+                                 level = SMIN(level, time_step_level[inner_neighborhood.j_[n]] + 1);
+                             }
+                             limited_level[i] = level;
+                         });
+            particle_for(ExecutionPolicy(),
+                         this->identifier_.LoopRange(),
+                         [&](size_t i)
+                         { time_step_level[i] = limited_level[i]; });
+        }
+    };
+};
+
+/**
+ * @class MultiRateDynamics1Level
+ * @brief Dynamics1Level integrating only the particles active at the current sub-step
+ * with their own time-step sizes. The argument of exec is not used.
+ * The positions of all particles are brought to the end of the sub-step by BaseMultiRateTimeStep::endSubStep.
+ */
+template <class LocalDynamicsType, class ExecutionPolicy = ParallelPolicy>
+class MultiRateDynamics1Level : public Dynamics1Level<LocalDynamicsType, ExecutionPolicy>
+{
+  public:
+    template <typename... Args>
+    MultiRateDynamics1Level(BaseMultiRateTimeStep &multi_rate_time_step, Args &&...args)
+        : Dynamics1Level<LocalDynamicsType, ExecutionPolicy>(std::forward<Args>(args)...),
+          multi_rate_time_step_(multi_rate_time_step){};
+    virtual ~MultiRateDynamics1Level(){};
+
+    virtual void exec(Real dt = 0.0) override
+    {
+        TimeStepLevel time_step_level = multi_rate_time_step_.getTimeStepLevel(ExecutionPolicy());
+        Real dt_min = multi_rate_time_step_.SmallestTimeStep();
+        this->setUpdated(this->identifier_.getSPHBody());
+        this->setupDynamics(dt_min);
+
+        particle_for(ExecutionPolicy(),
+                     this->identifier_.LoopRange(),
+                     [&](size_t i)
+                     {
+                         if (time_step_level.isActive(i))
+                             this->initialization(i, time_step_level.TimeStep(i));
+                     });
+
+        this->runInteraction(dt_min);
+
+        particle_for(ExecutionPolicy(),
+                     this->identifier_.LoopRange(),
+                     [&](size_t i)
+                     {
+                         if (time_step_level.isActive(i))
+                             this->update(i, time_step_level.TimeStep(i));
+                     });
+    };
+
+    virtual void runMainStep(Real dt) override
+    {
+        TimeStepLevel time_step_level = multi_rate_time_step_.getTimeStepLevel(ExecutionPolicy());
+        particle_for(ExecutionPolicy(),
+                     this->identifier_.LoopRange(),
+                     [&](size_t i)
+                     {
+                         if (time_step_level.isActive(i))
+                             this->interaction(i, time_step_level.TimeStep(i));
+                     });
+    };
+
+  protected:
+    BaseMultiRateTimeStep &multi_rate_time_step_;
+};
+} // namespace SPH
+#endif // MULTI_RATE_TIME_STEP_H
@@ -89,7 +89,7 @@ void FreeSurfaceIndication<Contact<>>::interaction(size_t index_i, Real dt)
     Real pos_div = 0.0;
     for (size_t k = 0; k < contact_configuration_.size(); ++k)
     {
-        Real *Vol_k = contact_Vol_[k];
+        StorageReal *Vol_k = contact_Vol_[k];
         Neighborhood &contact_neighborhood = (*contact_configuration_[k])[index_i];
         for (size_t n = 0; n != contact_neighborhood.current_size_; ++n)
         {
@@ -106,7 +106,7 @@ FreeSurfaceIndication<Contact<NonWetting>>::FreeSurfaceIndication(BaseContactRel
     for (size_t k = 0; k != contact_particles_.size(); ++k)
     {
         contact_phi_.push_back(this->contact_particles_[k]->template getVariableDataByName<Real>("Phi"));
-        contact_Vol_.push_back(contact_particles_[k]->getVariableDataByName<Real>("VolumetricMeasure"));
+        contact_Vol_.push_back(contact_particles_[k]->getVariableDataByName<StorageReal>("VolumetricMeasure"));
     }
 }
 //=================================================================================================//
@@ -116,7 +116,7 @@ void FreeSurfaceIndication<Contact<NonWetting>>::interaction(size_t index_i, Rea
     for (size_t k = 0; k < contact_configuration_.size(); ++k)
     {
         Real *wetting_k = contact_phi_[k];
-        Real *Vol_k = contact_Vol_[k];
+        StorageReal *Vol_k = contact_Vol_[k];
         Neighborhood &contact_neighborhood = (*contact_configuration_[k])[index_i];
         for (size_t n = 0; n != contact_neighborhood.current_size_; ++n)
         {
@@ -54,7 +54,8 @@ class FreeSurfaceIndication<DataDelegationType>
 
   protected:
     int *indicator_;
-    Real *pos_div_, *Vol_;
+    Real *pos_div_;
+    StorageReal *Vol_;
     Real threshold_by_dimensions_;
 };
 
@@ -99,14 +100,14 @@ class FreeSurfaceIndication<Contact<>>
     {
         for (size_t k = 0; k != this->contact_particles_.size(); ++k)
         {
-            contact_Vol_.push_back(this->contact_particles_[k]->getVariableDataByName<Real>("VolumetricMeasure"));
+            contact_Vol_.push_back(this->contact_particles_[k]->getVariableDataByName<StorageReal>("VolumetricMeasure"));
         }
     };
     virtual ~FreeSurfaceIndication(){};
     void interaction(size_t index_i, Real dt = 0.0);
 
   protected:
-    StdVec<Real *> contact_Vol_;
+    StdVec<StorageReal *> contact_Vol_;
 };
 
 /**
@@ -128,7 +129,8 @@ class FreeSurfaceIndication<Contact<NonWetting>>
     void interaction(size_t index_i, Real dt = 0.0);
 
   protected:
-    StdVec<Real *> contact_phi_, contact_Vol_;
+    StdVec<Real *> contact_phi_;
+    StdVec<StorageReal *> contact_Vol_;
 };
 
 using FreeSurfaceIndicationComplex =
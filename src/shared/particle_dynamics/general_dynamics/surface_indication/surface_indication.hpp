@@ -11,7 +11,7 @@ FreeSurfaceIndication<DataDelegationType>::FreeSurfaceIndication(BaseRelationTyp
     : LocalDynamics(base_relation.getSPHBody()), DataDelegationType(base_relation),
       indicator_(this->particles_->template registerStateVariable<int>("Indicator")),
       pos_div_(this->particles_->template registerStateVariable<Real>("PositionDivergence")),
-      Vol_(this->particles_->template getVariableDataByName<Real>("VolumetricMeasure")),
+      Vol_(this->particles_->template getVariableDataByName<StorageReal>("VolumetricMeasure")),
       threshold_by_dimensions_(0.75 * Dimensions) {}
 //=================================================================================================//
 } // namespace SPH
@@ -39,7 +39,7 @@ void RelaxationResidue<Contact<>>::interaction(size_t index_i, Real dt)
     Vecd residue = Vecd::Zero();
     for (size_t k = 0; k < contact_configuration_.size(); ++k)
     {
-        Real *Vol_k = contact_Vol_[k];
+        StorageReal *Vol_k = contact_Vol_[k];
         Neighborhood &contact_neighborhood = (*contact_configuration_[k])[index_i];
         for (size_t n = 0; n != contact_neighborhood.current_size_; ++n)
         {
@@ -80,7 +80,7 @@ UpdateSmoothingLengthRatioByShape::
     UpdateSmoothingLengthRatioByShape(SPHBody &sph_body, Shape &target_shape)
     : LocalDynamics(sph_body),
       h_ratio_(particles_->getVariableDataByName<Real>("SmoothingLengthRatio")),
-      Vol_(particles_->getVariableDataByName<Real>("VolumetricMeasure")),
+      Vol_(particles_->getVariableDataByName<StorageReal>("VolumetricMeasure")),
       pos_(particles_->getVariableDataByName<Vecd>("Position")),
       target_shape_(target_shape),
       particle_adaptation_(DynamicCast<ParticleRefinementByShape>(this, sph_body.sph_adaptation_)),
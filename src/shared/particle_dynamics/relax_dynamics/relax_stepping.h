@@ -54,7 +54,7 @@ class RelaxationResidue<Base, DataDelegationType>
 
   protected:
     SPHAdaptation *sph_adaptation_;
-    Real *Vol_;
+    StorageReal *Vol_;
     Vecd *residue_;
 };
 
@@ -100,14 +100,14 @@ class RelaxationResidue<Contact<>>
     {
         for (size_t k = 0; k < this->contact_configuration_.size(); ++k)
         {
-            contact_Vol_.push_back(this->contact_particles_[k]->template registerStateVariable<Real>("VolumetricMeasure"));
+            contact_Vol_.push_back(this->contact_particles_[k]->template registerStateVariable<StorageReal>("VolumetricMeasure"));
         }
     };
     virtual ~RelaxationResidue(){};
     void interaction(size_t index_i, Real dt = 0.0);
 
   protected:
-    StdVec<Real *> contact_Vol_;
+    StdVec<StorageReal *> contact_Vol_;
 };
 
 /**
@@ -146,7 +146,8 @@ class PositionRelaxation : public LocalDynamics
 class UpdateSmoothingLengthRatioByShape : public LocalDynamics
 {
   protected:
-    Real *h_ratio_, *Vol_;
+    Real *h_ratio_;
+    StorageReal *Vol_;
     Vecd *pos_;
     Shape &target_shape_;
     ParticleRefinementByShape *particle_adaptation_;
@@ -8,7 +8,7 @@ namespace solid_dynamics
 PairwiseFrictionFromWall::
     PairwiseFrictionFromWall(BaseContactRelation &contact_relation, Real eta)
     : LocalDynamics(contact_relation.getSPHBody()), DataDelegateContact(contact_relation),
-      eta_(eta), Vol_(particles_->getVariableDataByName<Real>("VolumetricMeasure")),
+      eta_(eta), Vol_(particles_->getVariableDataByName<StorageReal>("VolumetricMeasure")),
       mass_(particles_->getVariableDataByName<Real>("Mass")),
       vel_(particles_->getVariableDataByName<Vecd>("Velocity"))
 {
@@ -16,7 +16,7 @@ PairwiseFrictionFromWall::
     {
         wall_vel_n_.push_back(contact_particles_[k]->registerStateVariable<Vecd>("Velocity"));
         wall_n_.push_back(contact_particles_[k]->template getVariableDataByName<Vecd>("NormalDirection"));
-        wall_Vol_n_.push_back(contact_particles_[k]->getVariableDataByName<Real>("VolumetricMeasure"));
+        wall_Vol_n_.push_back(contact_particles_[k]->getVariableDataByName<StorageReal>("VolumetricMeasure"));
     }
 }
 //=================================================================================================//
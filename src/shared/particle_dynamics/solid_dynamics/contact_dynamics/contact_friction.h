@@ -59,7 +59,7 @@ class PairwiseFrictionFromWall : public LocalDynamics, public DataDelegateContac
         {
             Vecd *vel_k = wall_vel_n_[k];
             Vecd *n_k = wall_n_[k];
-            Real *Vol_k = wall_Vol_n_[k];
+            StorageReal *Vol_k = wall_Vol_n_[k];
             Neighborhood &contact_neighborhood = (*contact_configuration_[k])[index_i];
             // forward sweep
             for (size_t n = 0; n != contact_neighborhood.current_size_; ++n)
@@ -93,9 +93,10 @@ class PairwiseFrictionFromWall : public LocalDynamics, public DataDelegateContac
 
   protected:
     Real eta_; /**< friction coefficient */
-    Real *Vol_, *mass_;
+    StorageReal *Vol_;
+    Real *mass_;
     Vecd *vel_;
-    StdVec<Real *> wall_Vol_n_;
+    StdVec<StorageReal *> wall_Vol_n_;
     StdVec<Vecd *> wall_vel_n_, wall_n_;
 };
 
@@ -40,7 +40,7 @@ RepulsionForce<Contact<>>::RepulsionForce(BaseContactRelation &solid_body_contac
     for (size_t k = 0; k != contact_particles_.size(); ++k)
     {
         contact_solids_.push_back(&DynamicCast<Solid>(this, contact_bodies_[k]->getBaseMaterial()));
-        contact_Vol_.push_back(contact_particles_[k]->getVariableDataByName<Real>("VolumetricMeasure"));
+        contact_Vol_.push_back(contact_particles_[k]->getVariableDataByName<StorageReal>("VolumetricMeasure"));
         contact_repulsion_factor_.push_back(contact_particles_[k]->getVariableDataByName<Real>("RepulsionFactor"));
 
         const Real contact_stiffness_k = contact_solids_[k]->ContactStiffness();
@@ -56,7 +56,7 @@ void RepulsionForce<Contact<>>::interaction(size_t index_i, Real dt)
     {
         Vecd force_k = Vecd::Zero();
         Real *contact_repulsion_facto_k = contact_repulsion_factor_[k];
-        Real *Vol_k = contact_Vol_[k];
+        StorageReal *Vol_k = contact_Vol_[k];
 
         Neighborhood &contact_neighborhood = (*contact_configuration_[k])[index_i];
         for (size_t n = 0; n != contact_neighborhood.current_size_; ++n)
@@ -80,7 +80,7 @@ RepulsionForce<Contact<Wall>>::RepulsionForce(BaseContactRelation &solid_body_co
 {
     for (size_t k = 0; k < this->contact_configuration_.size(); ++k)
     {
-        contact_Vol_.push_back(this->contact_particles_[k]->template registerStateVariable<Real>("VolumetricMeasure"));
+        contact_Vol_.push_back(this->contact_particles_[k]->template registerStateVariable<StorageReal>("VolumetricMeasure"));
     }
 }
 //=================================================================================================//
@@ -91,7 +91,7 @@ void RepulsionForce<Contact<Wall>>::interaction(size_t index_i, Real dt)
     Vecd force = Vecd::Zero();
     for (size_t k = 0; k < contact_configuration_.size(); ++k)
     {
-        Real *Vol_k = contact_Vol_[k];
+        StorageReal *Vol_k = contact_Vol_[k];
         Neighborhood &contact_neighborhood = (*contact_configuration_[k])[index_i];
         for (size_t n = 0; n != contact_neighborhood.current_size_; ++n)
         {
@@ -111,7 +111,7 @@ RepulsionForce<Wall, Contact<>>::RepulsionForce(BaseContactRelation &solid_body_
     for (size_t k = 0; k != contact_particles_.size(); ++k)
     {
         contact_solids_.push_back(&DynamicCast<Solid>(this, contact_bodies_[k]->getBaseMaterial()));
-        contact_Vol_.push_back(contact_particles_[k]->getVariableDataByName<Real>("VolumetricMeasure"));
+        contact_Vol_.push_back(contact_particles_[k]->getVariableDataByName<StorageReal>("VolumetricMeasure"));
         contact_repulsion_factor_.push_back(contact_particles_[k]->getVariableDataByName<Real>("RepulsionFactor"));
     }
 }
@@ -121,7 +121,7 @@ void RepulsionForce<Wall, Contact<>>::interaction(size_t index_i, Real dt)
     Vecd force = Vecd::Zero();
     for (size_t k = 0; k < contact_configuration_.size(); ++k)
     {
-        Real *Vol_k = contact_Vol_[k];
+        StorageReal *Vol_k = contact_Vol_[k];
         Real *contact_repulsion_facto_k = contact_repulsion_factor_[k];
         Solid *solid_k = contact_solids_[k];
 
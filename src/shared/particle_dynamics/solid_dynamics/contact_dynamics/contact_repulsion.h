@@ -50,12 +50,12 @@ class RepulsionForce<Base, DataDelegationType>
     RepulsionForce(BaseRelationType &base_relation, const std::string &variable_name)
         : ForcePrior(base_relation.getSPHBody(), variable_name), DataDelegationType(base_relation),
           repulsion_force_(this->particles_->template registerStateVariable<Vecd>(variable_name)),
-          Vol_(this->particles_->template getVariableDataByName<Real>("VolumetricMeasure")){};
+          Vol_(this->particles_->template getVariableDataByName<StorageReal>("VolumetricMeasure")){};
     virtual ~RepulsionForce(){};
 
   protected:
     Vecd *repulsion_force_;
-    Real *Vol_;
+    StorageReal *Vol_;
 };
 
 template <>
@@ -87,7 +87,8 @@ class RepulsionForce<Contact<>> : public RepulsionForce<Base, DataDelegateContac
     Real *repulsion_factor_;
     StdVec<Solid *> contact_solids_;
     StdVec<Real> contact_stiffness_ave_;
-    StdVec<Real *> contact_repulsion_factor_, contact_Vol_;
+    StdVec<Real *> contact_repulsion_factor_;
+    StdVec<StorageReal *> contact_Vol_;
 };
 using ContactForce = RepulsionForce<Contact<>>;
 
@@ -102,7 +103,7 @@ class RepulsionForce<Contact<Wall>> : public RepulsionForce<Base, DataDelegateCo
   protected:
     Solid &solid_;
     Real *repulsion_factor_;
-    StdVec<Real *> contact_Vol_;
+    StdVec<StorageReal *> contact_Vol_;
 };
 using ContactForceFromWall = RepulsionForce<Contact<Wall>>;
 
@@ -116,7 +117,8 @@ class RepulsionForce<Wall, Contact<>> : public RepulsionForce<Base, DataDelegate
 
   protected:
     StdVec<Solid *> contact_solids_;
-    StdVec<Real *> contact_repulsion_factor_, contact_Vol_;
+    StdVec<Real *> contact_repulsion_factor_;
+    StdVec<StorageReal *> contact_Vol_;
 };
 using ContactForceToWall = RepulsionForce<Wall, Contact<>>;
 } // namespace solid_dynamics
@@ -69,7 +69,7 @@ ShellContactFactor::ShellContactFactor(ShellSurfaceContactRelation &solid_body_c
         /** a calibration factor to avoid particle penetration into shell structure */
         calibration_factor_.push_back(1.0 / (contact_max + Eps));
 
-        contact_Vol_.push_back(contact_particles_[k]->getVariableDataByName<Real>("VolumetricMeasure"));
+        contact_Vol_.push_back(contact_particles_[k]->getVariableDataByName<StorageReal>("VolumetricMeasure"));
     }
 }
 //=================================================================================================//
@@ -81,7 +81,7 @@ void ShellContactFactor::interaction(size_t index_i, Real dt)
 
     for (size_t k = 0; k < contact_configuration_.size(); ++k)
     {
-        Real *contact_Vol_k = contact_Vol_[k];
+        StorageReal *contact_Vol_k = contact_Vol_[k];
         Neighborhood &contact_neighborhood = (*contact_configuration_[k])[index_i];
         for (size_t n = 0; n != contact_neighborhood.current_size_; ++n)
         {
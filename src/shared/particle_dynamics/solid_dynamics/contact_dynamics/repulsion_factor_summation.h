@@ -101,7 +101,7 @@ class ShellContactFactor : public RepulsionFactorSummation<Base, DataDelegateCon
     Real particle_spacing_;
     StdVec<Real> calibration_factor_;
     StdVec<Real> offset_W_ij_;
-    StdVec<Real *> contact_Vol_;
+    StdVec<StorageReal *> contact_Vol_;
 
     /** Abscissas and weights for Gauss-Legendre quadrature integration with n=3 nodes */
     const StdVec<Real> three_gaussian_points_ = {-0.7745966692414834, 0.0, 0.7745966692414834};
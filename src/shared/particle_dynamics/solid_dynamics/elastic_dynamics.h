@@ -124,7 +124,7 @@ class DeformationGradientBySummation : public LocalDynamics, public DataDelegate
     };
 
   protected:
-    Real *Vol_;
+    StorageReal *Vol_;
     Vecd *pos_;
     Matd *B_, *F_;
 };
@@ -140,7 +140,7 @@ class BaseElasticIntegration : public LocalDynamics, public DataDelegateInner
     virtual ~BaseElasticIntegration(){};
 
   protected:
-    Real *Vol_;
+    StorageReal *Vol_;
     Vecd *pos_, *vel_, *force_;
     Matd *B_, *F_, *dF_dt_;
 };
@@ -160,7 +160,8 @@ class BaseIntegration1stHalf : public BaseElasticIntegration
   protected:
     ElasticSolid &elastic_solid_;
     Real rho0_, inv_rho0_;
-    Real *rho_, *mass_;
+    StorageReal *rho_;
+    Real *mass_;
     Vecd *force_prior_;
     Real smoothing_length_;
 };
@@ -209,16 +210,52 @@ class Integration1stHalf : public BaseIntegration1stHalf
 };
 
 /**
- * @class Integration1stHalfPK2
- * @brief Using PK2 stress constitute relation
+ * @brief The material on which the constitutive kernel is built.
+ * The kernel of an abstract material dispatches through the virtual interface and accepts any derived material,
+ * while that of a concrete material is dispatched statically and requires the exact material type.
+ */
+template <class MaterialType, class OwnerType, class CastedType>
+MaterialType &ConstitutiveCast(OwnerType *owner, CastedType &casted)
+{
+    if constexpr (std::is_abstract_v<MaterialType>)
+    {
+        return DynamicCast<MaterialType>(owner, casted);
+    }
+    else
+    {
+        return ExactCast<MaterialType>(owner, casted);
+    }
+}
+
+/**
+ * @class ConstitutiveIntegration1stHalfPK2
+ * @brief Using PK2 stress constitute relation given by the constitutive kernel of the material type
  */
-class Integration1stHalfPK2 : public Integration1stHalf
+template <class ElasticSolidType>
+class ConstitutiveIntegration1stHalfPK2 : public Integration1stHalf
 {
+    using ConstituteKernel = typename ElasticSolidType::ConstituteKernel;
+
   public:
-    explicit Integration1stHalfPK2(BaseInnerRelation &inner_relation);
-    virtual ~Integration1stHalfPK2(){};
-    void initialization(size_t index_i, Real dt = 0.0);
+    explicit ConstitutiveIntegration1stHalfPK2(BaseInnerRelation &inner_relation)
+        : Integration1stHalf(inner_relation),
+          constitute_(ConstitutiveCast<ElasticSolidType>(this, elastic_solid_)){};
+    virtual ~ConstitutiveIntegration1stHalfPK2(){};
+
+    void initialization(size_t index_i, Real dt = 0.0)
+    {
+        pos_[index_i] += vel_[index_i] * dt * 0.5;
+        F_[index_i] += dF_dt_[index_i] * dt * 0.5;
+        rho_[index_i] = rho0_ / F_[index_i].determinant();
+        // obtain the first Piola-Kirchhoff stress from the second Piola-Kirchhoff stress
+        // it seems using reproducing correction here increases convergence rate near the free surface, note that the correction matrix is in a form of transpose
+        stress_PK1_B_[index_i] = constitute_.StressPK1(F_[index_i], index_i) * B_[index_i].transpose();
+    };
+
+  protected:
+    ConstituteKernel constitute_;
 };
+using Integration1stHalfPK2 = ConstitutiveIntegration1stHalfPK2<ElasticSolid>;
 
 /** @class Integration1stHalfCauchy
  * @brief Using Cauchy stress constitute relation
@@ -232,19 +269,46 @@ class Integration1stHalfCauchy : public Integration1stHalf
 };
 
 /**
- * @class Integration1stHalfKirchhoff
- * @brief Using Kirchhoff stress constitute relation
+ * @class ConstitutiveIntegration1stHalfKirchhoff
+ * @brief Using Kirchhoff stress constitute relation given by the constitutive kernel of the material type
  */
-class Integration1stHalfKirchhoff : public Integration1stHalf
+template <class ElasticSolidType>
+class ConstitutiveIntegration1stHalfKirchhoff : public Integration1stHalf
 {
+    using ConstituteKernel = typename ElasticSolidType::ConstituteKernel;
+
   public:
-    explicit Integration1stHalfKirchhoff(BaseInnerRelation &inner_relation);
-    virtual ~Integration1stHalfKirchhoff(){};
-    void initialization(size_t index_i, Real dt = 0.0);
+    explicit ConstitutiveIntegration1stHalfKirchhoff(BaseInnerRelation &inner_relation)
+        : Integration1stHalf(inner_relation),
+          constitute_(ConstitutiveCast<ElasticSolidType>(this, elastic_solid_)){};
+    virtual ~ConstitutiveIntegration1stHalfKirchhoff(){};
+
+    void initialization(size_t index_i, Real dt = 0.0)
+    {
+        pos_[index_i] += vel_[index_i] * dt * 0.5;
+        F_[index_i] += dF_dt_[index_i] * dt * 0.5;
+        Real J = F_[index_i].determinant();
+        Real one_over_J = 1.0 / J;
+        rho_[index_i] = rho0_ * one_over_J;
+        Real J_to_minus_2_over_dimension = pow(one_over_J, 2.0 * OneOverDimensions);
+        Matd normalized_b = (F_[index_i] * F_[index_i].transpose()) * J_to_minus_2_over_dimension;
+        Matd deviatoric_b = normalized_b - Matd::Identity() * normalized_b.trace() * OneOverDimensions;
+        Matd inverse_F_T = F_[index_i].inverse().transpose();
+        // obtain the first Piola-Kirchhoff stress from the Kirchhoff stress
+        // it seems using reproducing correction here increases convergence rate
+        // near the free surface however, this correction is not used for the numerical dissipation
+        stress_PK1_B_[index_i] = (Matd::Identity() * constitute_.VolumetricKirchhoff(J) +
+                                  constitute_.DeviatoricKirchhoff(deviatoric_b)) *
+                                 inverse_F_T * B_[index_i];
+    };
+
+  protected:
+    ConstituteKernel constitute_;
 };
+using Integration1stHalfKirchhoff = ConstitutiveIntegration1stHalfKirchhoff<ElasticSolid>;
 
 /**
- * @class DecomposedIntegration1stHalf
+ * @class BaseDecomposedIntegration1stHalf
  * @brief Decompose the stress into particle stress includes isotropic stress
  * and the stress due to non-homogeneous material properties.
  * The preliminary shear stress is introduced by particle pair to avoid
@@ -258,12 +322,11 @@ class Integration1stHalfKirchhoff : public Integration1stHalf
  * it may be due to the determinate of deformation matrix become negative.
  * In this case, you may need decrease CFL number when computing time-step size.
  */
-class DecomposedIntegration1stHalf : public BaseIntegration1stHalf
+class BaseDecomposedIntegration1stHalf : public BaseIntegration1stHalf
 {
   public:
-    explicit DecomposedIntegration1stHalf(BaseInnerRelation &inner_relation);
-    virtual ~DecomposedIntegration1stHalf(){};
-    void initialization(size_t index_i, Real dt = 0.0);
+    explicit BaseDecomposedIntegration1stHalf(BaseInnerRelation &inner_relation);
+    virtual ~BaseDecomposedIntegration1stHalf(){};
 
     inline void interaction(size_t index_i, Real dt = 0.0)
     {
@@ -288,6 +351,43 @@ class DecomposedIntegration1stHalf : public BaseIntegration1stHalf
     const Real correction_factor_ = 1.07;
 };
 
+/**
+ * @class ConstitutiveDecomposedIntegration1stHalf
+ * @brief Decomposed stress given by the constitutive kernel of the material type
+ */
+template <class ElasticSolidType>
+class ConstitutiveDecomposedIntegration1stHalf : public BaseDecomposedIntegration1stHalf
+{
+    using ConstituteKernel = typename ElasticSolidType::ConstituteKernel;
+
+  public:
+    explicit ConstitutiveDecomposedIntegration1stHalf(BaseInnerRelation &inner_relation)
+        : BaseDecomposedIntegration1stHalf(inner_relation),
+          constitute_(ConstitutiveCast<ElasticSolidType>(this, elastic_solid_)){};
+    virtual ~ConstitutiveDecomposedIntegration1stHalf(){};
+
+    void initialization(size_t index_i, Real dt = 0.0)
+    {
+        pos_[index_i] += vel_[index_i] * dt * 0.5;
+        F_[index_i] += dF_dt_[index_i] * dt * 0.5;
+        Real J = F_[index_i].determinant();
+        Real one_over_J = 1.0 / J;
+        rho_[index_i] = rho0_ * one_over_J;
+        J_to_minus_2_over_dimension_[index_i] = pow(one_over_J * one_over_J, OneOverDimensions);
+
+        inverse_F_T_[index_i] = F_[index_i].inverse().transpose();
+        stress_on_particle_[index_i] =
+            inverse_F_T_[index_i] * (constitute_.VolumetricKirchhoff(J) -
+                                     correction_factor_ * constitute_.ShearModulus() * J_to_minus_2_over_dimension_[index_i] *
+                                         (F_[index_i] * F_[index_i].transpose()).trace() * OneOverDimensions) +
+            constitute_.NumericalDampingLeftCauchy(F_[index_i], dF_dt_[index_i], smoothing_length_, index_i) * inverse_F_T_[index_i];
+    };
+
+  protected:
+    ConstituteKernel constitute_;
+};
+using DecomposedIntegration1stHalf = ConstitutiveDecomposedIntegration1stHalf<ElasticSolid>;
+
 /**
  * @class Integration1stHalfPK2RightCauchy
  * @brief Using PK2 stress constitute relation and right Cauchy damping
@@ -9,7 +9,7 @@ namespace solid_dynamics
 BaseForceFromFluid::BaseForceFromFluid(BaseContactRelation &contact_relation, const std::string &force_name)
     : ForcePrior(contact_relation.getSPHBody(), force_name), DataDelegateContact(contact_relation),
       solid_(DynamicCast<Solid>(this, sph_body_.getBaseMaterial())),
-      Vol_(particles_->getVariableDataByName<Real>("VolumetricMeasure")),
+      Vol_(particles_->getVariableDataByName<StorageReal>("VolumetricMeasure")),
       force_from_fluid_(particles_->getVariableDataByName<Vecd>(force_name))
 {
     for (size_t k = 0; k != contact_particles_.size(); ++k)
@@ -25,7 +25,7 @@ ViscousForceFromFluid::ViscousForceFromFluid(BaseContactRelation &contact_relati
     for (size_t k = 0; k != contact_particles_.size(); ++k)
     {
         contact_vel_.push_back(contact_particles_[k]->getVariableDataByName<Vecd>("Velocity"));
-        contact_Vol_.push_back(contact_particles_[k]->getVariableDataByName<Real>("VolumetricMeasure"));
+        contact_Vol_.push_back(contact_particles_[k]->getVariableDataByName<StorageReal>("VolumetricMeasure"));
         mu_.push_back(contact_fluids_[k]->ReferenceViscosity());
         smoothing_length_.push_back(contact_bodies_[k]->sph_adaptation_->ReferenceSmoothingLength());
     }
@@ -40,7 +40,7 @@ void ViscousForceFromFluid::interaction(size_t index_i, Real dt)
         Real mu_k = mu_[k];
         Real smoothing_length_k = smoothing_length_[k];
         Vecd *vel_n_k = contact_vel_[k];
-        Real *Vol_k = contact_Vol_[k];
+        StorageReal *Vol_k = contact_Vol_[k];
         Neighborhood &contact_neighborhood = (*contact_configuration_[k])[index_i];
         for (size_t n = 0; n != contact_neighborhood.current_size_; ++n)
         {
@@ -52,7 +52,7 @@ class BaseForceFromFluid : public ForcePrior, public DataDelegateContact
 
   protected:
     Solid &solid_;
-    Real *Vol_;
+    StorageReal *Vol_;
     StdVec<Fluid *> contact_fluids_;
     Vecd *force_from_fluid_;
 };
@@ -70,7 +70,7 @@ class ViscousForceFromFluid : public BaseForceFromFluid
 
   protected:
     Vecd *vel_ave_;
-    StdVec<Real *> contact_Vol_;
+    StdVec<StorageReal *> contact_Vol_;
     StdVec<Vecd *> contact_vel_;
     StdVec<Real> mu_;
     StdVec<Real> smoothing_length_;
@@ -95,7 +95,9 @@ class PressureForceFromFluid : public BaseForceFromFluid
 
   protected:
     Vecd *vel_ave_, *acc_ave_, *n_;
-    StdVec<Real *> contact_rho_, contact_mass_, contact_p_, contact_Vol_;
+    StdVec<StorageReal *> contact_rho_;
+    StdVec<Real *> contact_mass_, contact_p_;
+    StdVec<StorageReal *> contact_Vol_;
     StdVec<Vecd *> contact_vel_, contact_force_prior_;
     StdVec<RiemannSolverType> riemann_solvers_;
 };
@@ -18,10 +18,10 @@ PressureForceFromFluid<FluidIntegration2ndHalfType>::
 {
     for (size_t k = 0; k != contact_particles_.size(); ++k)
     {
-        contact_rho_.push_back(contact_particles_[k]->template getVariableDataByName<Real>("Density"));
+        contact_rho_.push_back(contact_particles_[k]->template getVariableDataByName<StorageReal>("Density"));
         contact_mass_.push_back(contact_particles_[k]->template getVariableDataByName<Real>("Mass"));
         contact_vel_.push_back(contact_particles_[k]->template getVariableDataByName<Vecd>("Velocity"));
-        contact_Vol_.push_back(contact_particles_[k]->template getVariableDataByName<Real>("VolumetricMeasure"));
+        contact_Vol_.push_back(contact_particles_[k]->template getVariableDataByName<StorageReal>("VolumetricMeasure"));
         contact_p_.push_back(contact_particles_[k]->template getVariableDataByName<Real>("Pressure"));
         contact_force_prior_.push_back(contact_particles_[k]->template getVariableDataByName<Vecd>("ForcePrior"));
         riemann_solvers_.push_back(RiemannSolverType(*contact_fluids_[k], *contact_fluids_[k]));
@@ -34,8 +34,8 @@ void PressureForceFromFluid<FluidIntegration2ndHalfType>::interaction(size_t ind
     Vecd force = Vecd::Zero();
     for (size_t k = 0; k < contact_configuration_.size(); ++k)
     {
-        Real *Vol_k = contact_Vol_[k];
-        Real *rho_k = contact_rho_[k];
+        StorageReal *Vol_k = contact_Vol_[k];
+        StorageReal *rho_k = contact_rho_[k];
         Real *mass_k = contact_mass_[k];
         Real *p_k = contact_p_[k];
         Vecd *vel_k = contact_vel_[k];
@@ -37,16 +37,15 @@ namespace SPH
 namespace solid_dynamics
 {
 /**
- * @class DecomposedPlasticIntegration1stHalf
+ * @class BaseDecomposedPlasticIntegration1stHalf
  * @brief Generalized essentially non-hourglass control formulation based on volumetric-deviatoric stress decomposition.
  */
-class DecomposedPlasticIntegration1stHalf
-    : public DecomposedIntegration1stHalf
+class BaseDecomposedPlasticIntegration1stHalf
+    : public BaseDecomposedIntegration1stHalf
 {
   public:
-    DecomposedPlasticIntegration1stHalf(BaseInnerRelation &inner_relation);
-    virtual ~DecomposedPlasticIntegration1stHalf(){};
-    void initialization(size_t index_i, Real dt = 0.0);
+    BaseDecomposedPlasticIntegration1stHalf(BaseInnerRelation &inner_relation);
+    virtual ~BaseDecomposedPlasticIntegration1stHalf(){};
 
     inline void interaction(size_t index_i, Real dt = 0.0)
     {
@@ -78,5 +77,44 @@ class DecomposedPlasticIntegration1stHalf
     PlasticSolid &plastic_solid_;
     Matd *scaling_matrix_, *inverse_F_;
 };
+
+/**
+ * @class ConstitutiveDecomposedPlasticIntegration1stHalf
+ * @brief Decomposed plastic integration with the return mapping given by the constitutive kernel of the plastic solid type
+ */
+template <class PlasticSolidType>
+class ConstitutiveDecomposedPlasticIntegration1stHalf : public BaseDecomposedPlasticIntegration1stHalf
+{
+    using ConstituteKernel = typename PlasticSolidType::ConstituteKernel;
+
+  public:
+    explicit ConstitutiveDecomposedPlasticIntegration1stHalf(BaseInnerRelation &inner_relation)
+        : BaseDecomposedPlasticIntegration1stHalf(inner_relation),
+          constitute_(ConstitutiveCast<PlasticSolidType>(this, plastic_solid_)){};
+    virtual ~ConstitutiveDecomposedPlasticIntegration1stHalf(){};
+
+    void initialization(size_t index_i, Real dt = 0.0)
+    {
+        pos_[index_i] += vel_[index_i] * dt * 0.5;
+        F_[index_i] += dF_dt_[index_i] * dt * 0.5;
+        Real J = F_[index_i].determinant();
+        Real one_over_J = 1.0 / J;
+        rho_[index_i] = rho0_ * one_over_J;
+
+        Matd normalized_be = constitute_.ElasticLeftCauchy(F_[index_i], index_i, dt);
+        inverse_F_[index_i] = F_[index_i].inverse();
+        Matd inverse_F_T = inverse_F_[index_i].transpose();
+        scaling_matrix_[index_i] = normalized_be * inverse_F_T;
+        Real isotropic_stress = constitute_.ShearModulus() * normalized_be.trace() * OneOverDimensions;
+        // Note that as we use small numerical damping here, the time step size (CFL number) may need to be decreased.
+        stress_on_particle_[index_i] =
+            inverse_F_T * (constitute_.VolumetricKirchhoff(J) - isotropic_stress) +
+            0.125 * constitute_.NumericalDampingLeftCauchy(F_[index_i], dF_dt_[index_i], smoothing_length_, index_i) * inverse_F_T;
+    };
+
+  protected:
+    ConstituteKernel constitute_;
+};
+using DecomposedPlasticIntegration1stHalf = ConstitutiveDecomposedPlasticIntegration1stHalf<PlasticSolid>;
 } // namespace solid_dynamics
 } // namespace SPH
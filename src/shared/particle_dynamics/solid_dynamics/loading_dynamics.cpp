@@ -58,7 +58,7 @@ SpringNormalOnSurfaceParticles::
       n_(particles_->getVariableDataByName<Vecd>("NormalDirection")),
       n0_(particles_->registerStateVariableFrom<Vecd>("InitialNormalDirection", "NormalDirection")),
       vel_(particles_->getVariableDataByName<Vecd>("Velocity")),
-      Vol_(particles_->getVariableDataByName<Real>("VolumetricMeasure")),
+      Vol_(particles_->getVariableDataByName<StorageReal>("VolumetricMeasure")),
       mass_(particles_->getVariableDataByName<Real>("Mass")),
       is_spring_force_applied_(particles_->addUniqueDiscreteVariable<bool>(
           "isSpringForceApplied", particles_->ParticlesBound(), false))
@@ -127,7 +127,7 @@ SpringOnSurfaceParticles::
       pos_(particles_->getVariableDataByName<Vecd>("Position")),
       pos0_(particles_->registerStateVariableFrom<Vecd>("InitialPosition", "Position")),
       vel_(particles_->getVariableDataByName<Vecd>("Velocity")),
-      Vol_(particles_->getVariableDataByName<Real>("VolumetricMeasure")),
+      Vol_(particles_->getVariableDataByName<StorageReal>("VolumetricMeasure")),
       mass_(particles_->getVariableDataByName<Real>("Mass")),
       is_spring_force_applied_(particles_->addUniqueDiscreteVariable<bool>(
           "isSpringForceApplied", particles_->ParticlesBound(), false))
@@ -205,7 +205,7 @@ SurfacePressureFromSource::
     : BaseLoadingForce<BodyPartByParticle>(body_part, "SurfacePressureForce"),
       pos0_(particles_->registerStateVariableFrom<Vecd>("InitialPosition", "Position")),
       n_(particles_->getVariableDataByName<Vecd>("NormalDirection")),
-      Vol_(particles_->getVariableDataByName<Real>("VolumetricMeasure")),
+      Vol_(particles_->getVariableDataByName<StorageReal>("VolumetricMeasure")),
       mass_(particles_->getVariableDataByName<Real>("Mass")),
       pressure_over_time_(pressure_over_time),
       is_pressure_applied_(particles_->addUniqueDiscreteVariable<bool>(
@@ -271,7 +271,7 @@ void SurfacePressureFromSource::update(size_t index_i, Real dt)
 PressureForceOnShell::PressureForceOnShell(SPHBody &sph_body, Real pressure)
     : LoadingForce(sph_body, "PressureForceOnShell"),
       pressure_(pressure),
-      Vol_(particles_->getVariableDataByName<Real>("VolumetricMeasure")),
+      Vol_(particles_->getVariableDataByName<StorageReal>("VolumetricMeasure")),
       n_(particles_->getVariableDataByName<Vecd>("NormalDirection")) {}
 //=================================================================================================//
 void PressureForceOnShell::update(size_t index_i, Real dt)
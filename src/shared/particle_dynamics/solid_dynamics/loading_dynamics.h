@@ -101,7 +101,8 @@ class SpringNormalOnSurfaceParticles : public LoadingForce
 
   protected:
     Vecd *pos_, *pos0_, *n_, *n0_, *vel_;
-    Real *Vol_, *mass_;
+    StorageReal *Vol_;
+    Real *mass_;
     Real stiffness_;
     Real damping_coeff_; // damping component parallel to the spring force component
     bool *is_spring_force_applied_;
@@ -123,7 +124,8 @@ class SpringOnSurfaceParticles : public LoadingForce
 {
   protected:
     Vecd *pos_, *pos0_, *vel_;
-    Real *Vol_, *mass_;
+    StorageReal *Vol_;
+    Real *mass_;
     Real stiffness_;
     Real damping_coeff_; // damping component parallel to the spring force component
     bool *is_spring_force_applied_;
@@ -187,7 +189,8 @@ class SurfacePressureFromSource : public BaseLoadingForce<BodyPartByParticle>
 
   protected:
     Vecd *pos0_, *n_;
-    Real *Vol_, *mass_;
+    StorageReal *Vol_;
+    Real *mass_;
     StdVec<std::array<Real, 2>> pressure_over_time_;
     bool *is_pressure_applied_;
     Real *physical_time_;
@@ -198,7 +201,7 @@ class PressureForceOnShell : public LoadingForce
 {
   protected:
     Real pressure_;
-    Real *Vol_;
+    StorageReal *Vol_;
     Vecd *n_;
 
   public:
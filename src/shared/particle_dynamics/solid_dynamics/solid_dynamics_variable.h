@@ -106,7 +106,7 @@ class VonMisesStress : public BaseDerivedVariable<Real>
 
   protected:
     Real rho0_;
-    Real *rho_;
+    StorageReal *rho_;
     Matd *F_;
     ElasticSolid &elastic_solid_;
 };
@@ -53,7 +53,7 @@ Real ShellAcousticTimeStepSize::reduce(size_t index_i, Real dt)
 ShellCorrectConfiguration::
     ShellCorrectConfiguration(BaseInnerRelation &inner_relation)
     : LocalDynamics(inner_relation.getSPHBody()), DataDelegateInner(inner_relation),
-      Vol_(particles_->getVariableDataByName<Real>("VolumetricMeasure")),
+      Vol_(particles_->getVariableDataByName<StorageReal>("VolumetricMeasure")),
       B_(particles_->registerStateVariable<Matd>("LinearGradientCorrectionMatrix", IdentityMatrix<Matd>::value)),
       n0_(particles_->registerStateVariableFrom<Vecd>("InitialNormalDirection", "NormalDirection")),
       transformation_matrix0_(particles_->getVariableDataByName<Matd>("TransformationMatrix")) {}
@@ -61,7 +61,7 @@ ShellCorrectConfiguration::
 ShellDeformationGradientTensor::
     ShellDeformationGradientTensor(BaseInnerRelation &inner_relation)
     : LocalDynamics(inner_relation.getSPHBody()), DataDelegateInner(inner_relation),
-      Vol_(particles_->getVariableDataByName<Real>("VolumetricMeasure")),
+      Vol_(particles_->getVariableDataByName<StorageReal>("VolumetricMeasure")),
       pos_(particles_->getVariableDataByName<Vecd>("Position")),
       pseudo_n_(particles_->registerStateVariableFrom<Vecd>("PseudoNormal", "NormalDirection")),
       n0_(particles_->registerStateVariableFrom<Vecd>("InitialNormalDirection", "NormalDirection")),
@@ -73,7 +73,7 @@ ShellDeformationGradientTensor::
 BaseShellRelaxation::BaseShellRelaxation(BaseInnerRelation &inner_relation)
     : LocalDynamics(inner_relation.getSPHBody()), DataDelegateInner(inner_relation),
       thickness_(particles_->getVariableDataByName<Real>("Thickness")),
-      Vol_(particles_->getVariableDataByName<Real>("VolumetricMeasure")),
+      Vol_(particles_->getVariableDataByName<StorageReal>("VolumetricMeasure")),
       pos_(particles_->getVariableDataByName<Vecd>("Position")),
       vel_(particles_->registerStateVariable<Vecd>("Velocity")),
       force_(particles_->registerStateVariable<Vecd>("Force")),
@@ -102,7 +102,7 @@ ShellStressRelaxationFirstHalf::
       inv_rho0_(1.0 / rho0_),
       smoothing_length_(sph_body_.sph_adaptation_->ReferenceSmoothingLength()),
       numerical_damping_scaling_matrix_(Matd::Identity() * smoothing_length_),
-      rho_(particles_->getVariableDataByName<Real>("Density")),
+      rho_(particles_->getVariableDataByName<StorageReal>("Density")),
       mass_(particles_->getVariableDataByName<Real>("Mass")),
       global_stress_(particles_->registerStateVariable<Matd>("GlobalStress")),
       global_moment_(particles_->registerStateVariable<Matd>("GlobalMoment")),
@@ -269,7 +269,7 @@ void ConstrainShellBodyRegionAlongAxis::update(size_t index_i, Real dt)
 //=================================================================================================//
 InitialShellCurvature::InitialShellCurvature(BaseInnerRelation &inner_relation)
     : LocalDynamics(inner_relation.getSPHBody()), DataDelegateInner(inner_relation),
-      Vol_(particles_->getVariableDataByName<Real>("VolumetricMeasure")),
+      Vol_(particles_->getVariableDataByName<StorageReal>("VolumetricMeasure")),
       n0_(particles_->registerStateVariableFrom<Vecd>("InitialNormalDirection", "NormalDirection")),
       B_(particles_->getVariableDataByName<Matd>("LinearGradientCorrectionMatrix")),
       transformation_matrix0_(particles_->getVariableDataByName<Matd>("TransformationMatrix")),
@@ -321,7 +321,7 @@ void ShellCurvatureUpdate::update(size_t index_i, Real)
 //=================================================================================================//
 AverageShellCurvature::AverageShellCurvature(BaseInnerRelation &inner_relation)
     : LocalDynamics(inner_relation.getSPHBody()), DataDelegateInner(inner_relation),
-      Vol_(particles_->getVariableDataByName<Real>("VolumetricMeasure")),
+      Vol_(particles_->getVariableDataByName<StorageReal>("VolumetricMeasure")),
       n_(particles_->getVariableDataByName<Vecd>("NormalDirection")),
       k1_ave_(particles_->registerStateVariable<Real>("Average1stPrincipleCurvature")),
       k2_ave_(particles_->registerStateVariable<Real>("Average2ndPrincipleCurvature")){};
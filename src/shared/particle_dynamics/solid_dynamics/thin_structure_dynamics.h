@@ -109,7 +109,7 @@ class ShellCorrectConfiguration : public LocalDynamics, public DataDelegateInner
     };
 
   protected:
-    Real *Vol_;
+    StorageReal *Vol_;
     Matd *B_;
     Vecd *n0_;
     Matd *transformation_matrix0_;
@@ -148,7 +148,7 @@ class ShellDeformationGradientTensor : public LocalDynamics, public DataDelegate
     };
 
   protected:
-    Real *Vol_;
+    StorageReal *Vol_;
     Vecd *pos_, *pseudo_n_, *n0_;
     Matd *B_, *F_, *F_bending_;
     Matd *transformation_matrix0_;
@@ -165,7 +165,8 @@ class BaseShellRelaxation : public LocalDynamics, public DataDelegateInner
     virtual ~BaseShellRelaxation(){};
 
   protected:
-    Real *thickness_, *Vol_;
+    Real *thickness_;
+    StorageReal *Vol_;
     Vecd *pos_, *vel_, *force_, *force_prior_;
     Vecd *n0_, *pseudo_n_, *dpseudo_n_dt_, *dpseudo_n_d2t_, *rotation_,
         *angular_vel_, *dangular_vel_dt_;
@@ -237,7 +238,8 @@ class ShellStressRelaxationFirstHalf : public BaseShellRelaxation
     Real rho0_, inv_rho0_;
     Real smoothing_length_;
     Matd numerical_damping_scaling_matrix_;
-    Real *rho_, *mass_;
+    StorageReal *rho_;
+    Real *mass_;
     Matd *global_stress_, *global_moment_, *mid_surface_cauchy_stress_;
     Vecd *global_shear_stress_;
     Matd *global_F_, *global_F_bending_;
@@ -340,7 +342,7 @@ class InitialShellCurvature : public LocalDynamics, public DataDelegateInner
     void update(size_t index_i, Real);
 
   private:
-    Real *Vol_;
+    StorageReal *Vol_;
     Vecd *n0_;
     Matd *B_;
     Matd *transformation_matrix0_;
@@ -386,7 +388,7 @@ class AverageShellCurvature : public LocalDynamics, public DataDelegateInner
     void update(size_t index_i, Real);
 
   private:
-    Real *Vol_;
+    StorageReal *Vol_;
     Vecd *n_;
     Real *k1_ave_; // first principle curvature
     Real *k2_ave_; // second principle curvature
@@ -22,6 +22,13 @@ void Neighborhood::removeANeighbor(size_t neighbor_n)
     e_ij_[neighbor_n] = e_ij_[current_size_];
 }
 //=================================================================================================//
+size_t Neighborhood::MemoryBytes()
+{
+    return sizeof(Neighborhood) + j_.capacity() * sizeof(size_t) +
+           (W_ij_.capacity() + dW_ij_.capacity() + r_ij_.capacity()) * sizeof(Real) +
+           e_ij_.capacity() * sizeof(Vecd);
+}
+//=================================================================================================//
 void NeighborBuilder::createNeighbor(Neighborhood &neighborhood, const Real &distance,
                                      const Vecd &displacement, size_t index_j)
 {
@@ -44,6 +51,30 @@ void NeighborBuilder::initializeNeighbor(Neighborhood &neighborhood, const Real
     neighborhood.e_ij_[current_size] = kernel_->e(distance, displacement);
 }
 //=================================================================================================//
+void NeighborBuilder::addNeighbor(Neighborhood &neighborhood, const Real &distance, const Real &W_ij,
+                                  const Real &dW_ij, const Vecd &e_ij, size_t index_j)
+{
+    size_t current_size = neighborhood.current_size_;
+    if (current_size >= neighborhood.allocated_size_)
+    {
+        neighborhood.j_.push_back(index_j);
+        neighborhood.W_ij_.push_back(W_ij);
+        neighborhood.dW_ij_.push_back(dW_ij);
+        neighborhood.r_ij_.push_back(distance);
+        neighborhood.e_ij_.push_back(e_ij);
+        neighborhood.allocated_size_++;
+    }
+    else
+    {
+        neighborhood.j_[current_size] = index_j;
+        neighborhood.W_ij_[current_size] = W_ij;
+        neighborhood.dW_ij_[current_size] = dW_ij;
+        neighborhood.r_ij_[current_size] = distance;
+        neighborhood.e_ij_[current_size] = e_ij;
+    }
+    neighborhood.current_size_++;
+}
+//=================================================================================================//
 void NeighborBuilder::createNeighbor(Neighborhood &neighborhood, const Real &distance,
                                      const Vecd &displacement, size_t index_j,
                                      Real i_h_ratio, Real h_ratio_min)
@@ -96,6 +127,24 @@ void NeighborBuilderInner::operator()(Neighborhood &neighborhood,
     }
 };
 //=================================================================================================//
+void NeighborBuilderInner::operator()(Neighborhood &neighborhood_i, Neighborhood &neighborhood_j,
+                                      const ListData &list_data_i, const ListData &list_data_j)
+{
+    size_t index_i = list_data_i.first;
+    size_t index_j = list_data_j.first;
+    Vecd displacement = list_data_i.second - list_data_j.second;
+    if (kernel_->checkIfWithinCutOffRadius(displacement) && index_i != index_j)
+    {
+        // the kernel values are even in the displacement and only the unit vector changes sign
+        Real distance = std::sqrt(displacement.squaredNorm());
+        Real W_ij = kernel_->W(distance, displacement);
+        Real dW_ij = kernel_->dW(distance, displacement);
+        Vecd e_ij = kernel_->e(distance, displacement);
+        addNeighbor(neighborhood_i, distance, W_ij, dW_ij, e_ij, index_j);
+        addNeighbor(neighborhood_j, distance, W_ij, dW_ij, -e_ij, index_i);
+    }
+};
+//=================================================================================================//
 NeighborBuilderInnerAdaptive::
     NeighborBuilderInnerAdaptive(SPHBody &body)
     : NeighborBuilder(body.sph_adaptation_->getKernel()),
@@ -62,6 +62,8 @@ class Neighborhood
     ~Neighborhood(){};
 
     void removeANeighbor(size_t neighbor_n);
+    /** bytes of the neighborhood including the capacities of the neighbor data */
+    size_t MemoryBytes();
 };
 using ParticleConfiguration = StdLargeVec<Neighborhood>;
 
@@ -78,6 +80,9 @@ class NeighborBuilder
     //----------------------------------------------------------------------
     void createNeighbor(Neighborhood &neighborhood, const Real &distance, const Vecd &displacement, size_t j_index);
     void initializeNeighbor(Neighborhood &neighborhood, const Real &distance, const Vecd &displacement, size_t j_index);
+    /** create or initialize a neighbor with the kernel values already evaluated */
+    void addNeighbor(Neighborhood &neighborhood, const Real &distance, const Real &W_ij,
+                     const Real &dW_ij, const Vecd &e_ij, size_t j_index);
     //----------------------------------------------------------------------
     //	Below are for variable smoothing length.
     //----------------------------------------------------------------------
@@ -104,6 +109,9 @@ class NeighborBuilderInner : public NeighborBuilder
     explicit NeighborBuilderInner(SPHBody &body);
     void operator()(Neighborhood &neighborhood,
                     const Vecd &pos_i, size_t index_i, const ListData &list_data_j) override;
+    /** build the neighbor relations of both particles of a pair with a single kernel evaluation */
+    void operator()(Neighborhood &neighborhood_i, Neighborhood &neighborhood_j,
+                    const ListData &list_data_i, const ListData &list_data_j);
 };
 
 /**
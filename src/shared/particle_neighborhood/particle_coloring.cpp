@@ -0,0 +1,62 @@
+/**
+ * @file 	particle_coloring.cpp
+ * @author	Xiangyu Hu
+ */
+
+#include "particle_coloring.h"
+
+namespace SPH
+{
+//=================================================================================================//
+void ParticleColoring::updateColors(size_t total_real_particles)
+{
+    resetColors(total_real_particles);
+    for (auto &particles : colored_particles_)
+        particles.clear();
+
+    for (size_t index_i = 0; index_i != total_real_particles; ++index_i)
+    {
+        size_t color = smallestAvailableColor(index_i);
+        if (color >= colored_particles_.size())
+            colored_particles_.resize(color + 1);
+        colored_particles_[color].push_back(index_i);
+        assignColor(index_i, color);
+    }
+
+    while (!colored_particles_.empty() && colored_particles_.back().empty())
+        colored_particles_.pop_back();
+}
+//=================================================================================================//
+void GatherParticleColoring::resetColors(size_t total_real_particles)
+{
+    color_.assign(total_real_particles, MaxSize_t);
+    forbidden_colors_.assign(forbidden_colors_.size(), MaxSize_t);
+}
+//=================================================================================================//
+size_t GatherParticleColoring::smallestAvailableColor(size_t index_i)
+{
+    const Neighborhood &neighborhood = configuration_[index_i];
+    for (size_t n = 0; n != neighborhood.current_size_; ++n)
+    {
+        size_t index_j = neighborhood.j_[n];
+        if (index_j < color_.size() && color_[index_j] != MaxSize_t)
+        {
+            size_t color = color_[index_j];
+            if (color >= forbidden_colors_.size())
+                forbidden_colors_.resize(color + 1, MaxSize_t);
+            forbidden_colors_[color] = index_i;
+        }
+    }
+
+    size_t color = 0;
+    while (color < forbidden_colors_.size() && forbidden_colors_[color] == index_i)
+        ++color;
+    return color;
+}
+//=================================================================================================//
+void GatherParticleColoring::assignColor(size_t index_i, size_t color)
+{
+    color_[index_i] = color;
+}
+//=================================================================================================//
+} // namespace SPH
@@ -0,0 +1,99 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2023 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file 	particle_coloring.h
+ * @brief 	Greedy coloring of the particle conflict graph built from neighbor lists.
+ * @details Particles with the same color can be updated concurrently
+ * by an operator splitting algorithm, which is an alternative
+ * to the 3^d cell colors of the split cell linked list.
+ * Note that neighbors beyond the real particles, such as ghost particles,
+ * are not colored, but they are taken into account for conflicts.
+ * @author	Xiangyu Hu
+ */
+
+#ifndef PARTICLE_COLORING_H
+#define PARTICLE_COLORING_H
+
+#include "neighborhood.h"
+#include "execution_policy.h"
+
+namespace SPH
+{
+/**
+ * @class ParticleColoring
+ * @brief The base class of the particle coloring.
+ * The colors are updated from the present neighbor lists
+ * and particles are swept color by color forward and then backward.
+ */
+class ParticleColoring
+{
+  public:
+    explicit ParticleColoring(ParticleConfiguration &configuration)
+        : configuration_(configuration){};
+    virtual ~ParticleColoring(){};
+
+    void updateColors(size_t total_real_particles);
+    size_t NumberOfColors() { return colored_particles_.size(); };
+    StdVec<IndexVector> &ColoredParticles() { return colored_particles_; };
+
+    /** split algorithm */;
+    template <class LocalDynamicsFunction>
+    void particle_for_split(const execution::SequencedPolicy &, const LocalDynamicsFunction &local_dynamics_function);
+    template <class LocalDynamicsFunction>
+    void particle_for_split(const execution::ParallelPolicy &, const LocalDynamicsFunction &local_dynamics_function);
+
+  protected:
+    ParticleConfiguration &configuration_;
+    StdVec<IndexVector> colored_particles_;
+
+    /** the smallest color which does not conflict with the particles colored before particle i */
+    virtual size_t smallestAvailableColor(size_t index_i) = 0;
+    /** record the color taken by particle i */
+    virtual void assignColor(size_t index_i, size_t color) = 0;
+    virtual void resetColors(size_t total_real_particles) = 0;
+};
+
+/**
+ * @class GatherParticleColoring
+ * @brief Coloring for interactions which only update particle i from its neighbors.
+ * Two particles conflict if they are neighbors, i.e. it is a distance-one coloring.
+ * Note that, on a regular lattice with the default smoothing length,
+ * it gives 11 colors in 2D and 33 in 3D, which is not fewer than the 3^d split cells.
+ */
+class GatherParticleColoring : public ParticleColoring
+{
+  public:
+    explicit GatherParticleColoring(ParticleConfiguration &configuration)
+        : ParticleColoring(configuration){};
+    virtual ~GatherParticleColoring(){};
+
+  protected:
+    StdVec<size_t> color_;
+    StdVec<size_t> forbidden_colors_; /**< stamped by the particle index, so that no reset is required */
+
+    virtual size_t smallestAvailableColor(size_t index_i) override;
+    virtual void assignColor(size_t index_i, size_t color) override;
+    virtual void resetColors(size_t total_real_particles) override;
+};
+} // namespace SPH
+#endif // PARTICLE_COLORING_H
@@ -0,0 +1,75 @@
+/**
+ * @file 	particle_coloring.hpp
+ * @brief 	Here gives the split algorithm over particle colors.
+ * @author	Xiangyu Hu
+ */
+
+#ifndef PARTICLE_COLORING_HPP
+#define PARTICLE_COLORING_HPP
+
+#include "particle_coloring.h"
+
+namespace SPH
+{
+//=================================================================================================//
+template <class LocalDynamicsFunction>
+void ParticleColoring::particle_for_split(const execution::SequencedPolicy &, const LocalDynamicsFunction &local_dynamics_function)
+{
+    // forward sweeping
+    for (size_t k = 0; k != colored_particles_.size(); ++k)
+    {
+        for (const size_t index_i : colored_particles_[k])
+        {
+            local_dynamics_function(index_i);
+        }
+    }
+
+    // backward sweeping
+    for (size_t k = colored_particles_.size(); k != 0; --k)
+    {
+        const IndexVector &particles = colored_particles_[k - 1];
+        for (size_t l = particles.size(); l != 0; --l)
+        {
+            local_dynamics_function(particles[l - 1]);
+        }
+    }
+}
+//=================================================================================================//
+template <class LocalDynamicsFunction>
+void ParticleColoring::particle_for_split(const execution::ParallelPolicy &, const LocalDynamicsFunction &local_dynamics_function)
+{
+    // forward sweeping
+    for (size_t k = 0; k != colored_particles_.size(); ++k)
+    {
+        const IndexVector &particles = colored_particles_[k];
+        parallel_for(
+            IndexRange(0, particles.size()),
+            [&](const IndexRange &r)
+            {
+                for (size_t l = r.begin(); l < r.end(); ++l)
+                {
+                    local_dynamics_function(particles[l]);
+                }
+            },
+            ap);
+    }
+
+    // backward sweeping
+    for (size_t k = colored_particles_.size(); k != 0; --k)
+    {
+        const IndexVector &particles = colored_particles_[k - 1];
+        parallel_for(
+            IndexRange(0, particles.size()),
+            [&](const IndexRange &r)
+            {
+                for (size_t l = r.begin(); l < r.end(); ++l)
+                {
+                    local_dynamics_function(particles[l]);
+                }
+            },
+            ap);
+    }
+}
+//=================================================================================================//
+} // namespace SPH
+#endif // PARTICLE_COLORING_HPP
@@ -20,7 +20,8 @@ BaseParticles::BaseParticles(SPHBody &sph_body, BaseMaterial *base_material)
       copy_particle_state_(all_state_data_),
       write_restart_variable_to_xml_(variables_to_restart_, restart_xml_parser_),
       write_reload_variable_to_xml_(variables_to_reload_, reload_xml_parser_),
-      read_restart_variable_from_xml_(variables_to_restart_, restart_xml_parser_)
+      read_restart_variable_from_xml_(variables_to_restart_, restart_xml_parser_),
+      report_variable_memory_(all_discrete_variables_)
 {
     sph_body.assignBaseParticles(this);
     sv_total_real_particles_ = registerSingularVariable<UnsignedInt>("TotalRealParticles");
@@ -31,7 +32,7 @@ void BaseParticles::initializeBasicParticleVariables()
     //----------------------------------------------------------------------
     //		register non-geometric variables
     //----------------------------------------------------------------------
-    rho_ = registerStateVariable<Real>("Density", base_material_.ReferenceDensity());
+    rho_ = registerStateVariable<StorageReal>("Density", base_material_.ReferenceDensity());
     mass_ = registerStateVariable<Real>("Mass",
                                         [&](size_t i) -> Real
                                         { return rho_[i] * ParticleVolume(i); });
@@ -45,15 +46,15 @@ void BaseParticles::initializeBasicParticleVariables()
 void BaseParticles::registerPositionAndVolumetricMeasure(StdLargeVec<Vecd> &pos, StdLargeVec<Real> &Vol)
 {
     pos_ = registerStateVariableFrom<Vecd>("Position", pos);
-    Vol_ = registerStateVariableFrom<Real>("VolumetricMeasure", Vol);
+    Vol_ = registerStateVariableFrom<StorageReal>("VolumetricMeasure", Vol);
     addVariableToReload<Vecd>("Position");
-    addVariableToReload<Real>("VolumetricMeasure");
+    addVariableToReload<StorageReal>("VolumetricMeasure");
 }
 //=================================================================================================//
 void BaseParticles::registerPositionAndVolumetricMeasureFromReload()
 {
     pos_ = registerStateVariableFromReload<Vecd>("Position");
-    Vol_ = registerStateVariableFromReload<Real>("VolumetricMeasure");
+    Vol_ = registerStateVariableFromReload<StorageReal>("VolumetricMeasure");
 }
 //=================================================================================================//
 void BaseParticles::initializeAllParticlesBounds(size_t number_of_particles)
@@ -123,7 +124,7 @@ void BaseParticles::resizeXmlDocForParticles(XmlParser &xml_parser)
     size_t total_elements = xml_parser.Size(xml_parser.first_element_);
 
     UnsignedInt total_real_particles = TotalRealParticles();
-    if (total_elements <= total_real_particles)
+    if (total_elements != total_real_particles)
     {
         xml_parser.resize(xml_parser.first_element_, total_real_particles, "particle");
     }
@@ -139,6 +140,17 @@ void BaseParticles::writeParticlesToXmlForRestart(std::string &filefullpath)
 void BaseParticles::readParticleFromXmlForRestart(std::string &filefullpath)
 {
     restart_xml_parser_.loadXmlFile(filefullpath);
+    /** the number of real particles may change, e.g. by migrating particles between processes */
+    size_t total_real_particles = restart_xml_parser_.Size(restart_xml_parser_.first_element_);
+    if (total_real_particles > real_particles_bound_)
+    {
+        std::cout << "\n Error: the " << total_real_particles << " particles in the restart file "
+                  << filefullpath << " exceed the real particle bound " << real_particles_bound_ << "!" << std::endl;
+        std::cout << " Please reserve more buffer particles for the body. \n";
+        std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+        exit(1);
+    }
+    *sv_total_real_particles_->Data() = total_real_particles;
     read_restart_variable_from_xml_(this);
 }
 //=================================================================================================//
@@ -149,6 +161,14 @@ void BaseParticles::writeToXmlForReloadParticle(std::string &filefullpath)
     reload_xml_parser_.writeToXmlFile(filefullpath);
 }
 //=================================================================================================//
+void BaseParticles::reportMemoryFootprint(MemoryRegistry &registry)
+{
+    size_t reserve_bytes = 0;
+    registry.registerParticles(body_name_, TotalRealParticles());
+    report_variable_memory_(registry, body_name_, mesh_data_variables_, particles_bound_, TotalRealParticles(), reserve_bytes);
+    registry.registerMemory(body_name_, "ParticleReserve", "BufferAndGhostParticles", reserve_bytes);
+}
+//=================================================================================================//
 XmlParser &BaseParticles::readReloadXmlFile(const std::string &filefullpath)
 {
     is_reload_file_read_ = true;
@@ -34,6 +34,7 @@
 #define BASE_PARTICLES_H
 
 #include "base_data_package.h"
+#include "memory_registry.h"
 #include "sphinxsys_containers.h"
 #include "sphinxsys_variable.h"
 #include "xml_parser.h"
@@ -148,8 +149,8 @@ class BaseParticles
     DataType *registerStateVariable(const std::string &name, Args &&...args);
     template <typename DataType>
     DataType *registerStateVariableFrom(const std::string &new_name, const std::string &old_name);
-    template <typename DataType>
-    DataType *registerStateVariableFrom(const std::string &name, const StdLargeVec<DataType> &geometric_data);
+    template <typename DataType, typename GeometricDataType = DataType>
+    DataType *registerStateVariableFrom(const std::string &name, const StdLargeVec<GeometricDataType> &geometric_data);
     template <typename DataType>
     DataType *registerStateVariableFromReload(const std::string &name);
     template <typename DataType>
@@ -188,6 +189,9 @@ class BaseParticles
     template <typename DataType>
     void addVariableToReload(const std::string &name);
     inline const ParticleVariables &getVariablesToReload() const { return variables_to_reload_; }
+    /** tag a discrete variable holding mesh data, e.g. of cell linked list, which is reported by the mesh */
+    template <typename DataType>
+    void addVariableToMeshData(DiscreteVariable<DataType> *variable);
 
     //----------------------------------------------------------------------
     // Particle data for sorting
@@ -218,20 +222,25 @@ class BaseParticles
     template <typename OwnerType>
     void checkReloadFileRead(OwnerType *owner);
     //----------------------------------------------------------------------
+    // Memory footprint of the particle variables
+    //----------------------------------------------------------------------
+    /** the bytes of the buffer and ghost particles beyond the real ones are given as particle reserve */
+    void reportMemoryFootprint(MemoryRegistry &registry);
+    //----------------------------------------------------------------------
     // Function related to geometric variables and their relations
     //----------------------------------------------------------------------
     void registerPositionAndVolumetricMeasure(StdLargeVec<Vecd> &pos, StdLargeVec<Real> &Vol);
     void registerPositionAndVolumetricMeasureFromReload();
     Vecd *ParticlePositions() { return pos_; }
-    Real *VolumetricMeasures() { return Vol_; }
+    StorageReal *VolumetricMeasures() { return Vol_; }
     virtual Real ParticleVolume(size_t index) { return Vol_[index]; }
     virtual Real ParticleSpacing(size_t index) { return std::pow(Vol_[index], 1.0 / Real(Dimensions)); }
 
   protected:
-    Vecd *pos_;  /**< Position */
-    Real *Vol_;  /**< Volumetric measure, also area and length of surface and linear particle */
-    Real *rho_;  /**< Density as a fundamental property of phyiscal matter */
-    Real *mass_; /**< Mass as another fundamental property of physical matter */
+    Vecd *pos_;        /**< Position */
+    StorageReal *Vol_; /**< Volumetric measure, also area and length of surface and linear particle */
+    StorageReal *rho_; /**< Density as a fundamental property of phyiscal matter */
+    Real *mass_;       /**< Mass as another fundamental property of physical matter */
 
     SPHBody &sph_body_;
     std::string body_name_;
@@ -244,6 +253,7 @@ class BaseParticles
     ParticleVariables variables_to_write_;
     ParticleVariables variables_to_restart_;
     ParticleVariables variables_to_reload_;
+    ParticleVariables mesh_data_variables_; /**< not reported as particle variables */
     bool is_reload_file_read_ = false;
 
   public:
@@ -280,9 +290,18 @@ class BaseParticles
         void operator()(DataContainerAddressKeeper<DiscreteVariable<DataType>> &variables, BaseParticles *base_particles);
     };
 
+    struct ReportVariableMemory
+    {
+        template <typename DataType>
+        void operator()(DataContainerAddressKeeper<DiscreteVariable<DataType>> &variables,
+                        MemoryRegistry &registry, const std::string &owner, ParticleVariables &mesh_data_variables,
+                        UnsignedInt particles_bound, UnsignedInt total_real_particles, size_t &reserve_bytes);
+    };
+
     OperationOnDataAssemble<ParticleData, CopyParticleState> copy_particle_state_;
     OperationOnDataAssemble<ParticleVariables, WriteAParticleVariableToXml> write_restart_variable_to_xml_, write_reload_variable_to_xml_;
     OperationOnDataAssemble<ParticleVariables, ReadAParticleVariableFromXml> read_restart_variable_from_xml_;
+    OperationOnDataAssemble<ParticleVariables, ReportVariableMemory> report_variable_memory_;
 };
 } // namespace SPH
 #endif // BASE_PARTICLES_H
@@ -171,9 +171,9 @@ DiscreteVariable<DataType> *BaseParticles::registerStateVariableOnlyFrom(
                                                { return old_data_field[index]; });
 }
 //=================================================================================================//
-template <typename DataType>
+template <typename DataType, typename GeometricDataType>
 DataType *BaseParticles::registerStateVariableFrom(
-    const std::string &name, const StdLargeVec<DataType> &geometric_data)
+    const std::string &name, const StdLargeVec<GeometricDataType> &geometric_data)
 {
     DataType *data_field = registerStateVariable<DataType>(name);
 
@@ -339,6 +339,16 @@ void BaseParticles::addVariableToReload(const std::string &name)
 }
 //=================================================================================================//
 template <typename DataType>
+void BaseParticles::addVariableToMeshData(DiscreteVariable<DataType> *variable)
+{
+    if (findVariableByName<DataType>(mesh_data_variables_, variable->Name()) == nullptr)
+    {
+        constexpr int type_index = DataTypeIndex<DataType>::value;
+        std::get<type_index>(mesh_data_variables_).push_back(variable);
+    }
+}
+//=================================================================================================//
+template <typename DataType>
 void BaseParticles::CopyParticleState::
 operator()(DataContainerKeeper<AllocatedData<DataType>> &data_keeper, size_t index, size_t another_index)
 {
@@ -365,6 +375,30 @@ operator()(DataContainerAddressKeeper<DiscreteVariable<DataType>> &variables)
 }
 //=================================================================================================//
 template <typename DataType>
+void BaseParticles::ReportVariableMemory::
+operator()(DataContainerAddressKeeper<DiscreteVariable<DataType>> &variables,
+           MemoryRegistry &registry, const std::string &owner, ParticleVariables &mesh_data_variables,
+           UnsignedInt particles_bound, UnsignedInt total_real_particles, size_t &reserve_bytes)
+{
+    for (size_t i = 0; i != variables.size(); ++i)
+    {
+        if (findVariableByName<DataType>(mesh_data_variables, variables[i]->Name()) != nullptr)
+        {
+            continue;
+        }
+
+        size_t variable_reserve_bytes = 0;
+        if (variables[i]->getDataSize() >= particles_bound)
+        {
+            variable_reserve_bytes = (particles_bound - total_real_particles) * sizeof(DataType);
+        }
+        reserve_bytes += variable_reserve_bytes;
+        registry.registerMemory(owner, "ParticleVariable", variables[i]->Name(),
+                                variables[i]->MemoryBytes() - variable_reserve_bytes);
+    }
+}
+//=================================================================================================//
+template <typename DataType>
 void BaseParticles::ReadAParticleVariableFromXml::
 operator()(DataContainerAddressKeeper<DiscreteVariable<DataType>> &variables, BaseParticles *base_particles)
 {
@@ -50,27 +50,32 @@ class RegressionTestDynamicTimeWarping : public RegressionTestTimeAverage<Observ
     XmlEngine dtw_distance_xml_engine_out_; /* xml engine for dtw distance output. */
 
     StdVec<Real> dtw_distance_, dtw_distance_new_; /* the container of DTW distance between each pairs. */
+    Real mixed_precision_tolerance_;               /* the relative DTW distance allowed against the double-precision result. */
 
     /** the method used for calculating the p_norm. (calculateDTWDistance) */
-    Real calculatePNorm(Real variable_a, Real variable_b)
+    static Real calculatePNorm(Real variable_a, Real variable_b)
     {
         return std::abs(variable_a - variable_b);
     };
     template <typename Variable>
-    Real calculatePNorm(const Variable &variable_a, const Variable variable_b)
+    static Real calculatePNorm(const Variable &variable_a, const Variable variable_b)
     {
         return (variable_a - variable_b).norm();
     };
 
     /** the local constrained method used for calculating the dtw distance between two lines. */
-    StdVec<Real> calculateDTWDistance(BiVector<VariableType> dataset_a_, BiVector<VariableType> dataset_b_);
+    StdVec<Real> calculateDTWDistance(const BiVector<VariableType> &dataset_a_, const BiVector<VariableType> &dataset_b_);
+    /** the banded dtw distance between two sequences, keeping only two rows within the window. */
+    static Real calculateDTWDistance(const VariableType *sequence_a, int a_length,
+                                     const VariableType *sequence_b, int b_length, int window_size);
 
   public:
     template <typename... Args>
     explicit RegressionTestDynamicTimeWarping(Args &&...args)
         : RegressionTestTimeAverage<ObserveMethodType>(std::forward<Args>(args)...),
           dtw_distance_xml_engine_in_("dtw_distance_xml_engine_in", "dtw_distance"),
-          dtw_distance_xml_engine_out_("dtw_distance_xml_engine_out", "dtw_distance")
+          dtw_distance_xml_engine_out_("dtw_distance_xml_engine_out", "dtw_distance"),
+          mixed_precision_tolerance_(0.05)
     {
         dtw_distance_filefullpath_ = this->input_folder_path_ + "/" + this->dynamics_identifier_name_ + "_" + this->quantity_name_ + "_dtwdistance.xml";
     };
@@ -82,6 +87,9 @@ class RegressionTestDynamicTimeWarping : public RegressionTestTimeAverage<Observ
     void writeDTWDistanceToXml();                  /* write the updated DTWDistance to .xml file.*/
     bool compareDTWDistance(Real threshold_value); /* compare the DTWDistance if converged. */
     void resultTest();                             /** test the new result if it is converged within the range. */
+    /** The DTW distance of a mixed-precision result to each double-precision result in the database,
+     *  relative to the accumulated magnitude of the latter, is required to be within the tolerance. */
+    void setMixedPrecisionTolerance(Real tolerance) { mixed_precision_tolerance_ = tolerance; };
 
     /** the interface for generating the priori converged result with DTW */
     void generateDataBase(Real threshold_value, const std::string &filter = "false")
@@ -14,40 +14,89 @@ namespace SPH
 {
 //=================================================================================================//
 template <class ObserveMethodType>
-StdVec<Real> RegressionTestDynamicTimeWarping<ObserveMethodType>::calculateDTWDistance(BiVector<VariableType> dataset_a_, BiVector<VariableType> dataset_b_)
+StdVec<Real> RegressionTestDynamicTimeWarping<ObserveMethodType>::
+    calculateDTWDistance(const BiVector<VariableType> &dataset_a_, const BiVector<VariableType> &dataset_b_)
 {
-    /* define the container to hold the dtw distance.*/
-    StdVec<Real> dtw_distance;
     for (int observation_index = 0; observation_index != this->observation_; ++observation_index)
     {
-        int window_size_ = 5;
         int a_length = dataset_a_[observation_index].size();
         int b_length = dataset_b_[observation_index].size();
-
         if (b_length > 1.1 * a_length || b_length < 0.9 * a_length)
         {
             std::cout << "\n Error: please check the time step change, because the data length changed a lot !" << std::endl;
             std::cout << __FILE__ << ':' << __LINE__ << std::endl;
             exit(1);
         }
+    }
 
-        /** create a 2D vector with [a_length, b_length] to contain the local DTW distance value. */
-        BiVector<Real> local_dtw_distance(a_length, StdVec<Real>(b_length, 0));
-        local_dtw_distance[0][0] = calculatePNorm(dataset_a_[observation_index][0], dataset_b_[observation_index][0]);
-        for (int index_i = 1; index_i < a_length; ++index_i)
-            local_dtw_distance[index_i][0] = local_dtw_distance[index_i - 1][0] + calculatePNorm(dataset_a_[observation_index][index_i], dataset_b_[observation_index][0]);
-        for (int index_j = 1; index_j < b_length; ++index_j)
-            local_dtw_distance[0][index_j] = local_dtw_distance[0][index_j - 1] + calculatePNorm(dataset_a_[observation_index][0], dataset_b_[observation_index][index_j]);
+    /* define the container to hold the dtw distance.*/
+    StdVec<Real> dtw_distance(this->observation_, 0);
+    parallel_for(
+        IndexRange(0, this->observation_),
+        [&](const IndexRange &r)
+        {
+            for (size_t observation_index = r.begin(); observation_index != r.end(); ++observation_index)
+            {
+                const StdVec<VariableType> &sequence_a = dataset_a_[observation_index];
+                const StdVec<VariableType> &sequence_b = dataset_b_[observation_index];
+                int a_length = sequence_a.size();
+                int b_length = sequence_b.size();
+                /** add locality constraint */
+                int window_size = SMAX(5, ABS(a_length - b_length));
+                dtw_distance[observation_index] =
+                    calculateDTWDistance(sequence_a.data(), a_length, sequence_b.data(), b_length, window_size);
+            }
+        },
+        ap);
+    return dtw_distance;
+};
+//=================================================================================================//
+template <class ObserveMethodType>
+Real RegressionTestDynamicTimeWarping<ObserveMethodType>::
+    calculateDTWDistance(const VariableType *sequence_a, int a_length,
+                         const VariableType *sequence_b, int b_length, int window_size)
+{
+    /** the first row and column are accumulated, while the cells beyond the window are taken as zero. */
+    if (a_length == 1)
+    {
+        Real accumulated_distance = 0;
+        for (int index_j = 0; index_j != b_length; ++index_j)
+            accumulated_distance += calculatePNorm(sequence_a[0], sequence_b[index_j]);
+        return accumulated_distance;
+    }
+
+    StdVec<Real> first_row(SMIN(b_length, window_size + 1), 0);
+    first_row[0] = calculatePNorm(sequence_a[0], sequence_b[0]);
+    for (int index_j = 1; index_j < (int)first_row.size(); ++index_j)
+        first_row[index_j] = first_row[index_j - 1] + calculatePNorm(sequence_a[0], sequence_b[index_j]);
+
+    /** rows are stored with the offset index_j - index_i + window_size. */
+    StdVec<Real> previous_row(2 * window_size, 0), current_row(2 * window_size, 0);
+    auto local_dtw_distance = [&](const StdVec<Real> &row, int index_i, Real first_column, int index_j) -> Real
+    {
+        if (index_j == 0)
+            return first_column;
+        if (index_i == 0)
+            return first_row[index_j];
+        if (index_j >= SMAX(1, index_i - window_size) && index_j < SMIN(b_length, index_i + window_size))
+            return row[index_j - index_i + window_size];
+        return 0;
+    };
 
-        /** add locality constraint */
-        window_size_ = SMAX(window_size_, ABS(a_length - b_length));
-        for (int index_i = 1; index_i != a_length; ++index_i)
-            for (int index_j = SMAX(1, index_i - window_size_); index_j != SMIN(b_length, index_i + window_size_); ++index_j)
-                local_dtw_distance[index_i][index_j] = calculatePNorm(dataset_a_[observation_index][index_i], dataset_b_[observation_index][index_j]) +
-                                                       SMIN(local_dtw_distance[index_i - 1][index_j], local_dtw_distance[index_i][index_j - 1], local_dtw_distance[index_i - 1][index_j - 1]);
-        dtw_distance.push_back(local_dtw_distance[a_length - 1][b_length - 1]);
+    Real previous_first_column = first_row[0];
+    for (int index_i = 1; index_i != a_length; ++index_i)
+    {
+        Real first_column = previous_first_column + calculatePNorm(sequence_a[index_i], sequence_b[0]);
+        for (int index_j = SMAX(1, index_i - window_size); index_j != SMIN(b_length, index_i + window_size); ++index_j)
+            current_row[index_j - index_i + window_size] =
+                calculatePNorm(sequence_a[index_i], sequence_b[index_j]) +
+                SMIN(local_dtw_distance(previous_row, index_i - 1, previous_first_column, index_j),
+                     local_dtw_distance(current_row, index_i, first_column, index_j - 1),
+                     local_dtw_distance(previous_row, index_i - 1, previous_first_column, index_j - 1));
+        std::swap(previous_row, current_row);
+        previous_first_column = first_column;
     }
-    return dtw_distance;
+    return local_dtw_distance(previous_row, a_length - 1, previous_first_column, b_length - 1);
 };
 //=================================================================================================//
 template <class ObserveMethodType>
@@ -170,6 +219,20 @@ void RegressionTestDynamicTimeWarping<ObserveMethodType>::resultTest()
                       << ", and the current distance is " << dtw_distance_current_[observation_index] << "." << std::endl;
             test_wrong++;
         }
+#if SPHINXSYS_USE_MIXED_PRECISION
+        /** The database is generated in double precision. */
+        const StdVec<VariableType> &reference = this->result_in_[observation_index];
+        Real reference_magnitude = 0;
+        for (size_t snapshot_index = 0; snapshot_index != reference.size(); ++snapshot_index)
+            reference_magnitude += calculatePNorm(reference[snapshot_index], ZeroData<VariableType>::value);
+        Real relative_distance = dtw_distance_current_[observation_index] / SMAX(reference_magnitude, TinyReal);
+        if (relative_distance > mixed_precision_tolerance_)
+        {
+            std::cout << "The relative DTW distance of " << this->quantity_name_ << "[" << observation_index << "] to the double-precision result is "
+                      << relative_distance << ", beyond the mixed-precision tolerance " << mixed_precision_tolerance_ << "." << std::endl;
+            test_wrong++;
+        }
+#endif
     };
     if (test_wrong == 0)
     {
@@ -6,13 +6,28 @@ namespace SPH
 Relation<Base>::Relation(SPHBody &sph_body)
     : sph_body_(sph_body),
       particles_(sph_body.getBaseParticles()),
-      offset_list_size_(particles_.RealParticlesBound() + 1) {}
+      offset_list_size_(particles_.RealParticlesBound() + 1)
+{
+    sph_body_.body_relations_ck_.push_back(this);
+}
+//=================================================================================================//
+Relation<Base>::~Relation()
+{
+    StdVec<Relation<Base> *> &body_relations = sph_body_.body_relations_ck_;
+    body_relations.erase(std::remove(body_relations.begin(), body_relations.end(), this), body_relations.end());
+}
 //=================================================================================================//
 Relation<Inner<>>::Relation(RealBody &real_body)
     : Relation<Base>(real_body), real_body_(&real_body),
       cell_linked_list_(DynamicCast<CellLinkedList>(this, real_body.getCellLinkedList())),
       dv_neighbor_index_(addRelationVariable<UnsignedInt>("NeighborIndex", offset_list_size_)),
-      dv_particle_offset_(addRelationVariable<UnsignedInt>("ParticleOffset", offset_list_size_)) {}
+      dv_particle_offset_(addRelationVariable<UnsignedInt>("ParticleOffset", offset_list_size_))
+{
+#if SPHINXSYS_USE_COMPRESSED_NEIGHBOR
+    dv_neighbor_delta_ = addRelationVariable<NeighborDelta>("NeighborDelta", offset_list_size_);
+    dv_overflow_offset_ = addRelationVariable<UnsignedInt>("OverflowOffset", offset_list_size_);
+#endif // SPHINXSYS_USE_COMPRESSED_NEIGHBOR
+}
 //=================================================================================================//
 void Relation<Inner<>>::registerComputingKernel(execution::Implementation<Base> *implementation)
 {
@@ -27,6 +42,21 @@ void Relation<Inner<>>::resetComputingKernelUpdated()
     }
 }
 //=================================================================================================//
+void Relation<Inner<>>::reportMemoryFootprint(MemoryRegistry &registry)
+{
+    const std::string owner = sph_body_.getName();
+    registry.registerMemory(owner, "NeighborList", "Inner" + dv_neighbor_index_->Name(),
+                            dv_neighbor_index_->MemoryBytes());
+    registry.registerMemory(owner, "NeighborList", "Inner" + dv_particle_offset_->Name(),
+                            dv_particle_offset_->MemoryBytes());
+#if SPHINXSYS_USE_COMPRESSED_NEIGHBOR
+    registry.registerMemory(owner, "NeighborList", "Inner" + dv_neighbor_delta_->Name(),
+                            dv_neighbor_delta_->MemoryBytes());
+    registry.registerMemory(owner, "NeighborList", "Inner" + dv_overflow_offset_->Name(),
+                            dv_overflow_offset_->MemoryBytes());
+#endif // SPHINXSYS_USE_COMPRESSED_NEIGHBOR
+}
+//=================================================================================================//
 Relation<Contact<>>::Relation(SPHBody &sph_body, RealBodyVector contact_sph_bodies)
     : Relation<Base>(sph_body), contact_bodies_(contact_sph_bodies)
 {
@@ -62,4 +92,16 @@ void Relation<Contact<>>::resetComputingKernelUpdated(UnsignedInt contact_index)
     }
 }
 //=================================================================================================//
+void Relation<Contact<>>::reportMemoryFootprint(MemoryRegistry &registry)
+{
+    const std::string owner = sph_body_.getName();
+    for (size_t k = 0; k != contact_bodies_.size(); ++k)
+    {
+        registry.registerMemory(owner, "NeighborList", dv_contact_neighbor_index_[k]->Name(),
+                                dv_contact_neighbor_index_[k]->MemoryBytes());
+        registry.registerMemory(owner, "NeighborList", dv_contact_particle_offset_[k]->Name(),
+                                dv_contact_particle_offset_[k]->MemoryBytes());
+    }
+}
+//=================================================================================================//
 } // namespace SPH
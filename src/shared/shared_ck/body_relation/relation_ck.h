@@ -46,9 +46,10 @@ class Relation<Base>
 
   public:
     explicit Relation(SPHBody &sph_body);
-    virtual ~Relation(){};
+    virtual ~Relation();
     SPHBody &getSPHBody() { return sph_body_; };
     UnsignedInt getParticleOffsetListSize() { return offset_list_size_; };
+    virtual void reportMemoryFootprint(MemoryRegistry &registry){};
 
   protected:
     SPHBody &sph_body_;
@@ -69,14 +70,23 @@ class Relation<Inner<>> : public Relation<Base>
     CellLinkedList &getCellLinkedList() { return cell_linked_list_; };
     DiscreteVariable<UnsignedInt> *getNeighborIndex() { return dv_neighbor_index_; };
     DiscreteVariable<UnsignedInt> *getParticleOffset() { return dv_particle_offset_; };
+#if SPHINXSYS_USE_COMPRESSED_NEIGHBOR
+    DiscreteVariable<NeighborDelta> *getNeighborDelta() { return dv_neighbor_delta_; };
+    DiscreteVariable<UnsignedInt> *getOverflowOffset() { return dv_overflow_offset_; };
+#endif // SPHINXSYS_USE_COMPRESSED_NEIGHBOR
     void registerComputingKernel(execution::Implementation<Base> *implementation);
     void resetComputingKernelUpdated();
+    virtual void reportMemoryFootprint(MemoryRegistry &registry) override;
 
   protected:
     RealBody *real_body_;
     CellLinkedList &cell_linked_list_;
     DiscreteVariable<UnsignedInt> *dv_neighbor_index_;
     DiscreteVariable<UnsignedInt> *dv_particle_offset_;
+#if SPHINXSYS_USE_COMPRESSED_NEIGHBOR
+    DiscreteVariable<NeighborDelta> *dv_neighbor_delta_;
+    DiscreteVariable<UnsignedInt> *dv_overflow_offset_;
+#endif // SPHINXSYS_USE_COMPRESSED_NEIGHBOR
     StdVec<execution::Implementation<Base> *> all_inner_computing_kernels_;
 };
 
@@ -103,6 +113,7 @@ class Relation<Contact<>> : public Relation<Base>
     StdVec<DiscreteVariable<UnsignedInt> *> getContactParticleOffset() { return dv_contact_particle_offset_; };
     void registerComputingKernel(execution::Implementation<Base> *implementation, UnsignedInt contact_index);
     void resetComputingKernelUpdated(UnsignedInt contact_index);
+    virtual void reportMemoryFootprint(MemoryRegistry &registry) override;
 };
 } // namespace SPH
 #endif // RELATION_CK_H
\ No newline at end of file
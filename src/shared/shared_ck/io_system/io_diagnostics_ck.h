@@ -0,0 +1,93 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2023 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file 	io_diagnostics_ck.h
+ * @brief 	Neighbor and cell-occupancy diagnostics for the relations and cell linked lists
+ *          updated by computing kernels.
+ */
+
+#ifndef IO_DIAGNOSTICS_CK_H
+#define IO_DIAGNOSTICS_CK_H
+
+#include "io_diagnostics.h"
+
+#include "relation_ck.hpp"
+
+namespace SPH
+{
+/**
+ * @class NeighborDiagnosticsRecordingCK
+ * @brief The numbers of neighbors and of particles in cells are given by the offset lists.
+ */
+template <class ExecutionPolicy>
+class NeighborDiagnosticsRecordingCK : public BaseNeighborDiagnosticsRecording
+{
+  public:
+    explicit NeighborDiagnosticsRecordingCK(Relation<Inner<>> &inner_relation, size_t interval = 1,
+                                            UnsignedInt neighbor_bin_width = 8, UnsignedInt cell_bin_width = 2,
+                                            UnsignedInt number_of_bins = 16)
+        : BaseNeighborDiagnosticsRecording(inner_relation.getSPHBody(), interval,
+                                           neighbor_bin_width, cell_bin_width, number_of_bins),
+          dv_particle_offset_(inner_relation.getParticleOffset()),
+          cell_linked_list_(inner_relation.getCellLinkedList()),
+          particle_offset_(nullptr){};
+    virtual ~NeighborDiagnosticsRecordingCK(){};
+
+  protected:
+    DiscreteVariable<UnsignedInt> *dv_particle_offset_;
+    CellLinkedList &cell_linked_list_;
+    UnsignedInt *particle_offset_;
+
+    virtual void prepareNeighborCounts() override
+    {
+        dv_particle_offset_->prepareForOutput(ExecutionPolicy{});
+        particle_offset_ = dv_particle_offset_->Data();
+    };
+
+    virtual UnsignedInt NeighborCount(UnsignedInt index_i) override
+    {
+        return particle_offset_[index_i + 1] - particle_offset_[index_i];
+    };
+
+    virtual void collectCellOccupancy(StdVec<UnsignedInt> &cell_occupancy) override
+    {
+        DiscreteVariable<UnsignedInt> *dv_cell_offset = cell_linked_list_.getCellOffset();
+        dv_cell_offset->prepareForOutput(ExecutionPolicy{});
+        UnsignedInt *cell_offset = dv_cell_offset->Data();
+        // only the occupied cells are listed by sparse cell linked list
+        SingularVariable<UnsignedInt> *sv_number_of_occupied_cells = cell_linked_list_.getNumberOfOccupiedCells();
+        UnsignedInt number_of_cells = sv_number_of_occupied_cells == nullptr
+                                          ? cell_linked_list_.getCellOffsetListSize() - 1
+                                          : sv_number_of_occupied_cells->getValue();
+        for (UnsignedInt i = 0; i != number_of_cells; ++i)
+        {
+            UnsignedInt particles_in_cell = cell_offset[i + 1] - cell_offset[i];
+            if (particles_in_cell != 0)
+            {
+                cell_occupancy.push_back(particles_in_cell);
+            }
+        }
+    };
+};
+} // namespace SPH
+#endif // IO_DIAGNOSTICS_CK_H
@@ -31,6 +31,7 @@
 #ifndef NEIGHBORHOOD_CK_H
 #define NEIGHBORHOOD_CK_H
 
+#include "base_mesh.h"
 #include "kernel_wenland_c2_ck.h"
 #include "neighborhood.h"
 
@@ -44,13 +45,22 @@ class Neighbor<>
 {
   public:
     template <class ExecutionPolicy>
-    Neighbor(const ExecutionPolicy &ex_policy, SPHAdaptation *sph_adaptation, DiscreteVariable<Vecd> *dv_pos);
+    Neighbor(const ExecutionPolicy &ex_policy, SPHAdaptation *sph_adaptation, DiscreteVariable<Vecd> *dv_pos,
+             const PeriodicWrapping &periodic_wrapping = PeriodicWrapping());
 
     template <class ExecutionPolicy>
     Neighbor(const ExecutionPolicy &ex_policy, SPHAdaptation *sph_adaptation, SPHAdaptation *contact_adaptation,
-             DiscreteVariable<Vecd> *dv_pos, DiscreteVariable<Vecd> *dv_target_pos);
+             DiscreteVariable<Vecd> *dv_pos, DiscreteVariable<Vecd> *dv_target_pos,
+             const PeriodicWrapping &periodic_wrapping = PeriodicWrapping());
 
-    inline Vecd vec_r_ij(size_t i, size_t j) const { return source_pos_[i] - target_pos_[j]; };
+    inline Vecd vec_r_ij(size_t i, size_t j) const
+    {
+#if SPHINXSYS_USE_PERIODIC_NEIGHBOR
+        return periodic_wrapping_.minimumImage(source_pos_[i] - target_pos_[j]);
+#else
+        return source_pos_[i] - target_pos_[j];
+#endif // SPHINXSYS_USE_PERIODIC_NEIGHBOR
+    };
     inline Real W_ij(size_t i, size_t j) const { return kernel_.W(vec_r_ij(i, j)); }
     inline Real dW_ij(size_t i, size_t j) const { return kernel_.dW(vec_r_ij(i, j)); }
 
@@ -62,8 +72,25 @@ class Neighbor<>
 
   protected:
     KernelWendlandC2CK kernel_;
+#if SPHINXSYS_USE_PERIODIC_NEIGHBOR
+    PeriodicWrapping periodic_wrapping_;
+#endif // SPHINXSYS_USE_PERIODIC_NEIGHBOR
     Vecd *source_pos_;
     Vecd *target_pos_;
+
+    /** the minimum image convention is only compiled in with SPHINXSYS_USE_PERIODIC_NEIGHBOR,
+     * so that the pair displacement costs nothing extra without periodic axes */
+    void checkPeriodicWrapping(const PeriodicWrapping &periodic_wrapping)
+    {
+#if !SPHINXSYS_USE_PERIODIC_NEIGHBOR
+        if (periodic_wrapping.isPeriodic())
+        {
+            std::cout << "\n Error: periodic axes of the cell linked list require building with SPHINXSYS_USE_PERIODIC_NEIGHBOR!" << std::endl;
+            std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+            exit(1);
+        }
+#endif // SPHINXSYS_USE_PERIODIC_NEIGHBOR
+    };
 };
 
 class NeighborList
@@ -79,6 +106,69 @@ class NeighborList
     UnsignedInt *particle_offset_;
     inline UnsignedInt FirstNeighbor(UnsignedInt i) { return particle_offset_[i]; };
     inline UnsignedInt LastNeighbor(UnsignedInt i) { return particle_offset_[i + 1]; };
+    inline UnsignedInt NeighborIndex(UnsignedInt i, UnsignedInt n) { return neighbor_index_[n]; };
+};
+
+#if SPHINXSYS_USE_COMPRESSED_NEIGHBOR
+/**
+ * @class CompressedNeighborList
+ * @brief Neighbor j of particle i is saved as the 16-bit delta j - i.
+ * Neighbors out of the delta range are marked with an escape value and placed
+ * before all other neighbors of particle i. Their full indices are saved, in the same order,
+ * in neighbor_index_ starting from overflow_offset_[i], so that the rank of
+ * an escaped neighbor is simply its position in the list of particle i.
+ * Only used for inner relations, as contact neighbors have no index locality.
+ */
+class CompressedNeighborList : public NeighborList
+{
+  public:
+    template <class ExecutionPolicy>
+    CompressedNeighborList(const ExecutionPolicy &ex_policy,
+                           DiscreteVariable<UnsignedInt> *dv_neighbor_index,
+                           DiscreteVariable<UnsignedInt> *dv_particle_offset,
+                           DiscreteVariable<NeighborDelta> *dv_neighbor_delta,
+                           DiscreteVariable<UnsignedInt> *dv_overflow_offset);
+
+  protected:
+    static constexpr NeighborDelta escape_delta_ = std::numeric_limits<NeighborDelta>::min();
+    NeighborDelta *neighbor_delta_;
+    UnsignedInt *overflow_offset_;
+
+    inline bool isOverflowNeighbor(UnsignedInt i, UnsignedInt j)
+    {
+        return (i > j ? i - j : j - i) > UnsignedInt(std::numeric_limits<NeighborDelta>::max());
+    };
+
+    inline UnsignedInt NeighborIndex(UnsignedInt i, UnsignedInt n)
+    {
+        NeighborDelta delta = neighbor_delta_[n];
+        return delta != escape_delta_ ? i + delta
+                                      : neighbor_index_[overflow_offset_[i] + n - FirstNeighbor(i)];
+    };
+
+    /** The overflow neighbors of particle i are counted in a previous pass,
+     *  so that the other neighbors are saved after them. */
+    inline void setNeighbor(UnsignedInt i, UnsignedInt j,
+                            UnsignedInt &overflow_count, UnsignedInt &delta_count)
+    {
+        if (isOverflowNeighbor(i, j))
+        {
+            neighbor_delta_[FirstNeighbor(i) + overflow_count] = escape_delta_;
+            neighbor_index_[overflow_offset_[i] + overflow_count] = j;
+            overflow_count++;
+        }
+        else
+        {
+            UnsignedInt overflow_size = overflow_offset_[i + 1] - overflow_offset_[i];
+            neighbor_delta_[FirstNeighbor(i) + overflow_size + delta_count] =
+                j > i ? NeighborDelta(j - i) : NeighborDelta(-NeighborDelta(i - j));
+            delta_count++;
+        }
+    };
 };
+using InnerNeighborList = CompressedNeighborList;
+#else
+using InnerNeighborList = NeighborList;
+#endif // SPHINXSYS_USE_COMPRESSED_NEIGHBOR
 } // namespace SPH
 #endif // NEIGHBORHOOD_CK_H
\ No newline at end of file
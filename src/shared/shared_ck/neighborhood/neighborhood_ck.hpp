@@ -8,19 +8,31 @@ namespace SPH
 //=================================================================================================//
 template <class ExecutionPolicy>
 Neighbor<>::Neighbor(const ExecutionPolicy &ex_policy,
-                     SPHAdaptation *sph_adaptation, DiscreteVariable<Vecd> *dv_pos)
+                     SPHAdaptation *sph_adaptation, DiscreteVariable<Vecd> *dv_pos,
+                     const PeriodicWrapping &periodic_wrapping)
     : kernel_(*sph_adaptation->getKernel()),
+#if SPHINXSYS_USE_PERIODIC_NEIGHBOR
+      periodic_wrapping_(periodic_wrapping),
+#endif // SPHINXSYS_USE_PERIODIC_NEIGHBOR
       source_pos_(dv_pos->DelegatedData(ex_policy)),
-      target_pos_(dv_pos->DelegatedData(ex_policy)){};
+      target_pos_(dv_pos->DelegatedData(ex_policy))
+{
+    checkPeriodicWrapping(periodic_wrapping);
+}
 //=================================================================================================//
 template <class ExecutionPolicy>
 Neighbor<>::Neighbor(const ExecutionPolicy &ex_policy,
                      SPHAdaptation *sph_adaptation, SPHAdaptation *contact_adaptation,
-                     DiscreteVariable<Vecd> *dv_pos, DiscreteVariable<Vecd> *dv_contact_pos)
+                     DiscreteVariable<Vecd> *dv_pos, DiscreteVariable<Vecd> *dv_contact_pos,
+                     const PeriodicWrapping &periodic_wrapping)
     : kernel_(*sph_adaptation->getKernel()),
+#if SPHINXSYS_USE_PERIODIC_NEIGHBOR
+      periodic_wrapping_(periodic_wrapping),
+#endif // SPHINXSYS_USE_PERIODIC_NEIGHBOR
       source_pos_(dv_pos->DelegatedData(ex_policy)),
       target_pos_(dv_contact_pos->DelegatedData(ex_policy))
 {
+    checkPeriodicWrapping(periodic_wrapping);
     KernelWendlandC2CK contact_kernel(*contact_adaptation->getKernel());
     if (kernel_.CutOffRadius() < contact_kernel.CutOffRadius())
     {
@@ -35,5 +47,17 @@ NeighborList::NeighborList(const ExecutionPolicy &ex_policy,
     : neighbor_index_(dv_neighbor_index->DelegatedData(ex_policy)),
       particle_offset_(dv_particle_offset->DelegatedData(ex_policy)) {}
 //=================================================================================================//
+#if SPHINXSYS_USE_COMPRESSED_NEIGHBOR
+template <class ExecutionPolicy>
+CompressedNeighborList::CompressedNeighborList(const ExecutionPolicy &ex_policy,
+                                               DiscreteVariable<UnsignedInt> *dv_neighbor_index,
+                                               DiscreteVariable<UnsignedInt> *dv_particle_offset,
+                                               DiscreteVariable<NeighborDelta> *dv_neighbor_delta,
+                                               DiscreteVariable<UnsignedInt> *dv_overflow_offset)
+    : NeighborList(ex_policy, dv_neighbor_index, dv_particle_offset),
+      neighbor_delta_(dv_neighbor_delta->DelegatedData(ex_policy)),
+      overflow_offset_(dv_overflow_offset->DelegatedData(ex_policy)) {}
+//=================================================================================================//
+#endif // SPHINXSYS_USE_COMPRESSED_NEIGHBOR
 } // namespace SPH
 #endif // NEIGHBORHOOD_CK_HPP
@@ -38,6 +38,7 @@
 #include "complex_algorithms_ck.h"
 #include "interaction_algorithms_ck.hpp"
 #include "particle_sort_ck.hpp"
+#include "reaction_dynamics_ck.hpp"
 #include "simple_algorithms_ck.h"
 
 //soil mechanics
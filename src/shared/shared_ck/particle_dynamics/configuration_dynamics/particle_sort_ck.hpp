@@ -52,7 +52,6 @@ ParticleSortCK<ExecutionPolicy, SortMethodType>::ParticleSortCK(RealBody &real_b
     : LocalDynamics(real_body), BaseDynamics<void>(),
       ex_policy_(ExecutionPolicy{}),
       cell_linked_list_(DynamicCast<CellLinkedList>(this, real_body.getCellLinkedList())),
-      mesh_(cell_linked_list_),
       dv_pos_(particles_->getVariableByName<Vecd>("Position")),
       dv_sequence_(particles_->registerDiscreteVariableOnly<UnsignedInt>(
           "Sequence", particles_->ParticlesBound())),
@@ -65,13 +64,14 @@ ParticleSortCK<ExecutionPolicy, SortMethodType>::ParticleSortCK(RealBody &real_b
       kernel_implementation_(*this)
 {
     particles_->addVariableToSort<UnsignedInt>("OriginalID");
+    cell_linked_list_.registerComputingKernel(&kernel_implementation_);
 }
 //=================================================================================================//
 template <class ExecutionPolicy, class SortMethodType>
 ParticleSortCK<ExecutionPolicy, SortMethodType>::ComputingKernel::
     ComputingKernel(const ExecutionPolicy &ex_policy,
                     ParticleSortCK<ExecutionPolicy, SortMethodType> &encloser)
-    : mesh_(encloser.mesh_), pos_(encloser.dv_pos_->DelegatedData(ex_policy)),
+    : mesh_(encloser.cell_linked_list_), pos_(encloser.dv_pos_->DelegatedData(ex_policy)),
       sequence_(encloser.dv_sequence_->DelegatedData(ex_policy)),
       index_permutation_(encloser.dv_index_permutation_->DelegatedData(ex_policy)),
       original_id_(encloser.dv_original_id_->DelegatedData(ex_policy)),
@@ -19,6 +19,7 @@ UpdateRelation<ExecutionPolicy, Inner<Parameters...>>::
       kernel_implementation_(*this)
 {
     this->particles_->addVariableToWrite(this->dv_particle_offset_);
+    cell_linked_list_.registerComputingKernel(&kernel_implementation_);
 }
 //=================================================================================================//
 template <class ExecutionPolicy, typename... Parameters>
@@ -34,6 +35,9 @@ void UpdateRelation<ExecutionPolicy, Inner<Parameters...>>::
 {
     // Here, neighbor_index_ takes role of temporary storage for neighbor size list.
     UnsignedInt neighbor_count = 0;
+#if SPHINXSYS_USE_COMPRESSED_NEIGHBOR
+    // And particle_offset_ takes role of temporary storage for overflow size list.
+    UnsignedInt overflow_count = 0;
     neighbor_search_.forEachSearch(
         index_i, this->source_pos_,
         [&](size_t index_j)
@@ -41,8 +45,24 @@ void UpdateRelation<ExecutionPolicy, Inner<Parameters...>>::
             if (index_i != index_j)
             {
                 neighbor_count++;
+                if (this->isOverflowNeighbor(index_i, index_j))
+                {
+                    overflow_count++;
+                }
             }
         });
+    this->particle_offset_[index_i] = overflow_count;
+#else
+    neighbor_search_.forEachSearch(
+        index_i, this->source_pos_,
+        [&](size_t index_j)
+        {
+            if (index_i != index_j)
+            {
+                neighbor_count++;
+            }
+        });
+#endif // SPHINXSYS_USE_COMPRESSED_NEIGHBOR
     this->neighbor_index_[index_i] = neighbor_count;
 }
 //=================================================================================================//
@@ -50,6 +70,19 @@ template <class ExecutionPolicy, typename... Parameters>
 void UpdateRelation<ExecutionPolicy, Inner<Parameters...>>::
     ComputingKernel::updateNeighborList(UnsignedInt index_i)
 {
+#if SPHINXSYS_USE_COMPRESSED_NEIGHBOR
+    UnsignedInt overflow_count = 0;
+    UnsignedInt delta_count = 0;
+    neighbor_search_.forEachSearch(
+        index_i, this->source_pos_,
+        [&](size_t index_j)
+        {
+            if (index_i != index_j)
+            {
+                this->setNeighbor(index_i, index_j, overflow_count, delta_count);
+            }
+        });
+#else
     UnsignedInt neighbor_count = 0;
     neighbor_search_.forEachSearch(
         index_i, this->source_pos_,
@@ -61,6 +94,7 @@ void UpdateRelation<ExecutionPolicy, Inner<Parameters...>>::
                 neighbor_count++;
             }
         });
+#endif // SPHINXSYS_USE_COMPRESSED_NEIGHBOR
 }
 //=================================================================================================//
 template <class ExecutionPolicy, typename... Parameters>
@@ -75,17 +109,35 @@ void UpdateRelation<ExecutionPolicy, Inner<Parameters...>>::exec(Real dt)
 
     UnsignedInt *neighbor_index = this->dv_neighbor_index_->DelegatedData(ex_policy_);
     UnsignedInt *particle_offset = this->dv_particle_offset_->DelegatedData(ex_policy_);
+#if SPHINXSYS_USE_COMPRESSED_NEIGHBOR
+    UnsignedInt *overflow_offset = this->dv_overflow_offset_->DelegatedData(ex_policy_);
+    UnsignedInt current_overflow_size =
+        exclusive_scan(ex_policy_, particle_offset, overflow_offset,
+                       this->particle_offset_list_size_,
+                       typename PlusUnsignedInt<ExecutionPolicy>::type());
+#endif // SPHINXSYS_USE_COMPRESSED_NEIGHBOR
     UnsignedInt current_neighbor_index_size =
         exclusive_scan(ex_policy_, neighbor_index, particle_offset,
                        this->particle_offset_list_size_,
                        typename PlusUnsignedInt<ExecutionPolicy>::type());
 
+#if SPHINXSYS_USE_COMPRESSED_NEIGHBOR
+    if (current_neighbor_index_size > this->dv_neighbor_delta_->getDataSize() ||
+        current_overflow_size > this->dv_neighbor_index_->getDataSize())
+    {
+        this->dv_neighbor_delta_->reallocateData(ex_policy_, current_neighbor_index_size);
+        this->dv_neighbor_index_->reallocateData(ex_policy_, current_overflow_size);
+        this->inner_relation_.resetComputingKernelUpdated();
+        kernel_implementation_.overwriteComputingKernel();
+    }
+#else
     if (current_neighbor_index_size > this->dv_neighbor_index_->getDataSize())
     {
         this->dv_neighbor_index_->reallocateData(ex_policy_, current_neighbor_index_size);
         this->inner_relation_.resetComputingKernelUpdated();
         kernel_implementation_.overwriteComputingKernel();
     }
+#endif // SPHINXSYS_USE_COMPRESSED_NEIGHBOR
 
     particle_for(ex_policy_,
                  IndexRange(0, total_real_particles),
@@ -106,6 +158,7 @@ UpdateRelation<ExecutionPolicy, Contact<Parameters...>>::
         this->particles_->addVariableToWrite(this->dv_contact_particle_offset_[k]);
         contact_kernel_implementation_.push_back(
             contact_kernel_implementation_ptrs_.template createPtr<KernelImplementation>(*this));
+        contact_cell_linked_list_[k]->registerComputingKernel(contact_kernel_implementation_.back());
     }
 }
 //=================================================================================================//
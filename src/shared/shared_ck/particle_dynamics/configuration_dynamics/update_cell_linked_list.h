@@ -34,6 +34,9 @@
 #include "all_particle_dynamics.h"
 #include "base_body.h"
 #include "base_particles.hpp"
+#include "general_reduce_ck.h"
+#include "particle_sort_ck.h"
+#include "simple_algorithms_ck.h"
 
 namespace SPH
 {
@@ -46,8 +49,6 @@ class UpdateCellLinkedList<ExecutionPolicy, CellLinkedListType>
 {
   protected:
     CellLinkedListType &cell_linked_list_;
-    Mesh mesh_;
-    UnsignedInt cell_offset_list_size_;
     DiscreteVariable<Vecd> *dv_pos_;
     DiscreteVariable<UnsignedInt> *dv_particle_index_;
     DiscreteVariable<UnsignedInt> *dv_cell_offset_;
@@ -85,5 +86,85 @@ class UpdateCellLinkedList<ExecutionPolicy, CellLinkedListType>
     Implementation<ExecutionPolicy, LocalDynamicsType, ComputingKernel> kernel_implementation_;
 };
 
+template <class ExecutionPolicy>
+class UpdateCellLinkedList<ExecutionPolicy, SparseCellLinkedList>
+    : public LocalDynamics, public BaseDynamics<void>
+{
+  protected:
+    SparseCellLinkedList &cell_linked_list_;
+    DiscreteVariable<Vecd> *dv_pos_;
+    DiscreteVariable<UnsignedInt> *dv_particle_index_;
+    DiscreteVariable<UnsignedInt> *dv_cell_offset_;
+    DiscreteVariable<UnsignedInt> *dv_occupied_cell_;
+    SingularVariable<UnsignedInt> *sv_number_of_occupied_cells_;
+    DiscreteVariable<UnsignedInt> *dv_cell_key_;
+    DiscreteVariable<UnsignedInt> *dv_cell_position_;
+
+  public:
+    UpdateCellLinkedList(RealBody &real_body);
+    virtual ~UpdateCellLinkedList(){};
+
+    class ComputingKernel
+    {
+      public:
+        ComputingKernel(const ExecutionPolicy &ex_policy,
+                        UpdateCellLinkedList<ExecutionPolicy, SparseCellLinkedList> &encloser);
+        void prepareCellKey(UnsignedInt index_i);
+        void markFirstInCell(UnsignedInt index_i);
+        void updateOccupiedCell(UnsignedInt index_i);
+
+      protected:
+        Mesh mesh_;
+        UnsignedInt *total_real_particles_;
+
+        Vecd *pos_;
+        UnsignedInt *particle_index_;
+        UnsignedInt *cell_offset_;
+        UnsignedInt *occupied_cell_;
+        UnsignedInt *cell_key_;
+        UnsignedInt *cell_position_;
+
+        bool isFirstInCell(UnsignedInt index_i)
+        {
+            return index_i == 0 || cell_key_[index_i] != cell_key_[index_i - 1];
+        };
+    };
+
+    virtual void exec(Real dt = 0.0) override;
+    typedef UpdateCellLinkedList<ExecutionPolicy, SparseCellLinkedList> LocalDynamicsType;
+    using ComputingKernel = typename LocalDynamicsType::ComputingKernel;
+
+  protected:
+    ExecutionPolicy ex_policy_;
+    QuickSort sort_method_;
+    Implementation<ExecutionPolicy, LocalDynamicsType, ComputingKernel> kernel_implementation_;
+};
+
+/**
+ * @class UpdateCellLinkedListBounds
+ * @brief Track the bounding box of the body particles and extend the mesh of the cell linked list
+ * when particles approach the mesh bounds, so that a simulation can start with a tight system domain.
+ * The mesh only grows, with the given number of buffer cells beyond the particle bounding box,
+ * but not beyond the given maximum bounds, so that a runaway or NaN particle stops the simulation
+ * with an error instead of an unbounded reallocation.
+ * Returns true if the mesh is resized. Note that the cell linked list
+ * and the relations of the body need to be updated afterwards.
+ */
+template <class ExecutionPolicy>
+class UpdateCellLinkedListBounds : public LocalDynamics, public BaseDynamics<bool>
+{
+  public:
+    UpdateCellLinkedListBounds(RealBody &real_body, const BoundingBox &maximum_bounds, UnsignedInt buffer_cells = 4);
+    virtual ~UpdateCellLinkedListBounds(){};
+    virtual bool exec(Real dt = 0.0) override;
+
+  protected:
+    ExecutionPolicy ex_policy_;
+    CellLinkedList &cell_linked_list_;
+    BoundingBox maximum_bounds_;
+    Real buffer_width_;
+    ReduceDynamicsCK<ExecutionPolicy, PositionLowerBoundCK> position_lower_bound_;
+    ReduceDynamicsCK<ExecutionPolicy, PositionUpperBoundCK> position_upper_bound_;
+};
 } // namespace SPH
 #endif // UPDATE_CELL_LINKED_LIST_H
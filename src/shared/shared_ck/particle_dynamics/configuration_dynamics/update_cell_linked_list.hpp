@@ -5,6 +5,8 @@
 
 #include "adaptation.hpp"
 #include "base_particles.hpp"
+#include "cell_linked_list.hpp"
+#include "general_reduce_ck.hpp"
 #include "mesh_iterators.hpp"
 #include "particle_iterators_ck.h"
 
@@ -15,23 +17,23 @@ template <class ExecutionPolicy, typename CellLinkedListType>
 UpdateCellLinkedList<ExecutionPolicy, CellLinkedListType>::UpdateCellLinkedList(RealBody &real_body)
     : LocalDynamics(real_body), BaseDynamics<void>(),
       cell_linked_list_(DynamicCast<CellLinkedListType>(this, real_body.getCellLinkedList())),
-      mesh_(cell_linked_list_),
-      cell_offset_list_size_(cell_linked_list_.getCellOffsetListSize()),
       dv_pos_(particles_->getVariableByName<Vecd>("Position")),
       dv_particle_index_(cell_linked_list_.getParticleIndex()),
       dv_cell_offset_(cell_linked_list_.getCellOffset()),
-      dv_current_cell_size_(DiscreteVariable<UnsignedInt>("CurrentCellSize", cell_offset_list_size_)),
+      dv_current_cell_size_(DiscreteVariable<UnsignedInt>(
+          "CurrentCellSize", cell_linked_list_.getCellOffsetListSize())),
       ex_policy_(ExecutionPolicy{}), kernel_implementation_(*this)
 {
     particles_->addVariableToWrite<UnsignedInt>("ParticleIndex");
+    cell_linked_list_.registerComputingKernel(&kernel_implementation_);
 }
 //=================================================================================================//
 template <class ExecutionPolicy, typename CellLinkedListType>
 UpdateCellLinkedList<ExecutionPolicy, CellLinkedListType>::ComputingKernel::
     ComputingKernel(const ExecutionPolicy &ex_policy,
                     UpdateCellLinkedList<ExecutionPolicy, CellLinkedListType> &encloser)
-    : mesh_(encloser.mesh_),
-      cell_offset_list_size_(encloser.cell_offset_list_size_),
+    : mesh_(encloser.cell_linked_list_),
+      cell_offset_list_size_(encloser.cell_linked_list_.getCellOffsetListSize()),
       pos_(encloser.dv_pos_->DelegatedData(ex_policy)),
       particle_index_(encloser.dv_particle_index_->DelegatedData(ex_policy)),
       cell_offset_(encloser.dv_cell_offset_->DelegatedData(ex_policy)),
@@ -72,10 +74,12 @@ template <class ExecutionPolicy, class CellLinkedListType>
 void UpdateCellLinkedList<ExecutionPolicy, CellLinkedListType>::exec(Real dt)
 {
     UnsignedInt total_real_particles = this->particles_->TotalRealParticles();
+    UnsignedInt cell_offset_list_size = cell_linked_list_.getCellOffsetListSize();
+    dv_current_cell_size_.reallocateData(ex_policy_, cell_offset_list_size);
     ComputingKernel *computing_kernel = kernel_implementation_.getComputingKernel();
 
     particle_for(ex_policy_,
-                 IndexRange(0, this->cell_offset_list_size_),
+                 IndexRange(0, cell_offset_list_size),
                  [=](size_t i)
                  { computing_kernel->clearAllLists(i); });
 
@@ -87,7 +91,7 @@ void UpdateCellLinkedList<ExecutionPolicy, CellLinkedListType>::exec(Real dt)
     UnsignedInt *particle_index = this->dv_particle_index_->DelegatedData(ex_policy_);
     UnsignedInt *cell_offset = this->dv_cell_offset_->DelegatedData(ex_policy_);
     exclusive_scan(ex_policy_, particle_index, cell_offset,
-                   this->cell_offset_list_size_,
+                   cell_offset_list_size,
                    typename PlusUnsignedInt<ExecutionPolicy>::type());
 
     particle_for(ex_policy_,
@@ -96,5 +100,144 @@ void UpdateCellLinkedList<ExecutionPolicy, CellLinkedListType>::exec(Real dt)
                  { computing_kernel->updateCellList(i); });
 }
 //=================================================================================================//
+template <class ExecutionPolicy>
+UpdateCellLinkedList<ExecutionPolicy, SparseCellLinkedList>::UpdateCellLinkedList(RealBody &real_body)
+    : LocalDynamics(real_body), BaseDynamics<void>(),
+      cell_linked_list_(DynamicCast<SparseCellLinkedList>(this, real_body.getCellLinkedList())),
+      dv_pos_(particles_->getVariableByName<Vecd>("Position")),
+      dv_particle_index_(cell_linked_list_.getParticleIndex()),
+      dv_cell_offset_(cell_linked_list_.getCellOffset()),
+      dv_occupied_cell_(cell_linked_list_.getOccupiedCell()),
+      sv_number_of_occupied_cells_(cell_linked_list_.getNumberOfOccupiedCells()),
+      dv_cell_key_(cell_linked_list_.getCellKey()),
+      dv_cell_position_(cell_linked_list_.getCellPosition()),
+      ex_policy_(ExecutionPolicy{}),
+      sort_method_(ex_policy_, dv_cell_key_, dv_particle_index_),
+      kernel_implementation_(*this)
+{
+    particles_->addVariableToWrite<UnsignedInt>("ParticleIndex");
+    cell_linked_list_.registerComputingKernel(&kernel_implementation_);
+}
+//=================================================================================================//
+template <class ExecutionPolicy>
+UpdateCellLinkedList<ExecutionPolicy, SparseCellLinkedList>::ComputingKernel::
+    ComputingKernel(const ExecutionPolicy &ex_policy,
+                    UpdateCellLinkedList<ExecutionPolicy, SparseCellLinkedList> &encloser)
+    : mesh_(encloser.cell_linked_list_),
+      total_real_particles_(encloser.particles_->svTotalRealParticles()->DelegatedData(ex_policy)),
+      pos_(encloser.dv_pos_->DelegatedData(ex_policy)),
+      particle_index_(encloser.dv_particle_index_->DelegatedData(ex_policy)),
+      cell_offset_(encloser.dv_cell_offset_->DelegatedData(ex_policy)),
+      occupied_cell_(encloser.dv_occupied_cell_->DelegatedData(ex_policy)),
+      cell_key_(encloser.dv_cell_key_->DelegatedData(ex_policy)),
+      cell_position_(encloser.dv_cell_position_->DelegatedData(ex_policy)) {}
+//=================================================================================================//
+template <class ExecutionPolicy>
+void UpdateCellLinkedList<ExecutionPolicy, SparseCellLinkedList>::ComputingKernel::
+    prepareCellKey(UnsignedInt index_i)
+{
+    cell_key_[index_i] = mesh_.LinearCellIndexFromPosition(pos_[index_i]);
+    particle_index_[index_i] = index_i;
+}
+//=================================================================================================//
+template <class ExecutionPolicy>
+void UpdateCellLinkedList<ExecutionPolicy, SparseCellLinkedList>::ComputingKernel::
+    markFirstInCell(UnsignedInt index_i)
+{
+    // Here, cell_offset_ takes role of the flag list for the first particle in a cell.
+    cell_offset_[index_i] = isFirstInCell(index_i) ? 1 : 0;
+}
+//=================================================================================================//
+template <class ExecutionPolicy>
+void UpdateCellLinkedList<ExecutionPolicy, SparseCellLinkedList>::ComputingKernel::
+    updateOccupiedCell(UnsignedInt index_i)
+{
+    // Here, cell_position_ gives the position of the cell in the occupied cell list.
+    if (index_i == *total_real_particles_)
+    {
+        cell_offset_[cell_position_[index_i]] = index_i;
+    }
+    else if (isFirstInCell(index_i))
+    {
+        occupied_cell_[cell_position_[index_i]] = cell_key_[index_i];
+        cell_offset_[cell_position_[index_i]] = index_i;
+    }
+}
+//=================================================================================================//
+template <class ExecutionPolicy>
+void UpdateCellLinkedList<ExecutionPolicy, SparseCellLinkedList>::exec(Real dt)
+{
+    UnsignedInt total_real_particles = this->particles_->TotalRealParticles();
+    ComputingKernel *computing_kernel = kernel_implementation_.getComputingKernel();
+
+    particle_for(ex_policy_,
+                 IndexRange(0, total_real_particles),
+                 [=](size_t i)
+                 { computing_kernel->prepareCellKey(i); });
+
+    sort_method_.sort(ex_policy_, this->particles_);
+
+    particle_for(ex_policy_,
+                 IndexRange(0, total_real_particles),
+                 [=](size_t i)
+                 { computing_kernel->markFirstInCell(i); });
+
+    UnsignedInt *cell_offset = this->dv_cell_offset_->DelegatedData(ex_policy_);
+    UnsignedInt *cell_position = this->dv_cell_position_->DelegatedData(ex_policy_);
+    UnsignedInt number_of_occupied_cells =
+        exclusive_scan(ex_policy_, cell_offset, cell_position,
+                       total_real_particles + 1,
+                       typename PlusUnsignedInt<ExecutionPolicy>::type());
+
+    particle_for(ex_policy_,
+                 IndexRange(0, total_real_particles + 1),
+                 [=](size_t i)
+                 { computing_kernel->updateOccupiedCell(i); });
+    sv_number_of_occupied_cells_->setValue(number_of_occupied_cells);
+}
+//=================================================================================================//
+template <class ExecutionPolicy>
+UpdateCellLinkedListBounds<ExecutionPolicy>::
+    UpdateCellLinkedListBounds(RealBody &real_body, const BoundingBox &maximum_bounds, UnsignedInt buffer_cells)
+    : LocalDynamics(real_body), BaseDynamics<bool>(),
+      ex_policy_(ExecutionPolicy{}),
+      cell_linked_list_(DynamicCast<CellLinkedList>(this, real_body.getCellLinkedList())),
+      maximum_bounds_(maximum_bounds),
+      buffer_width_(Real(buffer_cells) * cell_linked_list_.GridSpacing()),
+      position_lower_bound_(real_body), position_upper_bound_(real_body) {}
+//=================================================================================================//
+template <class ExecutionPolicy>
+bool UpdateCellLinkedListBounds<ExecutionPolicy>::exec(Real dt)
+{
+    BoundingBox mesh_bounds = cell_linked_list_.MeshInnerBounds();
+    Vecd lower_bound = position_lower_bound_.exec();
+    Vecd upper_bound = position_upper_bound_.exec();
+
+    // particles are still away from the buffer cells of the mesh
+    if ((lower_bound.array() > mesh_bounds.first_.array()).all() &&
+        (upper_bound.array() < mesh_bounds.second_.array()).all())
+    {
+        return false;
+    }
+
+    if (!lower_bound.allFinite() || !upper_bound.allFinite() ||
+        (lower_bound.array() < maximum_bounds_.first_.array()).any() ||
+        (upper_bound.array() > maximum_bounds_.second_.array()).any())
+    {
+        std::cout << "\n Error: particles of " << getSPHBody().getName() << " with bounds ["
+                  << lower_bound.transpose() << "] and [" << upper_bound.transpose()
+                  << "] are beyond the maximum bounds of the cell linked list!" << std::endl;
+        std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+        exit(1);
+    }
+
+    Vecd buffer = buffer_width_ * Vecd::Ones();
+    BoundingBox tentative_bounds(
+        mesh_bounds.first_.cwiseMin((lower_bound - buffer).cwiseMax(maximum_bounds_.first_)),
+        mesh_bounds.second_.cwiseMax((upper_bound + buffer).cwiseMin(maximum_bounds_.second_)));
+    cell_linked_list_.resizeMesh(ex_policy_, tentative_bounds);
+    return true;
+}
+//=================================================================================================//
 } // namespace SPH
 #endif // UPDATE_CELL_LINKED_LIST_HPP
@@ -48,7 +48,7 @@ class PlasticAcousticStep : public fluid_dynamics::AcousticStep<BaseInteractionT
 
   protected:
     PlasticContinuum &plastic_continuum_;
-    DiscreteVariable<Mat3d> *dv_stress_tensor_3D_, *dv_strain_tensor_3D_, *dv_stress_rate_3D_, *dv_strain_rate_3D_;
+    DiscreteVariable<SymMat3d> *dv_stress_tensor_3D_, *dv_strain_tensor_3D_, *dv_stress_rate_3D_, *dv_strain_rate_3D_;
     DiscreteVariable<Matd> *dv_velocity_gradient_;
 
 };
@@ -75,9 +75,10 @@ class PlasticAcousticStep1stHalf<Inner<OneLevel, RiemannSolverType, KernelCorrec
         void initialize(size_t index_i, Real dt = 0.0);
 
       protected:
-        Real *rho_, *p_, *drho_dt_;
+        StorageReal *rho_;
+        Real *p_, *drho_dt_;
         Vecd *vel_, *dpos_;
-        Mat3d *stress_tensor_3D_;
+        SymMat3d *stress_tensor_3D_;
     };
 
     class InteractKernel : public BaseInteraction::InteractKernel
@@ -90,9 +91,10 @@ class PlasticAcousticStep1stHalf<Inner<OneLevel, RiemannSolverType, KernelCorrec
       protected:
         KernelCorrectionType correction_;
         RiemannSolverType riemann_solver_;
-        Real *Vol_, *rho_, *p_, *drho_dt_, *mass_;
+        StorageReal *Vol_, *rho_;
+        Real *p_, *drho_dt_, *mass_;
         Vecd *force_;
-        Mat3d *stress_tensor_3D_;
+        SymMat3d *stress_tensor_3D_;
     };
 
     class UpdateKernel
@@ -133,11 +135,12 @@ class PlasticAcousticStep1stHalf<Contact<Wall, RiemannSolverType, KernelCorrecti
       protected:
         KernelCorrectionType correction_;
         RiemannSolverType riemann_solver_;
-        Real *Vol_, *rho_, *mass_, *p_, *drho_dt_;
+        StorageReal *Vol_, *rho_;
+        Real *mass_, *p_, *drho_dt_;
         Vecd *force_, *force_prior_;
-        Mat3d *stress_tensor_3D_;
+        SymMat3d *stress_tensor_3D_;
 
-        Real *wall_Vol_;
+        StorageReal *wall_Vol_;
         Vecd *wall_acc_ave_;
 
     };
@@ -14,16 +14,16 @@ template <class DynamicsIdentifier>
 PlasticAcousticStep<BaseInteractionType>::PlasticAcousticStep(DynamicsIdentifier &identifier)
     : fluid_dynamics::AcousticStep<BaseInteractionType>(identifier),
     plastic_continuum_(DynamicCast<PlasticContinuum>(this, this->sph_body_.getBaseMaterial())),
-    dv_stress_tensor_3D_(this->particles_->template registerStateVariableOnly<Mat3d>("StressTensor3D")),
-    dv_strain_tensor_3D_(this->particles_->template registerStateVariableOnly<Mat3d>("StrainTensor3D")),
-    dv_stress_rate_3D_(this->particles_->template registerStateVariableOnly<Mat3d>("StressRate3D")),
-    dv_strain_rate_3D_(this->particles_->template registerStateVariableOnly<Mat3d>("StrainRate3D")),
+    dv_stress_tensor_3D_(this->particles_->template registerStateVariableOnly<SymMat3d>("StressTensor3D")),
+    dv_strain_tensor_3D_(this->particles_->template registerStateVariableOnly<SymMat3d>("StrainTensor3D")),
+    dv_stress_rate_3D_(this->particles_->template registerStateVariableOnly<SymMat3d>("StressRate3D")),
+    dv_strain_rate_3D_(this->particles_->template registerStateVariableOnly<SymMat3d>("StrainRate3D")),
     dv_velocity_gradient_(this->particles_->template registerStateVariableOnly<Matd>("VelocityGradient"))
 {
-    this->particles_->template addVariableToSort<Mat3d>("StressTensor3D");
-    this->particles_->template addVariableToSort<Mat3d>("StrainTensor3D");
-    this->particles_->template addVariableToSort<Mat3d>("StressRate3D");
-    this->particles_->template addVariableToSort<Mat3d>("StrainRate3D");
+    this->particles_->template addVariableToSort<SymMat3d>("StressTensor3D");
+    this->particles_->template addVariableToSort<SymMat3d>("StrainTensor3D");
+    this->particles_->template addVariableToSort<SymMat3d>("StressRate3D");
+    this->particles_->template addVariableToSort<SymMat3d>("StrainRate3D");
 }
 
 //step1-inner
@@ -83,7 +83,7 @@ void PlasticAcousticStep1stHalf<Inner<OneLevel, RiemannSolverType, KernelCorrect
     Matd stress_tensor_i = degradeToMatd(stress_tensor_3D_[index_i]);
     for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); ++n)
     {
-        UnsignedInt index_j = this->neighbor_index_[n];
+        UnsignedInt index_j = this->NeighborIndex(index_i, n);
         Real dW_ijV_j = this->dW_ij(index_i, index_j) * Vol_[index_j];
         Vecd nablaW_ijV_j = this->dW_ij(index_i, index_j) * Vol_[index_j] * this->e_ij(index_i, index_j);
         Matd stress_tensor_j = degradeToMatd(stress_tensor_3D_[index_j]);
@@ -148,7 +148,7 @@ void PlasticAcousticStep1stHalf<Contact<Wall, RiemannSolverType, KernelCorrectio
 
     for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); ++n)
     {
-        UnsignedInt index_j = this->neighbor_index_[n];
+        UnsignedInt index_j = this->NeighborIndex(index_i, n);
         Vecd e_ij = this->e_ij(index_i, index_j);
         Real dW_ijV_j = this->dW_ij(index_i, index_j) * wall_Vol_[index_j];
         Real r_ij = this->vec_r_ij(index_i, index_j).norm();
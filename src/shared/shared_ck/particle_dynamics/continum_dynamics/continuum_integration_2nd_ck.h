@@ -71,7 +71,8 @@ class PlasticAcousticStep2ndHalf<Inner<OneLevel, RiemannSolverType, KernelCorrec
       protected:
         KernelCorrectionType correction_;
         RiemannSolverType riemann_solver_;
-        Real *Vol_, *rho_, *drho_dt_;
+        StorageReal *Vol_, *rho_;
+        Real *drho_dt_;
         Vecd *vel_, *force_;
 
         Matd *velocity_gradient_;
@@ -83,11 +84,13 @@ class PlasticAcousticStep2ndHalf<Inner<OneLevel, RiemannSolverType, KernelCorrec
         template <class ExecutionPolicy, class EncloserType>
         UpdateKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser);
         void update(size_t index_i, Real dt = 0.0);
+        void updateBatch(UnsignedInt index_begin, UnsignedInt lanes, Real dt = 0.0);
 
       protected:
-        Real *rho_, *drho_dt_;
+        StorageReal *rho_;
+        Real *drho_dt_;
         Matd *velocity_gradient_;
-        Mat3d *stress_tensor_3D_,*strain_tensor_3D_,*stress_rate_3D_,*strain_rate_3D_;
+        SymMat3d *stress_tensor_3D_, *strain_tensor_3D_, *stress_rate_3D_, *strain_rate_3D_;
         PlasticKernel plastic_kernel_;
     };
 
@@ -117,9 +120,10 @@ class PlasticAcousticStep2ndHalf<Contact<Wall, RiemannSolverType, KernelCorrecti
       protected:
         KernelCorrectionType correction_;
         RiemannSolverType riemann_solver_;
-        Real *Vol_, *rho_, *drho_dt_;
+        StorageReal *Vol_, *rho_;
+        Real *drho_dt_;
         Vecd *vel_, *force_;
-        Real *wall_Vol_;
+        StorageReal *wall_Vol_;
         Vecd *wall_vel_ave_, *wall_n_;
 
         Matd *velocity_gradient_;
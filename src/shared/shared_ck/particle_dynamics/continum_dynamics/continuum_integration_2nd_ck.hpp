@@ -55,7 +55,7 @@ void PlasticAcousticStep2ndHalf<Inner<OneLevel, RiemannSolverType, KernelCorrect
     Matd velocity_gradient = Matd::Zero();
     for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); ++n)
     {
-        UnsignedInt index_j = this->neighbor_index_[n];
+        UnsignedInt index_j = this->NeighborIndex(index_i, n);
         Vecd e_ij = correction_(index_i) * this->e_ij(index_i, index_j);
         Real dW_ijV_j = this->dW_ij(index_i, index_j) * Vol_[index_j];
 
@@ -89,16 +89,42 @@ void PlasticAcousticStep2ndHalf<Inner<OneLevel, RiemannSolverType, KernelCorrect
     rho_[index_i] += drho_dt_[index_i] * dt * 0.5;
 
     Mat3d velocity_gradient = upgradeToMat3d(velocity_gradient_[index_i]);
-    Mat3d stress_tensor_rate_3D_ = plastic_kernel_.ConstitutiveRelation(velocity_gradient, stress_tensor_3D_[index_i]);
-    stress_rate_3D_[index_i] = stress_tensor_rate_3D_;
-    stress_tensor_3D_[index_i] += stress_rate_3D_[index_i] * dt;
+    Mat3d stress_tensor = stress_tensor_3D_[index_i].toMatrix();
+    Mat3d stress_tensor_rate_3D_ = plastic_kernel_.ConstitutiveRelation(velocity_gradient, stress_tensor);
+    stress_rate_3D_[index_i] = SymMat3d(stress_tensor_rate_3D_);
+    stress_tensor += stress_tensor_rate_3D_ * dt;
     /*return mapping*/
-    stress_tensor_3D_[index_i] = plastic_kernel_.ReturnMapping(stress_tensor_3D_[index_i]);
-    strain_rate_3D_[index_i] = 0.5 * (velocity_gradient + velocity_gradient.transpose());
+    stress_tensor_3D_[index_i] = SymMat3d(plastic_kernel_.ReturnMapping(stress_tensor));
+    strain_rate_3D_[index_i] = SymMat3d(velocity_gradient); // the symmetric part
     strain_tensor_3D_[index_i] += strain_rate_3D_[index_i] * dt;
 }
 //=================================================================================================//
 template <class RiemannSolverType, class KernelCorrectionType, typename... Parameters>
+void PlasticAcousticStep2ndHalf<Inner<OneLevel, RiemannSolverType, KernelCorrectionType, Parameters...>>::
+    UpdateKernel::updateBatch(UnsignedInt index_begin, UnsignedInt lanes, Real dt)
+{
+    for (UnsignedInt index_i = index_begin; index_i != index_begin + lanes; ++index_i)
+        rho_[index_i] += drho_dt_[index_i] * dt * 0.5;
+
+    MatrixBatch<Dimensions> velocity_gradient_batch;
+    velocity_gradient_batch.load(velocity_gradient_, index_begin, lanes);
+    MatrixBatch<3> velocity_gradient = upgradeToMat3d(velocity_gradient_batch);
+    MatrixBatch<3> stress_tensor;
+    stress_tensor.load(stress_tensor_3D_, index_begin, lanes);
+    MatrixBatch<3> stress_rate = plastic_kernel_.ConstitutiveRelation(velocity_gradient, stress_tensor);
+    stress_rate.store(stress_rate_3D_, index_begin, lanes);
+    /*return mapping*/
+    stress_tensor = plastic_kernel_.ReturnMapping(stress_tensor + stress_rate * dt);
+    stress_tensor.store(stress_tensor_3D_, index_begin, lanes);
+
+    MatrixBatch<3> strain_rate = 0.5 * (velocity_gradient + velocity_gradient.transpose());
+    strain_rate.store(strain_rate_3D_, index_begin, lanes);
+    MatrixBatch<3> strain_tensor;
+    strain_tensor.load(strain_tensor_3D_, index_begin, lanes);
+    (strain_tensor + strain_rate * dt).store(strain_tensor_3D_, index_begin, lanes);
+}
+//=================================================================================================//
+template <class RiemannSolverType, class KernelCorrectionType, typename... Parameters>
 PlasticAcousticStep2ndHalf<Contact<Wall, RiemannSolverType, KernelCorrectionType, Parameters...>>::
     PlasticAcousticStep2ndHalf(Relation<Contact<Parameters...>> &wall_contact_relation)
     : PlasticAcousticStep<Interaction<Contact<Wall, Parameters...>>>(wall_contact_relation),
@@ -132,7 +158,7 @@ void PlasticAcousticStep2ndHalf<Contact<Wall, RiemannSolverType, KernelCorrectio
     Matd velocity_gradient = Matd::Zero();
     for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); ++n)
     {
-        UnsignedInt index_j = this->neighbor_index_[n];
+        UnsignedInt index_j = this->NeighborIndex(index_i, n);
         Vecd e_ij = this->e_ij(index_i, index_j);
         Real dW_ijV_j = this->dW_ij(index_i, index_j) * wall_Vol_[index_j];
         Vecd vel_in_wall = 2.0 * wall_vel_ave_[index_j] - vel_[index_i];
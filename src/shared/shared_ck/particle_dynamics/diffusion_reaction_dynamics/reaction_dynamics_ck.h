@@ -0,0 +1,144 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2023 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file 	reaction_dynamics_ck.h
+ * @brief 	Computing kernels for the reaction process of all species
+ *          by the operator splitting method, for unconditionally stable time stepping.
+ * @details The reaction model provides a ReactionKernel with statically dispatched rates,
+ *          which are templated on the scalar type. Each species is updated by the
+ *          exponential (Rush-Larsen) integrator with the rates frozen in a sub-step,
+ *          and a batch of consecutive particles is updated at once by the vectorized version.
+ * @author	Chi Zhang and Xiangyu Hu
+ */
+
+#ifndef REACTION_DYNAMICS_CK_H
+#define REACTION_DYNAMICS_CK_H
+
+#include "base_general_dynamics.h"
+#include "small_matrix_batch.h"
+
+namespace SPH
+{
+/**
+ * @class BaseReactionRelaxationCK
+ * @brief Base class for computing the reaction process of all species
+ */
+template <class ReactionModelType>
+class BaseReactionRelaxationCK : public LocalDynamics
+{
+  protected:
+    static constexpr int NumReactiveSpecies = ReactionModelType::NumSpecies;
+    using ReactionKernel = typename ReactionModelType::ReactionKernel;
+
+  public:
+    explicit BaseReactionRelaxationCK(SPHBody &sph_body, ReactionModelType &reaction_model);
+    virtual ~BaseReactionRelaxationCK(){};
+
+    class UpdateKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        UpdateKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser);
+
+      protected:
+        ReactionKernel reaction_kernel_;
+        std::array<Real *, NumReactiveSpecies> reactive_species_;
+
+        template <typename ScalarType>
+        ScalarType UpdateReactionSpecies(const ScalarType &input, const ScalarType &production_rate,
+                                         const ScalarType &loss_rate, Real dt) const;
+        template <typename ScalarType>
+        void advanceSpecies(size_t k, std::array<ScalarType, NumReactiveSpecies> &local_species, Real dt) const;
+        void loadLocalSpecies(std::array<Real, NumReactiveSpecies> &local_species, size_t index_i) const;
+        void applyGlobalSpecies(const std::array<Real, NumReactiveSpecies> &local_species, size_t index_i) const;
+        /** the lanes beyond the given number are filled with the first particle of the batch */
+        void loadLocalSpecies(std::array<RealBatch, NumReactiveSpecies> &local_species,
+                              UnsignedInt index_begin, UnsignedInt lanes) const;
+        void applyGlobalSpecies(const std::array<RealBatch, NumReactiveSpecies> &local_species,
+                                UnsignedInt index_begin, UnsignedInt lanes) const;
+    };
+
+  protected:
+    ReactionModelType &reaction_model_;
+    std::array<DiscreteVariable<Real> *, NumReactiveSpecies> dv_reactive_species_;
+};
+
+/**
+ * @class ReactionRelaxationForwardCK
+ * @brief Compute the reaction process of all species by forward splitting
+ */
+template <class ReactionModelType>
+class ReactionRelaxationForwardCK : public BaseReactionRelaxationCK<ReactionModelType>
+{
+    using BaseDynamicsType = BaseReactionRelaxationCK<ReactionModelType>;
+
+  public:
+    template <typename... Args>
+    ReactionRelaxationForwardCK(Args &&...args) : BaseDynamicsType(std::forward<Args>(args)...){};
+    virtual ~ReactionRelaxationForwardCK(){};
+
+    class UpdateKernel : public BaseDynamicsType::UpdateKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        UpdateKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+            : BaseDynamicsType::UpdateKernel(ex_policy, encloser){};
+        void update(size_t index_i, Real dt = 0.0);
+        void updateBatch(UnsignedInt index_begin, UnsignedInt lanes, Real dt = 0.0);
+
+      protected:
+        template <typename ScalarType>
+        void advanceForwardStep(std::array<ScalarType, BaseDynamicsType::NumReactiveSpecies> &local_species, Real dt) const;
+    };
+};
+
+/**
+ * @class ReactionRelaxationBackwardCK
+ * @brief Compute the reaction process of all species by backward splitting
+ */
+template <class ReactionModelType>
+class ReactionRelaxationBackwardCK : public BaseReactionRelaxationCK<ReactionModelType>
+{
+    using BaseDynamicsType = BaseReactionRelaxationCK<ReactionModelType>;
+
+  public:
+    template <typename... Args>
+    ReactionRelaxationBackwardCK(Args &&...args) : BaseDynamicsType(std::forward<Args>(args)...){};
+    virtual ~ReactionRelaxationBackwardCK(){};
+
+    class UpdateKernel : public BaseDynamicsType::UpdateKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        UpdateKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+            : BaseDynamicsType::UpdateKernel(ex_policy, encloser){};
+        void update(size_t index_i, Real dt = 0.0);
+        void updateBatch(UnsignedInt index_begin, UnsignedInt lanes, Real dt = 0.0);
+
+      protected:
+        template <typename ScalarType>
+        void advanceBackwardStep(std::array<ScalarType, BaseDynamicsType::NumReactiveSpecies> &local_species, Real dt) const;
+    };
+};
+} // namespace SPH
+#endif // REACTION_DYNAMICS_CK_H
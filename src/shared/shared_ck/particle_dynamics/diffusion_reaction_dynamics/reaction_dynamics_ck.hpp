@@ -0,0 +1,169 @@
+/**
+ * @file 	reaction_dynamics_ck.hpp
+ * @author	Chi Zhang and Xiangyu Hu
+ */
+
+#ifndef REACTION_DYNAMICS_CK_HPP
+#define REACTION_DYNAMICS_CK_HPP
+
+#include "reaction_dynamics_ck.h"
+
+namespace SPH
+{
+//=================================================================================================//
+template <class ReactionModelType>
+BaseReactionRelaxationCK<ReactionModelType>::
+    BaseReactionRelaxationCK(SPHBody &sph_body, ReactionModelType &reaction_model)
+    : LocalDynamics(sph_body), reaction_model_(reaction_model)
+{
+    auto &species_names = reaction_model.getSpeciesNames();
+    for (size_t k = 0; k != NumReactiveSpecies; ++k)
+    {
+        dv_reactive_species_[k] = particles_->template registerStateVariableOnly<Real>(species_names[k]);
+    }
+}
+//=================================================================================================//
+template <class ReactionModelType>
+template <class ExecutionPolicy, class EncloserType>
+BaseReactionRelaxationCK<ReactionModelType>::UpdateKernel::
+    UpdateKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+    : reaction_kernel_(encloser.reaction_model_)
+{
+    for (size_t k = 0; k != NumReactiveSpecies; ++k)
+    {
+        reactive_species_[k] = encloser.dv_reactive_species_[k]->DelegatedData(ex_policy);
+    }
+}
+//=================================================================================================//
+template <class ReactionModelType>
+template <typename ScalarType>
+ScalarType BaseReactionRelaxationCK<ReactionModelType>::UpdateKernel::
+    UpdateReactionSpecies(const ScalarType &input, const ScalarType &production_rate,
+                          const ScalarType &loss_rate, Real dt) const
+{
+    ScalarType alpha = exp(-loss_rate * dt);
+    return input * alpha + production_rate * (1.0 - alpha) / (loss_rate + TinyReal);
+}
+//=================================================================================================//
+template <class ReactionModelType>
+template <typename ScalarType>
+void BaseReactionRelaxationCK<ReactionModelType>::UpdateKernel::
+    advanceSpecies(size_t k, std::array<ScalarType, NumReactiveSpecies> &local_species, Real dt) const
+{
+    ScalarType production_rate = reaction_kernel_.ProductionRate(k, local_species);
+    ScalarType loss_rate = reaction_kernel_.LossRate(k, local_species);
+    local_species[k] = UpdateReactionSpecies(local_species[k], production_rate, loss_rate, dt);
+}
+//=================================================================================================//
+template <class ReactionModelType>
+void BaseReactionRelaxationCK<ReactionModelType>::UpdateKernel::
+    loadLocalSpecies(std::array<Real, NumReactiveSpecies> &local_species, size_t index_i) const
+{
+    for (size_t k = 0; k != NumReactiveSpecies; ++k)
+    {
+        local_species[k] = reactive_species_[k][index_i];
+    }
+}
+//=================================================================================================//
+template <class ReactionModelType>
+void BaseReactionRelaxationCK<ReactionModelType>::UpdateKernel::
+    applyGlobalSpecies(const std::array<Real, NumReactiveSpecies> &local_species, size_t index_i) const
+{
+    for (size_t k = 0; k != NumReactiveSpecies; ++k)
+    {
+        reactive_species_[k][index_i] = local_species[k];
+    }
+}
+//=================================================================================================//
+template <class ReactionModelType>
+void BaseReactionRelaxationCK<ReactionModelType>::UpdateKernel::
+    loadLocalSpecies(std::array<RealBatch, NumReactiveSpecies> &local_species,
+                     UnsignedInt index_begin, UnsignedInt lanes) const
+{
+    for (size_t k = 0; k != NumReactiveSpecies; ++k)
+    {
+        if (lanes == BatchLanes)
+        {
+            local_species[k] = Eigen::Map<const RealBatch>(reactive_species_[k] + index_begin);
+        }
+        else
+        {
+            for (UnsignedInt l = 0; l != BatchLanes; ++l)
+                local_species[k][l] = reactive_species_[k][index_begin + (l < lanes ? l : 0)];
+        }
+    }
+}
+//=================================================================================================//
+template <class ReactionModelType>
+void BaseReactionRelaxationCK<ReactionModelType>::UpdateKernel::
+    applyGlobalSpecies(const std::array<RealBatch, NumReactiveSpecies> &local_species,
+                       UnsignedInt index_begin, UnsignedInt lanes) const
+{
+    for (size_t k = 0; k != NumReactiveSpecies; ++k)
+    {
+        Eigen::Map<RealBatch>(reactive_species_[k] + index_begin).head(lanes) = local_species[k].head(lanes);
+    }
+}
+//=================================================================================================//
+template <class ReactionModelType>
+template <typename ScalarType>
+void ReactionRelaxationForwardCK<ReactionModelType>::UpdateKernel::
+    advanceForwardStep(std::array<ScalarType, BaseDynamicsType::NumReactiveSpecies> &local_species, Real dt) const
+{
+    for (size_t k = 0; k != BaseDynamicsType::NumReactiveSpecies; ++k)
+    {
+        this->advanceSpecies(k, local_species, dt);
+    }
+}
+//=================================================================================================//
+template <class ReactionModelType>
+void ReactionRelaxationForwardCK<ReactionModelType>::UpdateKernel::update(size_t index_i, Real dt)
+{
+    std::array<Real, BaseDynamicsType::NumReactiveSpecies> local_species;
+    this->loadLocalSpecies(local_species, index_i);
+    advanceForwardStep(local_species, dt);
+    this->applyGlobalSpecies(local_species, index_i);
+}
+//=================================================================================================//
+template <class ReactionModelType>
+void ReactionRelaxationForwardCK<ReactionModelType>::UpdateKernel::
+    updateBatch(UnsignedInt index_begin, UnsignedInt lanes, Real dt)
+{
+    std::array<RealBatch, BaseDynamicsType::NumReactiveSpecies> local_species;
+    this->loadLocalSpecies(local_species, index_begin, lanes);
+    advanceForwardStep(local_species, dt);
+    this->applyGlobalSpecies(local_species, index_begin, lanes);
+}
+//=================================================================================================//
+template <class ReactionModelType>
+template <typename ScalarType>
+void ReactionRelaxationBackwardCK<ReactionModelType>::UpdateKernel::
+    advanceBackwardStep(std::array<ScalarType, BaseDynamicsType::NumReactiveSpecies> &local_species, Real dt) const
+{
+    for (size_t k = BaseDynamicsType::NumReactiveSpecies; k != 0; --k)
+    {
+        this->advanceSpecies(k - 1, local_species, dt);
+    }
+}
+//=================================================================================================//
+template <class ReactionModelType>
+void ReactionRelaxationBackwardCK<ReactionModelType>::UpdateKernel::update(size_t index_i, Real dt)
+{
+    std::array<Real, BaseDynamicsType::NumReactiveSpecies> local_species;
+    this->loadLocalSpecies(local_species, index_i);
+    advanceBackwardStep(local_species, dt);
+    this->applyGlobalSpecies(local_species, index_i);
+}
+//=================================================================================================//
+template <class ReactionModelType>
+void ReactionRelaxationBackwardCK<ReactionModelType>::UpdateKernel::
+    updateBatch(UnsignedInt index_begin, UnsignedInt lanes, Real dt)
+{
+    std::array<RealBatch, BaseDynamicsType::NumReactiveSpecies> local_species;
+    this->loadLocalSpecies(local_species, index_begin, lanes);
+    advanceBackwardStep(local_species, dt);
+    this->applyGlobalSpecies(local_species, index_begin, lanes);
+}
+//=================================================================================================//
+} // namespace SPH
+#endif // REACTION_DYNAMICS_CK_HPP
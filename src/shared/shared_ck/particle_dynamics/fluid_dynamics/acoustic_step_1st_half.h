@@ -51,7 +51,8 @@ class AcousticStep : public BaseInteractionType
 
   protected:
     WeaklyCompressibleFluid &fluid_;
-    DiscreteVariable<Real> *dv_Vol_, *dv_rho_, *dv_mass_, *dv_p_, *dv_drho_dt_;
+    DiscreteVariable<StorageReal> *dv_Vol_, *dv_rho_;
+    DiscreteVariable<Real> *dv_mass_, *dv_p_, *dv_drho_dt_;
     DiscreteVariable<Vecd> *dv_vel_, *dv_dpos_, *dv_force_, *dv_force_prior_;
 };
 
@@ -79,7 +80,8 @@ class AcousticStep1stHalf<Inner<OneLevel, RiemannSolverType, KernelCorrectionTyp
 
       protected:
         EosKernel eos_;
-        Real *rho_, *p_, *drho_dt_;
+        StorageReal *rho_;
+        Real *p_, *drho_dt_;
         Vecd *vel_, *dpos_;
     };
 
@@ -93,7 +95,8 @@ class AcousticStep1stHalf<Inner<OneLevel, RiemannSolverType, KernelCorrectionTyp
       protected:
         CorrectionKernel correction_;
         RiemannSolverType riemann_solver_;
-        Real *Vol_, *rho_, *p_, *drho_dt_;
+        StorageReal *Vol_, *rho_;
+        Real *p_, *drho_dt_;
         Vecd *force_;
     };
 
@@ -135,9 +138,10 @@ class AcousticStep1stHalf<Contact<Wall, RiemannSolverType, KernelCorrectionType,
       protected:
         CorrectionKernel correction_;
         RiemannSolverType riemann_solver_;
-        Real *Vol_, *rho_, *mass_, *p_, *drho_dt_;
+        StorageReal *Vol_, *rho_;
+        Real *mass_, *p_, *drho_dt_;
         Vecd *vel_, *force_, *force_prior_;
-        Real *wall_Vol_;
+        StorageReal *wall_Vol_;
         Vecd *wall_acc_ave_;
     };
 
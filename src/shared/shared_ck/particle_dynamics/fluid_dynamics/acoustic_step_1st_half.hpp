@@ -13,8 +13,8 @@ template <class DynamicsIdentifier>
 AcousticStep<BaseInteractionType>::AcousticStep(DynamicsIdentifier &identifier)
     : BaseInteractionType(identifier),
       fluid_(DynamicCast<WeaklyCompressibleFluid>(this, this->sph_body_.getBaseMaterial())),
-      dv_Vol_(this->particles_->template getVariableByName<Real>("VolumetricMeasure")),
-      dv_rho_(this->particles_->template getVariableByName<Real>("Density")),
+      dv_Vol_(this->particles_->template getVariableByName<StorageReal>("VolumetricMeasure")),
+      dv_rho_(this->particles_->template getVariableByName<StorageReal>("Density")),
       dv_mass_(this->particles_->template getVariableByName<Real>("Mass")),
       dv_p_(this->particles_->template registerStateVariableOnly<Real>("Pressure")),
       dv_drho_dt_(this->particles_->template registerStateVariableOnly<Real>("DensityChangeRate")),
@@ -32,14 +32,14 @@ AcousticStep<BaseInteractionType>::AcousticStep(DynamicsIdentifier &identifier)
     this->particles_->template addVariableToSort<Vecd>("ForcePrior");
     this->particles_->template addVariableToSort<Vecd>("Force");
     this->particles_->template addVariableToSort<Real>("DensityChangeRate");
-    this->particles_->template addVariableToSort<Real>("Density");
+    this->particles_->template addVariableToSort<StorageReal>("Density");
     this->particles_->template addVariableToSort<Real>("Pressure");
-    this->particles_->template addVariableToSort<Real>("VolumetricMeasure");
+    this->particles_->template addVariableToSort<StorageReal>("VolumetricMeasure");
     //----------------------------------------------------------------------
     //		add restart output particle data
     //----------------------------------------------------------------------
     this->particles_->template addVariableToRestart<Vecd>("Position");
-    this->particles_->template addVariableToRestart<Real>("VolumetricMeasure");
+    this->particles_->template addVariableToRestart<StorageReal>("VolumetricMeasure");
     this->particles_->template addVariableToRestart<Real>("Pressure");
     this->particles_->template addVariableToRestart<Real>("DensityChangeRate");
     this->particles_->template addVariableToRestart<Vecd>("Velocity");
@@ -102,7 +102,7 @@ void AcousticStep1stHalf<Inner<OneLevel, RiemannSolverType, KernelCorrectionType
     Real rho_dissipation(0);
     for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); ++n)
     {
-        UnsignedInt index_j = this->neighbor_index_[n];
+        UnsignedInt index_j = this->NeighborIndex(index_i, n);
         Real dW_ijV_j = this->dW_ij(index_i, index_j) * Vol_[index_j];
         Vecd e_ij = this->e_ij(index_i, index_j);
 
@@ -161,7 +161,7 @@ void AcousticStep1stHalf<Contact<Wall, RiemannSolverType, KernelCorrectionType,
     Real rho_dissipation(0);
     for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); ++n)
     {
-        UnsignedInt index_j = this->neighbor_index_[n];
+        UnsignedInt index_j = this->NeighborIndex(index_i, n);
         Real dW_ijV_j = this->dW_ij(index_i, index_j) * wall_Vol_[index_j];
         Vecd e_ij = this->e_ij(index_i, index_j);
         Real r_ij = this->vec_r_ij(index_i, index_j).norm();
@@ -72,7 +72,8 @@ class AcousticStep2ndHalf<Inner<OneLevel, RiemannSolverType, KernelCorrectionTyp
       protected:
         CorrectionKernel correction_;
         RiemannSolverType riemann_solver_;
-        Real *Vol_, *rho_, *drho_dt_;
+        StorageReal *Vol_, *rho_;
+        Real *drho_dt_;
         Vecd *vel_, *force_;
     };
 
@@ -84,7 +85,8 @@ class AcousticStep2ndHalf<Inner<OneLevel, RiemannSolverType, KernelCorrectionTyp
         void update(size_t index_i, Real dt = 0.0);
 
       protected:
-        Real *rho_, *drho_dt_;
+        StorageReal *rho_;
+        Real *drho_dt_;
     };
 
   protected:
@@ -116,9 +118,10 @@ class AcousticStep2ndHalf<Contact<Wall, RiemannSolverType, KernelCorrectionType,
       protected:
         CorrectionKernel correction_;
         RiemannSolverType riemann_solver_;
-        Real *Vol_, *rho_, *drho_dt_;
+        StorageReal *Vol_, *rho_;
+        Real *drho_dt_;
         Vecd *vel_, *force_;
-        Real *wall_Vol_;
+        StorageReal *wall_Vol_;
         Vecd *wall_vel_ave_, *wall_n_;
     };
 
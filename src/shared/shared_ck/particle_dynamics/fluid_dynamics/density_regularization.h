@@ -57,7 +57,7 @@ class Regularization<Internal>
                         Regularization<Internal> &encloser,
                         ComputingKernelType &computing_kernel){};
 
-        Real operator()(Real &rho_sum) { return rho_sum; };
+        Real operator()(Real rho_sum) { return rho_sum; };
     };
 };
 
@@ -76,7 +76,7 @@ class Regularization<FreeSurface>
                         ComputingKernelType &computing_kernel)
             : rho0_(computing_kernel.InitialDensity()){};
 
-        Real operator()(Real &rho_sum) { return SMAX(rho_sum, rho0_); };
+        Real operator()(Real rho_sum) { return SMAX(rho_sum, rho0_); };
 
       protected:
         Real rho0_;
@@ -107,12 +107,16 @@ class DensityRegularization<Base, RelationType<Parameters...>>
         Real InitialDensity() { return rho0_; };
 
       protected:
-        Real *rho_, *mass_, *rho_sum_, *Vol_;
+        StorageReal *rho_;
+        Real *mass_;
+        StorageReal *rho_sum_, *Vol_;
         Real rho0_, inv_sigma0_;
     };
 
   protected:
-    DiscreteVariable<Real> *dv_rho_, *dv_mass_, *dv_rho_sum_, *dv_Vol_;
+    DiscreteVariable<StorageReal> *dv_rho_;
+    DiscreteVariable<Real> *dv_mass_;
+    DiscreteVariable<StorageReal> *dv_rho_sum_, *dv_Vol_;
     Real rho0_, inv_sigma0_;
 };
 
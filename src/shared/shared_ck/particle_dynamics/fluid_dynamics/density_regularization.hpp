@@ -15,10 +15,10 @@ template <class DynamicsIdentifier>
 DensityRegularization<Base, RelationType<Parameters...>>::
     DensityRegularization(DynamicsIdentifier &identifier)
     : Interaction<RelationType<Parameters...>>(identifier),
-      dv_rho_(this->particles_->template getVariableByName<Real>("Density")),
+      dv_rho_(this->particles_->template getVariableByName<StorageReal>("Density")),
       dv_mass_(this->particles_->template getVariableByName<Real>("Mass")),
-      dv_rho_sum_(this->particles_->template registerStateVariableOnly<Real>("DensitySummation")),
-      dv_Vol_(this->particles_->template getVariableByName<Real>("VolumetricMeasure")),
+      dv_rho_sum_(this->particles_->template registerStateVariableOnly<StorageReal>("DensitySummation")),
+      dv_Vol_(this->particles_->template getVariableByName<StorageReal>("VolumetricMeasure")),
       rho0_(this->sph_body_.getBaseMaterial().ReferenceDensity()),
       inv_sigma0_(1.0 / this->sph_adaptation_->LatticeNumberDensity()) {}
 //=================================================================================================//
@@ -56,7 +56,7 @@ void DensityRegularization<Inner<WithUpdate, RegularizationType, Parameters...>>
 {
     Real sigma = W0_;
     for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); ++n)
-        sigma += this->W_ij(index_i, this->neighbor_index_[n]);
+        sigma += this->W_ij(index_i, this->NeighborIndex(index_i, n));
 
     this->rho_sum_[index_i] = sigma * this->rho0_ * this->inv_sigma0_;
 }
@@ -107,7 +107,7 @@ void DensityRegularization<Contact<Parameters...>>::
     Real sigma(0);
     for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); ++n)
     {
-        UnsignedInt index_j = this->neighbor_index_[n];
+        UnsignedInt index_j = this->NeighborIndex(index_i, n);
         sigma += this->W_ij(index_i, index_j) * contact_inv_rho0_k_ * contact_mass_k_[index_j];
     }
     this->rho_sum_[index_i] += sigma * this->rho0_ * this->rho0_ *
@@ -8,7 +8,7 @@ namespace fluid_dynamics
 AcousticTimeStepCK::AcousticTimeStepCK(SPHBody &sph_body, Real acousticCFL)
     : LocalDynamicsReduce<ReduceMax>(sph_body),
       fluid_(DynamicCast<WeaklyCompressibleFluid>(this, particles_->getBaseMaterial())),
-      dv_rho_(particles_->getVariableByName<Real>("Density")),
+      dv_rho_(particles_->getVariableByName<StorageReal>("Density")),
       dv_p_(particles_->getVariableByName<Real>("Pressure")),
       dv_mass_(particles_->getVariableByName<Real>("Mass")),
       dv_vel_(particles_->getVariableByName<Vecd>("Velocity")),
@@ -50,9 +50,9 @@ AdvectionViscousTimeStepCK::AdvectionViscousTimeStepCK(SPHBody &sph_body, Real U
 //=================================================================================================//
 AdvectionStepSetup::AdvectionStepSetup(SPHBody &sph_body)
     : LocalDynamics(sph_body),
-      dv_Vol_(particles_->getVariableByName<Real>("VolumetricMeasure")),
+      dv_Vol_(particles_->getVariableByName<StorageReal>("VolumetricMeasure")),
       dv_mass_(particles_->getVariableByName<Real>("Mass")),
-      dv_rho_(particles_->getVariableByName<Real>("Density")),
+      dv_rho_(particles_->getVariableByName<StorageReal>("Density")),
       dv_dpos_(particles_->registerStateVariableOnly<Vecd>("Displacement")) {}
 //=================================================================================================//
 AdvectionStepClose::AdvectionStepClose(SPHBody &sph_body)
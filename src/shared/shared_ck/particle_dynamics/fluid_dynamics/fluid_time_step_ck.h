@@ -63,14 +63,16 @@ class AcousticTimeStepCK : public LocalDynamicsReduce<ReduceMax>
 
       protected:
         EosKernel eos_;
-        Real *rho_, *p_, *mass_;
+        StorageReal *rho_;
+        Real *p_, *mass_;
         Vecd *vel_, *force_, *force_prior_;
         Real h_min_;
     };
 
   protected:
     WeaklyCompressibleFluid &fluid_;
-    DiscreteVariable<Real> *dv_rho_, *dv_p_, *dv_mass_;
+    DiscreteVariable<StorageReal> *dv_rho_;
+    DiscreteVariable<Real> *dv_p_, *dv_mass_;
     DiscreteVariable<Vecd> *dv_vel_, *dv_force_, *dv_force_prior_;
     Real h_min_;
     Real acousticCFL_;
@@ -161,12 +163,16 @@ class AdvectionStepSetup : public LocalDynamics
         };
 
       protected:
-        Real *Vol_, *mass_, *rho_;
+        StorageReal *Vol_;
+        Real *mass_;
+        StorageReal *rho_;
         Vecd *dpos_;
     };
 
   protected:
-    DiscreteVariable<Real> *dv_Vol_, *dv_mass_, *dv_rho_;
+    DiscreteVariable<StorageReal> *dv_Vol_;
+    DiscreteVariable<Real> *dv_mass_;
+    DiscreteVariable<StorageReal> *dv_rho_;
     DiscreteVariable<Vecd> *dv_dpos_;
 };
 
@@ -65,7 +65,7 @@ class ViscousForceCK<Base, ViscosityType, KernelCorrectionType, RelationType<Par
       protected:
         ViscosityKernel viscosity_;
         CorrectionKernel correction_;
-        Real *Vol_;
+        StorageReal *Vol_;
         Vecd *vel_, *viscous_force_;
         Real smoothing_length_sq_;
     };
@@ -76,7 +76,7 @@ class ViscousForceCK<Base, ViscosityType, KernelCorrectionType, RelationType<Par
 
     ViscosityType viscosity_method_;
     KernelCorrectionType kernel_correction_;
-    DiscreteVariable<Real> *dv_Vol_;
+    DiscreteVariable<StorageReal> *dv_Vol_;
     DiscreteVariable<Vecd> *dv_vel_, *dv_viscous_force_;
     Real smoothing_length_sq_;
 };
@@ -124,7 +124,7 @@ class ViscousForceCK<Contact<Wall, ViscosityType, KernelCorrectionType, Paramete
         void interact(size_t index_i, Real dt = 0.0);
 
       protected:
-        Real *wall_Vol_;
+        StorageReal *wall_Vol_;
         Vecd *wall_vel_ave_;
     };
 };
@@ -15,7 +15,7 @@ ViscousForceCK<Base, ViscosityType, KernelCorrectionType, RelationType<Parameter
     : Interaction<RelationType<Parameters...>>(base_relation),
       ForcePriorCK(this->particles_, "ViscousForce"),
       viscosity_method_(this->particles_), kernel_correction_(this->particles_),
-      dv_Vol_(this->particles_->template getVariableByName<Real>("VolumetricMeasure")),
+      dv_Vol_(this->particles_->template getVariableByName<StorageReal>("VolumetricMeasure")),
       dv_vel_(this->particles_->template getVariableByName<Vecd>("Velocity")),
       dv_viscous_force_(this->dv_current_force_),
       smoothing_length_sq_(pow(this->sph_body_.sph_adaptation_->ReferenceSmoothingLength(), 2)) {}
@@ -40,7 +40,7 @@ void ViscousForceCK<Inner<WithUpdate, ViscosityType, KernelCorrectionType, Param
     Vecd force = Vecd::Zero();
     for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); ++n)
     {
-        UnsignedInt index_j = this->neighbor_index_[n];
+        UnsignedInt index_j = this->NeighborIndex(index_i, n);
         Vecd e_ij = this->e_ij(index_i, index_j);
         Vecd vec_r_ij = this->vec_r_ij(index_i, index_j);
         Vecd vel_derivative = (this->vel_[index_i] - this->vel_[index_j]) /
@@ -60,7 +60,7 @@ void ViscousForceCK<Contact<Wall, ViscosityType, KernelCorrectionType, Parameter
     Vecd force = Vecd::Zero();
     for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); ++n)
     {
-        UnsignedInt index_j = this->neighbor_index_[n];
+        UnsignedInt index_j = this->NeighborIndex(index_i, n);
         Vecd e_ij = this->e_ij(index_i, index_j);
         Vecd vec_r_ij = this->vec_r_ij(index_i, index_j);
         Vecd vel_derivative = (this->vel_[index_i] - this->wall_vel_ave_[index_j]) /
@@ -56,21 +56,21 @@ class ForceFromFluid : public Interaction<Contact<Parameters...>>, public ForceP
         InteractKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser, UnsignedInt contact_index);
 
       protected:
-        Real *Vol_;
+        StorageReal *Vol_;
         Vecd *force_from_fluid_, *vel_ave_;
         CorrectionKernel contact_correction_;
-        Real *contact_Vol_;
+        StorageReal *contact_Vol_;
         Vecd *contact_vel_;
     };
 
   protected:
     Solid &solid_;
-    DiscreteVariable<Real> *dv_Vol_;
+    DiscreteVariable<StorageReal> *dv_Vol_;
     DiscreteVariable<Vecd> *dv_force_from_fluid_, *dv_vel_ave_;
 
     StdVec<Fluid *> contact_fluid_;
     StdVec<KernelCorrectionType> contact_kernel_correction_;
-    StdVec<DiscreteVariable<Real> *> contact_Vol_;
+    StdVec<DiscreteVariable<StorageReal> *> contact_Vol_;
     StdVec<DiscreteVariable<Vecd> *> contact_vel_;
 };
 
@@ -135,14 +135,16 @@ class PressureForceFromFluid<Contact<WithUpdate, AcousticStep2ndHalfType, Parame
       protected:
         Vecd *acc_ave_, *n_;
         RiemannSolverType riemann_solver_;
-        Real *contact_rho_, *contact_mass_, *contact_p_;
+        StorageReal *contact_rho_;
+        Real *contact_mass_, *contact_p_;
         Vecd *contact_force_prior_;
     };
 
   protected:
     DiscreteVariable<Vecd> *dv_acc_ave_, *dv_n_;
     StdVec<RiemannSolverType> contact_riemann_solver_;
-    StdVec<DiscreteVariable<Real> *> dv_contact_rho_, dv_contact_mass_, dv_contact_p_;
+    StdVec<DiscreteVariable<StorageReal> *> dv_contact_rho_;
+    StdVec<DiscreteVariable<Real> *> dv_contact_mass_, dv_contact_p_;
     StdVec<DiscreteVariable<Vecd> *> dv_contact_force_prior_;
 };
 template <typename AcousticStep2ndHalfType>
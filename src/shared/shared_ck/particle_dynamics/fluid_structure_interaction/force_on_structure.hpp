@@ -14,7 +14,7 @@ ForceFromFluid<KernelCorrectionType, Parameters...>::
     ForceFromFluid(ContactRelationType &contact_relation, const std::string &force_name)
     : Interaction<Contact<Parameters...>>(contact_relation), ForcePriorCK(this->particles_, force_name),
       solid_(DynamicCast<Solid>(this, this->sph_body_.getBaseMaterial())),
-      dv_Vol_(this->particles_->template getVariableByName<Real>("VolumetricMeasure")),
+      dv_Vol_(this->particles_->template getVariableByName<StorageReal>("VolumetricMeasure")),
       dv_force_from_fluid_(this->dv_current_force_),
       dv_vel_ave_(solid_.AverageVelocityVariable(this->particles_))
 {
@@ -22,7 +22,7 @@ ForceFromFluid<KernelCorrectionType, Parameters...>::
     {
         contact_fluid_.push_back(DynamicCast<Fluid>(this, &this->contact_particles_[k]->getBaseMaterial()));
         contact_kernel_correction_.push_back(KernelCorrectionType(this->contact_particles_[k]));
-        contact_Vol_.push_back(this->contact_particles_[k]->template getVariableByName<Real>("VolumetricMeasure"));
+        contact_Vol_.push_back(this->contact_particles_[k]->template getVariableByName<StorageReal>("VolumetricMeasure"));
         contact_vel_.push_back(this->contact_particles_[k]->template getVariableByName<Vecd>("Velocity"));
     }
 }
@@ -67,7 +67,7 @@ void ViscousForceFromFluid<Contact<WithUpdate, ViscousForceType, Parameters...>>
     Vecd force = Vecd::Zero();
     for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); ++n)
     {
-        UnsignedInt index_j = this->neighbor_index_[n];
+        UnsignedInt index_j = this->NeighborIndex(index_i, n);
         Vecd e_ij = this->e_ij(index_i, index_j);
         Vecd vec_r_ij = this->vec_r_ij(index_i, index_j);
         Vecd vel_derivative = (this->vel_ave_[index_i] - this->contact_vel_[index_j]) /
@@ -92,7 +92,7 @@ PressureForceFromFluid<Contact<WithUpdate, AcousticStep2ndHalfType, Parameters..
     for (size_t k = 0; k != this->contact_particles_.size(); ++k)
     {
         contact_riemann_solver_.push_back(RiemannSolverType(*this->contact_fluid_[k], *this->contact_fluid_[k]));
-        dv_contact_rho_.push_back(this->contact_particles_[k]->template getVariableByName<Real>("Density"));
+        dv_contact_rho_.push_back(this->contact_particles_[k]->template getVariableByName<StorageReal>("Density"));
         dv_contact_mass_.push_back(this->contact_particles_[k]->template getVariableByName<Real>("Mass"));
         dv_contact_p_.push_back(this->contact_particles_[k]->template getVariableByName<Real>("Pressure"));
         dv_contact_force_prior_.push_back(this->contact_particles_[k]->template getVariableByName<Vecd>("ForcePrior"));
@@ -119,7 +119,7 @@ void PressureForceFromFluid<Contact<WithUpdate, AcousticStep2ndHalfType, Paramet
     Vecd force = Vecd::Zero();
     for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); ++n)
     {
-        UnsignedInt index_j = this->neighbor_index_[n];
+        UnsignedInt index_j = this->NeighborIndex(index_i, n);
         Vecd e_ij = this->e_ij(index_i, index_j);
         Real r_ij = this->vec_r_ij(index_i, index_j).norm();
 
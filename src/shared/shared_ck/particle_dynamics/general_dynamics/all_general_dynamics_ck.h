@@ -35,3 +35,4 @@
 #include "geometric_dynamics.hpp"
 #include "interpolation_dynamics.hpp"
 #include "kernel_correction_ck.hpp"
+#include "multi_rate_time_step_ck.h"
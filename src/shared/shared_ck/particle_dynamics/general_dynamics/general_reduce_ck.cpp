@@ -3,6 +3,20 @@
 namespace SPH
 {
 //=================================================================================================//
+PositionLowerBoundCK::PositionLowerBoundCK(SPHBody &sph_body)
+    : LocalDynamicsReduce<ReduceLowerBound>(sph_body),
+      dv_pos_(particles_->getVariableByName<Vecd>("Position"))
+{
+    quantity_name_ = "PositionLowerBound";
+}
+//=================================================================================================//
+PositionUpperBoundCK::PositionUpperBoundCK(SPHBody &sph_body)
+    : LocalDynamicsReduce<ReduceUpperBound>(sph_body),
+      dv_pos_(particles_->getVariableByName<Vecd>("Position"))
+{
+    quantity_name_ = "PositionUpperBound";
+}
+//=================================================================================================//
 TotalKineticEnergyCK::TotalKineticEnergyCK(SPHBody &sph_body)
     : LocalDynamicsReduce<ReduceSum<Real>>(sph_body),
       dv_mass_(particles_->getVariableByName<Real>("Mass")),
@@ -60,6 +60,56 @@ class VariableNormCK : public BaseLocalDynamicsReduce<NormType, DynamicsIdentifi
     DiscreteVariable<DataType> *dv_variable_;
 };
 
+/**
+ * @class PositionLowerBoundCK
+ * @brief the lower bound of a body by reduced particle positions.
+ */
+class PositionLowerBoundCK : public LocalDynamicsReduce<ReduceLowerBound>
+{
+  public:
+    explicit PositionLowerBoundCK(SPHBody &sph_body);
+    virtual ~PositionLowerBoundCK(){};
+
+    class ReduceKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        ReduceKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser);
+        Vecd reduce(size_t index_i, Real dt = 0.0) { return pos_[index_i]; };
+
+      protected:
+        Vecd *pos_;
+    };
+
+  protected:
+    DiscreteVariable<Vecd> *dv_pos_;
+};
+
+/**
+ * @class PositionUpperBoundCK
+ * @brief the upper bound of a body by reduced particle positions.
+ */
+class PositionUpperBoundCK : public LocalDynamicsReduce<ReduceUpperBound>
+{
+  public:
+    explicit PositionUpperBoundCK(SPHBody &sph_body);
+    virtual ~PositionUpperBoundCK(){};
+
+    class ReduceKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        ReduceKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser);
+        Vecd reduce(size_t index_i, Real dt = 0.0) { return pos_[index_i]; };
+
+      protected:
+        Vecd *pos_;
+    };
+
+  protected:
+    DiscreteVariable<Vecd> *dv_pos_;
+};
+
 class TotalKineticEnergyCK
     : public LocalDynamicsReduce<ReduceSum<Real>>
 {
@@ -19,6 +19,16 @@ VariableNormCK<DataType, NormType, DynamicsIdentifier>::ReduceKernel::
     : variable_(encloser.dv_variable_->DelegatedData(ex_policy)) {}
 //=================================================================================================//
 template <class ExecutionPolicy, class EncloserType>
+PositionLowerBoundCK::ReduceKernel::
+    ReduceKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+    : pos_(encloser.dv_pos_->DelegatedData(ex_policy)) {}
+//=================================================================================================//
+template <class ExecutionPolicy, class EncloserType>
+PositionUpperBoundCK::ReduceKernel::
+    ReduceKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+    : pos_(encloser.dv_pos_->DelegatedData(ex_policy)) {}
+//=================================================================================================//
+template <class ExecutionPolicy, class EncloserType>
 TotalKineticEnergyCK::ReduceKernel::
     ReduceKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
     : mass_(encloser.dv_mass_->DelegatedData(ex_policy)),
@@ -1,5 +1,7 @@
 #include "geometric_dynamics.h"
 
+#include "cell_linked_list.h"
+
 namespace SPH
 {
 //=================================================================================================//
@@ -22,4 +24,9 @@ void NormalFromBodyShapeCK::UpdateKernel::update(size_t index_i, Real dt)
     phi0_[index_i] = signed_distance;
 }
 //=================================================================================================//
+PeriodicPositionWrappingCK::PeriodicPositionWrappingCK(RealBody &real_body)
+    : LocalDynamics(real_body),
+      periodic_wrapping_(DynamicCast<CellLinkedList>(this, real_body.getCellLinkedList()).getPeriodicWrapping()),
+      dv_pos_(particles_->getVariableByName<Vecd>("Position")) {}
+//=================================================================================================//
 } // namespace SPH
@@ -30,6 +30,7 @@
 #define GEOMETRIC_DYNAMICS_H
 
 #include "base_general_dynamics.h"
+#include "base_mesh.h"
 
 namespace SPH
 {
@@ -58,5 +59,38 @@ class NormalFromBodyShapeCK : public LocalDynamics
     DiscreteVariable<Vecd> *dv_pos_, *dv_n_, *dv_n0_;
     DiscreteVariable<Real> *dv_phi_, *dv_phi0_;
 };
+
+/**
+ * @class PeriodicPositionWrappingCK
+ * @brief Wrap particle positions into the periodic bounds set in the cell linked list.
+ * Together with the periodic neighbor search, no ghost particles are required.
+ */
+class PeriodicPositionWrappingCK : public LocalDynamics
+{
+  public:
+    explicit PeriodicPositionWrappingCK(RealBody &real_body);
+    virtual ~PeriodicPositionWrappingCK(){};
+
+    class UpdateKernel
+    {
+      public:
+        template <class ExecutionPolicy>
+        UpdateKernel(const ExecutionPolicy &ex_policy, PeriodicPositionWrappingCK &encloser)
+            : periodic_wrapping_(encloser.periodic_wrapping_),
+              pos_(encloser.dv_pos_->DelegatedData(ex_policy)){};
+        void update(size_t index_i, Real dt = 0.0)
+        {
+            pos_[index_i] = periodic_wrapping_.wrapPosition(pos_[index_i]);
+        };
+
+      protected:
+        PeriodicWrapping periodic_wrapping_;
+        Vecd *pos_;
+    };
+
+  protected:
+    const PeriodicWrapping &periodic_wrapping_;
+    DiscreteVariable<Vecd> *dv_pos_;
+};
 } // namespace SPH
 #endif // GEOMETRIC_DYNAMICS_H
@@ -57,13 +57,13 @@ class Interpolation<Contact<DataType>> : public Interaction<Contact<>>
       protected:
         DataType zero_value_;
         DataType *interpolated_quantities_;
-        Real *contact_Vol_;
+        StorageReal *contact_Vol_;
         DataType *contact_data_;
     };
 
   protected:
     DiscreteVariable<DataType> *dv_interpolated_quantities_;
-    StdVec<DiscreteVariable<Real> *> dv_contact_Vol_;
+    StdVec<DiscreteVariable<StorageReal> *> dv_contact_Vol_;
     StdVec<DiscreteVariable<DataType> *> dv_contact_data_;
 };
 
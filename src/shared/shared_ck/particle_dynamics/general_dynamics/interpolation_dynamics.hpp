@@ -17,7 +17,7 @@ Interpolation<Contact<DataType>>::Interpolation(Relation<Contact<>> &pair_contac
         exit(1);
     }
     // must be single contact body
-    dv_contact_Vol_.push_back(this->contact_particles_[0]->template getVariableByName<Real>("VolumetricMeasure"));
+    dv_contact_Vol_.push_back(this->contact_particles_[0]->template getVariableByName<StorageReal>("VolumetricMeasure"));
     dv_contact_data_.push_back(this->contact_particles_[0]->template getVariableByName<DataType>(variable_name));
 }
 //=================================================================================================//
@@ -39,7 +39,7 @@ void Interpolation<Contact<DataType>>::InteractKernel::interact(size_t index_i,
 
     for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); ++n)
     {
-        UnsignedInt index_j = this->neighbor_index_[n];
+        UnsignedInt index_j = this->NeighborIndex(index_i, n);
         Real weight_j = this->W_ij(index_i, index_j) * contact_Vol_[index_j];
 
         interpolated_quantity += weight_j * contact_data_[index_j];
@@ -58,12 +58,12 @@ class LinearCorrectionMatrix<Base, RelationType<Parameters...>>
                        Args &&...args);
 
       protected:
-        Real *Vol_;
+        StorageReal *Vol_;
         Matd *B_;
     };
 
   protected:
-    DiscreteVariable<Real> *dv_Vol_;
+    DiscreteVariable<StorageReal> *dv_Vol_;
     DiscreteVariable<Matd> *dv_B_;
 };
 
@@ -127,11 +127,11 @@ class LinearCorrectionMatrix<Contact<Parameters...>>
         void interact(size_t index_i, Real dt = 0.0);
 
       protected:
-        Real *contact_Vol_k_;
+        StorageReal *contact_Vol_k_;
     };
 
   protected:
-    StdVec<DiscreteVariable<Real> *> dv_contact_Vol_;
+    StdVec<DiscreteVariable<StorageReal> *> dv_contact_Vol_;
 };
 
 using LinearCorrectionMatrixComplex = LinearCorrectionMatrix<Inner<WithUpdate>, Contact<>>;
@@ -11,7 +11,7 @@ template <class DynamicsIdentifier>
 LinearCorrectionMatrix<Base, RelationType<Parameters...>>::
     LinearCorrectionMatrix(DynamicsIdentifier &identifier)
     : Interaction<RelationType<Parameters...>>(identifier),
-      dv_Vol_(this->particles_->template getVariableByName<Real>("VolumetricMeasure")),
+      dv_Vol_(this->particles_->template getVariableByName<StorageReal>("VolumetricMeasure")),
       dv_B_(this->particles_->template registerStateVariableOnly<Matd>(
           "LinearCorrectionMatrix", IdentityMatrix<Matd>::value)) {}
 //=================================================================================================//
@@ -40,7 +40,7 @@ void LinearCorrectionMatrix<Inner<WithUpdate, Parameters...>>::
     Matd local_configuration = Matd::Zero();
     for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); ++n)
     {
-        UnsignedInt index_j = this->neighbor_index_[n];
+        UnsignedInt index_j = this->NeighborIndex(index_i, n);
         Vecd gradW_ij = this->dW_ij(index_i, index_j) * this->Vol_[index_j] * this->e_ij(index_i, index_j);
         local_configuration -= this->vec_r_ij(index_i, index_j) * gradW_ij.transpose();
     }
@@ -74,7 +74,7 @@ LinearCorrectionMatrix<Contact<Parameters...>>::
 {
     for (size_t k = 0; k != this->contact_particles_.size(); ++k)
     {
-        dv_contact_Vol_.push_back(this->contact_particles_[k]->template getVariableByName<Real>("VolumetricMeasure"));
+        dv_contact_Vol_.push_back(this->contact_particles_[k]->template getVariableByName<StorageReal>("VolumetricMeasure"));
     }
 }
 //=================================================================================================//
@@ -95,7 +95,7 @@ void LinearCorrectionMatrix<Contact<Parameters...>>::
     Matd local_configuration = Matd::Zero();
     for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); ++n)
     {
-        UnsignedInt index_j = this->neighbor_index_[n];
+        UnsignedInt index_j = this->NeighborIndex(index_i, n);
         Vecd gradW_ij = this->dW_ij(index_i, index_j) * contact_Vol_k_[index_j] * this->e_ij(index_i, index_j);
         local_configuration -= this->vec_r_ij(index_i, index_j) * gradW_ij.transpose();
     }
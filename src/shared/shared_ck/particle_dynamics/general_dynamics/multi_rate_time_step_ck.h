@@ -0,0 +1,228 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2023 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file 	multi_rate_time_step_ck.h
+ * @brief 	Individual particle time stepping with power-of-two binned time-step levels
+ *          using computing kernels.
+ * @author	Xiangyu Hu
+ */
+
+#ifndef MULTI_RATE_TIME_STEP_CK_H
+#define MULTI_RATE_TIME_STEP_CK_H
+
+#include "interaction_algorithms_ck.hpp"
+#include "interaction_ck.hpp"
+#include "multi_rate_time_step.h"
+
+namespace SPH
+{
+template <typename... RelationTypes>
+class TimeStepLevelLimiterCK;
+
+/**
+ * @class TimeStepLevelLimiterCK
+ * @brief One pass lowering the time-step level of a particle to at most one larger than those of its neighbors.
+ */
+template <typename... Parameters>
+class TimeStepLevelLimiterCK<Inner<WithUpdate, Parameters...>> : public Interaction<Inner<Parameters...>>
+{
+    using BaseInteraction = Interaction<Inner<Parameters...>>;
+
+  public:
+    TimeStepLevelLimiterCK(Relation<Inner<Parameters...>> &inner_relation,
+                           DiscreteVariable<UnsignedInt> *dv_time_step_level,
+                           DiscreteVariable<UnsignedInt> *dv_limited_level)
+        : BaseInteraction(inner_relation),
+          dv_time_step_level_(dv_time_step_level), dv_limited_level_(dv_limited_level){};
+    virtual ~TimeStepLevelLimiterCK(){};
+
+    class InteractKernel : public BaseInteraction::InteractKernel
+    {
+      public:
+        template <class ExecutionPolicy>
+        InteractKernel(const ExecutionPolicy &ex_policy, TimeStepLevelLimiterCK<Inner<WithUpdate, Parameters...>> &encloser)
+            : BaseInteraction::InteractKernel(ex_policy, encloser),
+              time_step_level_(encloser.dv_time_step_level_->DelegatedData(ex_policy)),
+              limited_level_(encloser.dv_limited_level_->DelegatedData(ex_policy)){};
+        void interact(size_t index_i, Real dt = 0.0)
+        {
+            UnsignedInt level = time_step_level_[index_i];
+            for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); ++n)
+            {
+                UnsignedInt index_j = this->NeighborIndex(index_i, n);
+                level = SMIN(level, time_step_level_[index_j] + 1);
+            }
+            limited_level_[index_i] = level;
+        };
+
+      protected:
+        UnsignedInt *time_step_level_, *limited_level_;
+    };
+
+    class UpdateKernel
+    {
+      public:
+        template <class ExecutionPolicy>
+        UpdateKernel(const ExecutionPolicy &ex_policy, TimeStepLevelLimiterCK<Inner<WithUpdate, Parameters...>> &encloser)
+            : time_step_level_(encloser.dv_time_step_level_->DelegatedData(ex_policy)),
+              limited_level_(encloser.dv_limited_level_->DelegatedData(ex_policy)){};
+        void update(size_t index_i, Real dt = 0.0) { time_step_level_[index_i] = limited_level_[index_i]; };
+
+      protected:
+        UnsignedInt *time_step_level_, *limited_level_;
+    };
+
+  protected:
+    DiscreteVariable<UnsignedInt> *dv_time_step_level_, *dv_limited_level_;
+};
+
+/**
+ * @class MultiRateTimeStepCK
+ * @brief Computing the smallest time step by a time-step reduce type and binning the particles
+ * into time-step levels limited by the inner neighbors. The time-step size of the reduce type, such as AcousticTimeStepCK,
+ * is assumed to be inversely proportional to the reduced value.
+ * The argument of exec is the time interval to the next synchronization,
+ * and the returned value is the synchronization time-step size.
+ */
+template <class ExecutionPolicy, class TimeStepType>
+class MultiRateTimeStepCK : public TimeStepType, public BaseMultiRateTimeStep, public BaseDynamics<Real>
+{
+    using Identifier = typename TimeStepType::Identifier;
+    using ReduceKernel = typename TimeStepType::ReduceKernel;
+    using Operation = typename TimeStepType::OperationType;
+    using KernelImplementation = Implementation<ExecutionPolicy, TimeStepType, ReduceKernel>;
+    KernelImplementation kernel_implementation_;
+    InteractionDynamicsCK<ExecutionPolicy, TimeStepLevelLimiterCK<Inner<WithUpdate>>> time_step_level_limiter_;
+
+  public:
+    template <typename... Args>
+    MultiRateTimeStepCK(Relation<Inner<>> &inner_relation, UnsignedInt max_level, Args &&...args)
+        : TimeStepType(inner_relation.getSPHBody(), std::forward<Args>(args)...),
+          BaseMultiRateTimeStep(inner_relation.getSPHBody().getBaseParticles(), max_level),
+          BaseDynamics<Real>(), kernel_implementation_(*this),
+          time_step_level_limiter_(inner_relation, dv_time_step_level_, dv_limited_level_){};
+    virtual ~MultiRateTimeStepCK(){};
+
+    virtual Real exec(Real time_to_sync = 0.0) override
+    {
+        this->setupDynamics(0.0);
+        ReduceKernel *reduce_kernel = kernel_implementation_.getComputingKernel();
+        LoopRangeCK<ExecutionPolicy, Identifier> loop_range(this->identifier_);
+        Real reduced_value = particle_reduce<Operation>(
+            loop_range, ReduceReference<Operation>::value,
+            [=](size_t i)
+            { return reduce_kernel->reduce(i, 0.0); });
+        dt_min_ = this->outputResult(reduced_value);
+        top_level_ = TopLevel(time_to_sync);
+        sub_step_ = 0;
+
+        UnsignedInt top_level = top_level_;
+        UnsignedInt *time_step_level = dv_time_step_level_->DelegatedData(ExecutionPolicy{});
+        particle_for(loop_range,
+                     [=](size_t i)
+                     {
+                         Real time_step_ratio = reduced_value / (reduce_kernel->reduce(i, 0.0) + TinyReal);
+                         time_step_level[i] = binTimeStepLevel(time_step_ratio, top_level);
+                     });
+        /** top-level passes are sufficient as the levels are not larger than the top level. */
+        for (UnsignedInt pass = 0; pass != top_level_; ++pass)
+            time_step_level_limiter_.exec();
+
+        Real sum_of_updates = particle_reduce<ReduceSum<Real>>(
+            loop_range, ReduceReference<ReduceSum<Real>>::value,
+            [=](size_t i)
+            { return Real(1u << (top_level - time_step_level[i])); });
+        setEffectiveSpeedup(Real(this->particles_->TotalRealParticles()), sum_of_updates);
+        return SynchronizationTimeStep();
+    };
+
+    virtual void endSubStep() override
+    {
+        TimeStepLevel time_step_level = getTimeStepLevel(ExecutionPolicy{});
+        Vecd *pos = dv_pos_->DelegatedData(ExecutionPolicy{});
+        Vecd *vel = dv_vel_->DelegatedData(ExecutionPolicy{});
+        particle_for(LoopRangeCK<ExecutionPolicy, Identifier>(this->identifier_),
+                     [=](size_t i)
+                     { pos[i] += vel[i] * time_step_level.DriftTime(i); });
+    };
+};
+
+/**
+ * @class MultiRateInteractionDynamicsCK
+ * @brief One-level interaction dynamics, such as the acoustic steps, integrating only
+ * the particles active at the current sub-step with their own time-step sizes.
+ * The argument of exec is not used. Pre- and post-processes are carried out with the smallest time step.
+ * The positions of all particles are brought to the end of the sub-step by BaseMultiRateTimeStep::endSubStep.
+ */
+template <class ExecutionPolicy, class InteractionType>
+class MultiRateInteractionDynamicsCK : public InteractionDynamicsCK<ExecutionPolicy, InteractionType>
+{
+    using BaseDynamicsType = InteractionDynamicsCK<ExecutionPolicy, InteractionType>;
+    using Identifier = typename BaseDynamicsType::Identifier;
+    using InitializeKernel = typename BaseDynamicsType::InitializeKernel;
+    using UpdateKernel = typename BaseDynamicsType::UpdateKernel;
+
+  public:
+    template <typename... Args>
+    MultiRateInteractionDynamicsCK(BaseMultiRateTimeStep &multi_rate_time_step, Args &&...args)
+        : BaseDynamicsType(std::forward<Args>(args)...),
+          multi_rate_time_step_(multi_rate_time_step){};
+    virtual ~MultiRateInteractionDynamicsCK(){};
+
+    virtual void exec(Real dt = 0.0) override
+    {
+        TimeStepLevel time_step_level = multi_rate_time_step_.getTimeStepLevel(ExecutionPolicy{});
+        Real dt_min = multi_rate_time_step_.SmallestTimeStep();
+        this->setUpdated(this->identifier_.getSPHBody());
+        this->setupDynamics(dt_min);
+
+        InitializeKernel *initialize_kernel = this->initialize_kernel_implementation_.getComputingKernel();
+        particle_for(LoopRangeCK<ExecutionPolicy, Identifier>(this->identifier_),
+                     [=](size_t i)
+                     {
+                         if (time_step_level.isActive(i))
+                             initialize_kernel->initialize(i, time_step_level.TimeStep(i));
+                     });
+
+        for (size_t k = 0; k < this->pre_processes_.size(); ++k)
+            this->pre_processes_[k]->exec(dt_min);
+
+        this->runInteractionStep(time_step_level);
+
+        for (size_t k = 0; k < this->post_processes_.size(); ++k)
+            this->post_processes_[k]->exec(dt_min);
+
+        UpdateKernel *update_kernel = this->update_kernel_implementation_.getComputingKernel();
+        particle_for(LoopRangeCK<ExecutionPolicy, Identifier>(this->identifier_),
+                     [=](size_t i)
+                     {
+                         if (time_step_level.isActive(i))
+                             update_kernel->update(i, time_step_level.TimeStep(i));
+                     });
+    };
+
+  protected:
+    BaseMultiRateTimeStep &multi_rate_time_step_;
+};
+} // namespace SPH
+#endif // MULTI_RATE_TIME_STEP_CK_H
@@ -108,6 +108,8 @@ class InteractionDynamicsCK<ExecutionPolicy, Base, InteractionType<Inner<Paramet
 
   protected:
     void runInteraction(Real dt);
+    template <class TimeStepLevelType>
+    void runInteraction(const TimeStepLevelType &time_step_level);
 };
 
 template <class ExecutionPolicy, template <typename...> class InteractionType, typename... Parameters>
@@ -128,6 +130,8 @@ class InteractionDynamicsCK<ExecutionPolicy, Base, InteractionType<Contact<Param
 
   protected:
     void runInteraction(Real dt);
+    template <class TimeStepLevelType>
+    void runInteraction(const TimeStepLevelType &time_step_level);
 };
 
 template <class ExecutionPolicy, template <typename...> class InteractionType,
@@ -145,6 +149,9 @@ class InteractionDynamicsCK<ExecutionPolicy, InteractionType<RelationType<Parame
 
     virtual void exec(Real dt = 0.0) override;
     virtual void runInteractionStep(Real dt = 0.0) override;
+    /** interaction of the particles active at a sub-step of multi-rate time stepping. */
+    template <class TimeStepLevelType>
+    void runInteractionStep(const TimeStepLevelType &time_step_level);
 };
 
 template <class ExecutionPolicy, template <typename...> class InteractionType,
@@ -183,6 +190,7 @@ class InteractionDynamicsCK<
       public InteractionDynamicsCK<OneLevel>,
       public BaseDynamics<void>
 {
+  protected:
     using LocalDynamicsType = InteractionType<RelationType<OneLevel, OtherParameters...>>;
     using Identifier = typename LocalDynamicsType::Identifier;
     using InitializeKernel = typename LocalDynamicsType::InitializeKernel;
@@ -201,18 +209,55 @@ class InteractionDynamicsCK<
     virtual ~InteractionDynamicsCK(){};
     virtual void exec(Real dt = 0.0) override;
 
+    template <class TimeStepLevelType>
+    void runInteractionStep(const TimeStepLevelType &time_step_level);
+
   protected:
     virtual void runInitializationStep(Real dt) override;
     virtual void runInteractionStep(Real dt = 0.0) override;
     virtual void runUpdateStep(Real dt) override;
 };
 
+/**
+ * @class InteractionWithTimeStepCK
+ * @brief One-level interaction dynamics whose update sweep also carries out
+ * the reduction of a time-step type, such as AcousticTimeStepCK.
+ * The time-step size for the next step is obtained without an extra particle loop.
+ * Valid only when the reduction depends on the updated state of the particle itself.
+ */
+template <class ExecutionPolicy, class InteractionType, class TimeStepType>
+class InteractionWithTimeStepCK : public InteractionDynamicsCK<ExecutionPolicy, InteractionType>
+{
+    using BaseDynamicsType = InteractionDynamicsCK<ExecutionPolicy, InteractionType>;
+    using Identifier = typename BaseDynamicsType::Identifier;
+    using UpdateKernel = typename BaseDynamicsType::UpdateKernel;
+    using ReduceKernel = typename TimeStepType::ReduceKernel;
+    using Operation = typename TimeStepType::OperationType;
+    using ReduceKernelImplementation = Implementation<ExecutionPolicy, TimeStepType, ReduceKernel>;
+
+  public:
+    template <typename... Args>
+    InteractionWithTimeStepCK(TimeStepType &time_step, Args &&...args);
+    virtual ~InteractionWithTimeStepCK(){};
+    /** time-step size reduced in the last update sweep */
+    Real NextTimeStep() { return next_time_step_; };
+
+  protected:
+    TimeStepType &time_step_;
+    ReduceKernelImplementation reduce_kernel_implementation_;
+    Real next_time_step_;
+
+    virtual void runUpdateStep(Real dt) override;
+};
+
 template <class ExecutionPolicy, template <typename...> class InteractionType>
 class InteractionDynamicsCK<ExecutionPolicy, InteractionType<>>
 {
   public:
     InteractionDynamicsCK(){};
     void runInteractionStep(Real dt = 0.0){};
+    template <class TimeStepLevelType>
+    void runInteractionStep(const TimeStepLevelType &time_step_level){};
 };
 
 template <class ExecutionPolicy, template <typename...> class InteractionType,
@@ -228,6 +273,8 @@ class InteractionDynamicsCK<ExecutionPolicy, InteractionType<FirstInteraction, O
     explicit InteractionDynamicsCK(
         FirstParameterSet &&first_parameter_set, OtherParameterSets &&...other_parameter_sets);
     virtual void runInteractionStep(Real dt = 0.0) override;
+    template <class TimeStepLevelType>
+    void runInteractionStep(const TimeStepLevelType &time_step_level);
 };
 } // namespace SPH
 #endif // INTERACTION_ALGORITHMS_CK_H
@@ -27,6 +27,20 @@ void InteractionDynamicsCK<ExecutionPolicy, Base, InteractionType<Inner<Paramete
 }
 //=================================================================================================//
 template <class ExecutionPolicy, template <typename...> class InteractionType, typename... Parameters>
+template <class TimeStepLevelType>
+void InteractionDynamicsCK<ExecutionPolicy, Base, InteractionType<Inner<Parameters...>>>::
+    runInteraction(const TimeStepLevelType &time_step_level)
+{
+    InteractKernel *interact_kernel = kernel_implementation_.getComputingKernel();
+    particle_for(LoopRangeCK<ExecutionPolicy, Identifier>(this->identifier_),
+                 [=](size_t i)
+                 {
+                     if (time_step_level.isActive(i))
+                         interact_kernel->interact(i, time_step_level.TimeStep(i));
+                 });
+}
+//=================================================================================================//
+template <class ExecutionPolicy, template <typename...> class InteractionType, typename... Parameters>
 template <typename... Args>
 InteractionDynamicsCK<ExecutionPolicy, Base, InteractionType<Contact<Parameters...>>>::
     InteractionDynamicsCK(Args &&...args)
@@ -56,6 +70,25 @@ void InteractionDynamicsCK<ExecutionPolicy, Base, InteractionType<Contact<Parame
     }
 }
 //=================================================================================================//
+template <class ExecutionPolicy, template <typename...> class InteractionType, typename... Parameters>
+template <class TimeStepLevelType>
+void InteractionDynamicsCK<ExecutionPolicy, Base, InteractionType<Contact<Parameters...>>>::
+    runInteraction(const TimeStepLevelType &time_step_level)
+{
+    for (size_t k = 0; k != this->contact_bodies_.size(); ++k)
+    {
+        InteractKernel *interact_kernel =
+            contact_kernel_implementation_[k]->getComputingKernel(k);
+
+        particle_for(LoopRangeCK<ExecutionPolicy, Identifier>(this->identifier_),
+                     [=](size_t i)
+                     {
+                         if (time_step_level.isActive(i))
+                             interact_kernel->interact(i, time_step_level.TimeStep(i));
+                     });
+    }
+}
+//=================================================================================================//
 template <class ExecutionPolicy, template <typename...> class InteractionType,
           template <typename...> class RelationType, typename... Parameters>
 template <typename... Args>
@@ -84,6 +117,15 @@ void InteractionDynamicsCK<ExecutionPolicy, InteractionType<RelationType<Paramet
     this->runInteraction(dt);
 }
 //=================================================================================================//
+template <class ExecutionPolicy, template <typename...> class InteractionType,
+          template <typename...> class RelationType, typename... Parameters>
+template <class TimeStepLevelType>
+void InteractionDynamicsCK<ExecutionPolicy, InteractionType<RelationType<Parameters...>>>::
+    runInteractionStep(const TimeStepLevelType &time_step_level)
+{
+    this->runInteraction(time_step_level);
+}
+//=================================================================================================//
 template <class ExecutionPolicy, template <typename...> class InteractionType,
           template <typename...> class RelationType, typename... OtherParameters>
 template <typename... Args>
@@ -153,15 +195,33 @@ void InteractionDynamicsCK<ExecutionPolicy, InteractionType<RelationType<OneLeve
     this->runInteraction(dt);
 }
 //=================================================================================================//
+template <class ExecutionPolicy, template <typename...> class InteractionType,
+          template <typename...> class RelationType, typename... OtherParameters>
+template <class TimeStepLevelType>
+void InteractionDynamicsCK<ExecutionPolicy, InteractionType<RelationType<OneLevel, OtherParameters...>>>::
+    runInteractionStep(const TimeStepLevelType &time_step_level)
+{
+    this->runInteraction(time_step_level);
+}
+//=================================================================================================//
 template <class ExecutionPolicy, template <typename...> class InteractionType,
           template <typename...> class RelationType, typename... OtherParameters>
 void InteractionDynamicsCK<ExecutionPolicy, InteractionType<RelationType<OneLevel, OtherParameters...>>>::
     runInitializationStep(Real dt)
 {
     InitializeKernel *initialize_kernel = initialize_kernel_implementation_.getComputingKernel();
-    particle_for(LoopRangeCK<ExecutionPolicy, Identifier>(this->identifier_),
-                 [=](size_t i)
-                 { initialize_kernel->initialize(i, dt); });
+    if constexpr (has_initialize_batch<InitializeKernel>::value && has_batch_loop<ExecutionPolicy, Identifier>::value)
+    {
+        particle_for_batch(LoopRangeCK<ExecutionPolicy, Identifier>(this->identifier_),
+                           [=](UnsignedInt index_begin, UnsignedInt lanes)
+                           { initialize_kernel->initializeBatch(index_begin, lanes, dt); });
+    }
+    else
+    {
+        particle_for(LoopRangeCK<ExecutionPolicy, Identifier>(this->identifier_),
+                     [=](size_t i)
+                     { initialize_kernel->initialize(i, dt); });
+    }
 }
 //=================================================================================================//
 template <class ExecutionPolicy, template <typename...> class InteractionType,
@@ -170,9 +230,62 @@ void InteractionDynamicsCK<ExecutionPolicy, InteractionType<RelationType<OneLeve
     runUpdateStep(Real dt)
 {
     UpdateKernel *update_kernel = update_kernel_implementation_.getComputingKernel();
-    particle_for(LoopRangeCK<ExecutionPolicy, Identifier>(this->identifier_),
-                 [=](size_t i)
-                 { update_kernel->update(i, dt); });
+    if constexpr (has_update_batch<UpdateKernel>::value && has_batch_loop<ExecutionPolicy, Identifier>::value)
+    {
+        particle_for_batch(LoopRangeCK<ExecutionPolicy, Identifier>(this->identifier_),
+                           [=](UnsignedInt index_begin, UnsignedInt lanes)
+                           { update_kernel->updateBatch(index_begin, lanes, dt); });
+    }
+    else
+    {
+        particle_for(LoopRangeCK<ExecutionPolicy, Identifier>(this->identifier_),
+                     [=](size_t i)
+                     { update_kernel->update(i, dt); });
+    }
+}
+//=================================================================================================//
+template <class ExecutionPolicy, class InteractionType, class TimeStepType>
+template <typename... Args>
+InteractionWithTimeStepCK<ExecutionPolicy, InteractionType, TimeStepType>::
+    InteractionWithTimeStepCK(TimeStepType &time_step, Args &&...args)
+    : InteractionDynamicsCK<ExecutionPolicy, InteractionType>(std::forward<Args>(args)...),
+      time_step_(time_step), reduce_kernel_implementation_(time_step_),
+      next_time_step_(0.0) {}
+//=================================================================================================//
+template <class ExecutionPolicy, class InteractionType, class TimeStepType>
+void InteractionWithTimeStepCK<ExecutionPolicy, InteractionType, TimeStepType>::runUpdateStep(Real dt)
+{
+    time_step_.setupDynamics(dt);
+    UpdateKernel *update_kernel = this->update_kernel_implementation_.getComputingKernel();
+    ReduceKernel *reduce_kernel = reduce_kernel_implementation_.getComputingKernel();
+    Real reduced_value = ReduceReference<Operation>::value;
+    if constexpr (has_update_batch<UpdateKernel>::value && has_batch_loop<ExecutionPolicy, Identifier>::value)
+    {
+        reduced_value = particle_reduce_batch<Operation>(
+            LoopRangeCK<ExecutionPolicy, Identifier>(this->identifier_),
+            reduced_value,
+            [=](UnsignedInt index_begin, UnsignedInt lanes)
+            {
+                update_kernel->updateBatch(index_begin, lanes, dt);
+                Operation operation;
+                Real batch_value = ReduceReference<Operation>::value;
+                for (UnsignedInt i = index_begin; i != index_begin + lanes; ++i)
+                    batch_value = operation(batch_value, reduce_kernel->reduce(i, dt));
+                return batch_value;
+            });
+    }
+    else
+    {
+        reduced_value = particle_reduce<Operation>(
+            LoopRangeCK<ExecutionPolicy, Identifier>(this->identifier_),
+            reduced_value,
+            [=](size_t i)
+            {
+                update_kernel->update(i, dt);
+                return reduce_kernel->reduce(i, dt);
+            });
+    }
+    next_time_step_ = time_step_.outputResult(reduced_value);
 }
 //=================================================================================================//
 template <class ExecutionPolicy, template <typename...> class InteractionType,
@@ -193,5 +306,15 @@ void InteractionDynamicsCK<ExecutionPolicy, InteractionType<FirstInteraction, Ot
     other_interactions_.runInteractionStep(dt);
 }
 //=================================================================================================//
+template <class ExecutionPolicy, template <typename...> class InteractionType,
+          class FirstInteraction, class... Others>
+template <class TimeStepLevelType>
+void InteractionDynamicsCK<ExecutionPolicy, InteractionType<FirstInteraction, Others...>>::
+    runInteractionStep(const TimeStepLevelType &time_step_level)
+{
+    InteractionDynamicsCK<ExecutionPolicy, InteractionType<FirstInteraction>>::runInteractionStep(time_step_level);
+    other_interactions_.runInteractionStep(time_step_level);
+}
+//=================================================================================================//
 } // namespace SPH
 #endif // INTERACTION_ALGORITHMS_CK_HPP
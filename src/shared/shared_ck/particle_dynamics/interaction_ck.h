@@ -50,7 +50,7 @@ class Interaction<Inner<Parameters...>> : public LocalDynamics
     explicit Interaction(Relation<Inner<Parameters...>> &inner_relation);
     virtual ~Interaction(){};
 
-    class InteractKernel : public NeighborList, public Neighbor<Parameters...>
+    class InteractKernel : public InnerNeighborList, public Neighbor<Parameters...>
     {
       public:
         template <class ExecutionPolicy>
@@ -67,6 +67,10 @@ class Interaction<Inner<Parameters...>> : public LocalDynamics
     DiscreteVariable<Vecd> *dv_pos_;
     DiscreteVariable<UnsignedInt> *dv_neighbor_index_;
     DiscreteVariable<UnsignedInt> *dv_particle_offset_;
+#if SPHINXSYS_USE_COMPRESSED_NEIGHBOR
+    DiscreteVariable<NeighborDelta> *dv_neighbor_delta_;
+    DiscreteVariable<UnsignedInt> *dv_overflow_offset_;
+#endif // SPHINXSYS_USE_COMPRESSED_NEIGHBOR
 };
 
 template <typename... Parameters>
@@ -109,7 +113,7 @@ class Interaction<Contact<Wall, Parameters...>> : public Interaction<Contact<Par
 
   protected:
     StdVec<DiscreteVariable<Vecd> *> dv_wall_vel_ave_, dv_wall_acc_ave_, dv_wall_n_;
-    StdVec<DiscreteVariable<Real> *> dv_wall_Vol_;
+    StdVec<DiscreteVariable<StorageReal> *> dv_wall_Vol_;
 };
 } // namespace SPH
 #endif // INTERACTION_CK_H
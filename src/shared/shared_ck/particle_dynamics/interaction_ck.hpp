@@ -14,7 +14,13 @@ Interaction<Inner<Parameters...>>::
       sph_adaptation_(sph_body_.sph_adaptation_),
       dv_pos_(particles_->getVariableByName<Vecd>("Position")),
       dv_neighbor_index_(inner_relation.getNeighborIndex()),
-      dv_particle_offset_(inner_relation.getParticleOffset()) {}
+      dv_particle_offset_(inner_relation.getParticleOffset())
+{
+#if SPHINXSYS_USE_COMPRESSED_NEIGHBOR
+    dv_neighbor_delta_ = inner_relation.getNeighborDelta();
+    dv_overflow_offset_ = inner_relation.getOverflowOffset();
+#endif // SPHINXSYS_USE_COMPRESSED_NEIGHBOR
+}
 //=================================================================================================//
 template <typename... Parameters>
 void Interaction<Inner<Parameters...>>::
@@ -34,8 +40,14 @@ template <class ExecutionPolicy>
 Interaction<Inner<Parameters...>>::InteractKernel::
     InteractKernel(const ExecutionPolicy &ex_policy,
                    Interaction<Inner<Parameters...>> &encloser)
-    : NeighborList(ex_policy, encloser.dv_neighbor_index_, encloser.dv_particle_offset_),
-      Neighbor<Parameters...>(ex_policy, encloser.sph_adaptation_, encloser.dv_pos_) {}
+#if SPHINXSYS_USE_COMPRESSED_NEIGHBOR
+    : InnerNeighborList(ex_policy, encloser.dv_neighbor_index_, encloser.dv_particle_offset_,
+                        encloser.dv_neighbor_delta_, encloser.dv_overflow_offset_),
+#else
+    : InnerNeighborList(ex_policy, encloser.dv_neighbor_index_, encloser.dv_particle_offset_),
+#endif // SPHINXSYS_USE_COMPRESSED_NEIGHBOR
+      Neighbor<Parameters...>(ex_policy, encloser.sph_adaptation_, encloser.dv_pos_,
+                              encloser.inner_relation_.getCellLinkedList().getPeriodicWrapping()) {}
 //=================================================================================================//
 template <typename... Parameters>
 Interaction<Contact<Parameters...>>::
@@ -80,7 +92,9 @@ Interaction<Contact<Parameters...>>::InteractKernel::
                    encloser.dv_contact_particle_offset_[contact_index]),
       Neighbor<Parameters...>(ex_policy, encloser.sph_adaptation_,
                               encloser.contact_adaptations_[contact_index],
-                              encloser.dv_pos_, encloser.contact_pos_[contact_index]) {}
+                              encloser.dv_pos_, encloser.contact_pos_[contact_index],
+                              encloser.contact_relation_.getContactCellLinkedList()[contact_index]
+                                  ->getPeriodicWrapping()) {}
 //=================================================================================================//
 template <typename... Parameters>
 Interaction<Contact<Wall, Parameters...>>::
@@ -93,7 +107,7 @@ Interaction<Contact<Wall, Parameters...>>::
         dv_wall_vel_ave_.push_back(solid_material.AverageVelocityVariable(this->contact_particles_[k]));
         dv_wall_acc_ave_.push_back(solid_material.AverageAccelerationVariable(this->contact_particles_[k]));
         dv_wall_n_.push_back(this->contact_particles_[k]->template getVariableByName<Vecd>("NormalDirection"));
-        dv_wall_Vol_.push_back(this->contact_particles_[k]->template getVariableByName<Real>("VolumetricMeasure"));
+        dv_wall_Vol_.push_back(this->contact_particles_[k]->template getVariableByName<StorageReal>("VolumetricMeasure"));
     }
 }
 //=================================================================================================//
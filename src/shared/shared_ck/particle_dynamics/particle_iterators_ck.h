@@ -31,6 +31,7 @@
 
 #include "implementation.h"
 #include "loop_range.h"
+#include "small_matrix_batch.h"
 
 #include <numeric>
 
@@ -62,6 +63,111 @@ void particle_for(const LoopRangeCK<ParallelPolicy, DynamicsIdentifier> &loop_ra
         ap);
 };
 
+/**
+ * Loops over batches of consecutive particles with the first index and the number of particles in a batch,
+ * for computing kernels with batched operations, see small_matrix_batch.h.
+ * Only the loop range of a whole body with host execution policies is supported.
+ */
+template <class ExecutionPolicy, class DynamicsIdentifier>
+struct has_batch_loop : std::false_type
+{
+};
+
+/** computing kernels optionally provide batched versions, see particle_for_batch */
+template <class T, class = void>
+struct has_initialize_batch : std::false_type
+{
+};
+
+template <class T>
+struct has_initialize_batch<T, std::void_t<decltype(&T::initializeBatch)>> : std::true_type
+{
+};
+
+template <class T, class = void>
+struct has_update_batch : std::false_type
+{
+};
+
+template <class T>
+struct has_update_batch<T, std::void_t<decltype(&T::updateBatch)>> : std::true_type
+{
+};
+
+template <>
+struct has_batch_loop<SequencedPolicy, SPHBody> : std::true_type
+{
+};
+
+template <>
+struct has_batch_loop<ParallelPolicy, SPHBody> : std::true_type
+{
+};
+
+template <class BatchFunc>
+void particle_for_batch(const LoopRangeCK<SequencedPolicy, SPHBody> &loop_range,
+                        const BatchFunc &batch_func)
+{
+    UnsignedInt loop_bound = loop_range.LoopBound();
+    for (UnsignedInt i = 0; i < loop_bound; i += BatchLanes)
+        batch_func(i, SMIN(BatchLanes, loop_bound - i));
+};
+
+template <class BatchFunc>
+void particle_for_batch(const LoopRangeCK<ParallelPolicy, SPHBody> &loop_range,
+                        const BatchFunc &batch_func)
+{
+    UnsignedInt loop_bound = loop_range.LoopBound();
+    parallel_for(
+        IndexRange(0, (loop_bound + BatchLanes - 1) / BatchLanes),
+        [&](const IndexRange &r)
+        {
+            for (size_t k = r.begin(); k < r.end(); ++k)
+            {
+                UnsignedInt i = k * BatchLanes;
+                batch_func(i, SMIN(BatchLanes, loop_bound - i));
+            }
+        },
+        ap);
+};
+
+/** the batch function returns the value reduced over the particles of a batch */
+template <typename Operation, class ReturnType, class BatchFunc>
+ReturnType particle_reduce_batch(const LoopRangeCK<SequencedPolicy, SPHBody> &loop_range,
+                                 ReturnType temp, const BatchFunc &batch_func)
+{
+    Operation operation;
+    UnsignedInt loop_bound = loop_range.LoopBound();
+    for (UnsignedInt i = 0; i < loop_bound; i += BatchLanes)
+    {
+        temp = operation(temp, batch_func(i, SMIN(BatchLanes, loop_bound - i)));
+    }
+    return temp;
+};
+
+template <typename Operation, class ReturnType, class BatchFunc>
+ReturnType particle_reduce_batch(const LoopRangeCK<ParallelPolicy, SPHBody> &loop_range,
+                                 ReturnType temp, const BatchFunc &batch_func)
+{
+    Operation operation;
+    UnsignedInt loop_bound = loop_range.LoopBound();
+    return parallel_reduce(
+        IndexRange(0, (loop_bound + BatchLanes - 1) / BatchLanes),
+        temp, [&](const IndexRange &r, ReturnType temp0) -> ReturnType
+        {
+            for (size_t k = r.begin(); k != r.end(); ++k)
+            {
+                UnsignedInt i = k * BatchLanes;
+                temp0 = operation(temp0, batch_func(i, SMIN(BatchLanes, loop_bound - i)));
+            }
+            return temp0;
+        },
+        [&](const ReturnType &x, const ReturnType &y) -> ReturnType
+        {
+            return operation(x, y);
+        });
+};
+
 template <typename Operation, class DynamicsIdentifier, class ReturnType, class UnaryFunc>
 ReturnType particle_reduce(const LoopRangeCK<SequencedPolicy, DynamicsIdentifier> &loop_range,
                            ReturnType temp, const UnaryFunc &unary_func)
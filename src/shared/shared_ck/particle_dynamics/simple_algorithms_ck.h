@@ -57,9 +57,18 @@ class StateDynamics : public UpdateType, public BaseDynamics<void>
         this->setUpdated(this->identifier_.getSPHBody());
         this->setupDynamics(dt);
         UpdateKernel *update_kernel = kernel_implementation_.getComputingKernel();
-        particle_for(LoopRangeCK<ExecutionPolicy, Identifier>(this->identifier_),
-                     [=](size_t i)
-                     { update_kernel->update(i, dt); });
+        if constexpr (has_update_batch<UpdateKernel>::value && has_batch_loop<ExecutionPolicy, Identifier>::value)
+        {
+            particle_for_batch(LoopRangeCK<ExecutionPolicy, Identifier>(this->identifier_),
+                               [=](UnsignedInt index_begin, UnsignedInt lanes)
+                               { update_kernel->updateBatch(index_begin, lanes, dt); });
+        }
+        else
+        {
+            particle_for(LoopRangeCK<ExecutionPolicy, Identifier>(this->identifier_),
+                         [=](size_t i)
+                         { update_kernel->update(i, dt); });
+        }
     };
 };
 
@@ -26,4 +26,5 @@
 
 #pragma once
 
+#include "elastic_dynamics_ck.hpp"
 #include "solid_constraint.hpp"
@@ -0,0 +1,315 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2023 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file 	elastic_dynamics_ck.h
+ * @brief 	Here, we define the algorithm classes for total Lagrangian elastic solid dynamics
+ *          using computing kernels.
+ * @details The inner neighbor list is built once in the initial configuration
+ *          and the pair data are computed once and saved in the order of the neighbor list,
+ *          so that the later steps only read them back. The kernel gradient of a pair
+ *          is saved packed with the neighbor volume, i.e. gradW_ij * Vol_j, and also
+ *          with the correction matrix, i.e. B_i^T * gradW_ij * Vol_j, so that a pair
+ *          loads a single vector instead of the kernel gradient, direction, volume and correction matrix.
+ *          The stress is computed by the constitutive kernel of the given material type.
+ * @author	Xiangyu Hu
+ */
+
+#ifndef ELASTIC_DYNAMICS_CK_H
+#define ELASTIC_DYNAMICS_CK_H
+
+#include "base_particle_dynamics.h"
+#include "elastic_solid.h"
+#include "interaction_ck.hpp"
+#include "particle_iterators_ck.h"
+
+namespace SPH
+{
+namespace solid_dynamics
+{
+/** whether the constitutive kernel gives the stress for a batch of particles */
+template <class T, class = void>
+struct has_batched_stress : std::false_type
+{
+};
+
+template <class T>
+struct has_batched_stress<T, std::void_t<decltype(std::declval<const T &>().StressPK1(
+                                 std::declval<const MatrixBatch<Dimensions> &>()))>> : std::true_type
+{
+};
+
+/**
+ * @class ReferenceConfigurationCK
+ * @brief Computing the linear gradient correction matrix and the pair data
+ * in the reference (initial) configuration. It should be executed once after
+ * the cell linked list and the inner relation are updated for the initial particle positions.
+ */
+template <class ExecutionPolicy>
+class ReferenceConfigurationCK : public Interaction<Inner<>>, public BaseDynamics<void>
+{
+  public:
+    explicit ReferenceConfigurationCK(Relation<Inner<>> &inner_relation, Real alpha = Real(0));
+    virtual ~ReferenceConfigurationCK(){};
+    virtual void exec(Real dt = 0.0) override;
+
+  protected:
+    class ComputingKernel : public Interaction<Inner<>>::InteractKernel
+    {
+      public:
+        template <class EncloserType>
+        ComputingKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser);
+        void update(UnsignedInt index_i);
+
+      protected:
+        Real alpha_, inv_W0_;
+        StorageReal *Vol_;
+        Matd *B_;
+        Vecd *gradient_, *corrected_gradient_;
+        Real *damping_weight_, *strain_rate_weight_;
+    };
+    typedef ReferenceConfigurationCK<ExecutionPolicy> LocalDynamicsType;
+    using KernelImplementation = Implementation<ExecutionPolicy, LocalDynamicsType, ComputingKernel>;
+
+    ExecutionPolicy ex_policy_;
+    Real alpha_;
+    DiscreteVariable<StorageReal> *dv_Vol_;
+    DiscreteVariable<Matd> *dv_B_;
+    DiscreteVariable<Vecd> *dv_reference_gradient_, *dv_corrected_gradient_;
+    DiscreteVariable<Real> *dv_reference_damping_weight_, *dv_reference_strain_rate_weight_;
+    KernelImplementation kernel_implementation_;
+};
+
+/**
+ * @class ElasticIntegration
+ * @brief Base class of the integration steps, which use the pair data
+ * given by ReferenceConfigurationCK, which should be defined before.
+ */
+template <class BaseInteractionType>
+class ElasticIntegration : public BaseInteractionType
+{
+  public:
+    template <class DynamicsIdentifier>
+    explicit ElasticIntegration(DynamicsIdentifier &identifier);
+    virtual ~ElasticIntegration(){};
+
+  protected:
+    ElasticSolid &elastic_solid_;
+    Real rho0_;
+    DiscreteVariable<StorageReal> *dv_Vol_, *dv_rho_;
+    DiscreteVariable<Real> *dv_mass_;
+    DiscreteVariable<Vecd> *dv_vel_, *dv_force_, *dv_force_prior_;
+    DiscreteVariable<Matd> *dv_B_, *dv_F_, *dv_dF_dt_;
+    /** pair data in the reference configuration, indexed as the neighbor list */
+    DiscreteVariable<Vecd> *dv_reference_gradient_, *dv_corrected_gradient_;
+    DiscreteVariable<Real> *dv_reference_damping_weight_, *dv_reference_strain_rate_weight_;
+};
+
+template <typename...>
+class Integration1stHalfCK;
+
+template <class ElasticSolidType, typename... Parameters>
+class Integration1stHalfCK<Inner<OneLevel, ElasticSolidType, Parameters...>>
+    : public ElasticIntegration<Interaction<Inner<Parameters...>>>
+{
+    using ConstituteKernel = typename ElasticSolidType::ConstituteKernel;
+    using BaseInteraction = ElasticIntegration<Interaction<Inner<Parameters...>>>;
+
+  public:
+    explicit Integration1stHalfCK(Relation<Inner<Parameters...>> &inner_relation);
+    virtual ~Integration1stHalfCK(){};
+
+    class InitializeKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        InitializeKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser);
+        void initialize(size_t index_i, Real dt = 0.0);
+        void initializeBatch(UnsignedInt index_begin, UnsignedInt lanes, Real dt = 0.0);
+
+      protected:
+        ConstituteKernel constitute_;
+        Real rho0_;
+        StorageReal *rho_;
+        Vecd *pos_, *vel_;
+        Matd *B_, *F_, *dF_dt_, *stress_PK1_B_;
+    };
+
+    class InteractKernel : public BaseInteraction::InteractKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        InteractKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser);
+        void interact(size_t index_i, Real dt = 0.0);
+
+      protected:
+        ConstituteKernel constitute_;
+        Real inv_rho0_, numerical_dissipation_factor_, smoothing_length_;
+        Real *mass_;
+        Vecd *pos_, *vel_, *force_;
+        Matd *F_, *stress_PK1_B_;
+        Vecd *reference_gradient_;
+        Real *reference_damping_weight_, *reference_strain_rate_weight_;
+    };
+
+    class UpdateKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        UpdateKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser);
+        void update(size_t index_i, Real dt = 0.0);
+
+      protected:
+        Real *mass_;
+        Vecd *vel_, *force_, *force_prior_;
+    };
+
+  protected:
+    ElasticSolidType &material_;
+    DiscreteVariable<Matd> *dv_stress_PK1_B_;
+    Real numerical_dissipation_factor_;
+    Real smoothing_length_;
+};
+
+template <typename...>
+class Integration2ndHalfCK;
+
+template <typename... Parameters>
+class Integration2ndHalfCK<Inner<OneLevel, Parameters...>>
+    : public ElasticIntegration<Interaction<Inner<Parameters...>>>
+{
+    using BaseInteraction = ElasticIntegration<Interaction<Inner<Parameters...>>>;
+
+  public:
+    explicit Integration2ndHalfCK(Relation<Inner<Parameters...>> &inner_relation);
+    virtual ~Integration2ndHalfCK(){};
+
+    class InitializeKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        InitializeKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser);
+        void initialize(size_t index_i, Real dt = 0.0);
+
+      protected:
+        Vecd *pos_, *vel_;
+    };
+
+    class InteractKernel : public BaseInteraction::InteractKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        InteractKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser);
+        void interact(size_t index_i, Real dt = 0.0);
+
+      protected:
+        Vecd *vel_;
+        Matd *dF_dt_;
+        Vecd *corrected_gradient_;
+    };
+
+    class UpdateKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        UpdateKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser);
+        void update(size_t index_i, Real dt = 0.0);
+
+      protected:
+        Matd *F_, *dF_dt_;
+    };
+};
+
+template <typename...>
+class DeformationGradientBySummationCK;
+/**
+ * @class DeformationGradientBySummationCK
+ * @brief Computing deformation gradient tensor by summation with the corrected pair gradient.
+ */
+template <typename... Parameters>
+class DeformationGradientBySummationCK<Inner<Parameters...>>
+    : public Interaction<Inner<Parameters...>>
+{
+    using BaseInteraction = Interaction<Inner<Parameters...>>;
+
+  public:
+    explicit DeformationGradientBySummationCK(Relation<Inner<Parameters...>> &inner_relation);
+    virtual ~DeformationGradientBySummationCK(){};
+
+    class InteractKernel : public BaseInteraction::InteractKernel
+    {
+      public:
+        template <class ExecutionPolicy, class EncloserType>
+        InteractKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser);
+        void interact(size_t index_i, Real dt = 0.0);
+
+      protected:
+        Vecd *pos_;
+        Matd *F_;
+        Vecd *corrected_gradient_;
+    };
+
+  protected:
+    DiscreteVariable<Matd> *dv_F_;
+    DiscreteVariable<Vecd> *dv_corrected_gradient_;
+};
+
+template <class ElasticSolidType>
+using Integration1stHalfPK2CK = Integration1stHalfCK<Inner<OneLevel, ElasticSolidType>>;
+
+/**
+ * @class AcousticTimeStepCK
+ * @brief Computing the acoustic time step size of elastic solid.
+ */
+class AcousticTimeStepCK : public LocalDynamicsReduce<ReduceMin>
+{
+  public:
+    explicit AcousticTimeStepCK(SPHBody &sph_body, Real CFL = 0.6);
+    virtual ~AcousticTimeStepCK(){};
+
+    class ReduceKernel
+    {
+      public:
+        template <class ExecutionPolicy>
+        ReduceKernel(const ExecutionPolicy &ex_policy, AcousticTimeStepCK &encloser);
+
+        Real reduce(size_t index_i, Real dt = 0.0)
+        {
+            Real acceleration_norm = ((force_[index_i] + force_prior_[index_i]) / mass_[index_i]).norm();
+            return CFL_ * SMIN((Real)sqrt(h_min_ / (acceleration_norm + TinyReal)),
+                               h_min_ / (c0_ + vel_[index_i].norm()));
+        };
+
+      protected:
+        Real CFL_, h_min_, c0_;
+        Real *mass_;
+        Vecd *vel_, *force_, *force_prior_;
+    };
+
+  protected:
+    Real CFL_, h_min_, c0_;
+    DiscreteVariable<Real> *dv_mass_;
+    DiscreteVariable<Vecd> *dv_vel_, *dv_force_, *dv_force_prior_;
+};
+} // namespace solid_dynamics
+} // namespace SPH
+#endif // ELASTIC_DYNAMICS_CK_H
@@ -0,0 +1,335 @@
+#ifndef ELASTIC_DYNAMICS_CK_HPP
+#define ELASTIC_DYNAMICS_CK_HPP
+
+#include "elastic_dynamics_ck.h"
+
+namespace SPH
+{
+namespace solid_dynamics
+{
+//=================================================================================================//
+template <class ExecutionPolicy>
+ReferenceConfigurationCK<ExecutionPolicy>::
+    ReferenceConfigurationCK(Relation<Inner<>> &inner_relation, Real alpha)
+    : Interaction<Inner<>>(inner_relation), BaseDynamics<void>(),
+      ex_policy_(ExecutionPolicy{}), alpha_(alpha),
+      dv_Vol_(particles_->getVariableByName<StorageReal>("VolumetricMeasure")),
+      dv_B_(particles_->registerStateVariableOnly<Matd>(
+          "LinearGradientCorrectionMatrix", IdentityMatrix<Matd>::value)),
+      dv_reference_gradient_(particles_->registerDiscreteVariableOnly<Vecd>(
+          "ReferencePairGradient", inner_relation.getParticleOffsetListSize())),
+      dv_corrected_gradient_(particles_->registerDiscreteVariableOnly<Vecd>(
+          "CorrectedPairGradient", inner_relation.getParticleOffsetListSize())),
+      dv_reference_damping_weight_(particles_->registerDiscreteVariableOnly<Real>(
+          "ReferenceDampingWeight", inner_relation.getParticleOffsetListSize())),
+      dv_reference_strain_rate_weight_(particles_->registerDiscreteVariableOnly<Real>(
+          "ReferenceStrainRateWeight", inner_relation.getParticleOffsetListSize())),
+      kernel_implementation_(*this)
+{
+    this->registerComputingKernel(&kernel_implementation_);
+}
+//=================================================================================================//
+template <class ExecutionPolicy>
+template <class EncloserType>
+ReferenceConfigurationCK<ExecutionPolicy>::ComputingKernel::
+    ComputingKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+    : Interaction<Inner<>>::InteractKernel(ex_policy, encloser),
+      alpha_(encloser.alpha_), inv_W0_(1.0 / this->kernel_.W(ZeroData<Vecd>::value)),
+      Vol_(encloser.dv_Vol_->DelegatedData(ex_policy)),
+      B_(encloser.dv_B_->DelegatedData(ex_policy)),
+      gradient_(encloser.dv_reference_gradient_->DelegatedData(ex_policy)),
+      corrected_gradient_(encloser.dv_corrected_gradient_->DelegatedData(ex_policy)),
+      damping_weight_(encloser.dv_reference_damping_weight_->DelegatedData(ex_policy)),
+      strain_rate_weight_(encloser.dv_reference_strain_rate_weight_->DelegatedData(ex_policy)) {}
+//=================================================================================================//
+template <class ExecutionPolicy>
+void ReferenceConfigurationCK<ExecutionPolicy>::ComputingKernel::update(UnsignedInt index_i)
+{
+    Matd local_configuration = Matd::Zero();
+    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); ++n)
+    {
+        UnsignedInt index_j = this->NeighborIndex(index_i, n);
+        Vecd r_ij = this->vec_r_ij(index_i, index_j);
+        Vecd gradW_ijV_j = this->dW_ij(index_i, index_j) * Vol_[index_j] * this->e_ij(index_i, index_j);
+        Real dim_r_ij_1 = Dimensions / r_ij.norm();
+        gradient_[n] = gradW_ijV_j;
+        damping_weight_[n] = this->W_ij(index_i, index_j) * inv_W0_;
+        strain_rate_weight_[n] = dim_r_ij_1 * dim_r_ij_1;
+        local_configuration -= r_ij * gradW_ijV_j.transpose();
+    }
+
+    Real det_sqr = SMAX(alpha_ - local_configuration.determinant(), Real(0));
+    Matd B_T = local_configuration.transpose(); // for Tikhonov regularization
+    Matd inverse = (B_T * local_configuration + SqrtEps * Matd::Identity()).inverse() * B_T;
+    Real weight1 = local_configuration.determinant() / (local_configuration.determinant() + det_sqr);
+    Real weight2 = det_sqr / (local_configuration.determinant() + det_sqr);
+    B_[index_i] = weight1 * inverse + weight2 * Matd::Identity();
+
+    /** so that sum of (a_ij * gradW_ijV_j^T) * B_i is given by sum of a_ij * corrected_gradient^T */
+    Matd B_T_i = B_[index_i].transpose();
+    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); ++n)
+    {
+        corrected_gradient_[n] = B_T_i * gradient_[n];
+    }
+}
+//=================================================================================================//
+template <class ExecutionPolicy>
+void ReferenceConfigurationCK<ExecutionPolicy>::exec(Real dt)
+{
+#if SPHINXSYS_USE_COMPRESSED_NEIGHBOR
+    UnsignedInt pair_list_size = this->dv_neighbor_delta_->getDataSize();
+#else
+    UnsignedInt pair_list_size = this->dv_neighbor_index_->getDataSize();
+#endif // SPHINXSYS_USE_COMPRESSED_NEIGHBOR
+    if (pair_list_size > dv_reference_gradient_->getDataSize())
+    {
+        dv_reference_gradient_->reallocateData(ex_policy_, pair_list_size);
+        dv_corrected_gradient_->reallocateData(ex_policy_, pair_list_size);
+        dv_reference_damping_weight_->reallocateData(ex_policy_, pair_list_size);
+        dv_reference_strain_rate_weight_->reallocateData(ex_policy_, pair_list_size);
+        this->inner_relation_.resetComputingKernelUpdated();
+    }
+
+    UnsignedInt total_real_particles = this->particles_->TotalRealParticles();
+    ComputingKernel *computing_kernel = kernel_implementation_.getComputingKernel();
+    particle_for(ex_policy_,
+                 IndexRange(0, total_real_particles),
+                 [=](size_t i)
+                 { computing_kernel->update(i); });
+}
+//=================================================================================================//
+template <class BaseInteractionType>
+template <class DynamicsIdentifier>
+ElasticIntegration<BaseInteractionType>::ElasticIntegration(DynamicsIdentifier &identifier)
+    : BaseInteractionType(identifier),
+      elastic_solid_(DynamicCast<ElasticSolid>(this, this->sph_body_.getBaseMaterial())),
+      rho0_(elastic_solid_.ReferenceDensity()),
+      dv_Vol_(this->particles_->template getVariableByName<StorageReal>("VolumetricMeasure")),
+      dv_rho_(this->particles_->template getVariableByName<StorageReal>("Density")),
+      dv_mass_(this->particles_->template getVariableByName<Real>("Mass")),
+      dv_vel_(this->particles_->template registerStateVariableOnly<Vecd>("Velocity")),
+      dv_force_(this->particles_->template registerStateVariableOnly<Vecd>("Force")),
+      dv_force_prior_(this->particles_->template registerStateVariableOnly<Vecd>("ForcePrior")),
+      dv_B_(this->particles_->template getVariableByName<Matd>("LinearGradientCorrectionMatrix")),
+      dv_F_(this->particles_->template registerStateVariableOnly<Matd>(
+          "DeformationGradient", IdentityMatrix<Matd>::value)),
+      dv_dF_dt_(this->particles_->template registerStateVariableOnly<Matd>("DeformationRate")),
+      dv_reference_gradient_(this->particles_->template getVariableByName<Vecd>("ReferencePairGradient")),
+      dv_corrected_gradient_(this->particles_->template getVariableByName<Vecd>("CorrectedPairGradient")),
+      dv_reference_damping_weight_(this->particles_->template getVariableByName<Real>("ReferenceDampingWeight")),
+      dv_reference_strain_rate_weight_(this->particles_->template getVariableByName<Real>("ReferenceStrainRateWeight")) {}
+//=================================================================================================//
+template <class ElasticSolidType, typename... Parameters>
+Integration1stHalfCK<Inner<OneLevel, ElasticSolidType, Parameters...>>::
+    Integration1stHalfCK(Relation<Inner<Parameters...>> &inner_relation)
+    : BaseInteraction(inner_relation),
+      material_(ExactCast<ElasticSolidType>(this, this->elastic_solid_)),
+      dv_stress_PK1_B_(this->particles_->template registerStateVariableOnly<Matd>("StressPK1OnParticle")),
+      numerical_dissipation_factor_(0.25),
+      smoothing_length_(this->sph_body_.sph_adaptation_->ReferenceSmoothingLength()) {}
+//=================================================================================================//
+template <class ElasticSolidType, typename... Parameters>
+template <class ExecutionPolicy, class EncloserType>
+Integration1stHalfCK<Inner<OneLevel, ElasticSolidType, Parameters...>>::
+    InitializeKernel::InitializeKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+    : constitute_(encloser.material_), rho0_(encloser.rho0_),
+      rho_(encloser.dv_rho_->DelegatedData(ex_policy)),
+      pos_(encloser.dv_pos_->DelegatedData(ex_policy)),
+      vel_(encloser.dv_vel_->DelegatedData(ex_policy)),
+      B_(encloser.dv_B_->DelegatedData(ex_policy)),
+      F_(encloser.dv_F_->DelegatedData(ex_policy)),
+      dF_dt_(encloser.dv_dF_dt_->DelegatedData(ex_policy)),
+      stress_PK1_B_(encloser.dv_stress_PK1_B_->DelegatedData(ex_policy)) {}
+//=================================================================================================//
+template <class ElasticSolidType, typename... Parameters>
+void Integration1stHalfCK<Inner<OneLevel, ElasticSolidType, Parameters...>>::
+    InitializeKernel::initialize(size_t index_i, Real dt)
+{
+    pos_[index_i] += vel_[index_i] * dt * 0.5;
+    F_[index_i] += dF_dt_[index_i] * dt * 0.5;
+    rho_[index_i] = rho0_ / F_[index_i].determinant();
+    stress_PK1_B_[index_i] = constitute_.StressPK1(F_[index_i], index_i) * B_[index_i].transpose();
+}
+//=================================================================================================//
+template <class ElasticSolidType, typename... Parameters>
+void Integration1stHalfCK<Inner<OneLevel, ElasticSolidType, Parameters...>>::
+    InitializeKernel::initializeBatch(UnsignedInt index_begin, UnsignedInt lanes, Real dt)
+{
+    for (UnsignedInt index_i = index_begin; index_i != index_begin + lanes; ++index_i)
+        pos_[index_i] += vel_[index_i] * dt * 0.5;
+
+    MatrixBatch<Dimensions> F, dF_dt, B;
+    F.load(F_, index_begin, lanes);
+    dF_dt.load(dF_dt_, index_begin, lanes);
+    B.load(B_, index_begin, lanes);
+    F += dF_dt * (dt * 0.5);
+    F.store(F_, index_begin, lanes);
+    RealBatch J = F.determinant();
+    for (UnsignedInt l = 0; l != lanes; ++l)
+        rho_[index_begin + l] = rho0_ / J[l];
+
+    MatrixBatch<Dimensions> stress_PK1 = MatrixBatch<Dimensions>::Zero();
+    if constexpr (has_batched_stress<ConstituteKernel>::value)
+    {
+        stress_PK1 = constitute_.StressPK1(F);
+    }
+    else
+    {
+        for (UnsignedInt l = 0; l != lanes; ++l)
+            stress_PK1.setLane(l, constitute_.StressPK1(F.lane(l), index_begin + l));
+    }
+    (stress_PK1 * B.transpose()).store(stress_PK1_B_, index_begin, lanes);
+}
+//=================================================================================================//
+template <class ElasticSolidType, typename... Parameters>
+template <class ExecutionPolicy, class EncloserType>
+Integration1stHalfCK<Inner<OneLevel, ElasticSolidType, Parameters...>>::
+    InteractKernel::InteractKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+    : BaseInteraction::InteractKernel(ex_policy, encloser),
+      constitute_(encloser.material_), inv_rho0_(1.0 / encloser.rho0_),
+      numerical_dissipation_factor_(encloser.numerical_dissipation_factor_),
+      smoothing_length_(encloser.smoothing_length_),
+      mass_(encloser.dv_mass_->DelegatedData(ex_policy)),
+      pos_(encloser.dv_pos_->DelegatedData(ex_policy)),
+      vel_(encloser.dv_vel_->DelegatedData(ex_policy)),
+      force_(encloser.dv_force_->DelegatedData(ex_policy)),
+      F_(encloser.dv_F_->DelegatedData(ex_policy)),
+      stress_PK1_B_(encloser.dv_stress_PK1_B_->DelegatedData(ex_policy)),
+      reference_gradient_(encloser.dv_reference_gradient_->DelegatedData(ex_policy)),
+      reference_damping_weight_(encloser.dv_reference_damping_weight_->DelegatedData(ex_policy)),
+      reference_strain_rate_weight_(encloser.dv_reference_strain_rate_weight_->DelegatedData(ex_policy)) {}
+//=================================================================================================//
+template <class ElasticSolidType, typename... Parameters>
+void Integration1stHalfCK<Inner<OneLevel, ElasticSolidType, Parameters...>>::
+    InteractKernel::interact(size_t index_i, Real dt)
+{
+    Vecd force = Vecd::Zero();
+    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); ++n)
+    {
+        UnsignedInt index_j = this->NeighborIndex(index_i, n);
+        Vecd pos_jump = pos_[index_i] - pos_[index_j];
+        Vecd vel_jump = vel_[index_i] - vel_[index_j];
+        Real strain_rate = reference_strain_rate_weight_[n] * pos_jump.dot(vel_jump);
+        Matd numerical_stress_ij =
+            0.5 * (F_[index_i] + F_[index_j]) * constitute_.PairNumericalDamping(strain_rate, smoothing_length_);
+        force += (stress_PK1_B_[index_i] + stress_PK1_B_[index_j] +
+                  numerical_dissipation_factor_ * reference_damping_weight_[n] * numerical_stress_ij) *
+                 reference_gradient_[n];
+    }
+    force_[index_i] = mass_[index_i] * inv_rho0_ * force;
+}
+//=================================================================================================//
+template <class ElasticSolidType, typename... Parameters>
+template <class ExecutionPolicy, class EncloserType>
+Integration1stHalfCK<Inner<OneLevel, ElasticSolidType, Parameters...>>::
+    UpdateKernel::UpdateKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+    : mass_(encloser.dv_mass_->DelegatedData(ex_policy)),
+      vel_(encloser.dv_vel_->DelegatedData(ex_policy)),
+      force_(encloser.dv_force_->DelegatedData(ex_policy)),
+      force_prior_(encloser.dv_force_prior_->DelegatedData(ex_policy)) {}
+//=================================================================================================//
+template <class ElasticSolidType, typename... Parameters>
+void Integration1stHalfCK<Inner<OneLevel, ElasticSolidType, Parameters...>>::
+    UpdateKernel::update(size_t index_i, Real dt)
+{
+    vel_[index_i] += (force_prior_[index_i] + force_[index_i]) / mass_[index_i] * dt;
+}
+//=================================================================================================//
+template <typename... Parameters>
+Integration2ndHalfCK<Inner<OneLevel, Parameters...>>::
+    Integration2ndHalfCK(Relation<Inner<Parameters...>> &inner_relation)
+    : BaseInteraction(inner_relation) {}
+//=================================================================================================//
+template <typename... Parameters>
+template <class ExecutionPolicy, class EncloserType>
+Integration2ndHalfCK<Inner<OneLevel, Parameters...>>::
+    InitializeKernel::InitializeKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+    : pos_(encloser.dv_pos_->DelegatedData(ex_policy)),
+      vel_(encloser.dv_vel_->DelegatedData(ex_policy)) {}
+//=================================================================================================//
+template <typename... Parameters>
+void Integration2ndHalfCK<Inner<OneLevel, Parameters...>>::
+    InitializeKernel::initialize(size_t index_i, Real dt)
+{
+    pos_[index_i] += vel_[index_i] * dt * 0.5;
+}
+//=================================================================================================//
+template <typename... Parameters>
+template <class ExecutionPolicy, class EncloserType>
+Integration2ndHalfCK<Inner<OneLevel, Parameters...>>::
+    InteractKernel::InteractKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+    : BaseInteraction::InteractKernel(ex_policy, encloser),
+      vel_(encloser.dv_vel_->DelegatedData(ex_policy)),
+      dF_dt_(encloser.dv_dF_dt_->DelegatedData(ex_policy)),
+      corrected_gradient_(encloser.dv_corrected_gradient_->DelegatedData(ex_policy)) {}
+//=================================================================================================//
+template <typename... Parameters>
+void Integration2ndHalfCK<Inner<OneLevel, Parameters...>>::
+    InteractKernel::interact(size_t index_i, Real dt)
+{
+    Matd deformation_gradient_change_rate = Matd::Zero();
+    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); ++n)
+    {
+        UnsignedInt index_j = this->NeighborIndex(index_i, n);
+        deformation_gradient_change_rate -=
+            (vel_[index_i] - vel_[index_j]) * corrected_gradient_[n].transpose();
+    }
+    dF_dt_[index_i] = deformation_gradient_change_rate;
+}
+//=================================================================================================//
+template <typename... Parameters>
+template <class ExecutionPolicy, class EncloserType>
+Integration2ndHalfCK<Inner<OneLevel, Parameters...>>::
+    UpdateKernel::UpdateKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+    : F_(encloser.dv_F_->DelegatedData(ex_policy)),
+      dF_dt_(encloser.dv_dF_dt_->DelegatedData(ex_policy)) {}
+//=================================================================================================//
+template <typename... Parameters>
+void Integration2ndHalfCK<Inner<OneLevel, Parameters...>>::
+    UpdateKernel::update(size_t index_i, Real dt)
+{
+    F_[index_i] += dF_dt_[index_i] * dt * 0.5;
+}
+//=================================================================================================//
+template <typename... Parameters>
+DeformationGradientBySummationCK<Inner<Parameters...>>::
+    DeformationGradientBySummationCK(Relation<Inner<Parameters...>> &inner_relation)
+    : BaseInteraction(inner_relation),
+      dv_F_(this->particles_->template registerStateVariableOnly<Matd>(
+          "DeformationGradient", IdentityMatrix<Matd>::value)),
+      dv_corrected_gradient_(this->particles_->template getVariableByName<Vecd>("CorrectedPairGradient")) {}
+//=================================================================================================//
+template <typename... Parameters>
+template <class ExecutionPolicy, class EncloserType>
+DeformationGradientBySummationCK<Inner<Parameters...>>::
+    InteractKernel::InteractKernel(const ExecutionPolicy &ex_policy, EncloserType &encloser)
+    : BaseInteraction::InteractKernel(ex_policy, encloser),
+      pos_(encloser.dv_pos_->DelegatedData(ex_policy)),
+      F_(encloser.dv_F_->DelegatedData(ex_policy)),
+      corrected_gradient_(encloser.dv_corrected_gradient_->DelegatedData(ex_policy)) {}
+//=================================================================================================//
+template <typename... Parameters>
+void DeformationGradientBySummationCK<Inner<Parameters...>>::
+    InteractKernel::interact(size_t index_i, Real dt)
+{
+    Matd deformation = Matd::Zero();
+    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); ++n)
+    {
+        UnsignedInt index_j = this->NeighborIndex(index_i, n);
+        deformation -= (pos_[index_i] - pos_[index_j]) * corrected_gradient_[n].transpose();
+    }
+    F_[index_i] = deformation;
+}
+//=================================================================================================//
+template <class ExecutionPolicy>
+AcousticTimeStepCK::ReduceKernel::ReduceKernel(
+    const ExecutionPolicy &ex_policy, AcousticTimeStepCK &encloser)
+    : CFL_(encloser.CFL_), h_min_(encloser.h_min_), c0_(encloser.c0_),
+      mass_(encloser.dv_mass_->DelegatedData(ex_policy)),
+      vel_(encloser.dv_vel_->DelegatedData(ex_policy)),
+      force_(encloser.dv_force_->DelegatedData(ex_policy)),
+      force_prior_(encloser.dv_force_prior_->DelegatedData(ex_policy)) {}
+//=================================================================================================//
+} // namespace solid_dynamics
+} // namespace SPH
+#endif // ELASTIC_DYNAMICS_CK_HPP
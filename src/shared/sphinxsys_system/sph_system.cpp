@@ -12,7 +12,8 @@ SPHSystem::SPHSystem(BoundingBox system_domain_bounds, Real resolution_ref, size
       resolution_ref_(resolution_ref),
       tbb_global_control_(tbb::global_control::max_allowed_parallelism, number_of_threads),
       io_environment_(nullptr), run_particle_relaxation_(false), reload_particles_(false),
-      restart_step_(0), generate_regression_data_(false), state_recording_(true)
+      restart_step_(0), end_step_(0), memory_report_(false),
+      generate_regression_data_(false), state_recording_(true)
 {
     registerSystemVariable<Real>("PhysicalTime", 0.0);
 }
@@ -28,7 +29,12 @@ IOEnvironment &SPHSystem::getIOEnvironment()
     return *io_environment_;
 }
 //=================================================================================================//
-
+ProcessCommunicator &SPHSystem::getProcessCommunicator()
+{
+    static ProcessCommunicator process_communicator;
+    return process_communicator;
+}
+//=================================================================================================//
 void SPHSystem::initializeSystemCellLinkedLists()
 {
     for (auto &body : real_bodies_)
@@ -46,6 +52,42 @@ void SPHSystem::initializeSystemConfigurations()
             body->body_relations_[i]->updateConfiguration();
         }
     }
+
+    if (memory_report_)
+    {
+        printMemoryFootprint();
+    }
+}
+//=================================================================================================//
+void SPHSystem::reportMemoryFootprint(MemoryRegistry &registry)
+{
+    for (auto &body : sph_bodies_)
+    {
+        body->reportMemoryFootprint(registry);
+    }
+}
+//=================================================================================================//
+void SPHSystem::printMemoryFootprint()
+{
+    MemoryRegistry registry;
+    reportMemoryFootprint(registry);
+    registry.printTable();
+}
+//=================================================================================================//
+void SPHSystem::setNumberOfThreads(size_t number_of_threads)
+{
+    thread_limit_keeper_.createPtr<tbb::global_control>(
+        tbb::global_control::max_allowed_parallelism, number_of_threads);
+}
+//=================================================================================================//
+size_t SPHSystem::TotalRealParticles()
+{
+    size_t total_real_particles = 0;
+    for (auto &body : real_bodies_)
+    {
+        total_real_particles += body->getBaseParticles().TotalRealParticles();
+    }
+    return total_real_particles;
 }
 //=================================================================================================//
 Real SPHSystem::getSmallestTimeStepAmongSolidBodies(Real CFL)
@@ -74,6 +116,10 @@ SPHSystem *SPHSystem::handleCommandlineOptions(int ac, char *av[])
         desc.add_options()("regression", po::value<bool>(), "Regression test.");
         desc.add_options()("state_recording", po::value<bool>(), "State recording in output folder.");
         desc.add_options()("restart_step", po::value<int>(), "Run form a restart file.");
+        desc.add_options()("end_step", po::value<int>(), "Stop the simulation at the given step.");
+        desc.add_options()("number_of_threads", po::value<int>(), "Number of threads used.");
+        desc.add_options()("resolution_multiplier", po::value<Real>(), "Refine the reference resolution.");
+        desc.add_options()("memory_report", po::value<bool>(), "Print the memory footprint after initialization.");
 
         po::variables_map vm;
         po::store(po::parse_command_line(ac, av, desc), vm);
@@ -144,6 +190,34 @@ SPHSystem *SPHSystem::handleCommandlineOptions(int ac, char *av[])
             std::cout << "Restart inactivated, i.e. restart_step ("
                       << restart_step_ << ").\n";
         }
+
+        if (vm.count("end_step"))
+        {
+            end_step_ = vm["end_step"].as<int>();
+            std::cout << "End step was set to "
+                      << vm["end_step"].as<int>() << ".\n";
+        }
+
+        if (vm.count("number_of_threads"))
+        {
+            setNumberOfThreads(vm["number_of_threads"].as<int>());
+            std::cout << "Number of threads was set to "
+                      << vm["number_of_threads"].as<int>() << ".\n";
+        }
+
+        if (vm.count("resolution_multiplier"))
+        {
+            setResolutionMultiplier(vm["resolution_multiplier"].as<Real>());
+            std::cout << "Reference resolution was refined by "
+                      << vm["resolution_multiplier"].as<Real>() << ".\n";
+        }
+
+        if (vm.count("memory_report"))
+        {
+            memory_report_ = vm["memory_report"].as<bool>();
+            std::cout << "Memory report was set to "
+                      << vm["memory_report"].as<bool>() << ".\n";
+        }
     }
     catch (std::exception &e)
     {
@@ -40,6 +40,8 @@ namespace po = boost::program_options;
 #include "base_data_package.h"
 #include "execution_policy.h"
 #include "io_environment.h"
+#include "memory_registry.h"
+#include "process_communicator.h"
 #include "sphinxsys_containers.h"
 
 #include <filesystem>
@@ -62,6 +64,7 @@ class SPHSystem
     UniquePtrKeeper<IOEnvironment> io_ptr_keeper_;
     DataContainerUniquePtrAssemble<SingularVariable> all_system_variable_ptrs_;
     UniquePtrsKeeper<Entity> unique_system_variable_ptrs_;
+    UniquePtrKeeper<tbb::global_control> thread_limit_keeper_;
 
   public:
     BoundingBox system_domain_bounds_;       /**< Lower and Upper domain bounds. */
@@ -80,6 +83,8 @@ class SPHSystem
 #endif
     SPHSystem *setIOEnvironment(bool delete_output = true);
     IOEnvironment &getIOEnvironment();
+    /** The communicator is one per process and shared by all SPH systems. */
+    ProcessCommunicator &getProcessCommunicator();
     void setRunParticleRelaxation(bool run_particle_relaxation) { run_particle_relaxation_ = run_particle_relaxation; };
     bool RunParticleRelaxation() { return run_particle_relaxation_; };
     void setReloadParticles(bool reload_particles) { reload_particles_ = reload_particles; };
@@ -90,10 +95,27 @@ class SPHSystem
     void setStateRecording(bool state_recording) { state_recording_ = state_recording; };
     void setRestartStep(size_t restart_step) { restart_step_ = restart_step; };
     size_t RestartStep() { return restart_step_; };
+    /** Limit the number of threads below the one given at construction. */
+    void setNumberOfThreads(size_t number_of_threads);
+    /** Refine the reference resolution, only effective for the bodies created afterwards. */
+    void setResolutionMultiplier(Real resolution_multiplier) { resolution_ref_ /= resolution_multiplier; };
+    /** The simulation stops at the end step if it is set, e.g. for measuring performance. */
+    void setEndStep(size_t end_step) { end_step_ = end_step; };
+    size_t EndStep() { return end_step_; };
+    bool isEndStepReached(size_t step) { return end_step_ != 0 && step >= end_step_; };
+    /** The memory footprint is printed after initializing the system configurations if set. */
+    void setMemoryReport(bool memory_report) { memory_report_ = memory_report; };
+    bool MemoryReport() { return memory_report_; };
+    /** Total number of real particles in all real bodies. */
+    size_t TotalRealParticles();
     /** Initialize cell linked list for the SPH system. */
     void initializeSystemCellLinkedLists();
     /** Initialize particle configuration for the SPH system. */
     void initializeSystemConfigurations();
+    /** Report the memory footprint of all bodies. */
+    void reportMemoryFootprint(MemoryRegistry &registry);
+    /** Print the memory footprint of all bodies as tables, can be called on demand. */
+    void printMemoryFootprint();
     /** get the min time step from all bodies. */
     Real getSmallestTimeStepAmongSolidBodies(Real CFL = 0.6);
     Real ReferenceResolution() { return resolution_ref_; };
@@ -116,6 +138,8 @@ class SPHSystem
     bool run_particle_relaxation_;  /**< run particle relaxation for body fitted particle distribution */
     bool reload_particles_;         /**< start the simulation with relaxed particles. */
     size_t restart_step_;           /**< restart step */
+    size_t end_step_;               /**< end step, no limit if zero */
+    bool memory_report_;            /**< print the memory footprint after initialization. */
     bool generate_regression_data_; /**< run and generate or enhance the regression test data set. */
     bool state_recording_;          /**< Record state in output folder. */
     SingularVariables all_system_variables_;
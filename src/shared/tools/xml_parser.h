@@ -233,7 +233,7 @@ class XmlParser
     /** resize of Xml doc */
     inline void resize(const size_t input_size, const std::string name);
 
-    /** resize of an element */
+    /** resize of an element, the last child elements are deleted when decreasing the size */
     inline void resize(tinyxml2::XMLElement *element, const size_t input_size, const std::string name);
 
     //----------------------------------------------------------------------
@@ -375,9 +375,8 @@ inline void XmlParser::resize(tinyxml2::XMLElement *element, const size_t input_
     }
     else
     {
-        std::cout << "\n Error: XML Parser allows increase date size only!" << std::endl;
-        std::cout << __FILE__ << ':' << __LINE__ << std::endl;
-        exit(1);
+        for (size_t i = input_size; i != total_elements; ++i)
+            element->DeleteChild(element->LastChildElement());
     }
 }
 } // namespace SPH
@@ -113,19 +113,21 @@ int main(int ac, char *av[])
 
     InteractionDynamicsCK<MyExecutionPolicy, continuum_dynamics::PlasticAcousticStep1stHalfWithWallRiemannCK>
          soil_acoustic_step_1st_half(soil_block_inner, soil_block_contact);
-    InteractionDynamicsCK<MyExecutionPolicy, continuum_dynamics::PlasticAcousticStep2ndHalfWithWallRiemannCK>
-        soil_acoustic_step_2nd_half(soil_block_inner, soil_block_contact);
     InteractionDynamicsCK<MyExecutionPolicy, fluid_dynamics::DensityRegularizationComplexFreeSurface>
         soil_density_regularization(soil_block_inner, soil_block_contact);
 
     ReduceDynamicsCK<MyExecutionPolicy, fluid_dynamics::AcousticTimeStepCK> soil_acoustic_time_step(soil_block,0.4);
+    /** the acoustic time step for the next sub-step is reduced within the update sweep of the 2nd half. */
+    InteractionWithTimeStepCK<MyExecutionPolicy, continuum_dynamics::PlasticAcousticStep2ndHalfWithWallRiemannCK,
+                              fluid_dynamics::AcousticTimeStepCK>
+        soil_acoustic_step_2nd_half(soil_acoustic_time_step, soil_block_inner, soil_block_contact);
     //----------------------------------------------------------------------
     //	Define the methods for I/O operations, observations
     //	and regression tests of the simulation.
     //----------------------------------------------------------------------
     BodyStatesRecordingToVtp body_states_recording(sph_system);
     body_states_recording.addToWrite<Vecd>(wall_boundary, "NormalDirection");
-    body_states_recording.addToWrite<Real>(soil_block, "Density");
+    body_states_recording.addToWrite<StorageReal>(soil_block, "Density");
     RestartIO restart_io(sph_system);
     //----------------------------------------------------------------------
     //	Prepare the simulation with cell linked list, configuration
@@ -160,6 +162,7 @@ int main(int ac, char *av[])
     TimeInterval interval_computing_time_step;
     TimeInterval interval_acoustic_steps;
     TimeInterval interval_updating_configuration;
+    TimeInterval interval_sorting;
     TickCount time_instance;
     //----------------------------------------------------------------------
     //	First output before the main loop.
@@ -168,13 +171,14 @@ int main(int ac, char *av[])
     //----------------------------------------------------------------------
     //	Main loop starts here.
     //----------------------------------------------------------------------
-    while (sv_physical_time->getValue()  < End_Time)
+    while (sv_physical_time->getValue()  < End_Time && !sph_system.isEndStepReached(number_of_iterations))
     {
         Real integration_time = 0.0;
         /** Integrate time (loop) until the next output time. */
-        while (integration_time < output_interval)
+        while (integration_time < output_interval && !sph_system.isEndStepReached(number_of_iterations))
         {
             /** outer loop for dual-time criteria time-stepping. */
+            time_instance = TickCount::now();
             soil_density_regularization.exec();
             soil_advection_step_setup.exec();
             interval_computing_time_step += TickCount::now() - time_instance;
@@ -182,11 +186,13 @@ int main(int ac, char *av[])
             time_instance = TickCount::now();
             Real relaxation_time = 0.0;
             Real acoustic_dt = 0.0;
+            Real next_acoustic_dt = soil_acoustic_time_step.exec();
             while (relaxation_time < Dt)
             {
-                acoustic_dt = soil_acoustic_time_step.exec();
+                acoustic_dt = next_acoustic_dt;
                 soil_acoustic_step_1st_half.exec(acoustic_dt);
                 soil_acoustic_step_2nd_half.exec(acoustic_dt);
+                next_acoustic_dt = soil_acoustic_step_2nd_half.NextTimeStep();
                 relaxation_time += acoustic_dt;
                 integration_time += acoustic_dt;
                 sv_physical_time->incrementValue(acoustic_dt);
@@ -208,17 +214,23 @@ int main(int ac, char *av[])
             time_instance = TickCount::now();
             
             soil_advection_step_close.exec();
+            interval_updating_configuration += TickCount::now() - time_instance;
+
+            time_instance = TickCount::now();
             if (number_of_iterations % 100 == 0 && number_of_iterations != 1)
             {
                 particle_sort.exec();
             }
+            interval_sorting += TickCount::now() - time_instance;
+
+            time_instance = TickCount::now();
             soil_cell_linked_list.exec();
             soil_block_update_complex_relation.exec();
             interval_updating_configuration += TickCount::now() - time_instance;
         }
 
-        body_states_recording.writeToFile(MyExecutionPolicy{});
         TickCount t2 = TickCount::now();
+        body_states_recording.writeToFile(MyExecutionPolicy{});
         TickCount t3 = TickCount::now();
         interval += t3 - t2;
     }
@@ -230,8 +242,16 @@ int main(int ac, char *av[])
               << " seconds." << std::endl;
     std::cout << std::fixed << std::setprecision(9) << "interval_computing_time_step ="
               << interval_computing_time_step.seconds() << "\n";
+    std::cout << std::fixed << std::setprecision(9) << "interval_acoustic_steps = "
+              << interval_acoustic_steps.seconds() << "\n";
     std::cout << std::fixed << std::setprecision(9) << "interval_updating_configuration = "
               << interval_updating_configuration.seconds() << "\n";
+    std::cout << std::fixed << std::setprecision(9) << "interval_sorting = "
+              << interval_sorting.seconds() << "\n";
+    std::cout << std::fixed << std::setprecision(9) << "interval_writting_body_state = "
+              << interval.seconds() << "\n";
+    std::cout << "number_of_iterations = " << number_of_iterations << "\n";
+    std::cout << "total_real_particles = " << sph_system.TotalRealParticles() << "\n";
 
     return 0;
 };
@@ -122,7 +122,7 @@ int main(int ac, char *av[])
     //----------------------------------------------------------------------
     BodyStatesRecordingToVtp body_states_recording(sph_system);
     body_states_recording.addToWrite<Vecd>(wall_boundary, "NormalDirection");
-    body_states_recording.addToWrite<Real>(water_block, "Density");
+    body_states_recording.addToWrite<StorageReal>(water_block, "Density");
     RestartIO restart_io(sph_system);
 
     RegressionTestDynamicTimeWarping<ReducedQuantityRecording<MainExecutionPolicy, TotalMechanicalEnergyCK>>
@@ -166,6 +166,7 @@ int main(int ac, char *av[])
     TimeInterval interval_computing_time_step;
     TimeInterval interval_acoustic_steps;
     TimeInterval interval_updating_configuration;
+    TimeInterval interval_sorting;
     TickCount time_instance;
     //----------------------------------------------------------------------
     //	First output before the main loop.
@@ -176,11 +177,11 @@ int main(int ac, char *av[])
     //----------------------------------------------------------------------
     //	Main loop starts here.
     //----------------------------------------------------------------------
-    while (sv_physical_time->getValue() < end_time)
+    while (sv_physical_time->getValue() < end_time && !sph_system.isEndStepReached(number_of_iterations))
     {
         Real integration_time = 0.0;
         /** Integrate time (loop) until the next output time. */
-        while (integration_time < output_interval)
+        while (integration_time < output_interval && !sph_system.isEndStepReached(number_of_iterations))
         {
             /** outer loop for dual-time criteria time-stepping. */
             time_instance = TickCount::now();
@@ -230,6 +231,9 @@ int main(int ac, char *av[])
             {
                 particle_sort.exec();
             }
+            interval_sorting += TickCount::now() - time_instance;
+
+            time_instance = TickCount::now();
             water_cell_linked_list.exec();
             water_block_update_complex_relation.exec();
             fluid_observer_contact_relation.exec();
@@ -254,6 +258,12 @@ int main(int ac, char *av[])
               << interval_acoustic_steps.seconds() << "\n";
     std::cout << std::fixed << std::setprecision(9) << "interval_updating_configuration = "
               << interval_updating_configuration.seconds() << "\n";
+    std::cout << std::fixed << std::setprecision(9) << "interval_sorting = "
+              << interval_sorting.seconds() << "\n";
+    std::cout << std::fixed << std::setprecision(9) << "interval_writting_body_state = "
+              << interval_writting_body_state.seconds() << "\n";
+    std::cout << "number_of_iterations = " << number_of_iterations << "\n";
+    std::cout << "total_real_particles = " << sph_system.TotalRealParticles() << "\n";
     //----------------------------------------------------------------------
     // Post-run regression test to ensure that the case is validated
     //----------------------------------------------------------------------
@@ -262,7 +272,7 @@ int main(int ac, char *av[])
         record_water_mechanical_energy.generateDataBase(1.0e-3);
         fluid_observer_pressure.generateDataBase(1.0e-3);
     }
-    else if (sph_system.RestartStep() == 0)
+    else if (sph_system.RestartStep() == 0 && sph_system.EndStep() == 0)
     {
         record_water_mechanical_energy.testResult();
         fluid_observer_pressure.testResult();
@@ -294,6 +294,11 @@ int main(int ac, char *av[])
     /** statistics for computing time. */
     TickCount t1 = TickCount::now();
     TimeInterval interval;
+    TimeInterval interval_computing_time_step;
+    TimeInterval interval_acoustic_steps;
+    TimeInterval interval_updating_configuration;
+    TimeInterval interval_sorting;
+    TickCount time_instance;
     //----------------------------------------------------------------------
     //	First output before the main loop.
     //----------------------------------------------------------------------
@@ -303,18 +308,20 @@ int main(int ac, char *av[])
     //----------------------------------------------------------------------
     //	Main loop of time stepping starts here.
     //----------------------------------------------------------------------
-    while (sv_physical_time->getValue() < end_time)
+    while (sv_physical_time->getValue() < end_time && !sph_system.isEndStepReached(number_of_iterations))
     {
         Real integral_time = 0.0;
-        while (integral_time < output_interval)
+        while (integral_time < output_interval && !sph_system.isEndStepReached(number_of_iterations))
         {
-
+            time_instance = TickCount::now();
             fluid_density_regularization.exec();
             water_advection_step_setup.exec();
             Real advection_dt = fluid_advection_time_step.exec();
             fluid_viscous_force.exec();
             viscous_force_on_structure.exec();
+            interval_computing_time_step += TickCount::now() - time_instance;
 
+            time_instance = TickCount::now();
             Real relaxation_time = 0.0;
             Real acoustic_dt = 0.0;
             while (relaxation_time < advection_dt)
@@ -339,6 +346,7 @@ int main(int ac, char *av[])
                     sv_physical_time->incrementValue(acoustic_dt);
             }
             water_advection_step_close.exec();
+            interval_acoustic_steps += TickCount::now() - time_instance;
 
             if (number_of_iterations % screen_output_interval == 0)
             {
@@ -351,14 +359,19 @@ int main(int ac, char *av[])
             //----------------------------------------------------------------------
             //	particle sort, cell linked list, body relation updating.
             //----------------------------------------------------------------------
+            time_instance = TickCount::now();
             if (number_of_iterations % 100 == 0 && number_of_iterations != 1)
             {
                 particle_sort.exec();
             }
+            interval_sorting += TickCount::now() - time_instance;
+
+            time_instance = TickCount::now();
             water_cell_linked_list.exec();
             structure_cell_linked_list.exec();
             water_block_update_complex_relation.exec();
             structure_update_contact_relation.exec();
+            interval_updating_configuration += TickCount::now() - time_instance;
 
             if (total_time >= relax_time)
             {
@@ -379,13 +392,25 @@ int main(int ac, char *av[])
     TimeInterval tt;
     tt = t4 - t1 - interval;
     std::cout << "Total wall time for computation: " << tt.seconds() << " seconds." << std::endl;
+    std::cout << std::fixed << std::setprecision(9) << "interval_computing_time_step = "
+              << interval_computing_time_step.seconds() << "\n";
+    std::cout << std::fixed << std::setprecision(9) << "interval_acoustic_steps = "
+              << interval_acoustic_steps.seconds() << "\n";
+    std::cout << std::fixed << std::setprecision(9) << "interval_updating_configuration = "
+              << interval_updating_configuration.seconds() << "\n";
+    std::cout << std::fixed << std::setprecision(9) << "interval_sorting = "
+              << interval_sorting.seconds() << "\n";
+    std::cout << std::fixed << std::setprecision(9) << "interval_writting_body_state = "
+              << interval.seconds() << "\n";
+    std::cout << "number_of_iterations = " << number_of_iterations << "\n";
+    std::cout << "total_real_particles = " << sph_system.TotalRealParticles() << "\n";
 
     if (sph_system.GenerateRegressionData())
     {
         write_structure_position.generateDataBase(0.001);
         //            wave_gauge.generateDataBase(0.001);
     }
-    else
+    else if (sph_system.EndStep() == 0)
     {
         write_structure_position.testResult();
         //            wave_gauge.testResult();
@@ -116,7 +116,7 @@ int main(int ac, char *av[])
     //----------------------------------------------------------------------
     BodyStatesRecordingToPlt body_states_recording(sph_system);
     body_states_recording.addToWrite<Real>(wave_body, "TotalEnergy");
-    body_states_recording.addToWrite<Real>(wave_body, "Density");
+    body_states_recording.addToWrite<StorageReal>(wave_body, "Density");
     RegressionTestEnsembleAverage<ReducedQuantityRecording<MaximumSpeed>>
         write_maximum_speed(wave_body);
     //----------------------------------------------------------------------
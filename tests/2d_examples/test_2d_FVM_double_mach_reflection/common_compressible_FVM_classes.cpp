@@ -6,7 +6,7 @@ namespace SPH
 CompressibleAcousticTimeStepSizeInFVM::
     CompressibleAcousticTimeStepSizeInFVM(SPHBody &sph_body, Real min_distance_between_nodes, Real acousticCFL)
     : AcousticTimeStep(sph_body),
-      rho_(particles_->getVariableDataByName<Real>("Density")),
+      rho_(particles_->getVariableDataByName<StorageReal>("Density")),
       p_(particles_->getVariableDataByName<Real>("Pressure")),
       vel_(particles_->getVariableDataByName<Vecd>("Velocity")),
       min_distance_between_nodes_(min_distance_between_nodes),
@@ -18,7 +18,8 @@ namespace SPH
 class CompressibleAcousticTimeStepSizeInFVM : public fluid_dynamics::AcousticTimeStep
 {
   protected:
-    Real *rho_, *p_;
+    StorageReal *rho_;
+    Real *p_;
     Vecd *vel_;
     Real min_distance_between_nodes_;
 
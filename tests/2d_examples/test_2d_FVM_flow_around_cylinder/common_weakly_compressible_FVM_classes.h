@@ -42,7 +42,8 @@ namespace fluid_dynamics
 class WCAcousticTimeStepSizeInFVM : public fluid_dynamics::AcousticTimeStep
 {
   protected:
-    Real *rho_, *p_;
+    StorageReal *rho_;
+    Real *p_;
     Vecd *vel_;
     Fluid &fluid_;
     Real min_distance_between_nodes_;
@@ -67,7 +68,7 @@ class BaseForceFromFluidInFVM : public LocalDynamics, public DataDelegateInner
     Vecd *getForceFromFluid() { return force_from_fluid_; };
 
   protected:
-    Real *Vol_;
+    StorageReal *Vol_;
     Vecd *force_from_fluid_;
 };
 
@@ -106,7 +107,7 @@ class PressureForceFromFluidInFVM : public BaseForceFromFluidInFVM
           fluid_(DynamicCast<WeaklyCompressibleFluid>(this, particles_->getBaseMaterial())),
           vel_(particles_->getVariableDataByName<Vecd>("Velocity")),
           p_(particles_->getVariableDataByName<Real>("Pressure")),
-          rho_(particles_->getVariableDataByName<Real>("Density")),
+          rho_(particles_->getVariableDataByName<StorageReal>("Density")),
           riemann_solver_(fluid_, fluid_),
           each_boundary_type_contact_real_index_(each_boundary_type_contact_real_index)
     {
@@ -114,7 +115,8 @@ class PressureForceFromFluidInFVM : public BaseForceFromFluidInFVM
     };
     Fluid &fluid_;
     Vecd *vel_;
-    Real *p_, *rho_;
+    Real *p_;
+    StorageReal *rho_;
     RiemannSolverType riemann_solver_;
     StdVec<StdVec<size_t>> each_boundary_type_contact_real_index_;
     virtual ~PressureForceFromFluidInFVM(){};
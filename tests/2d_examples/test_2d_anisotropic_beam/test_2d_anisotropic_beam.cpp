@@ -135,7 +135,7 @@ class AnisotropicCorrectConfiguration : public LocalDynamics, public DataDelegat
     AnisotropicCorrectConfiguration(BaseInnerRelation &inner_relation, int beta = 0, Real alpha = Real(0))
         : LocalDynamics(inner_relation.getSPHBody()),
           DataDelegateInner(inner_relation),
-          beta_(beta), alpha_(alpha), Vol_(particles_->getVariableDataByName<Real>("VolumetricMeasure")),
+          beta_(beta), alpha_(alpha), Vol_(particles_->getVariableDataByName<StorageReal>("VolumetricMeasure")),
           B_(particles_->registerStateVariable<Matd>("LinearGradientCorrectionMatrix", IdentityMatrix<Matd>::value)),
           pos_(particles_->getVariableDataByName<Vecd>("Position")),
           show_neighbor_(particles_->registerStateVariable<Real>("ShowingNeighbor", Real(0.0))){};
@@ -145,7 +145,7 @@ class AnisotropicCorrectConfiguration : public LocalDynamics, public DataDelegat
   protected:
     int beta_;
     Real alpha_;
-    Real *Vol_;
+    StorageReal *Vol_;
     Matd *B_;
     Vecd *pos_;
     Real *show_neighbor_;
@@ -161,7 +161,7 @@ int main(int ac, char *av[])
     BodyStatesRecordingToVtp write_real_body_states(sph_system);
     write_real_body_states.addToWrite<Real>(water_block, "Pressure");
     write_real_body_states.addToWrite<int>(water_block, "Indicator");
-    write_real_body_states.addToWrite<Real>(water_block, "VolumetricMeasure");
+    write_real_body_states.addToWrite<StorageReal>(water_block, "VolumetricMeasure");
     write_real_body_states.addToWrite<Real>(water_block, "SmoothingLengthRatio");
     ObservedQuantityRecording<Vecd> write_fluid_velocity("Velocity", fluid_observer_contact);
     RegressionTestTimeAverage<ReducedQuantityRecording<QuantitySummation<Vecd>>> write_total_viscous_force_from_fluid(cylinder, "ViscousForceFromFluid");
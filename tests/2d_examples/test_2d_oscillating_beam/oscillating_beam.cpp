@@ -131,7 +131,8 @@ int main(int ac, char *av[])
     //-----------------------------------------------------------------------------
     InteractionWithUpdate<LinearGradientCorrectionMatrixInner> beam_corrected_configuration(beam_body_inner);
 
-    Dynamics1Level<solid_dynamics::Integration1stHalfPK2> stress_relaxation_first_half(beam_body_inner);
+    Dynamics1Level<solid_dynamics::ConstitutiveIntegration1stHalfPK2<SaintVenantKirchhoffSolid>>
+        stress_relaxation_first_half(beam_body_inner);
     Dynamics1Level<solid_dynamics::Integration2ndHalf> stress_relaxation_second_half(beam_body_inner);
 
     SimpleDynamics<BeamInitialCondition> beam_initial_velocity(beam_body);
@@ -144,7 +144,7 @@ int main(int ac, char *av[])
     // outputs
     //-----------------------------------------------------------------------------
     BodyStatesRecordingToVtp write_beam_states(beam_body);
-    write_beam_states.addToWrite<Real>(beam_body, "Density");
+    write_beam_states.addToWrite<StorageReal>(beam_body, "Density");
     write_beam_states.addToWrite<Real>(beam_body, "Pressure");
     SimpleDynamics<continuum_dynamics::VonMisesStress> beam_von_mises_stress(beam_body);
     write_beam_states.addToWrite<Real>(beam_body, "VonMisesStress");
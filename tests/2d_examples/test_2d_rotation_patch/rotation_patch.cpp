@@ -61,7 +61,7 @@ class InitialVelocity
         : fluid_dynamics::FluidInitialCondition(sph_body),
           fluid_particles_(dynamic_cast<BaseParticles *>(&sph_body.getBaseParticles())),
           p_(fluid_particles_->getVariableDataByName<Real>("Pressure")),
-          rho_(fluid_particles_->getVariableDataByName<Real>("Density")){};
+          rho_(fluid_particles_->getVariableDataByName<StorageReal>("Density")){};
 
     void update(size_t index_i, Real dt)
     {
@@ -88,7 +88,8 @@ class InitialVelocity
 
   protected:
     BaseParticles *fluid_particles_;
-    Real *p_, *rho_;
+    Real *p_;
+    StorageReal *rho_;
 };
 //----------------------------------------------------------------------
 //	wave gauge
@@ -162,7 +163,7 @@ int main(int ac, char *av[])
     //	and regression tests of the simulation.
     //----------------------------------------------------------------------
     BodyStatesRecordingToVtp body_states_recording(sph_system);
-    body_states_recording.addToWrite<Real>(water_block, "DensitySummation");
+    body_states_recording.addToWrite<StorageReal>(water_block, "DensitySummation");
     body_states_recording.addToWrite<int>(water_block, "Indicator");
     body_states_recording.addToWrite<Matd>(water_block, "LinearGradientCorrectionMatrix");
     RestartIO restart_io(sph_system);
@@ -155,11 +155,11 @@ int main(int ac, char *av[])
     //	and regression tests of the simulation.
     //----------------------------------------------------------------------
     BodyStatesRecordingToVtp body_states_recording(sph_system);
-    body_states_recording.addToWrite<Real>(water_block, "Density");
+    body_states_recording.addToWrite<StorageReal>(water_block, "Density");
     body_states_recording.addToWrite<Real>(water_block, "Pressure");
     body_states_recording.addToWrite<Matd>(water_block, "SurfaceTensionStress");
     body_states_recording.addToWrite<Vecd>(air_block, "ForcePrior");
-    body_states_recording.addToWrite<Real>(air_block, "Density");
+    body_states_recording.addToWrite<StorageReal>(air_block, "Density");
     body_states_recording.addToWrite<Real>(air_block, "Pressure");
     RegressionTestDynamicTimeWarping<ReducedQuantityRecording<TotalKineticEnergy>> write_water_kinetic_energy(water_block);
     //----------------------------------------------------------------------
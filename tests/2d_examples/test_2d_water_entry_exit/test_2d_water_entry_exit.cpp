@@ -354,7 +354,7 @@ int main(int ac, char *av[])
     //----------------------------------------------------------------------
     BodyStatesRecordingToVtp body_states_recording(sph_system);
     body_states_recording.addToWrite<Real>(water_block, "Pressure");          // output for debug
-    body_states_recording.addToWrite<Real>(water_block, "Density");           // output for debug
+    body_states_recording.addToWrite<StorageReal>(water_block, "Density");           // output for debug
     body_states_recording.addToWrite<int>(water_block, "Indicator");          // output for debug
     body_states_recording.addToWrite<Vecd>(wall_boundary, "NormalDirection"); // output for debug
     RestartIO restart_io(sph_system);
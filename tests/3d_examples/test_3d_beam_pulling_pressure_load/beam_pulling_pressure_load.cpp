@@ -47,7 +47,7 @@ class PullingForce : public solid_dynamics::BaseLoadingForce<BodyPartByParticle>
     PullingForce(BodyPartByParticle &body_part, StdVec<std::array<Real, 2>> f_arr)
         : solid_dynamics::BaseLoadingForce<BodyPartByParticle>(body_part, "PullingForce"),
           mass_n_(particles_->getVariableDataByName<Real>("Mass")),
-          Vol_(particles_->getVariableDataByName<Real>("VolumetricMeasure")),
+          Vol_(particles_->getVariableDataByName<StorageReal>("VolumetricMeasure")),
           F_(particles_->getVariableDataByName<Matd>("DeformationGradient")),
           force_arr_(f_arr),
           particles_num_(body_part.body_part_particles_.size())
@@ -79,7 +79,7 @@ class PullingForce : public solid_dynamics::BaseLoadingForce<BodyPartByParticle>
   protected:
     Real *mass_n_;
     StdLargeVec<Real> area_0_;
-    Real *Vol_;
+    StorageReal *Vol_;
     Matd *F_;
 
     StdVec<std::array<Real, 2>> force_arr_;
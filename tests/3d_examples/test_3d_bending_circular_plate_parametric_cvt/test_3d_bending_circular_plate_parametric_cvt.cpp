@@ -311,7 +311,7 @@ return_data bending_circular_plate(Real dp_ratio)
         EXPECT_GT(min_rij, dp / 2);
 
         // test volume
-        Real *Vol_ = shell_particles->VolumetricMeasures();
+        StorageReal *Vol_ = shell_particles->VolumetricMeasures();
         Real *mass_ = shell_particles->getVariableDataByName<Real>("Mass");
         Real total_volume = std::accumulate(Vol_, Vol_ + shell_particles->TotalRealParticles(), 0.0);
         std::cout << "total_volume: " << total_volume << std::endl;
@@ -10,7 +10,7 @@
  *			Pressure pa = g * (mm)^(-1) * (ms)^(-2)
  *			diffusion d = (mm)^(2) * (ms)^(-2)
  */
-#include "sphinxsys.h" // SPHinXsys Library.
+#include "sphinxsys_ck.h" // SPHinXsys Library.
 using namespace SPH;   // Namespace cite here.
 /** Geometry parameter. */
 /** Set the file path to the stl file. */
@@ -376,8 +376,8 @@ int main(int ac, char *av[])
     electro_physiology::ElectroPhysiologyDiffusionInnerRK2<LocalDirectionalDiffusion>
         diffusion_relaxation(physiology_heart_inner, mono_field_electro_physiology->AllDiffusions());
     // Solvers for ODE system.
-    electro_physiology::ElectroPhysiologyReactionRelaxationForward reaction_relaxation_forward(physiology_heart, aliev_panfilow_model);
-    electro_physiology::ElectroPhysiologyReactionRelaxationBackward reaction_relaxation_backward(physiology_heart, aliev_panfilow_model);
+    StateDynamics<execution::ParallelPolicy, ReactionRelaxationForwardCK<AlievPanfilowModel>> reaction_relaxation_forward(physiology_heart, aliev_panfilow_model);
+    StateDynamics<execution::ParallelPolicy, ReactionRelaxationBackwardCK<AlievPanfilowModel>> reaction_relaxation_backward(physiology_heart, aliev_panfilow_model);
     //	Apply the Iron stimulus.
     SimpleDynamics<ApplyStimulusCurrentSI> apply_stimulus_s1(physiology_heart);
     SimpleDynamics<ApplyStimulusCurrentSII> apply_stimulus_s2(physiology_heart);
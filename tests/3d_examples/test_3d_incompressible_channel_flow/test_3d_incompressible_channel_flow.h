@@ -55,12 +55,13 @@ class InvCFInitialCondition
   public:
     explicit InvCFInitialCondition(SPHBody &sph_body)
         : FluidInitialCondition(sph_body),
-          rho_(particles_->registerStateVariable<Real>("Density")),
+          rho_(particles_->registerStateVariable<StorageReal>("Density")),
           p_(particles_->registerStateVariable<Real>("Pressure")),
           vel_(particles_->registerStateVariable<Vecd>("Velocity")){};
 
   protected:
-    Real *rho_, *p_;
+    StorageReal *rho_;
+    Real *p_;
     void update(size_t index_i, Real dt)
     {
         rho_[index_i] = rho0_f;
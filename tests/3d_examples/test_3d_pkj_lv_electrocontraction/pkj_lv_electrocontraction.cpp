@@ -11,7 +11,7 @@
  *			diffusion d = (mm)^(2) * (ms)^(-2)
  */
 #include "pkj_lv_electrocontraction.h"
-#include "sphinxsys.h"
+#include "sphinxsys_ck.h"
 /** Namespace cite here. */
 using namespace SPH;
 /**
@@ -166,15 +166,15 @@ int main(int ac, char *av[])
         ConstructorArgs(physiology_heart_inner, myocardium_physiology->AllDiffusions()),
         ConstructorArgs(physiology_heart_contact_with_pkj_leaves, myocardium_physiology->AllDiffusions()));
     /** Solvers for ODE system */
-    electro_physiology::ElectroPhysiologyReactionRelaxationForward myocardium_reaction_relaxation_forward(physiology_heart, aliev_panfilow_model);
-    electro_physiology::ElectroPhysiologyReactionRelaxationBackward myocardium_reaction_relaxation_backward(physiology_heart, aliev_panfilow_model);
+    StateDynamics<execution::ParallelPolicy, ReactionRelaxationForwardCK<AlievPanfilowModel>> myocardium_reaction_relaxation_forward(physiology_heart, aliev_panfilow_model);
+    StateDynamics<execution::ParallelPolicy, ReactionRelaxationBackwardCK<AlievPanfilowModel>> myocardium_reaction_relaxation_backward(physiology_heart, aliev_panfilow_model);
     /** Physiology for PKJ*/
     /** Time step size calculation. */
     GetDiffusionTimeStepSize get_pkj_physiology_time_step(pkj_body, *pkj_physiology);
     electro_physiology::ElectroPhysiologyDiffusionNetworkRK2 pkj_diffusion_relaxation(pkj_inner, pkj_physiology->AllDiffusions());
     /** Solvers for ODE system */
-    electro_physiology::ElectroPhysiologyReactionRelaxationForward pkj_reaction_relaxation_forward(pkj_body, aliev_panfilow_model);
-    electro_physiology::ElectroPhysiologyReactionRelaxationBackward pkj_reaction_relaxation_backward(pkj_body, aliev_panfilow_model);
+    StateDynamics<execution::ParallelPolicy, ReactionRelaxationForwardCK<AlievPanfilowModel>> pkj_reaction_relaxation_forward(pkj_body, aliev_panfilow_model);
+    StateDynamics<execution::ParallelPolicy, ReactionRelaxationBackwardCK<AlievPanfilowModel>> pkj_reaction_relaxation_backward(pkj_body, aliev_panfilow_model);
     /**Apply the ion stimulus.*/
     SimpleDynamics<ApplyStimulusCurrentToMyocardium> apply_stimulus_myocardium(physiology_heart);
     SimpleDynamics<ApplyStimulusCurrentToPKJ> apply_stimulus_pkj(pkj_body);
@@ -169,7 +169,7 @@ int main(int ac, char *av[])
     //	and regression tests of the simulation.
     //----------------------------------------------------------------------
     BodyStatesRecordingToVtp body_states_recording(sph_system);
-    body_states_recording.addToWrite<Real>(soil_block, "Density");
+    body_states_recording.addToWrite<StorageReal>(soil_block, "Density");
     body_states_recording.addToWrite<Real>(soil_block, "Pressure");
     SimpleDynamics<continuum_dynamics::VerticalStress> vertical_stress(soil_block);
     body_states_recording.addToWrite<Real>(soil_block, "VerticalStress");
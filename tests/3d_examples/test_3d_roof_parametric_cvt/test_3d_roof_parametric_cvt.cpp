@@ -443,7 +443,7 @@ return_data roof_under_self_weight(Real dp, bool cvt = true, int particle_number
     EXPECT_GT(min_rij, dp / 2);
 
     // test volume
-    Real *Vol_ = shell_particles->VolumetricMeasures();
+    StorageReal *Vol_ = shell_particles->VolumetricMeasures();
     Real *mass_ = shell_particles->getVariableDataByName<Real>("Mass");
     Real total_volume = std::accumulate(Vol_, Vol_ + shell_particles->TotalRealParticles(), 0.0);
     std::cout << "total_volume: " << total_volume << std::endl;
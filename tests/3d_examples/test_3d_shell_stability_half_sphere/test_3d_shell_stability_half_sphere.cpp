@@ -214,7 +214,7 @@ void sphere_compression(int dp_ratio, Real pressure, Real gravity_z)
         }
 
         // test volume
-        Real *Vol_ = shell_particles->getVariableDataByName<Real>("VolumetricMeasure");
+        StorageReal *Vol_ = shell_particles->getVariableDataByName<StorageReal>("VolumetricMeasure");
         Real *mass_ = shell_particles->getVariableDataByName<Real>("Mass");
         Real total_volume = std::accumulate(Vol_, Vol_ + shell_particles->TotalRealParticles(), 0.0);
         std::cout << "total_volume: " << total_volume << std::endl;
@@ -88,7 +88,7 @@ int main(int ac, char *av[])
     /**define simple data file input and outputs functions. */
     BodyStatesRecordingToVtp write_states(system);
     write_states.addToWrite<Real>(column, "Pressure");
-    write_states.addToWrite<Real>(column, "Density");
+    write_states.addToWrite<StorageReal>(column, "Density");
     SimpleDynamics<continuum_dynamics::VonMisesStress> column_von_mises_stress(column);
     write_states.addToWrite<Real>(column, "VonMisesStress");
     RegressionTestDynamicTimeWarping<ObservedQuantityRecording<Vecd>> write_displacement("Position", my_observer_contact);
@@ -74,7 +74,7 @@ class DynamicContactForceWithWall : public LocalDynamics,
         : LocalDynamics(solid_body_contact_relation.getSPHBody()),
           DataDelegateContact(solid_body_contact_relation),
           continuum_(DynamicCast<GeneralContinuum>(this, sph_body_.getBaseMaterial())),
-          Vol_(particles_->getVariableDataByName<Real>("VolumetricMeasure")),
+          Vol_(particles_->getVariableDataByName<StorageReal>("VolumetricMeasure")),
           vel_(particles_->getVariableDataByName<Vecd>("Velocity")),
           force_prior_(particles_->getVariableDataByName<Vecd>("ForcePrior")),
           penalty_strength_(penalty_strength)
@@ -83,7 +83,7 @@ class DynamicContactForceWithWall : public LocalDynamics,
         reference_pressure_ = continuum_.ReferenceDensity() * continuum_.ContactStiffness();
         for (size_t k = 0; k != contact_particles_.size(); ++k)
         {
-            contact_Vol_.push_back(contact_particles_[k]->getVariableDataByName<Real>("VolumetricMeasure"));
+            contact_Vol_.push_back(contact_particles_[k]->getVariableDataByName<StorageReal>("VolumetricMeasure"));
             contact_vel_.push_back(contact_particles_[k]->registerStateVariable<Vecd>("Velocity"));
             contact_n_.push_back(contact_particles_[k]->template getVariableDataByName<Vecd>("NormalDirection"));
         }
@@ -101,7 +101,7 @@ class DynamicContactForceWithWall : public LocalDynamics,
 
             Vecd *n_k = contact_n_[k];
             Vecd *vel_n_k = contact_vel_[k];
-            Real *Vol_k = contact_Vol_[k];
+            StorageReal *Vol_k = contact_Vol_[k];
             Neighborhood &contact_neighborhood = (*contact_configuration_[k])[index_i];
             for (size_t n = 0; n != contact_neighborhood.current_size_; ++n)
             {
@@ -123,9 +123,9 @@ class DynamicContactForceWithWall : public LocalDynamics,
 
   protected:
     GeneralContinuum &continuum_;
-    Real *Vol_;
+    StorageReal *Vol_;
     Vecd *vel_, *force_prior_; // note that prior force directly used here
-    StdVec<Real *> contact_Vol_;
+    StdVec<StorageReal *> contact_Vol_;
     StdVec<Vecd *> contact_vel_, contact_n_;
     Real penalty_strength_;
     Real impedance_, reference_pressure_;
@@ -0,0 +1,78 @@
+/**
+ * @file 	benchmark_colored_split.cpp
+ * @brief 	Microbenchmarks for the particle-wise damping split over the 3^d cell colors
+ *          and over the colors of the particle conflict graph.
+ * @details The number of sweeps, i.e. the number of colors, is reported as a counter.
+ */
+#include "benchmark_setup.h"
+
+using namespace SPH;
+//----------------------------------------------------------------------
+//	Inner configuration of the lattice block with a damped quantity.
+//----------------------------------------------------------------------
+class ColoredSplitCase : public BenchmarkLattice
+{
+  public:
+    ColoredSplitCase(UnsignedInt particles_per_side, UnsignedInt number_of_threads)
+        : BenchmarkLattice(particles_per_side, number_of_threads),
+          soil_block_inner_(soil_block_)
+    {
+        BaseParticles &particles = soil_block_.getBaseParticles();
+        Vecd *pos = particles.getVariableDataByName<Vecd>("Position");
+        particles.registerStateVariable<Real>("Quantity", [&](size_t i) -> Real
+                                              { return pos[i].norm(); });
+        soil_block_.updateCellLinkedList();
+        soil_block_inner_.updateConfiguration();
+    };
+
+    InnerRelation soil_block_inner_;
+};
+Real damping_dt = 0.1;
+//----------------------------------------------------------------------
+//	Sweeping over the 3^d split cells.
+//----------------------------------------------------------------------
+static void BM_DampingJacobiCellSplit(benchmark::State &state)
+{
+    ColoredSplitCase split_case(state.range(0), state.range(1));
+    InteractionSplit<DampingJacobiInner<Real, FixedDampingRate>>
+        damping(split_case.soil_block_inner_, "Quantity", 1.0);
+    for (auto _ : state)
+    {
+        damping.exec(damping_dt);
+    }
+    state.counters["colors"] = Real(Dimensions == 2 ? 9 : 27);
+    state.SetItemsProcessed(state.iterations() * split_case.TotalBlockParticles());
+}
+BENCHMARK(BM_DampingJacobiCellSplit)->Apply(LatticeArguments);
+//----------------------------------------------------------------------
+//	Sweeping over the particle colors, which are computed at the first execution.
+//----------------------------------------------------------------------
+static void BM_DampingJacobiMultiColorSplit(benchmark::State &state)
+{
+    ColoredSplitCase split_case(state.range(0), state.range(1));
+    InteractionMultiColorSplit<DampingJacobiInner<Real, FixedDampingRate>>
+        damping(split_case.soil_block_inner_, "Quantity", 1.0);
+    damping.exec(damping_dt);
+    for (auto _ : state)
+    {
+        damping.exec(damping_dt);
+    }
+    state.counters["colors"] = Real(damping.getParticleColoring().NumberOfColors());
+    state.SetItemsProcessed(state.iterations() * split_case.TotalBlockParticles());
+}
+BENCHMARK(BM_DampingJacobiMultiColorSplit)->Apply(LatticeArguments);
+//----------------------------------------------------------------------
+//	Coloring of the particle conflict graph alone.
+//----------------------------------------------------------------------
+static void BM_GatherParticleColoring(benchmark::State &state)
+{
+    ColoredSplitCase split_case(state.range(0), state.range(1));
+    GatherParticleColoring coloring(split_case.soil_block_inner_.inner_configuration_);
+    for (auto _ : state)
+    {
+        coloring.updateColors(split_case.TotalBlockParticles());
+    }
+    state.counters["colors"] = Real(coloring.NumberOfColors());
+    state.SetItemsProcessed(state.iterations() * split_case.TotalBlockParticles());
+}
+BENCHMARK(BM_GatherParticleColoring)->Apply(LatticeArguments);
@@ -0,0 +1,88 @@
+/**
+ * @file 	benchmark_configuration.cpp
+ * @brief 	Microbenchmarks for cell linked list, neighbor search and particle sorting.
+ */
+#include "benchmark_setup.h"
+
+#include <random>
+
+using namespace SPH;
+//----------------------------------------------------------------------
+//	Cell linked list updated by the particle dynamics without computing kernels.
+//----------------------------------------------------------------------
+static void BM_CellLinkedListUpdateCellLists(benchmark::State &state)
+{
+    BenchmarkLattice lattice(state.range(0), state.range(1));
+    for (auto _ : state)
+    {
+        lattice.soil_block_.updateCellLinkedList();
+    }
+    state.SetItemsProcessed(state.iterations() * lattice.TotalBlockParticles());
+}
+BENCHMARK(BM_CellLinkedListUpdateCellLists)->Apply(LatticeArguments);
+//----------------------------------------------------------------------
+//	Cell linked list updated by computing kernels.
+//----------------------------------------------------------------------
+static void BM_UpdateCellLinkedListCK(benchmark::State &state)
+{
+    BenchmarkLattice lattice(state.range(0), state.range(1));
+    UpdateCellLinkedList<execution::ParallelPolicy, CellLinkedList> soil_cell_linked_list(lattice.soil_block_);
+    for (auto _ : state)
+    {
+        soil_cell_linked_list.exec();
+    }
+    state.SetItemsProcessed(state.iterations() * lattice.TotalBlockParticles());
+}
+BENCHMARK(BM_UpdateCellLinkedListCK)->Apply(LatticeArguments);
+//----------------------------------------------------------------------
+//	Inner and contact neighbor lists built by computing kernels.
+//----------------------------------------------------------------------
+static void BM_UpdateRelationInner(benchmark::State &state)
+{
+    BenchmarkLattice lattice(state.range(0), state.range(1));
+    Relation<Inner<>> soil_block_inner(lattice.soil_block_);
+    UpdateCellLinkedList<execution::ParallelPolicy, CellLinkedList> soil_cell_linked_list(lattice.soil_block_);
+    UpdateRelation<execution::ParallelPolicy, Inner<>> soil_block_update_inner_relation(soil_block_inner);
+    soil_cell_linked_list.exec();
+    for (auto _ : state)
+    {
+        soil_block_update_inner_relation.exec();
+    }
+    state.SetItemsProcessed(state.iterations() * lattice.TotalBlockParticles());
+}
+BENCHMARK(BM_UpdateRelationInner)->Apply(LatticeArguments);
+
+static void BM_UpdateRelationContact(benchmark::State &state)
+{
+    BenchmarkLattice lattice(state.range(0), state.range(1));
+    Relation<Contact<>> soil_block_contact(lattice.soil_block_, {&lattice.wall_boundary_});
+    UpdateCellLinkedList<execution::ParallelPolicy, CellLinkedList> wall_cell_linked_list(lattice.wall_boundary_);
+    UpdateRelation<execution::ParallelPolicy, Contact<>> soil_block_update_contact_relation(soil_block_contact);
+    wall_cell_linked_list.exec();
+    for (auto _ : state)
+    {
+        soil_block_update_contact_relation.exec();
+    }
+    state.SetItemsProcessed(state.iterations() * lattice.TotalBlockParticles());
+}
+BENCHMARK(BM_UpdateRelationContact)->Apply(LatticeArguments);
+//----------------------------------------------------------------------
+//	Particle sorting from randomly shuffled positions.
+//----------------------------------------------------------------------
+static void BM_ParticleSortCKQuickSort(benchmark::State &state)
+{
+    BenchmarkLattice lattice(state.range(0), state.range(1));
+    ParticleSortCK<execution::ParallelPolicy, QuickSort> particle_sort(lattice.soil_block_);
+    BaseParticles &particles = lattice.soil_block_.getBaseParticles();
+    Vecd *pos = particles.ParticlePositions();
+    std::mt19937 random_engine(1);
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        std::shuffle(pos, pos + particles.TotalRealParticles(), random_engine);
+        state.ResumeTiming();
+        particle_sort.exec();
+    }
+    state.SetItemsProcessed(state.iterations() * lattice.TotalBlockParticles());
+}
+BENCHMARK(BM_ParticleSortCKQuickSort)->Apply(LatticeArguments);
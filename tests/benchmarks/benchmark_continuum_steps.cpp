@@ -0,0 +1,149 @@
+/**
+ * @file 	benchmark_continuum_steps.cpp
+ * @brief 	Microbenchmarks for the acoustic steps and density regularization
+ *          of the plastic continuum using computing kernels.
+ */
+#include "benchmark_setup.h"
+
+using namespace SPH;
+//----------------------------------------------------------------------
+//	Soil block with the wall boundary and its configuration updated once.
+//----------------------------------------------------------------------
+class ContinuumStepsCase : public BenchmarkLattice
+{
+  public:
+    ContinuumStepsCase(UnsignedInt particles_per_side, UnsignedInt number_of_threads)
+        : BenchmarkLattice(particles_per_side, number_of_threads),
+          soil_block_inner_(soil_block_),
+          soil_block_contact_(soil_block_, {&wall_boundary_}),
+          soil_cell_linked_list_(soil_block_),
+          wall_cell_linked_list_(wall_boundary_),
+          soil_block_update_complex_relation_(soil_block_inner_, soil_block_contact_),
+          wall_boundary_normal_direction_(wall_boundary_),
+          soil_advection_step_setup_(soil_block_){};
+
+    void prepare()
+    {
+        wall_boundary_normal_direction_.exec();
+        soil_cell_linked_list_.exec();
+        wall_cell_linked_list_.exec();
+        soil_block_update_complex_relation_.exec();
+        soil_advection_step_setup_.exec();
+    };
+
+    Relation<Inner<>> soil_block_inner_;
+    Relation<Contact<>> soil_block_contact_;
+
+  protected:
+    UpdateCellLinkedList<execution::ParallelPolicy, CellLinkedList> soil_cell_linked_list_;
+    UpdateCellLinkedList<execution::ParallelPolicy, CellLinkedList> wall_cell_linked_list_;
+    UpdateRelation<execution::ParallelPolicy, Inner<>, Contact<>> soil_block_update_complex_relation_;
+    StateDynamics<execution::ParallelPolicy, NormalFromBodyShapeCK> wall_boundary_normal_direction_;
+    StateDynamics<execution::ParallelPolicy, fluid_dynamics::AdvectionStepSetup> soil_advection_step_setup_;
+};
+Real acoustic_dt = 1.0e-7;
+//----------------------------------------------------------------------
+//	Acoustic steps.
+//----------------------------------------------------------------------
+static void BM_PlasticAcousticStep1stHalf(benchmark::State &state)
+{
+    ContinuumStepsCase continuum_case(state.range(0), state.range(1));
+    InteractionDynamicsCK<execution::ParallelPolicy, continuum_dynamics::PlasticAcousticStep1stHalfWithWallRiemannCK>
+        soil_acoustic_step_1st_half(continuum_case.soil_block_inner_, continuum_case.soil_block_contact_);
+    continuum_case.prepare();
+    for (auto _ : state)
+    {
+        soil_acoustic_step_1st_half.exec(acoustic_dt);
+    }
+    state.SetItemsProcessed(state.iterations() * continuum_case.TotalBlockParticles());
+}
+BENCHMARK(BM_PlasticAcousticStep1stHalf)->Apply(LatticeArguments);
+
+static void BM_PlasticAcousticStep2ndHalf(benchmark::State &state)
+{
+    ContinuumStepsCase continuum_case(state.range(0), state.range(1));
+    InteractionDynamicsCK<execution::ParallelPolicy, continuum_dynamics::PlasticAcousticStep2ndHalfWithWallRiemannCK>
+        soil_acoustic_step_2nd_half(continuum_case.soil_block_inner_, continuum_case.soil_block_contact_);
+    continuum_case.prepare();
+    for (auto _ : state)
+    {
+        soil_acoustic_step_2nd_half.exec(acoustic_dt);
+    }
+    state.SetItemsProcessed(state.iterations() * continuum_case.TotalBlockParticles());
+}
+BENCHMARK(BM_PlasticAcousticStep2ndHalf)->Apply(LatticeArguments);
+
+static void BM_PlasticAcousticStep2ndHalfWithTimeStep(benchmark::State &state)
+{
+    ContinuumStepsCase continuum_case(state.range(0), state.range(1));
+    ReduceDynamicsCK<execution::ParallelPolicy, fluid_dynamics::AcousticTimeStepCK>
+        soil_acoustic_time_step(continuum_case.soil_block_, 0.4);
+    InteractionWithTimeStepCK<execution::ParallelPolicy, continuum_dynamics::PlasticAcousticStep2ndHalfWithWallRiemannCK,
+                              fluid_dynamics::AcousticTimeStepCK>
+        soil_acoustic_step_2nd_half(soil_acoustic_time_step, continuum_case.soil_block_inner_, continuum_case.soil_block_contact_);
+    continuum_case.prepare();
+    for (auto _ : state)
+    {
+        soil_acoustic_step_2nd_half.exec(acoustic_dt);
+        benchmark::DoNotOptimize(soil_acoustic_step_2nd_half.NextTimeStep());
+    }
+    state.SetItemsProcessed(state.iterations() * continuum_case.TotalBlockParticles());
+}
+BENCHMARK(BM_PlasticAcousticStep2ndHalfWithTimeStep)->Apply(LatticeArguments);
+
+static void BM_AcousticTimeStepCK(benchmark::State &state)
+{
+    ContinuumStepsCase continuum_case(state.range(0), state.range(1));
+    ReduceDynamicsCK<execution::ParallelPolicy, fluid_dynamics::AcousticTimeStepCK>
+        soil_acoustic_time_step(continuum_case.soil_block_, 0.4);
+    continuum_case.prepare();
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(soil_acoustic_time_step.exec());
+    }
+    state.SetItemsProcessed(state.iterations() * continuum_case.TotalBlockParticles());
+}
+BENCHMARK(BM_AcousticTimeStepCK)->Apply(LatticeArguments);
+
+static void BM_PlasticAcousticStepsMultiRate(benchmark::State &state)
+{
+    ContinuumStepsCase continuum_case(state.range(0), state.range(1));
+    MultiRateTimeStepCK<execution::ParallelPolicy, fluid_dynamics::AcousticTimeStepCK>
+        soil_multi_rate_time_step(continuum_case.soil_block_inner_, 3, 0.4);
+    MultiRateInteractionDynamicsCK<execution::ParallelPolicy, continuum_dynamics::PlasticAcousticStep1stHalfWithWallRiemannCK>
+        soil_acoustic_step_1st_half(soil_multi_rate_time_step, continuum_case.soil_block_inner_, continuum_case.soil_block_contact_);
+    MultiRateInteractionDynamicsCK<execution::ParallelPolicy, continuum_dynamics::PlasticAcousticStep2ndHalfWithWallRiemannCK>
+        soil_acoustic_step_2nd_half(soil_multi_rate_time_step, continuum_case.soil_block_inner_, continuum_case.soil_block_contact_);
+    continuum_case.prepare();
+    for (auto _ : state)
+    {
+        soil_multi_rate_time_step.exec(MaxReal);
+        for (UnsignedInt k = 0; k != soil_multi_rate_time_step.NumberOfSubSteps(); ++k)
+        {
+            soil_multi_rate_time_step.setSubStep(k);
+            soil_acoustic_step_1st_half.exec();
+            soil_acoustic_step_2nd_half.exec();
+            soil_multi_rate_time_step.endSubStep();
+        }
+    }
+    state.counters["EffectiveSpeedup"] = soil_multi_rate_time_step.EffectiveSpeedup();
+    state.SetItemsProcessed(state.iterations() * continuum_case.TotalBlockParticles() *
+                            soil_multi_rate_time_step.NumberOfSubSteps());
+}
+BENCHMARK(BM_PlasticAcousticStepsMultiRate)->Apply(LatticeArguments);
+//----------------------------------------------------------------------
+//	Density regularization.
+//----------------------------------------------------------------------
+static void BM_DensityRegularization(benchmark::State &state)
+{
+    ContinuumStepsCase continuum_case(state.range(0), state.range(1));
+    InteractionDynamicsCK<execution::ParallelPolicy, fluid_dynamics::DensityRegularizationComplexFreeSurface>
+        soil_density_regularization(continuum_case.soil_block_inner_, continuum_case.soil_block_contact_);
+    continuum_case.prepare();
+    for (auto _ : state)
+    {
+        soil_density_regularization.exec();
+    }
+    state.SetItemsProcessed(state.iterations() * continuum_case.TotalBlockParticles());
+}
+BENCHMARK(BM_DensityRegularization)->Apply(LatticeArguments);
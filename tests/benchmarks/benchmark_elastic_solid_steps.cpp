@@ -0,0 +1,205 @@
+/**
+ * @file 	benchmark_elastic_solid_steps.cpp
+ * @brief 	Microbenchmarks for the total Lagrangian elastic solid steps,
+ *          by the particle dynamics in test_3d_passive_cantilever and by computing kernels.
+ */
+#include "benchmark_setup.h"
+
+using namespace SPH;
+//----------------------------------------------------------------------
+//	Elastic block with the material of the neo-Hookean passive cantilever.
+//----------------------------------------------------------------------
+class ElasticSolidStepsCase
+{
+  public:
+    ElasticSolidStepsCase(UnsignedInt particles_per_side, UnsignedInt number_of_threads)
+        : particle_spacing_(0.01), block_length_(Real(particles_per_side) * particle_spacing_),
+          block_shape_(Vecd::Constant(0.5 * block_length_), "ElasticBlock"),
+          sph_system_(BoundingBox(Vecd::Constant(-0.5 * block_length_), Vecd::Constant(0.5 * block_length_)),
+                      particle_spacing_, number_of_threads),
+          elastic_block_(sph_system_, block_shape_)
+    {
+        Real rho0_s = 1100.0;
+        Real youngs_modulus = 1.7e7;
+        Real poisson = 0.45;
+        elastic_block_.defineMaterial<NeoHookeanSolid>(rho0_s, youngs_modulus, poisson);
+        elastic_block_.generateParticles<BaseParticles, Lattice>();
+    };
+    UnsignedInt TotalBlockParticles() { return elastic_block_.getBaseParticles().TotalRealParticles(); };
+
+  protected:
+    Real particle_spacing_;
+    Real block_length_;
+    GeometricShapeBox block_shape_;
+
+  public:
+    SPHSystem sph_system_;
+    SolidBody elastic_block_;
+};
+//----------------------------------------------------------------------
+//	Inner configuration updated once by the particle dynamics.
+//----------------------------------------------------------------------
+class ElasticSolidStepsLegacyCase : public ElasticSolidStepsCase
+{
+  public:
+    ElasticSolidStepsLegacyCase(UnsignedInt particles_per_side, UnsignedInt number_of_threads)
+        : ElasticSolidStepsCase(particles_per_side, number_of_threads),
+          elastic_block_inner_(elastic_block_),
+          corrected_configuration_(elastic_block_inner_){};
+
+    void prepare()
+    {
+        elastic_block_.updateCellLinkedList();
+        elastic_block_inner_.updateConfiguration();
+        corrected_configuration_.exec();
+    };
+
+    InnerRelation elastic_block_inner_;
+
+  protected:
+    InteractionWithUpdate<LinearGradientCorrectionMatrixInner> corrected_configuration_;
+};
+//----------------------------------------------------------------------
+//	Inner configuration and reference pair data computed once by computing kernels.
+//----------------------------------------------------------------------
+class ElasticSolidStepsCKCase : public ElasticSolidStepsCase
+{
+  public:
+    ElasticSolidStepsCKCase(UnsignedInt particles_per_side, UnsignedInt number_of_threads)
+        : ElasticSolidStepsCase(particles_per_side, number_of_threads),
+          elastic_block_inner_(elastic_block_),
+          elastic_block_cell_linked_list_(elastic_block_),
+          elastic_block_update_inner_relation_(elastic_block_inner_),
+          elastic_block_reference_configuration_(elastic_block_inner_){};
+
+    void prepare()
+    {
+        elastic_block_cell_linked_list_.exec();
+        elastic_block_update_inner_relation_.exec();
+        elastic_block_reference_configuration_.exec();
+    };
+
+    Relation<Inner<>> elastic_block_inner_;
+
+  protected:
+    UpdateCellLinkedList<execution::ParallelPolicy, CellLinkedList> elastic_block_cell_linked_list_;
+    UpdateRelation<execution::ParallelPolicy, Inner<>> elastic_block_update_inner_relation_;
+    solid_dynamics::ReferenceConfigurationCK<execution::ParallelPolicy> elastic_block_reference_configuration_;
+};
+Real solid_dt = 1.0e-6;
+//----------------------------------------------------------------------
+//	Steps by the particle dynamics.
+//----------------------------------------------------------------------
+static void BM_ElasticIntegration1stHalf(benchmark::State &state)
+{
+    ElasticSolidStepsLegacyCase solid_case(state.range(0), state.range(1));
+    Dynamics1Level<solid_dynamics::Integration1stHalfPK2> stress_relaxation_first_half(solid_case.elastic_block_inner_);
+    solid_case.prepare();
+    for (auto _ : state)
+    {
+        stress_relaxation_first_half.exec(solid_dt);
+    }
+    state.SetItemsProcessed(state.iterations() * solid_case.TotalBlockParticles());
+}
+BENCHMARK(BM_ElasticIntegration1stHalf)->Apply(LatticeArguments);
+
+static void BM_ElasticIntegration2ndHalf(benchmark::State &state)
+{
+    ElasticSolidStepsLegacyCase solid_case(state.range(0), state.range(1));
+    Dynamics1Level<solid_dynamics::Integration2ndHalf> stress_relaxation_second_half(solid_case.elastic_block_inner_);
+    solid_case.prepare();
+    for (auto _ : state)
+    {
+        stress_relaxation_second_half.exec(solid_dt);
+    }
+    state.SetItemsProcessed(state.iterations() * solid_case.TotalBlockParticles());
+}
+BENCHMARK(BM_ElasticIntegration2ndHalf)->Apply(LatticeArguments);
+
+static void BM_ElasticAcousticTimeStep(benchmark::State &state)
+{
+    ElasticSolidStepsLegacyCase solid_case(state.range(0), state.range(1));
+    /** the first half step registers the force variables */
+    Dynamics1Level<solid_dynamics::Integration1stHalfPK2> stress_relaxation_first_half(solid_case.elastic_block_inner_);
+    ReduceDynamics<solid_dynamics::AcousticTimeStep> computing_time_step_size(solid_case.elastic_block_, 0.3);
+    solid_case.prepare();
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(computing_time_step_size.exec());
+    }
+    state.SetItemsProcessed(state.iterations() * solid_case.TotalBlockParticles());
+}
+BENCHMARK(BM_ElasticAcousticTimeStep)->Apply(LatticeArguments);
+
+static void BM_DeformationGradientBySummation(benchmark::State &state)
+{
+    ElasticSolidStepsLegacyCase solid_case(state.range(0), state.range(1));
+    InteractionDynamics<solid_dynamics::DeformationGradientBySummation> deformation_gradient(solid_case.elastic_block_inner_);
+    solid_case.prepare();
+    for (auto _ : state)
+    {
+        deformation_gradient.exec();
+    }
+    state.SetItemsProcessed(state.iterations() * solid_case.TotalBlockParticles());
+}
+BENCHMARK(BM_DeformationGradientBySummation)->Apply(LatticeArguments);
+//----------------------------------------------------------------------
+//	Steps by computing kernels.
+//----------------------------------------------------------------------
+static void BM_ElasticIntegration1stHalfCK(benchmark::State &state)
+{
+    ElasticSolidStepsCKCase solid_case(state.range(0), state.range(1));
+    InteractionDynamicsCK<execution::ParallelPolicy, solid_dynamics::Integration1stHalfPK2CK<NeoHookeanSolid>>
+        stress_relaxation_first_half(solid_case.elastic_block_inner_);
+    solid_case.prepare();
+    for (auto _ : state)
+    {
+        stress_relaxation_first_half.exec(solid_dt);
+    }
+    state.SetItemsProcessed(state.iterations() * solid_case.TotalBlockParticles());
+}
+BENCHMARK(BM_ElasticIntegration1stHalfCK)->Apply(LatticeArguments);
+
+static void BM_ElasticIntegration2ndHalfCK(benchmark::State &state)
+{
+    ElasticSolidStepsCKCase solid_case(state.range(0), state.range(1));
+    InteractionDynamicsCK<execution::ParallelPolicy, solid_dynamics::Integration2ndHalfCK<Inner<OneLevel>>>
+        stress_relaxation_second_half(solid_case.elastic_block_inner_);
+    solid_case.prepare();
+    for (auto _ : state)
+    {
+        stress_relaxation_second_half.exec(solid_dt);
+    }
+    state.SetItemsProcessed(state.iterations() * solid_case.TotalBlockParticles());
+}
+BENCHMARK(BM_ElasticIntegration2ndHalfCK)->Apply(LatticeArguments);
+
+static void BM_ElasticAcousticTimeStepCK(benchmark::State &state)
+{
+    ElasticSolidStepsCKCase solid_case(state.range(0), state.range(1));
+    InteractionDynamicsCK<execution::ParallelPolicy, solid_dynamics::Integration1stHalfPK2CK<NeoHookeanSolid>>
+        stress_relaxation_first_half(solid_case.elastic_block_inner_); // registers the force variables
+    ReduceDynamicsCK<execution::ParallelPolicy, solid_dynamics::AcousticTimeStepCK>
+        computing_time_step_size(solid_case.elastic_block_, 0.3);
+    solid_case.prepare();
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(computing_time_step_size.exec());
+    }
+    state.SetItemsProcessed(state.iterations() * solid_case.TotalBlockParticles());
+}
+BENCHMARK(BM_ElasticAcousticTimeStepCK)->Apply(LatticeArguments);
+
+static void BM_DeformationGradientBySummationCK(benchmark::State &state)
+{
+    ElasticSolidStepsCKCase solid_case(state.range(0), state.range(1));
+    InteractionDynamicsCK<execution::ParallelPolicy, solid_dynamics::DeformationGradientBySummationCK<Inner<>>>
+        deformation_gradient(solid_case.elastic_block_inner_);
+    solid_case.prepare();
+    for (auto _ : state)
+    {
+        deformation_gradient.exec();
+    }
+    state.SetItemsProcessed(state.iterations() * solid_case.TotalBlockParticles());
+}
+BENCHMARK(BM_DeformationGradientBySummationCK)->Apply(LatticeArguments);
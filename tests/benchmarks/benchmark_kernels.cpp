@@ -0,0 +1,107 @@
+/**
+ * @file 	benchmark_kernels.cpp
+ * @brief 	Microbenchmarks for evaluating the smoothing kernel and its gradient.
+ */
+#include "benchmark_setup.h"
+
+#include <random>
+
+using namespace SPH;
+//----------------------------------------------------------------------
+//	Displacements randomly distributed within the cut-off radius.
+//----------------------------------------------------------------------
+StdVec<Vecd> randomDisplacements(Real cutoff_radius, size_t number_of_samples)
+{
+    std::mt19937 random_engine(1);
+    std::uniform_real_distribution<Real> distribution(-1.0, 1.0);
+    StdVec<Vecd> displacements;
+    while (displacements.size() != number_of_samples)
+    {
+        Vecd displacement = Vecd::Zero();
+        for (int k = 0; k != Dimensions; ++k)
+        {
+            displacement[k] = distribution(random_engine) * cutoff_radius;
+        }
+        if (displacement.norm() < cutoff_radius)
+        {
+            displacements.push_back(displacement);
+        }
+    }
+    return displacements;
+}
+size_t number_of_samples = 1 << 16;
+Real smoothing_length = 0.013;
+//----------------------------------------------------------------------
+//	Computing kernel of Wendland C2.
+//----------------------------------------------------------------------
+static void BM_KernelWendlandC2CK_W(benchmark::State &state)
+{
+    KernelWendlandC2 kernel(smoothing_length);
+    KernelWendlandC2CK kernel_ck(kernel);
+    StdVec<Vecd> displacements = randomDisplacements(kernel.CutOffRadius(), number_of_samples);
+    for (auto _ : state)
+    {
+        Real sum = 0.0;
+        for (const Vecd &displacement : displacements)
+        {
+            sum += kernel_ck.W(displacement);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * displacements.size());
+}
+BENCHMARK(BM_KernelWendlandC2CK_W);
+
+static void BM_KernelWendlandC2CK_dW(benchmark::State &state)
+{
+    KernelWendlandC2 kernel(smoothing_length);
+    KernelWendlandC2CK kernel_ck(kernel);
+    StdVec<Vecd> displacements = randomDisplacements(kernel.CutOffRadius(), number_of_samples);
+    for (auto _ : state)
+    {
+        Real sum = 0.0;
+        for (const Vecd &displacement : displacements)
+        {
+            sum += kernel_ck.dW(displacement);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * displacements.size());
+}
+BENCHMARK(BM_KernelWendlandC2CK_dW);
+//----------------------------------------------------------------------
+//	Tabulated kernel evaluated through the virtual kernel interface.
+//----------------------------------------------------------------------
+static void BM_KernelTabulated_W(benchmark::State &state)
+{
+    KernelTabulated<KernelWendlandC2> kernel(smoothing_length, 20);
+    StdVec<Vecd> displacements = randomDisplacements(kernel.CutOffRadius(), number_of_samples);
+    for (auto _ : state)
+    {
+        Real sum = 0.0;
+        for (const Vecd &displacement : displacements)
+        {
+            sum += kernel.W(displacement.norm(), displacement);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * displacements.size());
+}
+BENCHMARK(BM_KernelTabulated_W);
+
+static void BM_KernelTabulated_dW(benchmark::State &state)
+{
+    KernelTabulated<KernelWendlandC2> kernel(smoothing_length, 20);
+    StdVec<Vecd> displacements = randomDisplacements(kernel.CutOffRadius(), number_of_samples);
+    for (auto _ : state)
+    {
+        Real sum = 0.0;
+        for (const Vecd &displacement : displacements)
+        {
+            sum += kernel.dW(displacement.norm(), displacement);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * displacements.size());
+}
+BENCHMARK(BM_KernelTabulated_dW);
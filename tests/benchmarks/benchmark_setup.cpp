@@ -0,0 +1,58 @@
+#include "benchmark_setup.h"
+
+#include <thread>
+
+namespace SPH
+{
+//=================================================================================================//
+BenchmarkWall::BenchmarkWall(const std::string &shape_name, Real block_length, Real wall_width)
+    : ComplexShape(shape_name)
+{
+    add<GeometricShapeBox>(Vecd::Constant(0.5 * block_length + wall_width));
+    subtract<GeometricShapeBox>(Vecd::Constant(0.5 * block_length));
+}
+//=================================================================================================//
+BenchmarkLattice::BenchmarkLattice(UnsignedInt particles_per_side, UnsignedInt number_of_threads)
+    : particle_spacing_(0.01), block_length_(Real(particles_per_side) * particle_spacing_),
+      wall_width_(4.0 * particle_spacing_),
+      block_shape_(Vecd::Constant(0.5 * block_length_), "SoilBlock"),
+      sph_system_(BoundingBox(Vecd::Constant(-0.5 * block_length_ - wall_width_),
+                              Vecd::Constant(0.5 * block_length_ + wall_width_)),
+                  particle_spacing_, number_of_threads),
+      soil_block_(sph_system_, block_shape_),
+      wall_boundary_(sph_system_, makeShared<BenchmarkWall>("WallBoundary", block_length_, wall_width_))
+{
+    Real rho0_s = 2040;
+    Real youngs_modulus = 5.84e6;
+    Real poisson = 0.3;
+    Real c_s = sqrt(youngs_modulus / (rho0_s * 3.0 * (1.0 - 2.0 * poisson)));
+    Real friction_angle = 21.9 * Pi / 180;
+    soil_block_.defineMaterial<PlasticContinuum>(rho0_s, c_s, youngs_modulus, poisson, friction_angle);
+    soil_block_.generateParticles<BaseParticles, Lattice>();
+
+    wall_boundary_.defineMaterial<Solid>();
+    wall_boundary_.generateParticles<BaseParticles, Lattice>();
+}
+//=================================================================================================//
+void LatticeArguments(benchmark::internal::Benchmark *benchmark)
+{
+    StdVec<int64_t> particles_per_side =
+        Dimensions == 2 ? StdVec<int64_t>{64, 128, 256} : StdVec<int64_t>{16, 32, 48};
+    StdVec<int64_t> number_of_threads = {1};
+    int64_t max_threads = std::thread::hardware_concurrency();
+    if (max_threads > 1)
+    {
+        number_of_threads.push_back(max_threads);
+    }
+
+    for (int64_t n : particles_per_side)
+    {
+        for (int64_t threads : number_of_threads)
+        {
+            benchmark->Args({n, threads});
+        }
+    }
+    benchmark->ArgNames({"side", "threads"})->UseRealTime()->Unit(benchmark::kMillisecond);
+}
+//=================================================================================================//
+} // namespace SPH
@@ -0,0 +1,44 @@
+/**
+ * @file 	benchmark_setup.h
+ * @brief 	Synthetic lattice case shared by the microbenchmarks.
+ * @details A plastic continuum block fills a box and is surrounded by a wall layer,
+ *          so that both inner and contact configurations are available.
+ *          The benchmarks take the number of particles along each side of the block
+ *          and the number of threads as arguments.
+ */
+#ifndef BENCHMARK_SETUP_H
+#define BENCHMARK_SETUP_H
+
+#include "sphinxsys_ck.h"
+#include <benchmark/benchmark.h>
+
+namespace SPH
+{
+class BenchmarkWall : public ComplexShape
+{
+  public:
+    BenchmarkWall(const std::string &shape_name, Real block_length, Real wall_width);
+};
+
+class BenchmarkLattice
+{
+  public:
+    BenchmarkLattice(UnsignedInt particles_per_side, UnsignedInt number_of_threads);
+    UnsignedInt TotalBlockParticles() { return soil_block_.getBaseParticles().TotalRealParticles(); };
+
+  protected:
+    Real particle_spacing_;
+    Real block_length_;
+    Real wall_width_;
+    GeometricShapeBox block_shape_;
+
+  public:
+    SPHSystem sph_system_;
+    RealBody soil_block_;
+    SolidBody wall_boundary_;
+};
+
+/** Arguments as {particles per side, number of threads}. */
+void LatticeArguments(benchmark::internal::Benchmark *benchmark);
+} // namespace SPH
+#endif // BENCHMARK_SETUP_H
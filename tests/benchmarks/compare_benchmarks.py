@@ -0,0 +1,72 @@
+#!/usr/bin/env python3
+"""
+Compare the JSON output of sphinxsys_benchmarks against a stored baseline.
+
+Generate the results with
+    sphinxsys_benchmarks --benchmark_out=current.json --benchmark_out_format=json
+and compare them with
+    python3 compare_benchmarks.py baseline.json current.json --threshold 0.1
+
+A benchmark is flagged as a regression if its real time increases by more than
+the relative threshold. The script exits with 1 if any regression is found.
+"""
+import argparse
+import json
+import sys
+
+
+def load_real_times(file_name):
+    with open(file_name) as file:
+        data = json.load(file)
+    real_times = {}
+    for benchmark in data["benchmarks"]:
+        # only compare single runs but not aggregates, such as mean or median
+        if benchmark.get("run_type", "iteration") != "iteration":
+            continue
+        real_times[benchmark["name"]] = (benchmark["real_time"], benchmark["time_unit"])
+    return real_times
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Flag performance regressions of sphinxsys_benchmarks.")
+    parser.add_argument("baseline", help="JSON output of the baseline run")
+    parser.add_argument("current", help="JSON output of the current run")
+    parser.add_argument("--threshold", type=float, default=0.1,
+                        help="relative increase of real time regarded as a regression")
+    arguments = parser.parse_args()
+
+    baseline = load_real_times(arguments.baseline)
+    current = load_real_times(arguments.current)
+
+    regressions = []
+    print("{:<64} {:>14} {:>14} {:>9}".format("Benchmark", "Baseline", "Current", "Change"))
+    for name, (current_time, time_unit) in current.items():
+        if name not in baseline:
+            print("{:<64} {:>14} {:>14.3f} {:>9}".format(name, "-", current_time, "new"))
+            continue
+        baseline_time, baseline_unit = baseline[name]
+        if baseline_unit != time_unit:
+            print("{:<64} time units differ: {} and {}".format(name, baseline_unit, time_unit))
+            continue
+        change = (current_time - baseline_time) / baseline_time
+        flag = ""
+        if change > arguments.threshold:
+            flag = "  <-- regression"
+            regressions.append(name)
+        print("{:<64} {:>14.3f} {:>14.3f} {:>+8.1f}%{}".format(
+            name, baseline_time, current_time, 100.0 * change, flag))
+
+    for name in baseline:
+        if name not in current:
+            print("{:<64} missing in the current run".format(name))
+
+    if regressions:
+        print("\n{} regression(s) found with threshold {:.0f}%.".format(
+            len(regressions), 100.0 * arguments.threshold))
+        return 1
+    print("\nNo regression found with threshold {:.0f}%.".format(100.0 * arguments.threshold))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,128 @@
+#!/usr/bin/env python3
+"""
+Strong and weak scaling driver for the CK example cases, such as
+test_2d_column_collapse_ck, test_2d_dambreak_ck and test_2d_stfb_ck.
+
+Each run uses the command line options of SPHSystem:
+    --end_step              fixed number of (advection) steps
+    --number_of_threads     number of threads given to tbb::global_control
+    --resolution_multiplier refinement of the reference resolution
+    --state_recording=0     no body state output
+Regression tests are skipped by the cases when the end step is given.
+
+Strong scaling runs every resolution multiplier with every thread count.
+Weak scaling refines the resolution with the thread count so that
+the number of particles per thread is kept about constant.
+
+Example:
+    python3 run_scaling.py --executable bin/test_2d_dambreak_ck \\
+        --mode strong --threads 1 2 4 8 --resolutions 1 2 --steps 200 --output dambreak.csv
+
+The CSV file gives the time per particle step, the parallel efficiency relative
+to the run with the fewest threads, and the per-phase breakdown in seconds.
+"""
+import argparse
+import csv
+import os
+import re
+import subprocess
+import sys
+
+PHASES = {
+    "interval_computing_time_step": "time_step",
+    "interval_acoustic_steps": "acoustic_steps",
+    "interval_updating_configuration": "configuration",
+    "interval_sorting": "sorting",
+    "interval_writting_body_state": "io",
+}
+
+
+def run_case(executable, threads, resolution, steps):
+    command = [os.path.abspath(executable),
+               "--end_step={}".format(steps),
+               "--number_of_threads={}".format(threads),
+               "--resolution_multiplier={}".format(resolution),
+               "--state_recording=0"]
+    result = subprocess.run(command, cwd=os.path.dirname(os.path.abspath(executable)),
+                            stdout=subprocess.PIPE, stderr=subprocess.STDOUT, universal_newlines=True)
+    if result.returncode != 0:
+        sys.stderr.write(result.stdout)
+        raise RuntimeError("{} failed with return code {}".format(" ".join(command), result.returncode))
+
+    values = {}
+    for line in result.stdout.splitlines():
+        wall_time = re.match(r"Total wall time for computation:\s*([0-9.eE+-]+)", line)
+        if wall_time:
+            values["wall_time"] = float(wall_time.group(1))
+            continue
+        entry = re.match(r"^(\w+)\s*=\s*([0-9.eE+-]+)\s*$", line)
+        if entry:
+            values[entry.group(1)] = float(entry.group(2))
+
+    for key in ["wall_time", "number_of_iterations", "total_real_particles"]:
+        if key not in values:
+            raise RuntimeError("'{}' is not found in the output of {}".format(key, executable))
+    return values
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Strong and weak scaling of SPHinXsys cases.")
+    parser.add_argument("--executable", required=True, help="path of the case executable")
+    parser.add_argument("--mode", choices=["strong", "weak"], default="strong")
+    parser.add_argument("--threads", type=int, nargs="+", default=[1, 2, 4, 8])
+    parser.add_argument("--resolutions", type=float, nargs="+", default=[1.0],
+                        help="resolution multipliers for strong scaling, the first one is the base for weak scaling")
+    parser.add_argument("--dimensions", type=int, choices=[2, 3], default=2,
+                        help="used for refining the resolution in weak scaling")
+    parser.add_argument("--steps", type=int, default=200)
+    parser.add_argument("--output", default="scaling.csv")
+    arguments = parser.parse_args()
+
+    threads = sorted(arguments.threads)
+    if arguments.mode == "strong":
+        runs = [(resolution, thread) for resolution in arguments.resolutions for thread in threads]
+    else:
+        base = arguments.resolutions[0]
+        runs = [(base * (thread / threads[0]) ** (1.0 / arguments.dimensions), thread) for thread in threads]
+
+    case_name = os.path.basename(arguments.executable)
+    rows = []
+    reference = {}
+    for resolution, thread in runs:
+        values = run_case(arguments.executable, thread, resolution, arguments.steps)
+        particle_steps = values["total_real_particles"] * values["number_of_iterations"]
+        time_per_particle_step = values["wall_time"] / particle_steps
+
+        reference_key = resolution if arguments.mode == "strong" else None
+        if reference_key not in reference:
+            reference[reference_key] = (thread, time_per_particle_step)
+        reference_threads, reference_time = reference[reference_key]
+        efficiency = reference_time * reference_threads / (time_per_particle_step * thread)
+
+        row = {
+            "case": case_name,
+            "mode": arguments.mode,
+            "threads": thread,
+            "resolution_multiplier": "{:.4f}".format(resolution),
+            "particles": int(values["total_real_particles"]),
+            "steps": int(values["number_of_iterations"]),
+            "wall_time": "{:.6f}".format(values["wall_time"]),
+            "time_per_particle_step": "{:.6e}".format(time_per_particle_step),
+            "parallel_efficiency": "{:.4f}".format(efficiency),
+        }
+        for key, phase in PHASES.items():
+            row[phase] = "{:.6f}".format(values.get(key, 0.0))
+        rows.append(row)
+        print("{} threads={} resolution={:.3f}: {} s/particle-step, efficiency {}".format(
+            case_name, thread, resolution, row["time_per_particle_step"], row["parallel_efficiency"]))
+
+    with open(arguments.output, "w", newline="") as file:
+        writer = csv.DictWriter(file, fieldnames=list(rows[0].keys()))
+        writer.writeheader()
+        writer.writerows(rows)
+    print("Scaling results are written to {}.".format(arguments.output))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
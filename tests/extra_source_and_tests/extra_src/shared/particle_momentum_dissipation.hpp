@@ -13,7 +13,7 @@ PorousMediaDampingPairwiseInner<VariableType>::
                                     const std::string &variable_name, Real eta)
     : LocalDynamics(inner_relation.getSPHBody()),
       DataDelegateInner(inner_relation),
-      Vol_(particles_->getVariableDataByName<Real>("VolumetricMeasure")),
+      Vol_(particles_->getVariableDataByName<StorageReal>("VolumetricMeasure")),
       mass_(particles_->getVariableDataByName<Real>("Mass")),
       variable_(particles_->getVariableDataByName<VariableType>(variable_name)),
       eta_(eta) {}
@@ -15,7 +15,7 @@ BasePorousMediaRelaxation::BasePorousMediaRelaxation(BaseInnerRelation &inner_re
     : LocalDynamics(inner_relation.getSPHBody()),
       DataDelegateInner(inner_relation),
       porous_solid_(DynamicCast<PorousMediaSolid>(this, particles_->getBaseMaterial())),
-      Vol_(particles_->getVariableDataByName<Real>("VolumetricMeasure")),
+      Vol_(particles_->getVariableDataByName<StorageReal>("VolumetricMeasure")),
       pos_(particles_->getVariableDataByName<Vecd>("Position")),
       vel_(particles_->registerStateVariable<Vecd>("Velocity")),
       B_(particles_->getVariableDataByName<Matd>("LinearGradientCorrectionMatrix")),
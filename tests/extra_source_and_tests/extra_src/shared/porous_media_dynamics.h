@@ -88,7 +88,7 @@ class BasePorousMediaRelaxation : public LocalDynamics, public DataDelegateInner
 
   protected:
     PorousMediaSolid &porous_solid_;
-    Real *Vol_;
+    StorageReal *Vol_;
     Vecd *pos_, *vel_;
     Matd *B_, *F_, *dF_dt_;
     Real rho0_, inv_rho0_;
@@ -195,14 +195,16 @@ class PorousMediaSaturationDynamicsInitialCondition : public BaseLocalDynamics<B
           fluid_mass_(particles_->getVariableDataByName<Real>("FluidMass")),
           fluid_saturation_(particles_->getVariableDataByName<Real>("FluidSaturation")),
           total_mass_(particles_->getVariableDataByName<Real>("TotalMass")),
-          rho_n_(particles_->getVariableDataByName<Real>("Density")),
+          rho_n_(particles_->getVariableDataByName<StorageReal>("Density")),
           Vol_update_(particles_->getVariableDataByName<Real>("UpdateVolume")),
           pos_(particles_->getVariableDataByName<Vecd>("Position")){};
 
     virtual ~PorousMediaSaturationDynamicsInitialCondition(){};
 
   protected:
-    Real *fluid_mass_, *fluid_saturation_, *total_mass_, *rho_n_, *Vol_update_;
+    Real *fluid_mass_, *fluid_saturation_, *total_mass_;
+    StorageReal *rho_n_;
+    Real *Vol_update_;
     Vecd *pos_;
 };
 
@@ -94,7 +94,7 @@ class BidirectionalBuffer
               aligned_box_(aligned_box_part.getAlignedBoxShape()),
               fluid_(DynamicCast<Fluid>(this, particles_->getBaseMaterial())),
               pos_(particles_->getVariableDataByName<Vecd>("Position")),
-              rho_(particles_->getVariableDataByName<Real>("Density")),
+              rho_(particles_->getVariableDataByName<StorageReal>("Density")),
               p_(particles_->getVariableDataByName<Real>("Pressure")),
               previous_surface_indicator_(particles_->getVariableDataByName<int>("PreviousSurfaceIndicator")),
               buffer_particle_indicator_(particles_->getVariableDataByName<int>("BufferParticleIndicator")),
@@ -137,7 +137,8 @@ class BidirectionalBuffer
         AlignedBoxShape &aligned_box_;
         Fluid &fluid_;
         Vecd *pos_;
-        Real *rho_, *p_;
+        StorageReal *rho_;
+        Real *p_;
         int *previous_surface_indicator_, *buffer_particle_indicator_;
         Real upper_bound_fringe_;
         Real *physical_time_;
@@ -48,7 +48,9 @@ class DensitySummationPressure<Base, DataDelegationType>
     virtual ~DensitySummationPressure(){};
 
   protected:
-    Real *rho_, *mass_, *rho_sum_;
+    StorageReal *rho_;
+    Real *mass_;
+    StorageReal *rho_sum_;
     Real rho0_, inv_sigma0_, W0_;
 };
 
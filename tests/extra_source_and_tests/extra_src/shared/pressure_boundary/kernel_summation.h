@@ -60,7 +60,7 @@ class NablaWV<Inner<>>
     void interaction(size_t index_i, Real dt = 0.0);
 
   protected:
-    Real *Vol_;
+    StorageReal *Vol_;
 };
 
 template <>
@@ -73,13 +73,13 @@ class NablaWV<Contact<>>
     {
         for (size_t k = 0; k < contact_configuration_.size(); ++k)
         {
-            contact_Vol_.push_back(contact_particles_[k]->getVariableDataByName<Real>("VolumetricMeasure"));
+            contact_Vol_.push_back(contact_particles_[k]->getVariableDataByName<StorageReal>("VolumetricMeasure"));
         }
     };
     virtual ~NablaWV(){};
     void interaction(size_t index_i, Real dt = 0.0);
 
-    StdVec<Real *> contact_Vol_;
+    StdVec<StorageReal *> contact_Vol_;
 };
 
 using NablaWVComplex = ComplexInteraction<NablaWV<Inner<>, Contact<>>>;
@@ -95,7 +95,7 @@ class TransportVelocityCorrection<Inner<ResolutionType, LimiterType>, CommonCont
         : fluid_dynamics::TransportVelocityCorrection<Base, DataDelegateInner, CommonControlTypes...>(inner_relation),
           h_ref_(this->sph_body_.sph_adaptation_->ReferenceSmoothingLength()),
           correction_scaling_(coefficient * h_ref_ * h_ref_),
-          Vol_(this->particles_->template getVariableDataByName<Real>("VolumetricMeasure")),
+          Vol_(this->particles_->template getVariableDataByName<StorageReal>("VolumetricMeasure")),
           pos_div_(this->particles_->template registerStateVariable<Real>("PositionDivergence")),
           pos_(this->particles_->template getVariableDataByName<Vecd>("Position")),
           h_ratio_(this->particles_), limiter_(h_ref_ * h_ref_),
@@ -143,7 +143,8 @@ class TransportVelocityCorrection<Inner<ResolutionType, LimiterType>, CommonCont
 
   protected:
     const Real h_ref_, correction_scaling_;
-    Real *Vol_, *pos_div_;
+    StorageReal *Vol_;
+    Real *pos_div_;
     Vecd *pos_;
     ResolutionType h_ratio_;
     LimiterType limiter_;
@@ -164,7 +165,7 @@ class TransportVelocityCorrection<Contact<Boundary>, CommonControlTypes...>
     {
         for (size_t k = 0; k != this->contact_particles_.size(); ++k)
         {
-            wall_Vol_.push_back(this->contact_particles_[k]->template getVariableDataByName<Real>("VolumetricMeasure"));
+            wall_Vol_.push_back(this->contact_particles_[k]->template getVariableDataByName<StorageReal>("VolumetricMeasure"));
         }
     };
     virtual ~TransportVelocityCorrection(){};
@@ -175,7 +176,7 @@ class TransportVelocityCorrection<Contact<Boundary>, CommonControlTypes...>
             Vecd inconsistency = Vecd::Zero();
             for (size_t k = 0; k < this->contact_configuration_.size(); ++k)
             {
-                Real *wall_Vol_k = wall_Vol_[k];
+                StorageReal *wall_Vol_k = wall_Vol_[k];
                 Neighborhood &contact_neighborhood = (*this->contact_configuration_[k])[index_i];
                 for (size_t n = 0; n != contact_neighborhood.current_size_; ++n)
                 {
@@ -190,7 +191,7 @@ class TransportVelocityCorrection<Contact<Boundary>, CommonControlTypes...>
     };
 
   protected:
-    StdVec<Real *> wall_Vol_;
+    StdVec<StorageReal *> wall_Vol_;
 };
 template <class ResolutionType, class LimiterType, typename... CommonControlTypes>
 using BaseTransportVelocityCorrectionComplex =
@@ -218,7 +219,7 @@ class FreeSurfaceNormal<DataDelegationType>
           color_gradient_(particles_->registerStateVariable<Vecd>("ColorGradient")),
           B_(particles_->getVariableDataByName<Matd>("LinearGradientCorrectionMatrix")),
           indicator_(particles_->registerStateVariable<int>("Indicator")),
-          Vol_(particles_->getVariableDataByName<Real>("VolumetricMeasure"))
+          Vol_(particles_->getVariableDataByName<StorageReal>("VolumetricMeasure"))
     {
         particles_->addVariableToSort<Vecd>("SurfaceNormal");
         particles_->addVariableToSort<Vecd>("ColorGradient");
@@ -229,7 +230,7 @@ class FreeSurfaceNormal<DataDelegationType>
     Vecd *surface_normal_, *color_gradient_;
     Matd *B_;
     int *indicator_;
-    Real *Vol_;
+    StorageReal *Vol_;
 };
 
 template <>
@@ -277,7 +278,7 @@ class FreeSurfaceNormal<Contact<>>
     {
         for (size_t k = 0; k != this->contact_particles_.size(); ++k)
         {
-            contact_Vol_.push_back(contact_particles_[k]->getVariableDataByName<Real>("VolumetricMeasure"));
+            contact_Vol_.push_back(contact_particles_[k]->getVariableDataByName<StorageReal>("VolumetricMeasure"));
         }
     };
     virtual ~FreeSurfaceNormal(){};
@@ -288,7 +289,7 @@ class FreeSurfaceNormal<Contact<>>
             for (size_t k = 0; k < contact_configuration_.size(); ++k)
             {
                 Vecd color_gradient = ZeroData<Vecd>::value;
-                Real *Vol_k = contact_Vol_[k];
+                StorageReal *Vol_k = contact_Vol_[k];
                 Neighborhood &contact_neighborhood = (*contact_configuration_[k])[index_i];
                 for (size_t n = 0; n != contact_neighborhood.current_size_; ++n)
                 {
@@ -301,7 +302,7 @@ class FreeSurfaceNormal<Contact<>>
     };
 
   protected:
-    StdVec<Real *> contact_Vol_;
+    StdVec<StorageReal *> contact_Vol_;
 };
 using FreeSurfaceNormalComplex =
     ComplexInteraction<FreeSurfaceNormal<Inner<>, Contact<>>>;
\ No newline at end of file
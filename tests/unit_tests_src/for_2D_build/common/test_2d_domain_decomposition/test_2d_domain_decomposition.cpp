@@ -0,0 +1,159 @@
+#include "sphinxsys.h"
+#include "sphinxsys_ck.h"
+#include <gtest/gtest.h>
+
+using namespace SPH;
+
+TEST(test_common, space_filling_curve_partition)
+{
+    Real spacing = 0.1;
+    BoundingBox bounds(Vec2d(-2.0, -1.0), Vec2d(2.0, 1.0));
+    Mesh mesh(bounds, spacing, 2);
+    StdVec<Vecd> positions;
+    for (Real x = -2.0 + 0.25 * spacing; x < 2.0; x += 0.5 * spacing)
+    {
+        for (Real y = -1.0 + 0.25 * spacing; y < 1.0; y += 0.5 * spacing)
+        {
+            positions.push_back(Vecd(x, y));
+        }
+    }
+
+    int number_of_ranks = 4;
+    SpaceFillingCurvePartition partition(mesh, 256);
+    StdVec<std::uint64_t> histogram;
+    partition.addToHistogram(positions.data(), positions.size(), histogram);
+    partition.setSplitters(histogram, number_of_ranks);
+    EXPECT_EQ(partition.NumberOfRanks(), number_of_ranks);
+
+    std::uint64_t max_bin_count = *std::max_element(histogram.begin(), histogram.end());
+    StdVec<std::uint64_t> owned_particles(number_of_ranks, 0);
+    for (const Vecd &position : positions)
+    {
+        int owner_rank = partition.OwnerRank(position);
+        ASSERT_GE(owner_rank, 0);
+        ASSERT_LT(owner_rank, number_of_ranks);
+        owned_particles[owner_rank]++;
+    }
+    for (int k = 0; k != number_of_ranks; ++k)
+    {
+        EXPECT_LE(owned_particles[k], positions.size() / number_of_ranks + max_bin_count);
+    }
+
+    // a neighbor owned by another rank is always sent as halo particle
+    StdVec<int> halo_ranks;
+    for (size_t i = 0; i < positions.size(); i += 7)
+    {
+        int owner_i = partition.OwnerRank(positions[i]);
+        partition.findHaloRanks(positions[i], owner_i, halo_ranks);
+        for (size_t j = 0; j != positions.size(); ++j)
+        {
+            int owner_j = partition.OwnerRank(positions[j]);
+            if (owner_j != owner_i && (positions[i] - positions[j]).norm() < spacing)
+            {
+                EXPECT_NE(std::find(halo_ranks.begin(), halo_ranks.end(), owner_j), halo_ranks.end());
+            }
+        }
+    }
+}
+
+TEST(test_common, domain_decomposition)
+{
+    Real dp = 0.05;
+    BoundingBox system_domain_bounds(Vec2d(-2.0, -2.0), Vec2d(2.0, 2.0));
+    SPHSystem sph_system(system_domain_bounds, dp);
+    sph_system.setIOEnvironment();
+    Vec2d halfsize(1.0, 0.5);
+    Transform translation(Vec2d::Zero());
+
+    FluidBody fluid_body(sph_system, makeShared<TransformShape<GeometricShapeBox>>(translation, halfsize, "FluidBody"));
+    fluid_body.defineMaterial<WeaklyCompressibleFluid>(1.0, 10.0);
+    Ghost<ReserveSizeFactor> halo_ghost(0.5);
+    ParticleBuffer<ReserveSizeFactor> particle_buffer(0.5);
+    fluid_body.generateParticles<BaseParticles, Ghost<ReserveSizeFactor>, ParticleBuffer<ReserveSizeFactor>, Lattice>(
+        halo_ghost, particle_buffer);
+    BaseParticles &particles = fluid_body.getBaseParticles();
+    particles.addVariableToSort<Vecd>("Position");
+    particles.addVariableToSort<StorageReal>("VolumetricMeasure");
+    particles.addVariableToSort<StorageReal>("Density");
+    StorageReal *rho = particles.getVariableDataByName<StorageReal>("Density");
+    UnsignedInt total_particles = particles.TotalRealParticles();
+
+    ProcessCommunicator &process_communicator = sph_system.getProcessCommunicator();
+    DomainDecomposition domain_decomposition(fluid_body, halo_ghost);
+    domain_decomposition.addVariableToExchange<StorageReal>("Density");
+    domain_decomposition.initializePartition();
+    EXPECT_EQ(domain_decomposition.GlobalParticles(), total_particles);
+    if (!process_communicator.isDistributed())
+    {
+        EXPECT_EQ(domain_decomposition.OwnedParticles(), total_particles);
+    }
+
+    fluid_body.updateCellLinkedList();
+    domain_decomposition.exchangeHaloParticles();
+    UnsignedInt owned_particles = domain_decomposition.OwnedParticles();
+    EXPECT_EQ(particles.TotalRealParticles(), owned_particles);
+    UnsignedInt *global_id = particles.getVariableDataByName<UnsignedInt>("GlobalID");
+    Vecd *pos = particles.ParticlePositions();
+    SpaceFillingCurvePartition &partition = domain_decomposition.getPartition();
+    for (UnsignedInt i = 0; i != owned_particles; ++i)
+    {
+        EXPECT_EQ(partition.OwnerRank(pos[i]), process_communicator.Rank());
+        rho[i] = Real(global_id[i]);
+    }
+    // halo particles are kept in the ghost range, not as real particles
+    IndexRange halo_range = domain_decomposition.HaloParticleRange();
+    EXPECT_GE(halo_range.begin(), particles.RealParticlesBound());
+    for (UnsignedInt i = halo_range.begin(); i != halo_range.end(); ++i)
+    {
+        EXPECT_NE(partition.OwnerRank(pos[i]), process_communicator.Rank());
+        rho[i] = -1.0;
+    }
+    domain_decomposition.updateHaloVariables();
+    for (UnsignedInt i = halo_range.begin(); i != halo_range.end(); ++i)
+    {
+        EXPECT_EQ(rho[i], Real(global_id[i]));
+    }
+
+    // particles moved across the partition are migrated to their new owners
+    for (UnsignedInt i = 0; i != owned_particles; ++i)
+    {
+        pos[i][0] = -pos[i][0];
+    }
+    domain_decomposition.migrateParticles();
+    EXPECT_EQ(domain_decomposition.HaloParticles(), UnsignedInt(0));
+    EXPECT_EQ(domain_decomposition.GlobalParticles(), total_particles);
+    Real global_id_sum = 0.0;
+    for (UnsignedInt i = 0; i != domain_decomposition.OwnedParticles(); ++i)
+    {
+        EXPECT_EQ(partition.OwnerRank(pos[i]), process_communicator.Rank());
+        EXPECT_EQ(rho[i], Real(global_id[i]));
+        global_id_sum += Real(global_id[i]);
+    }
+    EXPECT_NEAR(process_communicator.allReduceSum(global_id_sum),
+                0.5 * Real(total_particles) * Real(total_particles - 1), Eps);
+}
+
+TEST(test_common, domain_decomposition_with_computing_kernels)
+{
+    Real dp = 0.05;
+    BoundingBox system_domain_bounds(Vec2d(-2.0, -2.0), Vec2d(2.0, 2.0));
+    SPHSystem sph_system(system_domain_bounds, dp);
+    sph_system.setIOEnvironment();
+    Vec2d halfsize(1.0, 0.5);
+    Transform translation(Vec2d::Zero());
+
+    FluidBody fluid_body(sph_system, makeShared<TransformShape<GeometricShapeBox>>(translation, halfsize, "FluidBody"));
+    fluid_body.defineMaterial<WeaklyCompressibleFluid>(1.0, 10.0);
+    Ghost<ReserveSizeFactor> halo_ghost(0.5);
+    ParticleBuffer<ReserveSizeFactor> particle_buffer(0.5);
+    fluid_body.generateParticles<BaseParticles, Ghost<ReserveSizeFactor>, ParticleBuffer<ReserveSizeFactor>, Lattice>(
+        halo_ghost, particle_buffer);
+    fluid_body.getBaseParticles().addVariableToSort<Vecd>("Position");
+
+    DomainDecomposition domain_decomposition(fluid_body, halo_ghost);
+    domain_decomposition.initializePartition();
+    // the cell linked list updated by computing kernels does not see the halo particles
+    UpdateCellLinkedList<execution::ParallelPolicy, CellLinkedList> fluid_cell_linked_list(fluid_body);
+    fluid_cell_linked_list.exec();
+    EXPECT_EXIT(domain_decomposition.exchangeHaloParticles(), ::testing::ExitedWithCode(1), ".*");
+}
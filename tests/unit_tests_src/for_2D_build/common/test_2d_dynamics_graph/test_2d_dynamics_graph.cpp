@@ -0,0 +1,70 @@
+#include "sphinxsys.h"
+#include <gtest/gtest.h>
+
+#include <atomic>
+
+using namespace SPH;
+
+std::atomic<int> execution_counter(0);
+
+class OrderedDynamics : public BaseDynamics<void>
+{
+  public:
+    OrderedDynamics() : BaseDynamics<void>(){};
+    virtual void exec(Real dt = 0.0) override
+    {
+        order_ = execution_counter++;
+        dt_ = dt;
+    };
+    int order_ = -1;
+    Real dt_ = 0.0;
+};
+
+class ConstantTimeStep : public BaseDynamics<Real>
+{
+  public:
+    ConstantTimeStep() : BaseDynamics<Real>(){};
+    virtual Real exec(Real dt = 0.0) override
+    {
+        order_ = execution_counter++;
+        return 0.25;
+    };
+    int order_ = -1;
+};
+
+TEST(test_common, dynamics_graph)
+{
+    SingularVariable<Real> position("Position", 0.0);
+    SingularVariable<Real> velocity("Velocity", 0.0);
+    SingularVariable<Real> wall_position("WallPosition", 0.0);
+    OrderedDynamics update_position, wall_cell_linked_list, fluid_cell_linked_list, update_velocity;
+    ConstantTimeStep time_step;
+
+    DynamicsGraph dynamics_graph;
+    size_t update_position_node = dynamics_graph.addNode(update_position, {&velocity}, {&position});
+    size_t wall_cell_linked_list_node = dynamics_graph.addNode(wall_cell_linked_list, {&wall_position}, {});
+    size_t fluid_cell_linked_list_node = dynamics_graph.addNode(fluid_cell_linked_list, {&position}, {});
+    size_t time_step_node = dynamics_graph.addNode(time_step, {&velocity}, {});
+    size_t update_velocity_node = dynamics_graph.addNode(update_velocity, {&position, &wall_position}, {&velocity});
+
+    EXPECT_EQ(dynamics_graph.NumberOfNodes(), 5u);
+    EXPECT_TRUE(dynamics_graph.Predecessors(update_position_node).empty());
+    EXPECT_TRUE(dynamics_graph.Predecessors(wall_cell_linked_list_node).empty());
+    EXPECT_EQ(dynamics_graph.Predecessors(fluid_cell_linked_list_node), StdVec<size_t>{update_position_node});
+    EXPECT_TRUE(dynamics_graph.Predecessors(time_step_node).empty());
+    // last writer of position and the earlier readers of velocity
+    EXPECT_EQ(dynamics_graph.Predecessors(update_velocity_node),
+              (StdVec<size_t>{update_position_node, time_step_node}));
+    EXPECT_EQ(dynamics_graph.NumberOfEdges(), 3u);
+
+    for (size_t k = 0; k != 3; ++k)
+    {
+        dynamics_graph.exec(0.5);
+        EXPECT_LT(update_position.order_, fluid_cell_linked_list.order_);
+        EXPECT_LT(update_position.order_, update_velocity.order_);
+        EXPECT_LT(time_step.order_, update_velocity.order_);
+        EXPECT_EQ(execution_counter, int(5 * (k + 1)));
+    }
+    EXPECT_EQ(update_velocity.dt_, 0.5);
+    EXPECT_EQ(dynamics_graph.Result(time_step_node), 0.25);
+}
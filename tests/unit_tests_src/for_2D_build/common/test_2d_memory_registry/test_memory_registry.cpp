@@ -0,0 +1,77 @@
+#include "sphinxsys_ck.h"
+#include <gtest/gtest.h>
+
+using namespace SPH;
+
+TEST(test_common, memory_registry)
+{
+    Real dp = 0.1;
+    BoundingBox system_domain_bounds(Vec2d(-2.0, -2.0), Vec2d(2.0, 2.0));
+    SPHSystem sph_system(system_domain_bounds, dp);
+    Vec2d halfsize(1.0, 0.5);
+    Transform translation(Vec2d::Zero());
+
+    FluidBody fluid_body(sph_system, makeShared<TransformShape<GeometricShapeBox>>(translation, halfsize, "FluidBody"));
+    fluid_body.defineMaterial<WeaklyCompressibleFluid>(1.0, 10.0);
+    fluid_body.generateParticles<BaseParticles, Lattice>();
+    BaseParticles &particles = fluid_body.getBaseParticles();
+    UnsignedInt total_real_particles = particles.TotalRealParticles();
+
+    MemoryRegistry registry;
+    {
+        Relation<Inner<>> fluid_inner(fluid_body);
+        UpdateCellLinkedList<execution::ParallelPolicy, CellLinkedList> fluid_cell_linked_list(fluid_body);
+        UpdateRelation<execution::ParallelPolicy, Inner<>> fluid_update_relation(fluid_inner);
+        fluid_cell_linked_list.exec();
+        fluid_update_relation.exec();
+
+        sph_system.reportMemoryFootprint(registry);
+        registry.printTable();
+    }
+
+    EXPECT_EQ(registry.TotalRealParticles("FluidBody"), total_real_particles);
+    EXPECT_EQ(registry.CategoryBytes("FluidBody", "ParticleVariable"),
+              registry.TotalBytes("FluidBody") - registry.CategoryBytes("FluidBody", "ParticleReserve") -
+                  registry.CategoryBytes("FluidBody", "NeighborList") -
+                  registry.CategoryBytes("FluidBody", "CellLinkedList"));
+    EXPECT_GE(registry.CategoryBytes("FluidBody", "ParticleVariable"),
+              total_real_particles * (sizeof(Vecd) + 2 * sizeof(Real)));
+    EXPECT_GE(registry.CategoryBytes("FluidBody", "NeighborList"),
+              2 * (total_real_particles + 1) * sizeof(UnsignedInt));
+    EXPECT_GT(registry.CategoryBytes("FluidBody", "CellLinkedList"), 0);
+    EXPECT_NEAR(registry.BytesPerParticle("FluidBody"),
+                Real(registry.TotalBytes("FluidBody")) / Real(total_real_particles), Eps);
+
+    // the cell linked list arrays allocated as particle variables are reported once as mesh data
+    size_t cell_linked_list_arrays = 0;
+    for (auto &entry : registry.Entries())
+    {
+        if (entry.name_ == "ParticleIndex" || entry.name_ == "CellOffset")
+        {
+            EXPECT_EQ(entry.category_, "CellLinkedList");
+            cell_linked_list_arrays++;
+        }
+    }
+    EXPECT_EQ(cell_linked_list_arrays, 2);
+
+    // the format of the output stream is not changed by the table
+    std::ostringstream table;
+    table << std::scientific << std::setprecision(2);
+    registry.printTable(table);
+    EXPECT_EQ(table.flags() & std::ios_base::floatfield, std::ios_base::scientific);
+    EXPECT_EQ(table.precision(), 2);
+
+    // the relation is not reported anymore after its destruction
+    MemoryRegistry registry_without_relation;
+    sph_system.reportMemoryFootprint(registry_without_relation);
+    EXPECT_EQ(registry_without_relation.CategoryBytes("FluidBody", "NeighborList"), 0);
+
+    // a redefined body level-set shape replaces the previous one
+    SolidBody solid_body(sph_system, makeShared<TransformShape<GeometricShapeBox>>(translation, halfsize, "SolidBody"));
+    solid_body.defineBodyLevelSetShape();
+    solid_body.defineBodyLevelSetShape();
+    EXPECT_EQ(solid_body.level_set_shapes_.size(), 1);
+    MemoryRegistry registry_with_level_set;
+    sph_system.reportMemoryFootprint(registry_with_level_set);
+    EXPECT_GT(registry_with_level_set.CategoryBytes("SolidBody", "LevelSet"), 0);
+}
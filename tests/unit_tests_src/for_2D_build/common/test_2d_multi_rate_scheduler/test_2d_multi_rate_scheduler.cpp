@@ -0,0 +1,87 @@
+#include "sphinxsys.h"
+#include <gtest/gtest.h>
+
+using namespace SPH;
+
+class FixedTimeStep : public BaseDynamics<Real>
+{
+  public:
+    explicit FixedTimeStep(Real dt) : BaseDynamics<Real>(), dt_(dt){};
+    virtual Real exec(Real dt = 0.0) override { return dt_; };
+
+  protected:
+    Real dt_;
+};
+
+class RecordStep : public BaseDynamics<void>
+{
+  public:
+    explicit RecordStep(Vecd *coupling = nullptr) : BaseDynamics<void>(), coupling_(coupling){};
+    virtual void exec(Real dt = 0.0) override
+    {
+        time_steps_.push_back(dt);
+        if (coupling_ != nullptr)
+            coupling_values_.push_back(coupling_[0][0]);
+    };
+    StdVec<Real> time_steps_;
+    StdVec<Real> coupling_values_;
+
+  protected:
+    Vecd *coupling_;
+};
+
+TEST(test_common, multi_rate_scheduler)
+{
+    Real dp = 0.1;
+    BoundingBox system_domain_bounds(Vec2d(-2.0, -2.0), Vec2d(2.0, 2.0));
+    SPHSystem sph_system(system_domain_bounds, dp);
+    sph_system.setIOEnvironment();
+    Vec2d halfsize(0.5, 0.5);
+
+    FluidBody fluid_body(sph_system, makeShared<TransformShape<GeometricShapeBox>>(Transform(Vec2d(-1.0, 0.0)), halfsize, "FluidBody"));
+    fluid_body.defineMaterial<WeaklyCompressibleFluid>(1.0, 10.0);
+    fluid_body.generateParticles<BaseParticles, Lattice>();
+    SolidBody solid_body(sph_system, makeShared<TransformShape<GeometricShapeBox>>(Transform(Vec2d(1.0, 0.0)), halfsize, "SolidBody"));
+    solid_body.defineMaterial<Solid>();
+    solid_body.generateParticles<BaseParticles, Lattice>();
+    Vecd *force_from_fluid = solid_body.getBaseParticles().registerStateVariable<Vecd>("ForceFromFluid");
+
+    FixedTimeStep fluid_time_step(1.0);
+    FixedTimeStep solid_time_step(0.3);
+    RecordStep fluid_step;
+    RecordStep solid_step(force_from_fluid);
+    RecordStep solid_sync_start, solid_sync_end;
+    CouplingInterpolation<Vecd> force_from_fluid_interpolation(solid_body, "ForceFromFluid");
+
+    MultiRateScheduler multi_rate_scheduler;
+    multi_rate_scheduler.addBody(fluid_body, fluid_time_step).addStep(fluid_step);
+    multi_rate_scheduler.addBody(solid_body, solid_time_step)
+        .addSyncStart(solid_sync_start)
+        .addStep(solid_step)
+        .addSyncEnd(solid_sync_end)
+        .addInterpolation(force_from_fluid_interpolation);
+    //----------------------------------------------------------------------
+    //	The interval is the largest time step, sub-cycled by the solid.
+    //----------------------------------------------------------------------
+    EXPECT_NEAR(multi_rate_scheduler.exec(), 1.0, Eps);
+    ASSERT_EQ(fluid_step.time_steps_.size(), 1u);
+    EXPECT_NEAR(fluid_step.time_steps_[0], 1.0, Eps);
+    ASSERT_EQ(solid_step.time_steps_.size(), 4u);
+    EXPECT_NEAR(solid_step.time_steps_[3], 0.1, Eps);
+    EXPECT_NEAR(solid_sync_start.time_steps_[0], 1.0, Eps);
+    EXPECT_NEAR(solid_sync_end.time_steps_[0], 1.0, Eps);
+    EXPECT_EQ(multi_rate_scheduler.TotalSubSteps(), 5u);
+    EXPECT_EQ(multi_rate_scheduler.UniformSteps(), 8u);
+    //----------------------------------------------------------------------
+    //	Coupling force interpolated at the middle of the solid sub-steps.
+    //----------------------------------------------------------------------
+    for (size_t i = 0; i != solid_body.getBaseParticles().TotalRealParticles(); ++i)
+    {
+        force_from_fluid[i] = Vecd(1.0, 0.0);
+    }
+    EXPECT_NEAR(multi_rate_scheduler.exec(0.6), 0.6, Eps);
+    ASSERT_EQ(solid_step.coupling_values_.size(), 6u);
+    EXPECT_NEAR(solid_step.coupling_values_[4], 0.25, Eps);
+    EXPECT_NEAR(solid_step.coupling_values_[5], 0.75, Eps);
+    EXPECT_NEAR(force_from_fluid[0][0], 1.0, Eps);
+}
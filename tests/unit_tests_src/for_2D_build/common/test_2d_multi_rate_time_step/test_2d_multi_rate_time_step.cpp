@@ -0,0 +1,154 @@
+#include "sphinxsys.h"
+#include "sphinxsys_ck.h"
+#include <gtest/gtest.h>
+
+using namespace SPH;
+
+TEST(test_common, multi_rate_time_step)
+{
+    Real dp = 0.1;
+    BoundingBox system_domain_bounds(Vec2d(-2.0, -2.0), Vec2d(2.0, 2.0));
+    SPHSystem sph_system(system_domain_bounds, dp);
+    sph_system.setIOEnvironment();
+    Vec2d halfsize(1.0, 0.5);
+    Transform translation(Vec2d::Zero());
+
+    FluidBody fluid_body(sph_system, makeShared<TransformShape<GeometricShapeBox>>(translation, halfsize, "FluidBody"));
+    fluid_body.defineMaterial<WeaklyCompressibleFluid>(1.0, 10.0);
+    fluid_body.generateParticles<BaseParticles, Lattice>();
+    BaseParticles &particles = fluid_body.getBaseParticles();
+    UnsignedInt total_real_particles = particles.TotalRealParticles();
+    FluidBody legacy_body(sph_system, makeShared<TransformShape<GeometricShapeBox>>(translation, halfsize, "LegacyBody"));
+    legacy_body.defineMaterial<WeaklyCompressibleFluid>(1.0, 10.0);
+    legacy_body.generateParticles<BaseParticles, Lattice>();
+    BaseParticles &legacy_particles = legacy_body.getBaseParticles();
+
+    Relation<Inner<>> fluid_inner_ck(fluid_body);
+    InnerRelation fluid_inner(fluid_body);
+    InnerRelation legacy_inner(legacy_body);
+    UpdateCellLinkedList<execution::ParallelPolicy, CellLinkedList> fluid_cell_linked_list(fluid_body);
+    UpdateRelation<execution::ParallelPolicy, Inner<>> fluid_update_relation(fluid_inner_ck);
+    StateDynamics<execution::ParallelPolicy, fluid_dynamics::AdvectionStepSetup> fluid_advection_step_setup(fluid_body);
+
+    MultiRateTimeStepCK<execution::ParallelPolicy, fluid_dynamics::AcousticTimeStepCK> multi_rate_time_step(fluid_inner_ck, 3);
+    using AcousticStep1stHalfInner = fluid_dynamics::AcousticStep1stHalf<Inner<OneLevel, AcousticRiemannSolver, NoKernelCorrectionCK>>;
+    using AcousticStep2ndHalfInner = fluid_dynamics::AcousticStep2ndHalf<Inner<OneLevel, AcousticRiemannSolver, NoKernelCorrectionCK>>;
+    MultiRateInteractionDynamicsCK<execution::ParallelPolicy, AcousticStep1stHalfInner>
+        fluid_acoustic_step_1st_half(multi_rate_time_step, fluid_inner_ck);
+    MultiRateInteractionDynamicsCK<execution::ParallelPolicy, AcousticStep2ndHalfInner>
+        fluid_acoustic_step_2nd_half(multi_rate_time_step, fluid_inner_ck);
+    MultiRateTimeStep<fluid_dynamics::AcousticTimeStep> multi_rate_time_step_legacy(legacy_inner, 3);
+    MultiRateDynamics1Level<fluid_dynamics::Integration1stHalfInnerRiemann>
+        legacy_pressure_relaxation(multi_rate_time_step_legacy, legacy_inner);
+    //----------------------------------------------------------------------
+    //	Fast particles on the right hand side.
+    //----------------------------------------------------------------------
+    Vecd *pos = particles.getVariableDataByName<Vecd>("Position");
+    Vecd *vel = particles.getVariableDataByName<Vecd>("Velocity");
+    StorageReal *rho = particles.getVariableDataByName<StorageReal>("Density");
+    Vecd *legacy_pos = legacy_particles.getVariableDataByName<Vecd>("Position");
+    Vecd *legacy_vel = legacy_particles.getVariableDataByName<Vecd>("Velocity");
+    for (size_t i = 0; i != total_real_particles; ++i)
+    {
+        vel[i] = Vecd(30.0 * SMAX(pos[i][0], Real(0)), 0.0);
+        legacy_vel[i] = vel[i];
+    }
+    fluid_cell_linked_list.exec();
+    fluid_update_relation.exec();
+    fluid_body.updateCellLinkedList();
+    fluid_inner.updateConfiguration();
+    legacy_body.updateCellLinkedList();
+    legacy_inner.updateConfiguration();
+    fluid_advection_step_setup.exec();
+
+    Real sync_dt = multi_rate_time_step.exec(1.0);
+    Real dt_min = multi_rate_time_step.SmallestTimeStep();
+    EXPECT_EQ(multi_rate_time_step.NumberOfSubSteps(), 8u);
+    EXPECT_NEAR(sync_dt, 8.0 * dt_min, Eps);
+    EXPECT_NEAR(dt_min, fluid_dynamics::AcousticTimeStepCK(fluid_body).outputResult(10.0 + 30.0 * 0.95), Eps);
+    EXPECT_EQ(multi_rate_time_step.exec(dt_min * 2.5), 2.0 * dt_min);
+
+    multi_rate_time_step.exec(1.0);
+    UnsignedInt *time_step_level = multi_rate_time_step.dvTimeStepLevel()->Data();
+    size_t number_of_level_1 = 0;
+    for (size_t i = 0; i != total_real_particles; ++i)
+    {
+        UnsignedInt expected_level = 10.0 + 30.0 * SMAX(pos[i][0], Real(0)) > 0.5 * (10.0 + 30.0 * 0.95) ? 0 : 1;
+        EXPECT_EQ(time_step_level[i], expected_level);
+        number_of_level_1 += time_step_level[i];
+    }
+    Real expected_speedup = 8.0 * Real(total_real_particles) /
+                            (8.0 * Real(total_real_particles - number_of_level_1) + 4.0 * Real(number_of_level_1));
+    EXPECT_NEAR(multi_rate_time_step.EffectiveSpeedup(), expected_speedup, Eps);
+    EXPECT_GT(multi_rate_time_step.EffectiveSpeedup(), 1.0);
+
+    EXPECT_NEAR(multi_rate_time_step_legacy.exec(1.0), sync_dt, Eps);
+    EXPECT_NEAR(multi_rate_time_step_legacy.EffectiveSpeedup(), expected_speedup, Eps);
+    UnsignedInt *legacy_time_step_level = multi_rate_time_step_legacy.dvTimeStepLevel()->Data();
+    for (size_t i = 0; i != total_real_particles; ++i)
+    {
+        EXPECT_EQ(legacy_time_step_level[i], time_step_level[i]);
+    }
+    //----------------------------------------------------------------------
+    //	Only the particles at level 0 are integrated at the sub-step 1,
+    //	and the others drift to the end of the sub-step.
+    //----------------------------------------------------------------------
+    StdVec<Vecd> pos_0(pos, pos + total_real_particles);
+    StdVec<Real> rho_0(rho, rho + total_real_particles);
+    StdVec<Vecd> legacy_pos_0(legacy_pos, legacy_pos + total_real_particles);
+    multi_rate_time_step.setSubStep(1);
+    fluid_acoustic_step_1st_half.exec();
+    fluid_acoustic_step_2nd_half.exec();
+    StdVec<Vecd> pos_1(pos, pos + total_real_particles);
+    multi_rate_time_step.endSubStep();
+    multi_rate_time_step_legacy.setSubStep(1);
+    legacy_pressure_relaxation.exec();
+    multi_rate_time_step_legacy.endSubStep();
+    for (size_t i = 0; i != total_real_particles; ++i)
+    {
+        if (time_step_level[i] == 0)
+        {
+            EXPECT_GT((pos[i] - pos_0[i]).norm(), 0.0);
+            EXPECT_EQ(pos[i], pos_1[i]);
+        }
+        else
+        {
+            EXPECT_NEAR((pos[i] - pos_0[i] - vel[i] * dt_min).norm(), 0.0, Eps);
+            EXPECT_NEAR((legacy_pos[i] - legacy_pos_0[i] - legacy_vel[i] * dt_min).norm(), 0.0, Eps);
+            EXPECT_EQ(rho[i], rho_0[i]);
+        }
+    }
+    //----------------------------------------------------------------------
+    //	The levels of the slow particles next to the fast ones are limited by their neighbors.
+    //----------------------------------------------------------------------
+    for (size_t i = 0; i != total_real_particles; ++i)
+    {
+        vel[i] = Vecd(pos[i][0] > 0.5 ? 300.0 : 0.0, 0.0);
+        legacy_vel[i] = Vecd(legacy_pos[i][0] > 0.5 ? 300.0 : 0.0, 0.0);
+    }
+    fluid_cell_linked_list.exec();
+    fluid_update_relation.exec();
+    fluid_body.updateCellLinkedList();
+    fluid_inner.updateConfiguration();
+    legacy_body.updateCellLinkedList();
+    legacy_inner.updateConfiguration();
+    multi_rate_time_step.exec(1.0);
+    multi_rate_time_step_legacy.exec(1.0);
+    StdVec<std::pair<UnsignedInt *, InnerRelation *>> limited_levels = {
+        {time_step_level, &fluid_inner}, {legacy_time_step_level, &legacy_inner}};
+    for (auto &limited_level : limited_levels)
+    {
+        UnsignedInt *level = limited_level.first;
+        UnsignedInt max_level = 0;
+        for (size_t i = 0; i != total_real_particles; ++i)
+        {
+            const Neighborhood &inner_neighborhood = limited_level.second->inner_configuration_[i];
+            for (size_t n = 0; n != inner_neighborhood.current_size_; ++n)
+            {
+                EXPECT_LE(level[i], level[inner_neighborhood.j_[n]] + 1);
+            }
+            max_level = SMAX(max_level, level[i]);
+        }
+        EXPECT_EQ(max_level, 3u);
+    }
+}
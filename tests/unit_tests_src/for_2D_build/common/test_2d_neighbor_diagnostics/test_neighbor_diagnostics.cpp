@@ -0,0 +1,51 @@
+#include "sphinxsys.h"
+#include "sphinxsys_ck.h"
+#include <gtest/gtest.h>
+
+using namespace SPH;
+
+TEST(test_common, neighbor_diagnostics)
+{
+    Real dp = 0.1;
+    BoundingBox system_domain_bounds(Vec2d(-2.0, -2.0), Vec2d(2.0, 2.0));
+    SPHSystem sph_system(system_domain_bounds, dp);
+    sph_system.setIOEnvironment();
+    Vec2d halfsize(1.0, 0.5);
+    Transform translation(Vec2d::Zero());
+
+    FluidBody fluid_body(sph_system, makeShared<TransformShape<GeometricShapeBox>>(translation, halfsize, "FluidBody"));
+    fluid_body.defineMaterial<WeaklyCompressibleFluid>(1.0, 10.0);
+    fluid_body.generateParticles<BaseParticles, Lattice>();
+    UnsignedInt total_real_particles = fluid_body.getBaseParticles().TotalRealParticles();
+
+    InnerRelation fluid_inner(fluid_body);
+    fluid_body.updateCellLinkedList();
+    fluid_inner.updateConfiguration();
+    NeighborDiagnosticsRecording neighbor_diagnostics(fluid_inner);
+    neighbor_diagnostics.writeToFile(0);
+
+    Relation<Inner<>> fluid_inner_ck(fluid_body);
+    UpdateCellLinkedList<execution::ParallelPolicy, CellLinkedList> fluid_cell_linked_list(fluid_body);
+    UpdateRelation<execution::ParallelPolicy, Inner<>> fluid_update_relation(fluid_inner_ck);
+    fluid_cell_linked_list.exec();
+    fluid_update_relation.exec();
+    NeighborDiagnosticsRecordingCK<execution::ParallelPolicy> neighbor_diagnostics_ck(fluid_inner_ck);
+    neighbor_diagnostics_ck.writeToFile(0);
+
+    CountStatistics &neighbors = neighbor_diagnostics.NeighborStatistics();
+    CountStatistics &neighbors_ck = neighbor_diagnostics_ck.NeighborStatistics();
+    EXPECT_EQ(neighbors.NumberOfSamples(), total_real_particles);
+    EXPECT_LT(neighbors.MinCount(), neighbors.MaxCount());
+    EXPECT_EQ(neighbors.MinCount(), neighbors_ck.MinCount());
+    EXPECT_EQ(neighbors.MaxCount(), neighbors_ck.MaxCount());
+    EXPECT_NEAR(neighbors.MeanCount(), neighbors_ck.MeanCount(), Eps);
+    EXPECT_EQ(neighbors.Histogram(), neighbors_ck.Histogram());
+
+    CountStatistics &cells = neighbor_diagnostics.CellOccupancyStatistics();
+    CountStatistics &cells_ck = neighbor_diagnostics_ck.CellOccupancyStatistics();
+    EXPECT_NEAR(cells.MeanCount() * Real(cells.NumberOfSamples()), Real(total_real_particles), Eps);
+    EXPECT_EQ(cells.NumberOfSamples(), cells_ck.NumberOfSamples());
+    EXPECT_EQ(cells.Histogram(), cells_ck.Histogram());
+
+    EXPECT_GE(neighbor_diagnostics.ThreadWorkImbalance(), 1.0 - Eps);
+}
@@ -0,0 +1,70 @@
+#include "sphinxsys.h"
+#include "sphinxsys_ck.h"
+#include <gtest/gtest.h>
+
+using namespace SPH;
+
+TEST(test_common, periodic_wrapping)
+{
+    BoundingBox periodic_bounds(Vec2d(-1.0, -0.5), Vec2d(1.0, 0.5));
+    PeriodicWrapping periodic_wrapping;
+    EXPECT_FALSE(periodic_wrapping.isPeriodic());
+    periodic_wrapping.setPeriodicAxis(periodic_bounds, xAxis);
+    periodic_wrapping.setPeriodicAxis(periodic_bounds, yAxis);
+    EXPECT_TRUE(periodic_wrapping.isPeriodic());
+
+    EXPECT_NEAR((periodic_wrapping.minimumImage(Vec2d(1.9, -0.8)) - Vec2d(-0.1, 0.2)).norm(), 0.0, Eps);
+    EXPECT_NEAR((periodic_wrapping.wrapPosition(Vec2d(1.1, -0.6)) - Vec2d(-0.9, 0.4)).norm(), 0.0, Eps);
+
+    UnsignedInt number_of_images = 0;
+    periodic_wrapping.forEachImage(Vec2d(0.95, 0.45), 0.1, [&](const Vecd &image)
+                                   { number_of_images++; });
+    EXPECT_EQ(number_of_images, 4);
+}
+
+TEST(test_common, periodic_neighbor_search)
+{
+    Real dp = 0.1;
+    BoundingBox system_domain_bounds(Vec2d(-2.0, -2.0), Vec2d(2.0, 2.0));
+    SPHSystem sph_system(system_domain_bounds, dp);
+    sph_system.setIOEnvironment();
+    Vec2d halfsize(1.0, 0.5);
+    Transform translation(Vec2d::Zero());
+    BoundingBox periodic_bounds(-halfsize, halfsize);
+
+    FluidBody fluid_body(sph_system, makeShared<TransformShape<GeometricShapeBox>>(translation, halfsize, "FluidBody"));
+    fluid_body.defineMaterial<WeaklyCompressibleFluid>(1.0, 10.0);
+    fluid_body.generateParticles<BaseParticles, Lattice>();
+    CellLinkedList &cell_linked_list = DynamicCast<CellLinkedList>(&fluid_body, fluid_body.getCellLinkedList());
+    cell_linked_list.setPeriodicAxis(periodic_bounds, xAxis);
+    cell_linked_list.setPeriodicAxis(periodic_bounds, yAxis);
+
+    InnerRelation fluid_inner(fluid_body);
+    fluid_body.updateCellLinkedList();
+    fluid_inner.updateConfiguration();
+    NeighborDiagnosticsRecording neighbor_diagnostics(fluid_inner);
+
+    Relation<Inner<>> fluid_inner_ck(fluid_body);
+    UpdateCellLinkedList<execution::ParallelPolicy, CellLinkedList> fluid_cell_linked_list(fluid_body);
+    UpdateRelation<execution::ParallelPolicy, Inner<>> fluid_update_relation(fluid_inner_ck);
+    fluid_cell_linked_list.exec();
+    fluid_update_relation.exec();
+    NeighborDiagnosticsRecordingCK<execution::ParallelPolicy> neighbor_diagnostics_ck(fluid_inner_ck);
+
+    // with periodicity along both axes, all particles of the lattice have the same number of neighbors
+    CountStatistics &neighbors = neighbor_diagnostics.NeighborStatistics();
+    CountStatistics &neighbors_ck = neighbor_diagnostics_ck.NeighborStatistics();
+    EXPECT_EQ(neighbors.MinCount(), neighbors.MaxCount());
+    EXPECT_EQ(neighbors_ck.MinCount(), neighbors_ck.MaxCount());
+    EXPECT_EQ(neighbors.MaxCount(), neighbors_ck.MaxCount());
+
+    // the displacement of a pair across the bound is given by the nearest image
+    Vecd *pos = fluid_body.getBaseParticles().ParticlePositions();
+    Neighborhood &corner_neighborhood = fluid_inner.inner_configuration_[0];
+    for (size_t n = 0; n != corner_neighborhood.current_size_; ++n)
+    {
+        size_t index_j = corner_neighborhood.j_[n];
+        Vecd displacement = cell_linked_list.getPeriodicWrapping().minimumImage(pos[0] - pos[index_j]);
+        EXPECT_NEAR(corner_neighborhood.r_ij_[n], displacement.norm(), Eps);
+    }
+}
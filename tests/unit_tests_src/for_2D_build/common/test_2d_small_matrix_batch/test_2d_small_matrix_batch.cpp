@@ -0,0 +1,115 @@
+#include "sphinxsys.h"
+#include <gtest/gtest.h>
+#include <random>
+
+using namespace SPH;
+
+std::mt19937 random_engine(42);
+std::uniform_real_distribution<Real> random_real(-1.0, 1.0);
+
+Mat3d randomMatrix(Real scale)
+{
+    Mat3d matrix;
+    for (int i = 0; i != 3; ++i)
+        for (int j = 0; j != 3; ++j)
+            matrix(i, j) = scale * random_real(random_engine);
+    return matrix;
+}
+
+TEST(test_common, small_matrix_batch_algebra)
+{
+    Mat3d matrices[BatchLanes];
+    for (UnsignedInt l = 0; l != BatchLanes; ++l)
+        matrices[l] = Mat3d::Identity() + randomMatrix(0.3);
+
+    MatrixBatch<3> batch;
+    batch.load(matrices, 0, BatchLanes);
+    RealBatch determinant = batch.determinant();
+    MatrixBatch<3> inverse = batch.inverse();
+    MatrixBatch<3> rotation, stretch;
+    polarDecomposition(batch, rotation, stretch);
+    for (UnsignedInt l = 0; l != BatchLanes; ++l)
+    {
+        EXPECT_NEAR(determinant[l], matrices[l].determinant(), 1.0e-12);
+        EXPECT_NEAR((inverse.lane(l) - matrices[l].inverse()).norm(), 0.0, 1.0e-12);
+        // rotation is orthogonal and the stretch is symmetric
+        EXPECT_NEAR((rotation.lane(l) * rotation.lane(l).transpose() - Mat3d::Identity()).norm(), 0.0, 1.0e-10);
+        EXPECT_NEAR((stretch.lane(l) - stretch.lane(l).transpose()).norm(), 0.0, 1.0e-12);
+        EXPECT_NEAR((rotation.lane(l) * stretch.lane(l) - matrices[l]).norm(), 0.0, 1.0e-10);
+    }
+
+    // the lanes beyond the given number are identity
+    batch.load(matrices, 0, 1);
+    EXPECT_NEAR((batch.lane(BatchLanes - 1) - Mat3d::Identity()).norm(), 0.0, Eps);
+
+    Mat2d matrix_2d = Mat2d::Identity() + randomMatrix(0.3).block<2, 2>(0, 0);
+    MatrixBatch<2> batch_2d;
+    batch_2d.load(&matrix_2d, 0, 1);
+    EXPECT_NEAR(batch_2d.determinant()[0], matrix_2d.determinant(), 1.0e-12);
+    EXPECT_NEAR((batch_2d.inverse().lane(0) - matrix_2d.inverse()).norm(), 0.0, 1.0e-12);
+}
+
+TEST(test_common, small_matrix_batch_symmetric_eigen)
+{
+    Mat3d matrices[BatchLanes];
+    for (UnsignedInt l = 0; l != BatchLanes; ++l)
+    {
+        Mat3d random_matrix = randomMatrix(1.0);
+        matrices[l] = random_matrix + random_matrix.transpose();
+    }
+    matrices[0] = Mat3d::Identity(); // already diagonal
+
+    MatrixBatch<3> batch, eigenvectors;
+    batch.load(matrices, 0, BatchLanes);
+    RealBatch eigenvalues[3];
+    symmetricEigenDecomposition(batch, eigenvectors, eigenvalues);
+    for (UnsignedInt l = 0; l != BatchLanes; ++l)
+    {
+        Mat3d V = eigenvectors.lane(l);
+        Mat3d D = Vec3d(eigenvalues[0][l], eigenvalues[1][l], eigenvalues[2][l]).asDiagonal();
+        EXPECT_NEAR((V * D * V.transpose() - matrices[l]).norm(), 0.0, 1.0e-10);
+        EXPECT_NEAR((V * V.transpose() - Mat3d::Identity()).norm(), 0.0, 1.0e-10);
+    }
+}
+
+TEST(test_common, small_matrix_batch_constitutive_kernels)
+{
+    PlasticContinuum soil(2040.0, 1.0e3, 5.98e6, 0.3, 30.0 * Pi / 180.0, 1.0e3);
+    PlasticContinuum::PlasticKernel plastic_kernel(soil);
+    Mat3d velocity_gradients[BatchLanes], stress_tensors[BatchLanes];
+    for (UnsignedInt l = 0; l != BatchLanes; ++l)
+    {
+        velocity_gradients[l] = randomMatrix(1.0);
+        // from compression to tension, so that all branches of the return mapping are visited
+        Real pressure = 2.0e4 * (1.0 - 2.0 * Real(l) / Real(BatchLanes));
+        stress_tensors[l] = -pressure * Mat3d::Identity() + randomMatrix(1.0e4);
+        stress_tensors[l] = 0.5 * (stress_tensors[l] + stress_tensors[l].transpose()).eval();
+    }
+
+    MatrixBatch<3> velocity_gradient, stress_tensor;
+    velocity_gradient.load(velocity_gradients, 0, BatchLanes);
+    stress_tensor.load(stress_tensors, 0, BatchLanes);
+    MatrixBatch<3> stress_rate = plastic_kernel.ConstitutiveRelation(velocity_gradient, stress_tensor);
+    MatrixBatch<3> mapped_stress = plastic_kernel.ReturnMapping(stress_tensor);
+    for (UnsignedInt l = 0; l != BatchLanes; ++l)
+    {
+        Mat3d expected_rate = plastic_kernel.ConstitutiveRelation(velocity_gradients[l], stress_tensors[l]);
+        Mat3d expected_stress = plastic_kernel.ReturnMapping(stress_tensors[l]);
+        EXPECT_NEAR((stress_rate.lane(l) - expected_rate).norm(), 0.0, 1.0e-9 * expected_rate.norm());
+        EXPECT_NEAR((mapped_stress.lane(l) - expected_stress).norm(), 0.0, 1.0e-9 * expected_stress.norm());
+    }
+
+    NeoHookeanSolid neo_hookean(1100.0, 1.7e7, 0.45);
+    NeoHookeanSolid::ConstituteKernel constitute(neo_hookean);
+    Mat2d deformations[BatchLanes];
+    for (UnsignedInt l = 0; l != BatchLanes; ++l)
+        deformations[l] = Mat2d::Identity() + randomMatrix(0.2).block<2, 2>(0, 0);
+    MatrixBatch<2> deformation;
+    deformation.load(deformations, 0, BatchLanes);
+    MatrixBatch<2> stress_PK1 = constitute.StressPK1(deformation);
+    for (UnsignedInt l = 0; l != BatchLanes; ++l)
+    {
+        Mat2d expected_stress = constitute.StressPK1(deformations[l], l);
+        EXPECT_NEAR((stress_PK1.lane(l) - expected_stress).norm(), 0.0, 1.0e-9 * expected_stress.norm());
+    }
+}
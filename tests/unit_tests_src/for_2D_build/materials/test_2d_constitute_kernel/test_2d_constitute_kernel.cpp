@@ -0,0 +1,209 @@
+#include "sphinxsys.h"
+#include <gtest/gtest.h>
+#include <random>
+
+using namespace SPH;
+
+std::mt19937 random_engine(42);
+std::uniform_real_distribution<Real> random_real(-1.0, 1.0);
+
+Mat2d randomDeformation(Real scale)
+{
+    Mat2d deformation = Mat2d::Identity();
+    for (int i = 0; i != 2; ++i)
+        for (int j = 0; j != 2; ++j)
+            deformation(i, j) += scale * random_real(random_engine);
+    return deformation;
+}
+//----------------------------------------------------------------------
+//	Reference constitutive relations written out explicitly.
+//----------------------------------------------------------------------
+Mat2d linearPK2(Real lambda, Real G, const Mat2d &F)
+{
+    Mat2d strain = 0.5 * (F.transpose() + F) - Mat2d::Identity();
+    return lambda * strain.trace() * Mat2d::Identity() + 2.0 * G * strain;
+}
+
+Mat2d saintVenantKirchhoffPK2(Real lambda, Real G, const Mat2d &F)
+{
+    Mat2d strain = 0.5 * (F.transpose() * F - Mat2d::Identity());
+    return lambda * strain.trace() * Mat2d::Identity() + 2.0 * G * strain;
+}
+
+Mat2d neoHookeanPK2(Real lambda, Real G, const Mat2d &F)
+{
+    Mat2d right_cauchy = F.transpose() * F;
+    Real J = F.determinant();
+    return G * Mat2d::Identity() + (lambda * (J - 1.0) - G) * J * right_cauchy.inverse();
+}
+
+Mat2d neoHookeanCauchy(Real K, Real G, const Mat2d &almansi_strain)
+{
+    Mat2d B = (-2.0 * almansi_strain + Mat2d::Identity()).inverse();
+    Real J = sqrt(B.determinant());
+    return 0.5 * K * (J - 1.0 / J) * Mat2d::Identity() +
+           G * pow(J, -2.0 * 0.5 - 1.0) * (B - 0.5 * B.trace() * Mat2d::Identity());
+}
+
+Mat2d musclePK2(Real lambda, const Vec2d &f0, const Vec2d &s0, const Real (&a0)[4], const Real (&b0)[4], const Mat2d &F)
+{
+    Mat2d right_cauchy = F.transpose() * F;
+    Real I_ff_1 = (right_cauchy * f0).dot(f0) - 1.0;
+    Real I_ss_1 = (right_cauchy * s0).dot(s0) - 1.0;
+    Real I_fs = (right_cauchy * f0).dot(s0);
+    Real I_1_1 = right_cauchy.trace() - 2.0;
+    Real J = F.determinant();
+    return a0[0] * exp(b0[0] * I_1_1) * Mat2d::Identity() +
+           (lambda * (J - 1.0) - a0[0]) * J * right_cauchy.inverse() +
+           2.0 * a0[1] * I_ff_1 * exp(b0[1] * I_ff_1 * I_ff_1) * f0 * f0.transpose() +
+           2.0 * a0[2] * I_ss_1 * exp(b0[2] * I_ss_1 * I_ss_1) * s0 * s0.transpose() +
+           a0[3] * I_fs * exp(b0[3] * I_fs * I_fs) * (f0 * s0.transpose() + s0 * f0.transpose());
+}
+
+Mat2d hardeningElasticLeftCauchy(Real G, Real yield_stress, Real hardening_modulus, const Mat2d &F,
+                                 Mat2d &inverse_plastic_strain, Real &hardening_parameter)
+{
+    Real sqrt_2_over_3 = sqrt(2.0 / 3.0);
+    Mat2d be = F * inverse_plastic_strain * F.transpose();
+    Mat2d normalized_be = be * pow(be.determinant(), -0.5);
+    Real normalized_be_isentropic = normalized_be.trace() * 0.5;
+    Mat2d deviatoric_Kirchhoff = G * (normalized_be - normalized_be_isentropic * Mat2d::Identity());
+    Real deviatoric_Kirchhoff_norm = deviatoric_Kirchhoff.norm();
+    Real trial_function = deviatoric_Kirchhoff_norm -
+                          sqrt_2_over_3 * (hardening_modulus * hardening_parameter + yield_stress);
+    if (trial_function > 0.0)
+    {
+        Real renormalized_shear_modulus = normalized_be_isentropic * G;
+        Real relax_increment = 0.5 * trial_function / (renormalized_shear_modulus + hardening_modulus / 3.0);
+        hardening_parameter += sqrt_2_over_3 * relax_increment;
+        deviatoric_Kirchhoff -= 2.0 * renormalized_shear_modulus * relax_increment * deviatoric_Kirchhoff / deviatoric_Kirchhoff_norm;
+        Mat2d relaxed_be = deviatoric_Kirchhoff / G + normalized_be_isentropic * Mat2d::Identity();
+        normalized_be = relaxed_be * pow(relaxed_be.determinant(), -0.5);
+    }
+    Mat2d inverse_F = F.inverse();
+    inverse_plastic_strain = inverse_F * normalized_be * inverse_F.transpose();
+    return normalized_be;
+}
+//----------------------------------------------------------------------
+//	Virtual methods, scalar and batched kernels against the references.
+//----------------------------------------------------------------------
+TEST(test_materials, elastic_constitute_kernels)
+{
+    Real rho0 = 1.0, E = 1.0e3, nu = 0.3;
+    Real lambda = E * nu / (1.0 + nu) / (1.0 - 2.0 * nu);
+    Real G = 0.5 * E / (1.0 + nu);
+    Real K = E / 3.0 / (1.0 - 2.0 * nu);
+    LinearElasticSolid linear_elastic(rho0, E, nu);
+    SaintVenantKirchhoffSolid saint_venant_kirchhoff(rho0, E, nu);
+    NeoHookeanSolid neo_hookean(rho0, E, nu);
+    LinearElasticSolid::ConstituteKernel linear_elastic_kernel(linear_elastic);
+    SaintVenantKirchhoffSolid::ConstituteKernel saint_venant_kirchhoff_kernel(saint_venant_kirchhoff);
+    NeoHookeanSolid::ConstituteKernel neo_hookean_kernel(neo_hookean);
+    ElasticSolid::ConstituteKernel virtual_kernel(neo_hookean);
+
+    Real a0[4] = {0.059, 0.0, 0.0, 0.0};
+    Real b0[4] = {8.023, 0.0, 0.0, 0.0};
+    a0[1] = 18.472;
+    b0[1] = 16.026;
+    a0[3] = 0.216;
+    b0[3] = 11.436;
+    Vec2d f0 = Vec2d(1.0, 1.0).normalized();
+    Vec2d s0 = Vec2d(-1.0, 1.0).normalized();
+    Muscle muscle(rho0, 100.0, f0, s0, a0, b0);
+    Muscle::ConstituteKernel muscle_kernel(muscle);
+    Real muscle_E = muscle.LinearElasticSolid::getYoungsModulus();
+    Real muscle_nu = muscle.LinearElasticSolid::getPoissonRatio();
+    Real muscle_lambda = muscle_E * muscle_nu / (1.0 + muscle_nu) / (1.0 - 2.0 * muscle_nu);
+
+    Mat2d deformations[BatchLanes];
+    for (UnsignedInt l = 0; l != BatchLanes; ++l)
+        deformations[l] = randomDeformation(0.2);
+    MatrixBatch<2> deformation_batch;
+    deformation_batch.load(deformations, 0, BatchLanes);
+    MatrixBatch<2> linear_pk1_batch = linear_elastic_kernel.StressPK1(deformation_batch);
+    MatrixBatch<2> svk_pk1_batch = saint_venant_kirchhoff_kernel.StressPK1(deformation_batch);
+    MatrixBatch<2> neo_hookean_pk1_batch = neo_hookean_kernel.StressPK1(deformation_batch);
+
+    for (UnsignedInt l = 0; l != BatchLanes; ++l)
+    {
+        Mat2d F = deformations[l];
+        Real tolerance = 1.0e-9 * E;
+        Mat2d expected = F * linearPK2(lambda, G, F);
+        EXPECT_NEAR((linear_elastic.StressPK1(F, l) - expected).norm(), 0.0, tolerance);
+        EXPECT_NEAR((linear_elastic_kernel.StressPK1(F, l) - expected).norm(), 0.0, tolerance);
+        EXPECT_NEAR((linear_pk1_batch.lane(l) - expected).norm(), 0.0, tolerance);
+
+        expected = F * saintVenantKirchhoffPK2(lambda, G, F);
+        EXPECT_NEAR((saint_venant_kirchhoff.StressPK1(F, l) - expected).norm(), 0.0, tolerance);
+        EXPECT_NEAR((saint_venant_kirchhoff_kernel.StressPK1(F, l) - expected).norm(), 0.0, tolerance);
+        EXPECT_NEAR((svk_pk1_batch.lane(l) - expected).norm(), 0.0, tolerance);
+
+        expected = F * neoHookeanPK2(lambda, G, F);
+        EXPECT_NEAR((neo_hookean.StressPK1(F, l) - expected).norm(), 0.0, tolerance);
+        EXPECT_NEAR((neo_hookean_kernel.StressPK1(F, l) - expected).norm(), 0.0, tolerance);
+        EXPECT_NEAR((neo_hookean_pk1_batch.lane(l) - expected).norm(), 0.0, tolerance);
+        EXPECT_NEAR((virtual_kernel.StressPK1(F, l) - expected).norm(), 0.0, tolerance);
+
+        Mat2d dF_dt = randomDeformation(0.2) - Mat2d::Identity();
+        Real smoothing_length = 0.13;
+        Mat2d damping = neo_hookean.NumericalDampingLeftCauchy(F, dF_dt, smoothing_length, l);
+        EXPECT_NEAR((neo_hookean_kernel.NumericalDampingLeftCauchy(F, dF_dt, smoothing_length, l) - damping).norm(), 0.0, tolerance);
+        EXPECT_NEAR((virtual_kernel.NumericalDampingLeftCauchy(F, dF_dt, smoothing_length, l) - damping).norm(), 0.0, tolerance);
+
+        Mat2d almansi_strain = 0.5 * (Mat2d::Identity() - (F * F.transpose()).inverse());
+        expected = neoHookeanCauchy(K, G, almansi_strain);
+        EXPECT_NEAR((neo_hookean.StressCauchy(almansi_strain, l) - expected).norm(), 0.0, tolerance);
+        EXPECT_NEAR((neo_hookean_kernel.StressCauchy(almansi_strain, l) - expected).norm(), 0.0, tolerance);
+
+        Real J = F.determinant();
+        EXPECT_NEAR(linear_elastic.VolumetricKirchhoff(J), K * J * (J - 1.0), tolerance);
+        EXPECT_NEAR(neo_hookean.VolumetricKirchhoff(J), 0.5 * K * (J * J - 1.0), tolerance);
+        EXPECT_NEAR(neo_hookean_kernel.VolumetricKirchhoff(J), 0.5 * K * (J * J - 1.0), tolerance);
+
+        expected = musclePK2(muscle_lambda, f0, s0, a0, b0, F);
+        Real muscle_tolerance = 1.0e-9 * SMAX(Real(1), expected.norm());
+        EXPECT_NEAR((muscle.StressPK1(F, l) - F * expected).norm(), 0.0, muscle_tolerance);
+        EXPECT_NEAR((muscle_kernel.StressPK1(F, l) - F * expected).norm(), 0.0, muscle_tolerance);
+    }
+}
+
+TEST(test_materials, plastic_constitute_kernels)
+{
+    Real dp = 0.1;
+    BoundingBox system_domain_bounds(Vec2d(-1.0, -1.0), Vec2d(1.0, 1.0));
+    SPHSystem sph_system(system_domain_bounds, dp);
+    sph_system.setIOEnvironment();
+    Real rho0 = 1.0, E = 1.0e3, nu = 0.3, yield_stress = 1.0, hardening_modulus = 10.0;
+    Real G = 0.5 * E / (1.0 + nu);
+    Vec2d halfsize(0.5, 0.5);
+    Transform translation(Vec2d::Zero());
+    SolidBody plastic_body(sph_system, makeShared<TransformShape<GeometricShapeBox>>(translation, halfsize, "PlasticBody"));
+    HardeningPlasticSolid *plastic_solid =
+        plastic_body.defineMaterial<HardeningPlasticSolid>(rho0, E, nu, yield_stress, hardening_modulus);
+    plastic_body.generateParticles<BaseParticles, Lattice>();
+    BaseParticles &particles = plastic_body.getBaseParticles();
+    Mat2d *inverse_plastic_strain = particles.getVariableDataByName<Mat2d>("InversePlasticRightCauchyStrain");
+    Real *hardening_parameter = particles.getVariableDataByName<Real>("HardeningParameter");
+    HardeningPlasticSolid::ConstituteKernel plastic_kernel(*plastic_solid);
+
+    // the virtual method and the kernel update the same plastic state on alternating particles
+    UnsignedInt total_real_particles = particles.TotalRealParticles();
+    StdVec<Mat2d> reference_inverse_plastic_strain(total_real_particles, Mat2d::Identity());
+    StdVec<Real> reference_hardening_parameter(total_real_particles, 0.0);
+    for (int step = 0; step != 3; ++step)
+    {
+        for (UnsignedInt i = 0; i != total_real_particles; ++i)
+        {
+            Mat2d F = randomDeformation(0.2);
+            Mat2d expected = hardeningElasticLeftCauchy(G, yield_stress, hardening_modulus, F,
+                                                        reference_inverse_plastic_strain[i],
+                                                        reference_hardening_parameter[i]);
+            Mat2d be = i % 2 == 0 ? plastic_solid->ElasticLeftCauchy(F, i) : plastic_kernel.ElasticLeftCauchy(F, i);
+            EXPECT_NEAR((be - expected).norm(), 0.0, 1.0e-9);
+            EXPECT_NEAR((inverse_plastic_strain[i] - reference_inverse_plastic_strain[i]).norm(), 0.0, 1.0e-9);
+            EXPECT_NEAR(hardening_parameter[i], reference_hardening_parameter[i], 1.0e-9);
+        }
+    }
+    // the deformations are large enough to yield
+    EXPECT_GT(*std::max_element(reference_hardening_parameter.begin(), reference_hardening_parameter.end()), 0.0);
+}
@@ -0,0 +1,41 @@
+/**
+ * @file 	inner_neighbors_for_test.h
+ * @brief 	Inner neighbor lookup shared by the cell linked list and neighbor list tests.
+ */
+#ifndef INNER_NEIGHBORS_FOR_TEST_H
+#define INNER_NEIGHBORS_FOR_TEST_H
+
+#include "sphinxsys_ck.h"
+
+namespace SPH
+{
+class InnerNeighborsForTest : public Interaction<Inner<>>
+{
+    /** Reads neighbors through the computing kernel,
+     *  so that both plain and compressed neighbor lists are decoded. */
+    class NeighborKernel : public InteractKernel
+    {
+      public:
+        explicit NeighborKernel(InnerNeighborsForTest &encloser)
+            : InteractKernel(execution::seq, encloser) {}
+        StdVec<UnsignedInt> sortedNeighbors(UnsignedInt index_i)
+        {
+            StdVec<UnsignedInt> neighbors;
+            for (UnsignedInt n = FirstNeighbor(index_i); n != LastNeighbor(index_i); ++n)
+            {
+                neighbors.push_back(NeighborIndex(index_i, n));
+            }
+            std::sort(neighbors.begin(), neighbors.end());
+            return neighbors;
+        };
+    };
+
+  public:
+    using Interaction<Inner<>>::Interaction;
+    StdVec<UnsignedInt> sortedNeighbors(UnsignedInt index_i)
+    {
+        return NeighborKernel(*this).sortedNeighbors(index_i);
+    };
+};
+} // namespace SPH
+#endif // INNER_NEIGHBORS_FOR_TEST_H
@@ -0,0 +1,65 @@
+#include "sphinxsys_ck.h"
+#include "../inner_neighbors_for_test.h"
+#include <gtest/gtest.h>
+
+using namespace SPH;
+
+TEST(test_meshes, cell_linked_list_bounds)
+{
+    Real dp = 0.1;
+    // a tight domain only covering the initial block
+    BoundingBox system_domain_bounds(Vec2d(-1.0, -0.5), Vec2d(1.0, 0.5));
+    SPHSystem sph_system(system_domain_bounds, dp);
+    Vec2d halfsize(1.0, 0.5);
+    FluidBody fluid_block(sph_system, makeShared<GeometricShapeBox>(halfsize, "FluidBlock"));
+    fluid_block.defineMaterial<WeaklyCompressibleFluid>(1.0, 10.0);
+    fluid_block.generateParticles<BaseParticles, Lattice>();
+    Relation<Inner<>> fluid_block_inner(fluid_block);
+    InnerNeighborsForTest fluid_block_neighbors(fluid_block_inner);
+
+    BoundingBox maximum_bounds(Vec2d(-10.0, -10.0), Vec2d(10.0, 10.0));
+    UpdateCellLinkedListBounds<execution::ParallelPolicy> update_cell_linked_list_bounds(fluid_block, maximum_bounds);
+    UpdateCellLinkedList<execution::ParallelPolicy, CellLinkedList> update_cell_linked_list(fluid_block);
+    UpdateRelation<execution::ParallelPolicy, Inner<>> update_relation(fluid_block_inner);
+    update_cell_linked_list.exec();
+    update_relation.exec();
+
+    // move the block far outside of the initial domain
+    BaseParticles &particles = fluid_block.getBaseParticles();
+    UnsignedInt total_real_particles = particles.TotalRealParticles();
+    Vecd *pos = particles.ParticlePositions();
+    for (UnsignedInt i = 0; i != total_real_particles; ++i)
+    {
+        pos[i] += Vec2d(5.0, -3.0);
+    }
+
+    CellLinkedList &cell_linked_list = DynamicCast<CellLinkedList>(&fluid_block, fluid_block.getCellLinkedList());
+    UnsignedInt initial_number_of_cells = cell_linked_list.NumberOfCells();
+    EXPECT_TRUE(update_cell_linked_list_bounds.exec());
+    EXPECT_FALSE(update_cell_linked_list_bounds.exec());
+    EXPECT_GT(cell_linked_list.NumberOfCells(), initial_number_of_cells);
+    update_cell_linked_list.exec();
+    update_relation.exec();
+
+    BoundingBox mesh_bounds = cell_linked_list.MeshInnerBounds();
+    Real cutoff_radius_squared = cell_linked_list.GridSpacing() * cell_linked_list.GridSpacing();
+    for (UnsignedInt i = 0; i != total_real_particles; ++i)
+    {
+        ASSERT_TRUE((pos[i].array() > mesh_bounds.first_.array()).all());
+        ASSERT_TRUE((pos[i].array() < mesh_bounds.second_.array()).all());
+
+        StdVec<UnsignedInt> neighbors;
+        for (UnsignedInt j = 0; j != total_real_particles; ++j)
+        {
+            if (i != j && (pos[i] - pos[j]).squaredNorm() < cutoff_radius_squared)
+            {
+                neighbors.push_back(j);
+            }
+        }
+        ASSERT_EQ(fluid_block_neighbors.sortedNeighbors(i), neighbors);
+    }
+
+    // a runaway particle beyond the maximum bounds stops the growth with an error
+    pos[0] = Vec2d(100.0, 0.0);
+    EXPECT_EXIT(update_cell_linked_list_bounds.exec(), ::testing::ExitedWithCode(1), "");
+}
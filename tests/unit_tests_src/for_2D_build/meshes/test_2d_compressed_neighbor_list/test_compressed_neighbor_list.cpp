@@ -0,0 +1,106 @@
+#include "sphinxsys_ck.h"
+#include "../inner_neighbors_for_test.h"
+#include <gtest/gtest.h>
+
+using namespace SPH;
+
+/** Contact neighbor lists are not compressed. With a twin body at identical positions,
+ *  the contact neighbors of particle i, without i itself, are its inner neighbors. */
+class ContactNeighborsForTest : public Interaction<Contact<>>
+{
+    class NeighborKernel : public InteractKernel
+    {
+      public:
+        explicit NeighborKernel(ContactNeighborsForTest &encloser)
+            : InteractKernel(execution::seq, encloser, 0) {}
+        StdVec<UnsignedInt> sortedNeighbors(UnsignedInt index_i)
+        {
+            StdVec<UnsignedInt> neighbors;
+            for (UnsignedInt n = FirstNeighbor(index_i); n != LastNeighbor(index_i); ++n)
+            {
+                UnsignedInt index_j = NeighborIndex(index_i, n);
+                if (index_j != index_i)
+                {
+                    neighbors.push_back(index_j);
+                }
+            }
+            std::sort(neighbors.begin(), neighbors.end());
+            return neighbors;
+        };
+    };
+
+  public:
+    using Interaction<Contact<>>::Interaction;
+    StdVec<UnsignedInt> sortedNeighbors(UnsignedInt index_i)
+    {
+        return NeighborKernel(*this).sortedNeighbors(index_i);
+    };
+};
+
+void scrambleParticles(BaseParticles &particles)
+{
+    // swap every tenth particle with its mirror in the index range,
+    // so that a part of the neighbors are out of the 16-bit delta range
+    UnsignedInt total_real_particles = particles.TotalRealParticles();
+    Vecd *pos = particles.ParticlePositions();
+    for (UnsignedInt i = 0; i < total_real_particles / 2; i += 10)
+    {
+        std::swap(pos[i], pos[total_real_particles - 1 - i]);
+    }
+}
+
+TEST(test_meshes, compressed_neighbor_list)
+{
+    Real dp = 0.005;
+    BoundingBox system_domain_bounds(Vec2d(-1.1, -0.6), Vec2d(1.1, 0.6));
+    SPHSystem sph_system(system_domain_bounds, dp);
+    Vec2d halfsize(1.0, 0.5);
+
+    FluidBody fluid_block(sph_system, makeShared<GeometricShapeBox>(halfsize, "FluidBlock"));
+    fluid_block.defineMaterial<WeaklyCompressibleFluid>(1.0, 10.0);
+    fluid_block.generateParticles<BaseParticles, Lattice>();
+    scrambleParticles(fluid_block.getBaseParticles());
+
+    FluidBody twin_block(sph_system, makeShared<GeometricShapeBox>(halfsize, "TwinBlock"));
+    twin_block.defineMaterial<WeaklyCompressibleFluid>(1.0, 10.0);
+    twin_block.generateParticles<BaseParticles, Lattice>();
+    scrambleParticles(twin_block.getBaseParticles());
+
+    Relation<Inner<>> fluid_block_inner(fluid_block);
+    Relation<Contact<>> fluid_block_contact(fluid_block, {&twin_block});
+    InnerNeighborsForTest compressed_neighbors(fluid_block_inner);
+    ContactNeighborsForTest plain_neighbors(fluid_block_contact);
+
+    UpdateCellLinkedList<execution::ParallelPolicy, CellLinkedList> fluid_block_cell_linked_list(fluid_block);
+    UpdateCellLinkedList<execution::ParallelPolicy, CellLinkedList> twin_block_cell_linked_list(twin_block);
+    UpdateRelation<execution::ParallelPolicy, Inner<>, Contact<>>
+        update_relation(fluid_block_inner, fluid_block_contact);
+    fluid_block_cell_linked_list.exec();
+    twin_block_cell_linked_list.exec();
+    update_relation.exec();
+
+    UnsignedInt total_real_particles = fluid_block.getBaseParticles().TotalRealParticles();
+    ASSERT_EQ(total_real_particles, twin_block.getBaseParticles().TotalRealParticles());
+    ASSERT_GT(total_real_particles, UnsignedInt(2 * std::numeric_limits<NeighborDelta>::max()));
+
+    UnsignedInt overflow_rows = 0;
+    UnsignedInt mixed_rows = 0;
+    for (UnsignedInt i = 0; i != total_real_particles; ++i)
+    {
+        StdVec<UnsignedInt> neighbors = compressed_neighbors.sortedNeighbors(i);
+        ASSERT_EQ(neighbors, plain_neighbors.sortedNeighbors(i));
+
+        UnsignedInt overflow_count = 0;
+        for (UnsignedInt j : neighbors)
+        {
+            if ((i > j ? i - j : j - i) > UnsignedInt(std::numeric_limits<NeighborDelta>::max()))
+            {
+                overflow_count++;
+            }
+        }
+        overflow_rows += overflow_count != 0 ? 1 : 0;
+        mixed_rows += overflow_count != 0 && overflow_count != neighbors.size() ? 1 : 0;
+    }
+    EXPECT_GT(overflow_rows, UnsignedInt(0));
+    EXPECT_GT(mixed_rows, UnsignedInt(0));
+}
@@ -0,0 +1,113 @@
+#include "sphinxsys.h"
+#include <gtest/gtest.h>
+
+using namespace SPH;
+
+class ColoredSplitTest : public ::testing::Test
+{
+  protected:
+    Real length = 10;
+    Real dp = 1;
+    SharedPtr<MultiPolygonShape> polygon_shape;
+    UniquePtr<SPHSystem> system;
+    UniquePtr<SolidBody> body;
+    UniquePtr<InnerRelation> inner;
+    Vec2d *pos = nullptr;
+    Real *quantity = nullptr;
+    size_t total_real_particles = 0;
+
+    void SetUp() override
+    {
+        MultiPolygon shape;
+        shape.addABox(Transform(0.5 * length * Vec2d::Ones()), 0.5 * length * Vec2d::Ones(), ShapeBooleanOps::add);
+        polygon_shape = makeShared<MultiPolygonShape>(shape, "PolygonShape");
+        system = makeUnique<SPHSystem>(polygon_shape->getBounds(), dp);
+        body = makeUnique<SolidBody>(*system, polygon_shape);
+        body->defineMaterial<Solid>();
+        body->generateParticles<BaseParticles, Lattice>();
+        auto &particles = body->getBaseParticles();
+        pos = particles.registerStateVariable<Vec2d>("Position");
+        quantity = particles.registerStateVariable<Real>("Quantity", [&](size_t i) -> Real
+                                                         { return pos[i].norm(); });
+        total_real_particles = particles.TotalRealParticles();
+
+        inner = makeUnique<InnerRelation>(*body);
+        body->updateCellLinkedList();
+        inner->updateConfiguration();
+    }
+
+    void resetQuantity()
+    {
+        for (size_t i = 0; i < total_real_particles; i++)
+        {
+            quantity[i] = pos[i].norm();
+        }
+    }
+};
+
+TEST_F(ColoredSplitTest, gather_coloring)
+{
+    const auto &configuration = inner->inner_configuration_;
+    GatherParticleColoring coloring(inner->inner_configuration_);
+    coloring.updateColors(total_real_particles);
+
+    StdVec<size_t> color(total_real_particles, MaxSize_t);
+    for (size_t k = 0; k != coloring.NumberOfColors(); ++k)
+    {
+        for (size_t index_i : coloring.ColoredParticles()[k])
+        {
+            ASSERT_EQ(color[index_i], MaxSize_t);
+            color[index_i] = k;
+        }
+    }
+    for (size_t i = 0; i < total_real_particles; i++)
+    {
+        ASSERT_NE(color[i], MaxSize_t);
+        const auto &neighborhood = configuration[i];
+        for (size_t n = 0; n < neighborhood.current_size_; n++)
+        {
+            ASSERT_NE(color[i], color[neighborhood.j_[n]]);
+        }
+    }
+}
+
+TEST_F(ColoredSplitTest, multi_color_damping)
+{
+    InteractionMultiColorSplit<DampingJacobiInner<Real, FixedDampingRate>> damping(*inner, "Quantity", 1.0);
+
+    auto spread = [&]()
+    {
+        Real q_max = quantity[0];
+        Real q_min = quantity[0];
+        for (size_t i = 0; i < total_real_particles; i++)
+        {
+            q_max = SMAX(q_max, quantity[i]);
+            q_min = SMIN(q_min, quantity[i]);
+        }
+        return q_max - q_min;
+    };
+
+    Real initial_spread = spread();
+    damping.exec(0.1);
+    EXPECT_GT(damping.getParticleColoring().NumberOfColors(), 0u);
+    StdVec<Real> q_par(quantity, quantity + total_real_particles);
+    EXPECT_LT(spread(), initial_spread);
+
+    // the same result as the sequenced sweeping, since particles of a color are independent
+    resetQuantity();
+    BaseInteractionColoredSplit<DampingJacobiInner<Real, FixedDampingRate>,
+                                GatherParticleColoring, execution::SequencedPolicy>
+        damping_seq(*inner, "Quantity", 1.0);
+    damping_seq.exec(0.1);
+    for (size_t i = 0; i < total_real_particles; i++)
+    {
+        ASSERT_EQ(q_par[i], quantity[i]);
+    }
+
+    // the colors are updated only after the configuration is updated
+    EXPECT_EQ(inner->TotalConfigurationUpdates(), 1u);
+    inner->updateConfiguration();
+    EXPECT_EQ(inner->TotalConfigurationUpdates(), 2u);
+    damping.exec(0.1);
+    EXPECT_GT(damping.getParticleColoring().NumberOfColors(), 0u);
+}
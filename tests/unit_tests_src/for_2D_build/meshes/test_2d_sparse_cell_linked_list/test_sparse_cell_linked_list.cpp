@@ -0,0 +1,78 @@
+#include "sphinxsys_ck.h"
+#include "../inner_neighbors_for_test.h"
+#include <gtest/gtest.h>
+
+using namespace SPH;
+
+TEST(test_meshes, sparse_cell_linked_list)
+{
+    Real dp = 0.1;
+    // a small block in a large and mostly empty domain
+    BoundingBox system_domain_bounds(Vec2d(-10.0, -10.0), Vec2d(10.0, 10.0));
+    SPHSystem sph_system(system_domain_bounds, dp);
+    Vec2d halfsize(1.0, 0.5);
+    Transform translation(Vec2d(2.0, 3.0));
+
+    FluidBody dense_body(sph_system, makeShared<TransformShape<GeometricShapeBox>>(translation, halfsize, "DenseBody"));
+    dense_body.defineMaterial<WeaklyCompressibleFluid>(1.0, 10.0);
+    dense_body.generateParticles<BaseParticles, Lattice>();
+
+    FluidBody sparse_body(sph_system, makeShared<TransformShape<GeometricShapeBox>>(translation, halfsize, "SparseBody"));
+    sparse_body.defineMaterial<WeaklyCompressibleFluid>(1.0, 10.0);
+    sparse_body.generateParticles<BaseParticles, Lattice>();
+    sparse_body.defineCellLinkedList<SparseCellLinkedList>();
+
+    Relation<Inner<>> dense_inner(dense_body);
+    Relation<Inner<>> sparse_inner(sparse_body);
+    InnerNeighborsForTest dense_neighbors(dense_inner);
+    InnerNeighborsForTest sparse_neighbors(sparse_inner);
+
+    UpdateCellLinkedList<execution::ParallelPolicy, CellLinkedList> dense_cell_linked_list(dense_body);
+    UpdateCellLinkedList<execution::ParallelPolicy, SparseCellLinkedList> sparse_cell_linked_list(sparse_body);
+    UpdateRelation<execution::ParallelPolicy, Inner<>> dense_update_relation(dense_inner);
+    UpdateRelation<execution::ParallelPolicy, Inner<>> sparse_update_relation(sparse_inner);
+
+    dense_cell_linked_list.exec();
+    sparse_cell_linked_list.exec();
+    dense_update_relation.exec();
+    sparse_update_relation.exec();
+
+    SparseCellLinkedList &sparse_list = DynamicCast<SparseCellLinkedList>(&sparse_body, sparse_body.getCellLinkedList());
+    UnsignedInt total_real_particles = sparse_body.getBaseParticles().TotalRealParticles();
+    EXPECT_LT(sparse_list.getNumberOfOccupiedCells()->getValue(), total_real_particles);
+    EXPECT_LT(sparse_list.getCellOffset()->getDataSize(), sparse_list.NumberOfCells());
+
+    for (UnsignedInt i = 0; i != total_real_particles; ++i)
+    {
+        ASSERT_EQ(dense_neighbors.sortedNeighbors(i), sparse_neighbors.sortedNeighbors(i));
+    }
+}
+
+TEST(test_meshes, sparse_cell_linked_list_legacy_relation)
+{
+    // the tbb threads are started before the death tests
+    ::testing::FLAGS_gtest_death_test_style = "threadsafe";
+
+    Real dp = 0.1;
+    BoundingBox system_domain_bounds(Vec2d(-10.0, -10.0), Vec2d(10.0, 10.0));
+    SPHSystem sph_system(system_domain_bounds, dp);
+    Vec2d halfsize(1.0, 0.5);
+    Transform translation(Vec2d(2.0, 3.0));
+
+    FluidBody sparse_body(sph_system, makeShared<TransformShape<GeometricShapeBox>>(translation, halfsize, "SparseBody"));
+    sparse_body.defineMaterial<WeaklyCompressibleFluid>(1.0, 10.0);
+    sparse_body.generateParticles<BaseParticles, Lattice>();
+    sparse_body.defineCellLinkedList<SparseCellLinkedList>();
+
+    UpdateCellLinkedList<execution::ParallelPolicy, SparseCellLinkedList> sparse_cell_linked_list(sparse_body);
+    sparse_cell_linked_list.exec();
+
+    // the cell-based searches of the legacy relations exit with an error instead of crashing
+    InnerRelation legacy_inner(sparse_body);
+    EXPECT_EXIT(legacy_inner.updateConfiguration(), ::testing::ExitedWithCode(1), "");
+    InnerRelationByCellPairs legacy_inner_by_cell_pairs(sparse_body);
+    EXPECT_EXIT(legacy_inner_by_cell_pairs.updateConfiguration(), ::testing::ExitedWithCode(1), "");
+    CellLinkedList &cell_linked_list = legacy_inner.getCellLinkedList();
+    EXPECT_EXIT(cell_linked_list.particle_for_split(execution::par, [](size_t index_i) {}),
+                ::testing::ExitedWithCode(1), "");
+}
@@ -0,0 +1,52 @@
+#include "sphinxsys.h"
+#include <gtest/gtest.h>
+
+using namespace SPH;
+
+StdVec<std::pair<size_t, Real>> sortedNeighbors(const Neighborhood &neighborhood)
+{
+    StdVec<std::pair<size_t, Real>> neighbors;
+    for (size_t n = 0; n != neighborhood.current_size_; ++n)
+    {
+        neighbors.push_back(std::make_pair(neighborhood.j_[n], neighborhood.W_ij_[n]));
+    }
+    std::sort(neighbors.begin(), neighbors.end());
+    return neighbors;
+}
+
+TEST(test_meshes, cell_pair_search)
+{
+    Real dp = 0.1;
+    auto shape = makeShared<GeometricShapeBox>(Vec3d(1.0, 0.5, 0.3), "Shape");
+    SPHSystem system(shape->getBounds(), dp);
+
+    SolidBody body(system, shape);
+    body.defineMaterial<Solid>();
+    body.generateParticles<BaseParticles, Lattice>();
+    BaseParticles &particles = body.getBaseParticles();
+    // perturb the lattice so that the particles are not aligned with the cells
+    Vecd *pos = particles.ParticlePositions();
+    for (size_t i = 0; i != particles.TotalRealParticles(); ++i)
+    {
+        pos[i] += 0.2 * dp * Vec3d(sin(Real(i)), cos(Real(i)), sin(Real(2 * i)));
+    }
+
+    InnerRelation inner(body);
+    InnerRelationByCellPairs inner_by_cell_pairs(body);
+    body.updateCellLinkedList();
+    inner.updateConfiguration();
+    inner_by_cell_pairs.updateConfiguration();
+
+    for (size_t i = 0; i != particles.TotalRealParticles(); ++i)
+    {
+        StdVec<std::pair<size_t, Real>> neighbors = sortedNeighbors(inner.inner_configuration_[i]);
+        StdVec<std::pair<size_t, Real>> neighbors_by_cell_pairs =
+            sortedNeighbors(inner_by_cell_pairs.inner_configuration_[i]);
+        ASSERT_EQ(neighbors.size(), neighbors_by_cell_pairs.size());
+        for (size_t n = 0; n != neighbors.size(); ++n)
+        {
+            ASSERT_EQ(neighbors[n].first, neighbors_by_cell_pairs[n].first);
+            ASSERT_NEAR(neighbors[n].second, neighbors_by_cell_pairs[n].second, Eps);
+        }
+    }
+}
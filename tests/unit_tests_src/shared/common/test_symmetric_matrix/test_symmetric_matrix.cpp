@@ -0,0 +1,67 @@
+#include "data_type.h"
+#include "small_matrix_batch.h"
+#include "xml_parser.h"
+#include <gtest/gtest.h>
+
+using namespace SPH;
+
+Mat3d test_matrix{
+    {1.0, 2.0, 3.0},
+    {4.0, 5.0, 6.0},
+    {7.0, 8.0, 9.0},
+};
+//=================================================================================================//
+TEST(symmetric_matrix, SymmetricPartAndComponents)
+{
+    SymMat3d matrix(test_matrix);
+    Mat3d symmetric_part = 0.5 * (test_matrix + test_matrix.transpose());
+    EXPECT_EQ(matrix.toMatrix(), symmetric_part);
+    EXPECT_EQ(matrix(1, 2), matrix(2, 1));
+    EXPECT_EQ(matrix.components()[SymMat3d::index(0, 2)], 5.0);
+    EXPECT_EQ(sizeof(SymMat3d), 6 * sizeof(Real));
+    EXPECT_EQ(sizeof(SymMat2d), 3 * sizeof(Real));
+}
+//=================================================================================================//
+TEST(symmetric_matrix, Arithmetic)
+{
+    SymMat3d a(test_matrix);
+    SymMat3d b = SymMat3d::Identity() * 2.0;
+    Mat3d full_a = a.toMatrix();
+    Mat3d full_b = b.toMatrix();
+
+    EXPECT_EQ((a + b).toMatrix(), full_a + full_b);
+    EXPECT_EQ((a - 0.5 * b).toMatrix(), full_a - 0.5 * full_b);
+    EXPECT_DOUBLE_EQ(a.trace(), full_a.trace());
+    EXPECT_DOUBLE_EQ(a.doubleDot(b), full_a.cwiseProduct(full_b).sum());
+    EXPECT_DOUBLE_EQ(a.squaredNorm(), full_a.squaredNorm());
+    EXPECT_NEAR(a.deviatoric().trace(), 0.0, 1.0e-12);
+}
+//=================================================================================================//
+TEST(symmetric_matrix, StringConversion)
+{
+    SymMat3d matrix(test_matrix);
+    std::string value_str = DataToString(matrix);
+    SymMat3d restored = SymMat3d::Zero();
+    StringToData(value_str, restored);
+    EXPECT_EQ(restored, matrix);
+}
+//=================================================================================================//
+TEST(symmetric_matrix, BatchLoadAndStore)
+{
+    StdVec<SymMat3d> data(BatchLanes, SymMat3d(test_matrix));
+    MatrixBatch<3> batch;
+    batch.load(data.data(), 0, BatchLanes);
+    EXPECT_EQ(batch.lane(BatchLanes - 1), SymMat3d(test_matrix).toMatrix());
+
+    (batch * 2.0).store(data.data(), 0, BatchLanes);
+    EXPECT_EQ(data[0], SymMat3d(test_matrix) * 2.0);
+}
+//=================================================================================================//
+TEST(symmetric_matrix, UpgradeAndDegrade)
+{
+    SymMat2d matrix(Mat2d{{1.0, 2.0}, {2.0, 3.0}});
+    SymMat3d upgraded = upgradeToSymMat3d(matrix);
+    EXPECT_EQ(upgraded(0, 1), 2.0);
+    EXPECT_EQ(upgraded(2, 2), 0.0);
+    EXPECT_EQ(degradeToMatd(upgraded), upgraded.toMatrix());
+}
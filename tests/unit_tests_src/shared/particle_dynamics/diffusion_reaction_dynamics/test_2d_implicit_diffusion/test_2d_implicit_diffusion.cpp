@@ -0,0 +1,228 @@
+/**
+ * @file 	test_2d_implicit_diffusion.cpp
+ * @brief 	Implicit diffusion of heat conduction in a square against the analytic solution
+ *          and the explicit 2nd-order runge-kutta integration at small time step sizes,
+ *          with Dirichlet and Robin boundary conditions.
+ */
+#include "sphinxsys.h"
+#include <gtest/gtest.h>
+
+using namespace SPH;
+
+Real L = 1.0;
+Real resolution_ref = L / 40.0;
+Real BW = resolution_ref * 3.0;
+BoundingBox system_domain_bounds(Vec2d(-BW, -BW), Vec2d(L + BW, L + BW));
+Real diffusion_coeff = 1.0;
+Real end_time = 0.02;
+Real implicit_dt = 0.002;
+Real convection = 10.0;
+Real T_infinity = 1.0;
+
+Vec2d square_halfsize = Vec2d(0.5 * L, 0.5 * L);
+Vec2d square_translation = square_halfsize;
+Vec2d frame_halfsize = Vec2d(0.5 * L + BW, 0.5 * L + BW);
+Vec2d frame_translation = Vec2d(-BW, -BW) + frame_halfsize;
+Vec2d open_frame_halfsize = Vec2d(0.5 * L + BW, 0.5 * (L + BW));
+Vec2d open_frame_translation = Vec2d(-BW, 0.0) + open_frame_halfsize;
+Vec2d bottom_halfsize = Vec2d(0.5 * L + BW, 0.5 * BW);
+Vec2d bottom_translation = Vec2d(-BW, -BW) + bottom_halfsize;
+
+class ClosedWall : public ComplexShape
+{
+  public:
+    explicit ClosedWall(const std::string &shape_name) : ComplexShape(shape_name)
+    {
+        add<TransformShape<GeometricShapeBox>>(Transform(frame_translation), frame_halfsize);
+        subtract<TransformShape<GeometricShapeBox>>(Transform(square_translation), square_halfsize);
+    }
+};
+
+class OpenWall : public ComplexShape
+{
+  public:
+    explicit OpenWall(const std::string &shape_name) : ComplexShape(shape_name)
+    {
+        add<TransformShape<GeometricShapeBox>>(Transform(open_frame_translation), open_frame_halfsize);
+        subtract<TransformShape<GeometricShapeBox>>(Transform(square_translation), square_halfsize);
+    }
+};
+
+template <class RelaxationType>
+void integrateDiffusion(RelaxationType &relaxation, Real dt, Real time_interval)
+{
+    Real integration_time = 0.0;
+    while (integration_time < time_interval - TinyReal)
+    {
+        Real step_dt = SMIN(dt, time_interval - integration_time);
+        relaxation.exec(step_dt);
+        integration_time += step_dt;
+    }
+}
+
+Real maxDifference(const StdVec<Real> &a, const StdVec<Real> &b)
+{
+    Real difference = 0.0;
+    for (size_t i = 0; i != a.size(); ++i)
+        difference = SMAX(difference, ABS(a[i] - b[i]));
+    return difference;
+}
+
+Real maxMagnitude(const StdVec<Real> &a)
+{
+    Real magnitude = 0.0;
+    for (size_t i = 0; i != a.size(); ++i)
+        magnitude = SMAX(magnitude, ABS(a[i]));
+    return magnitude;
+}
+
+TEST(test_diffusion_dynamics, implicit_diffusion_dirichlet)
+{
+    SPHSystem sph_system(system_domain_bounds, resolution_ref);
+    sph_system.setIOEnvironment();
+    SolidBody diffusion_body(sph_system, makeShared<TransformShape<GeometricShapeBox>>(
+                                             Transform(square_translation), square_halfsize, "DiffusionBody"));
+    IsotropicDiffusion *diffusion = diffusion_body.defineMaterial<IsotropicDiffusion>("Phi", "Phi", diffusion_coeff);
+    diffusion_body.generateParticles<BaseParticles, Lattice>();
+    SolidBody wall_boundary(sph_system, makeShared<ClosedWall>("WallBoundary"));
+    wall_boundary.defineMaterial<Solid>();
+    wall_boundary.generateParticles<BaseParticles, Lattice>();
+
+    InnerRelation diffusion_inner(diffusion_body);
+    ContactRelation diffusion_contact(diffusion_body, {&wall_boundary});
+
+    DiffusionBodyRelaxationComplex<IsotropicDiffusion, KernelGradientInner, KernelGradientContact, Dirichlet>
+        explicit_relaxation(ConstructorArgs(diffusion_inner, diffusion), ConstructorArgs(diffusion_contact, diffusion));
+    DiffusionBodyRelaxationComplexImplicit<IsotropicDiffusion, KernelGradientInner, KernelGradientContact, Dirichlet>
+        implicit_relaxation(ConstructorArgs(diffusion_inner, diffusion), ConstructorArgs(diffusion_contact, diffusion));
+    GetDiffusionTimeStepSize<IsotropicDiffusion> get_time_step_size(diffusion_body, *diffusion);
+
+    sph_system.initializeSystemCellLinkedLists();
+    sph_system.initializeSystemConfigurations();
+
+    BaseParticles &particles = diffusion_body.getBaseParticles();
+    size_t total_real_particles = particles.TotalRealParticles();
+    Vecd *pos = particles.getVariableDataByName<Vecd>("Position");
+    Real *phi = particles.getVariableDataByName<Real>("Phi");
+    Real *wall_phi = wall_boundary.getBaseParticles().getVariableDataByName<Real>("Phi");
+    for (size_t i = 0; i != wall_boundary.getBaseParticles().TotalRealParticles(); ++i)
+        wall_phi[i] = 0.0;
+    auto setInitialCondition = [&]()
+    {
+        for (size_t i = 0; i != total_real_particles; ++i)
+            phi[i] = sin(Pi * pos[i][0] / L) * sin(Pi * pos[i][1] / L);
+    };
+    auto getSolution = [&]()
+    { return StdVec<Real>(phi, phi + total_real_particles); };
+
+    Real decay = exp(-2.0 * Pi * Pi * diffusion_coeff * end_time / (L * L));
+    StdVec<Real> analytic_solution(total_real_particles);
+    for (size_t i = 0; i != total_real_particles; ++i)
+        analytic_solution[i] = decay * sin(Pi * pos[i][0] / L) * sin(Pi * pos[i][1] / L);
+
+    setInitialCondition();
+    integrateDiffusion(explicit_relaxation, get_time_step_size.exec(), end_time);
+    StdVec<Real> explicit_solution = getSolution();
+    EXPECT_LT(maxDifference(explicit_solution, analytic_solution), 0.05 * decay);
+
+    /** Backward Euler, which is first order in time. */
+    setInitialCondition();
+    integrateDiffusion(implicit_relaxation, implicit_dt, end_time);
+    EXPECT_TRUE(implicit_relaxation.isConverged());
+    EXPECT_GT(implicit_relaxation.Iterations(), 0u);
+    StdVec<Real> backward_euler_solution = getSolution();
+    EXPECT_LT(maxDifference(backward_euler_solution, analytic_solution), 0.05 * decay);
+    EXPECT_LT(maxDifference(backward_euler_solution, explicit_solution), 0.02 * decay);
+
+    /** Crank-Nicolson, which is second order in time. */
+    implicit_relaxation.setTheta(0.5);
+    setInitialCondition();
+    integrateDiffusion(implicit_relaxation, implicit_dt, end_time);
+    EXPECT_TRUE(implicit_relaxation.isConverged());
+    StdVec<Real> crank_nicolson_solution = getSolution();
+    EXPECT_LT(maxDifference(crank_nicolson_solution, analytic_solution), 0.05 * decay);
+    EXPECT_LT(maxDifference(crank_nicolson_solution, explicit_solution), 1.0e-3 * decay);
+
+    /** Non-convergence is exposed when the iteration is cut off. */
+    implicit_relaxation.setTolerance(1.0e-14);
+    implicit_relaxation.setMaxIterations(1);
+    setInitialCondition();
+    implicit_relaxation.exec(implicit_dt);
+    EXPECT_FALSE(implicit_relaxation.isConverged());
+    EXPECT_EQ(implicit_relaxation.Iterations(), 1u);
+}
+
+TEST(test_diffusion_dynamics, implicit_diffusion_robin)
+{
+    SPHSystem sph_system(system_domain_bounds, resolution_ref);
+    sph_system.setIOEnvironment();
+    SolidBody diffusion_body(sph_system, makeShared<TransformShape<GeometricShapeBox>>(
+                                             Transform(square_translation), square_halfsize, "DiffusionBody"));
+    IsotropicDiffusion *diffusion = diffusion_body.defineMaterial<IsotropicDiffusion>("Phi", "Phi", diffusion_coeff);
+    diffusion_body.generateParticles<BaseParticles, Lattice>();
+    SolidBody wall_boundary_Dirichlet(sph_system, makeShared<OpenWall>("DirichletWallBoundary"));
+    wall_boundary_Dirichlet.defineMaterial<Solid>();
+    wall_boundary_Dirichlet.generateParticles<BaseParticles, Lattice>();
+    SolidBody wall_boundary_Robin(sph_system, makeShared<TransformShape<GeometricShapeBox>>(
+                                                  Transform(bottom_translation), bottom_halfsize, "RobinWallBoundary"));
+    wall_boundary_Robin.defineMaterial<Solid>();
+    wall_boundary_Robin.generateParticles<BaseParticles, Lattice>();
+
+    InnerRelation diffusion_inner(diffusion_body);
+    ContactRelation contact_Dirichlet(diffusion_body, {&wall_boundary_Dirichlet});
+    ContactRelation contact_Robin(diffusion_body, {&wall_boundary_Robin});
+
+    SimpleDynamics<NormalDirectionFromBodyShape> diffusion_body_normal_direction(diffusion_body);
+    SimpleDynamics<NormalDirectionFromBodyShape> Robin_normal_direction(wall_boundary_Robin);
+    DiffusionBodyRelaxationComplex<IsotropicDiffusion, KernelGradientInner, KernelGradientContact, Dirichlet, Robin>
+        explicit_relaxation(ConstructorArgs(diffusion_inner, diffusion),
+                            ConstructorArgs(contact_Dirichlet, diffusion), ConstructorArgs(contact_Robin, diffusion));
+    DiffusionBodyRelaxationComplexImplicit<IsotropicDiffusion, KernelGradientInner, KernelGradientContact, Dirichlet, Robin>
+        implicit_relaxation(ConstructorArgs(diffusion_inner, diffusion),
+                            ConstructorArgs(contact_Dirichlet, diffusion), ConstructorArgs(contact_Robin, diffusion));
+    GetDiffusionTimeStepSize<IsotropicDiffusion> get_time_step_size(diffusion_body, *diffusion);
+
+    sph_system.initializeSystemCellLinkedLists();
+    sph_system.initializeSystemConfigurations();
+    diffusion_body_normal_direction.exec();
+    Robin_normal_direction.exec();
+
+    BaseParticles &particles = diffusion_body.getBaseParticles();
+    size_t total_real_particles = particles.TotalRealParticles();
+    Real *phi = particles.getVariableDataByName<Real>("Phi");
+    BaseParticles &Dirichlet_particles = wall_boundary_Dirichlet.getBaseParticles();
+    Real *Dirichlet_phi = Dirichlet_particles.getVariableDataByName<Real>("Phi");
+    for (size_t i = 0; i != Dirichlet_particles.TotalRealParticles(); ++i)
+        Dirichlet_phi[i] = 0.0;
+    BaseParticles &Robin_particles = wall_boundary_Robin.getBaseParticles();
+    Real *phi_convection = Robin_particles.getVariableDataByName<Real>("PhiConvection");
+    for (size_t i = 0; i != Robin_particles.TotalRealParticles(); ++i)
+        phi_convection[i] = convection;
+    *Robin_particles.getSingularVariableByName<Real>("PhiInfinity")->Data() = T_infinity;
+    auto setInitialCondition = [&]()
+    {
+        for (size_t i = 0; i != total_real_particles; ++i)
+            phi[i] = 0.0;
+    };
+    auto getSolution = [&]()
+    { return StdVec<Real>(phi, phi + total_real_particles); };
+
+    setInitialCondition();
+    integrateDiffusion(explicit_relaxation, get_time_step_size.exec(), end_time);
+    StdVec<Real> explicit_solution = getSolution();
+    Real max_phi = maxMagnitude(explicit_solution);
+    EXPECT_GT(max_phi, 0.0);
+
+    setInitialCondition();
+    integrateDiffusion(implicit_relaxation, implicit_dt, end_time);
+    EXPECT_TRUE(implicit_relaxation.isConverged());
+    StdVec<Real> backward_euler_solution = getSolution();
+    EXPECT_LT(maxDifference(backward_euler_solution, explicit_solution), 0.05 * max_phi);
+
+    implicit_relaxation.setTheta(0.5);
+    setInitialCondition();
+    integrateDiffusion(implicit_relaxation, implicit_dt, end_time);
+    EXPECT_TRUE(implicit_relaxation.isConverged());
+    StdVec<Real> crank_nicolson_solution = getSolution();
+    EXPECT_LT(maxDifference(crank_nicolson_solution, explicit_solution), 0.01 * max_phi);
+}
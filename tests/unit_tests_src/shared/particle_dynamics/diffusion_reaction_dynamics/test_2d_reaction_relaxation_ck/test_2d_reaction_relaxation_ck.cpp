@@ -0,0 +1,122 @@
+/**
+ * @file 	test_2d_reaction_relaxation_ck.cpp
+ * @brief 	Statically dispatched Aliev-Panfilow reaction rates and relaxation steps
+ *          against the std::function based reaction model.
+ */
+#include "sphinxsys.h"
+#include "sphinxsys_ck.h"
+#include <gtest/gtest.h>
+#include <random>
+
+using namespace SPH;
+
+std::mt19937 random_engine(42);
+std::uniform_real_distribution<Real> random_unit(0.0, 1.0);
+
+Real c_m = 1.0;
+Real k = 8.0;
+Real a = 0.15;
+Real b = 0.0;
+Real mu_1 = 0.2;
+Real mu_2 = 0.3;
+Real epsilon = 0.04;
+Real k_a = 0.1;
+
+std::array<Real, 3> randomSpecies()
+{
+    // voltage, gate variable and active contraction stress
+    return {1.2 * random_unit(random_engine) - 0.1, 2.0 * random_unit(random_engine), random_unit(random_engine)};
+}
+
+TEST(test_reaction_dynamics, aliev_panfilow_reaction_kernel)
+{
+    AlievPanfilowModel reaction_model(k_a, c_m, k, a, b, mu_1, mu_2, epsilon);
+    AlievPanfilowModel::ReactionKernel reaction_kernel(reaction_model);
+
+    std::array<Real, 3> species_lanes[BatchLanes];
+    std::array<RealBatch, 3> species_batch;
+    for (UnsignedInt l = 0; l != BatchLanes; ++l)
+    {
+        species_lanes[l] = randomSpecies();
+        for (size_t s = 0; s != 3; ++s)
+            species_batch[s][l] = species_lanes[l][s];
+    }
+
+    for (size_t s = 0; s != 3; ++s)
+    {
+        RealBatch production_rate_batch = reaction_kernel.ProductionRate(s, species_batch);
+        RealBatch loss_rate_batch = reaction_kernel.LossRate(s, species_batch);
+        for (UnsignedInt l = 0; l != BatchLanes; ++l)
+        {
+            Real expected_production_rate = reaction_model.get_production_rates_[s](species_lanes[l]);
+            Real expected_loss_rate = reaction_model.get_loss_rates_[s](species_lanes[l]);
+            Real production_tolerance = 1.0e-12 * SMAX(Real(1), ABS(expected_production_rate));
+            Real loss_tolerance = 1.0e-12 * SMAX(Real(1), ABS(expected_loss_rate));
+            EXPECT_NEAR(reaction_kernel.ProductionRate(s, species_lanes[l]), expected_production_rate, production_tolerance);
+            EXPECT_NEAR(reaction_kernel.LossRate(s, species_lanes[l]), expected_loss_rate, loss_tolerance);
+            EXPECT_NEAR(production_rate_batch[l], expected_production_rate, production_tolerance);
+            EXPECT_NEAR(loss_rate_batch[l], expected_loss_rate, loss_tolerance);
+        }
+    }
+}
+
+TEST(test_reaction_dynamics, reaction_relaxation_ck)
+{
+    Real dp = 0.1;
+    BoundingBox system_domain_bounds(Vec2d(-1.0, -1.0), Vec2d(1.0, 1.0));
+    SPHSystem sph_system(system_domain_bounds, dp);
+    sph_system.setIOEnvironment();
+    // the number of particles is not a multiple of the batch lanes
+    Vec2d halfsize(0.5, 0.35);
+    Transform translation(Vec2d::Zero());
+    AlievPanfilowModel reaction_model(k_a, c_m, k, a, b, mu_1, mu_2, epsilon);
+
+    SolidBody legacy_body(sph_system, makeShared<TransformShape<GeometricShapeBox>>(translation, halfsize, "LegacyBody"));
+    legacy_body.defineMaterial<Solid>();
+    legacy_body.generateParticles<BaseParticles, Lattice>();
+    SolidBody ck_body(sph_system, makeShared<TransformShape<GeometricShapeBox>>(translation, halfsize, "CKBody"));
+    ck_body.defineMaterial<Solid>();
+    ck_body.generateParticles<BaseParticles, Lattice>();
+    BaseParticles &legacy_particles = legacy_body.getBaseParticles();
+    BaseParticles &ck_particles = ck_body.getBaseParticles();
+    UnsignedInt total_real_particles = ck_particles.TotalRealParticles();
+    ASSERT_EQ(legacy_particles.TotalRealParticles(), total_real_particles);
+
+    SimpleDynamics<ReactionRelaxationForward<ElectroPhysiologyReaction>> legacy_forward(legacy_body, reaction_model);
+    SimpleDynamics<ReactionRelaxationBackward<ElectroPhysiologyReaction>> legacy_backward(legacy_body, reaction_model);
+    StateDynamics<execution::ParallelPolicy, ReactionRelaxationForwardCK<AlievPanfilowModel>> ck_forward(ck_body, reaction_model);
+    StateDynamics<execution::ParallelPolicy, ReactionRelaxationBackwardCK<AlievPanfilowModel>> ck_backward(ck_body, reaction_model);
+
+    auto &species_names = reaction_model.getSpeciesNames();
+    std::array<Real *, 3> legacy_species, ck_species;
+    for (size_t s = 0; s != 3; ++s)
+    {
+        legacy_species[s] = legacy_particles.getVariableDataByName<Real>(species_names[s]);
+        ck_species[s] = ck_particles.getVariableDataByName<Real>(species_names[s]);
+    }
+    for (size_t i = 0; i != total_real_particles; ++i)
+    {
+        std::array<Real, 3> species = randomSpecies();
+        for (size_t s = 0; s != 3; ++s)
+        {
+            legacy_species[s][i] = species[s];
+            ck_species[s][i] = species[s];
+        }
+    }
+
+    Real dt = 0.05;
+    for (int step = 0; step != 3; ++step)
+    {
+        legacy_forward.exec(0.5 * dt);
+        ck_forward.exec(0.5 * dt);
+        for (size_t i = 0; i != total_real_particles; ++i)
+            for (size_t s = 0; s != 3; ++s)
+                EXPECT_NEAR(ck_species[s][i], legacy_species[s][i], 1.0e-10 * SMAX(Real(1), ABS(legacy_species[s][i])));
+
+        legacy_backward.exec(0.5 * dt);
+        ck_backward.exec(0.5 * dt);
+        for (size_t i = 0; i != total_real_particles; ++i)
+            for (size_t s = 0; s != 3; ++s)
+                EXPECT_NEAR(ck_species[s][i], legacy_species[s][i], 1.0e-10 * SMAX(Real(1), ABS(legacy_species[s][i])));
+    }
+}
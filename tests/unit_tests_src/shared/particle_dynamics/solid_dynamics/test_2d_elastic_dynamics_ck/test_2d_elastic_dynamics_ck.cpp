@@ -0,0 +1,111 @@
+/**
+ * @file 	test_2d_elastic_dynamics_ck.cpp
+ * @brief 	Total Lagrangian elastic steps by computing kernels against the particle dynamics
+ *          on a deformed and moving block.
+ */
+#include "sphinxsys.h"
+#include "sphinxsys_ck.h"
+#include <gtest/gtest.h>
+
+using namespace SPH;
+
+Real rho0_s = 1100.0;
+Real youngs_modulus = 1.7e7;
+Real poisson = 0.45;
+
+void setDeformedState(BaseParticles &particles)
+{
+    Vecd *pos = particles.getVariableDataByName<Vecd>("Position");
+    Vecd *vel = particles.getVariableDataByName<Vecd>("Velocity");
+    Matd *F = particles.getVariableDataByName<Matd>("DeformationGradient");
+    for (size_t i = 0; i != particles.TotalRealParticles(); ++i)
+    {
+        Real x = pos[i][0], y = pos[i][1];
+        vel[i] = Vecd(0.2 * sin(2.0 * x) * y, 0.1 * x * x);
+        F[i] = Matd::Identity() + 0.1 * (Matd() << x, y, -y, 0.5 * x).finished();
+    }
+}
+
+TEST(test_solid_dynamics, elastic_dynamics_ck)
+{
+    Real dp = 0.05;
+    BoundingBox system_domain_bounds(Vec2d(-1.0, -1.0), Vec2d(1.0, 1.0));
+    SPHSystem sph_system(system_domain_bounds, dp);
+    sph_system.setIOEnvironment();
+    Vec2d halfsize(0.5, 0.25);
+    Transform translation(Vec2d::Zero());
+
+    SolidBody legacy_block(sph_system, makeShared<TransformShape<GeometricShapeBox>>(translation, halfsize, "LegacyBlock"));
+    legacy_block.defineMaterial<NeoHookeanSolid>(rho0_s, youngs_modulus, poisson);
+    legacy_block.generateParticles<BaseParticles, Lattice>();
+    SolidBody ck_block(sph_system, makeShared<TransformShape<GeometricShapeBox>>(translation, halfsize, "CKBlock"));
+    ck_block.defineMaterial<NeoHookeanSolid>(rho0_s, youngs_modulus, poisson);
+    ck_block.generateParticles<BaseParticles, Lattice>();
+    BaseParticles &legacy_particles = legacy_block.getBaseParticles();
+    BaseParticles &ck_particles = ck_block.getBaseParticles();
+    UnsignedInt total_real_particles = ck_particles.TotalRealParticles();
+    ASSERT_EQ(legacy_particles.TotalRealParticles(), total_real_particles);
+    //----------------------------------------------------------------------
+    //	Particle dynamics.
+    //----------------------------------------------------------------------
+    InnerRelation legacy_inner(legacy_block);
+    InteractionWithUpdate<LinearGradientCorrectionMatrixInner> legacy_corrected_configuration(legacy_inner);
+    Dynamics1Level<solid_dynamics::Integration1stHalfPK2> legacy_first_half(legacy_inner);
+    Dynamics1Level<solid_dynamics::Integration2ndHalf> legacy_second_half(legacy_inner);
+    //----------------------------------------------------------------------
+    //	Computing kernels.
+    //----------------------------------------------------------------------
+    Relation<Inner<>> ck_inner(ck_block);
+    UpdateCellLinkedList<execution::ParallelPolicy, CellLinkedList> ck_cell_linked_list(ck_block);
+    UpdateRelation<execution::ParallelPolicy, Inner<>> ck_update_inner_relation(ck_inner);
+    solid_dynamics::ReferenceConfigurationCK<execution::ParallelPolicy> ck_reference_configuration(ck_inner);
+    InteractionDynamicsCK<execution::ParallelPolicy, solid_dynamics::Integration1stHalfPK2CK<NeoHookeanSolid>>
+        ck_first_half(ck_inner);
+    InteractionDynamicsCK<execution::ParallelPolicy, solid_dynamics::Integration2ndHalfCK<Inner<OneLevel>>>
+        ck_second_half(ck_inner);
+
+    legacy_block.updateCellLinkedList();
+    legacy_inner.updateConfiguration();
+    legacy_corrected_configuration.exec();
+    ck_cell_linked_list.exec();
+    ck_update_inner_relation.exec();
+    ck_reference_configuration.exec();
+    setDeformedState(legacy_particles);
+    setDeformedState(ck_particles);
+
+    Matd *legacy_B = legacy_particles.getVariableDataByName<Matd>("LinearGradientCorrectionMatrix");
+    Matd *ck_B = ck_particles.getVariableDataByName<Matd>("LinearGradientCorrectionMatrix");
+    for (size_t i = 0; i != total_real_particles; ++i)
+    {
+        EXPECT_NEAR((ck_B[i] - legacy_B[i]).norm(), 0.0, 1.0e-10 * legacy_B[i].norm());
+    }
+
+    Real dt = 1.0e-6;
+    legacy_first_half.exec(dt);
+    ck_first_half.exec(dt);
+    Vecd *legacy_force = legacy_particles.getVariableDataByName<Vecd>("Force");
+    Vecd *ck_force = ck_particles.getVariableDataByName<Vecd>("Force");
+    Vecd *legacy_vel = legacy_particles.getVariableDataByName<Vecd>("Velocity");
+    Vecd *ck_vel = ck_particles.getVariableDataByName<Vecd>("Velocity");
+    Real max_force = 0.0;
+    for (size_t i = 0; i != total_real_particles; ++i)
+        max_force = SMAX(max_force, legacy_force[i].norm());
+    EXPECT_GT(max_force, 0.0);
+    for (size_t i = 0; i != total_real_particles; ++i)
+    {
+        EXPECT_NEAR((ck_force[i] - legacy_force[i]).norm(), 0.0, 1.0e-10 * max_force);
+        EXPECT_NEAR((ck_vel[i] - legacy_vel[i]).norm(), 0.0, 1.0e-10 * SMAX(Real(1), legacy_vel[i].norm()));
+    }
+
+    legacy_second_half.exec(dt);
+    ck_second_half.exec(dt);
+    Matd *legacy_dF_dt = legacy_particles.getVariableDataByName<Matd>("DeformationRate");
+    Matd *ck_dF_dt = ck_particles.getVariableDataByName<Matd>("DeformationRate");
+    Matd *legacy_F = legacy_particles.getVariableDataByName<Matd>("DeformationGradient");
+    Matd *ck_F = ck_particles.getVariableDataByName<Matd>("DeformationGradient");
+    for (size_t i = 0; i != total_real_particles; ++i)
+    {
+        EXPECT_NEAR((ck_dF_dt[i] - legacy_dF_dt[i]).norm(), 0.0, 1.0e-10 * SMAX(Real(1), legacy_dF_dt[i].norm()));
+        EXPECT_NEAR((ck_F[i] - legacy_F[i]).norm(), 0.0, 1.0e-12);
+    }
+}
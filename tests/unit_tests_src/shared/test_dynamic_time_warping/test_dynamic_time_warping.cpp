@@ -0,0 +1,122 @@
+/**
+ * @file 	test_dynamic_time_warping.cpp
+ * @brief 	Banded two-row dynamic time warping distance against the full-matrix reference.
+ */
+#include "sphinxsys.h"
+#include <gtest/gtest.h>
+#include <random>
+
+using namespace SPH;
+
+template <class VariableType>
+class DynamicTimeWarping : public RegressionTestDynamicTimeWarping<ObservedQuantityRecording<VariableType>>
+{
+  public:
+    using RegressionTestDynamicTimeWarping<ObservedQuantityRecording<VariableType>>::calculateDTWDistance;
+    using RegressionTestDynamicTimeWarping<ObservedQuantityRecording<VariableType>>::calculatePNorm;
+};
+
+/** The full accumulated distance matrix, in which the cells beyond the window are kept as zero. */
+template <class VariableType>
+Real referenceDTWDistance(const StdVec<VariableType> &sequence_a, const StdVec<VariableType> &sequence_b)
+{
+    auto p_norm = [](const VariableType &a, const VariableType &b)
+    { return DynamicTimeWarping<VariableType>::calculatePNorm(a, b); };
+    int a_length = sequence_a.size();
+    int b_length = sequence_b.size();
+    int window_size = SMAX(5, ABS(a_length - b_length));
+    BiVector<Real> distance(a_length, StdVec<Real>(b_length, 0));
+    distance[0][0] = p_norm(sequence_a[0], sequence_b[0]);
+    for (int i = 1; i < a_length; ++i)
+        distance[i][0] = distance[i - 1][0] + p_norm(sequence_a[i], sequence_b[0]);
+    for (int j = 1; j < b_length; ++j)
+        distance[0][j] = distance[0][j - 1] + p_norm(sequence_a[0], sequence_b[j]);
+    for (int i = 1; i < a_length; ++i)
+        for (int j = SMAX(1, i - window_size); j < SMIN(b_length, i + window_size); ++j)
+            distance[i][j] = p_norm(sequence_a[i], sequence_b[j]) +
+                             SMIN(distance[i - 1][j], distance[i][j - 1], distance[i - 1][j - 1]);
+    return distance[a_length - 1][b_length - 1];
+}
+
+template <class VariableType>
+Real bandedDTWDistance(const StdVec<VariableType> &sequence_a, const StdVec<VariableType> &sequence_b)
+{
+    int a_length = sequence_a.size();
+    int b_length = sequence_b.size();
+    int window_size = SMAX(5, ABS(a_length - b_length));
+    return DynamicTimeWarping<VariableType>::calculateDTWDistance(
+        sequence_a.data(), a_length, sequence_b.data(), b_length, window_size);
+}
+
+std::mt19937 random_engine(7);
+std::uniform_real_distribution<Real> random_unit(0.0, 1.0);
+
+StdVec<Real> randomScalarSequence(int length)
+{
+    StdVec<Real> sequence(length);
+    for (auto &value : sequence)
+        value = random_unit(random_engine);
+    return sequence;
+}
+
+StdVec<Vecd> randomVectorSequence(int length)
+{
+    StdVec<Vecd> sequence(length);
+    for (auto &value : sequence)
+        for (int d = 0; d != Dimensions; ++d)
+            value[d] = random_unit(random_engine);
+    return sequence;
+}
+
+TEST(test_dynamic_time_warping, banded_against_full_matrix)
+{
+    /** lengths within 10%, as required by the regression test */
+    for (int k = 0; k != 2000; ++k)
+    {
+        int a_length = 1 + random_engine() % 80;
+        int b_length = SMAX(1, (int)std::lround(a_length * (0.9 + 0.2 * random_unit(random_engine))));
+        if (b_length > 1.1 * a_length || b_length < 0.9 * a_length)
+            continue;
+        StdVec<Real> sequence_a = randomScalarSequence(a_length);
+        StdVec<Real> sequence_b = randomScalarSequence(b_length);
+        EXPECT_DOUBLE_EQ(bandedDTWDistance(sequence_a, sequence_b), referenceDTWDistance(sequence_a, sequence_b))
+            << "lengths " << a_length << " and " << b_length;
+    }
+}
+
+TEST(test_dynamic_time_warping, window_from_length_difference)
+{
+    /** the window is widened to the length difference when it is not less than 5 */
+    StdVec<std::pair<int, int>> lengths = {{50, 55}, {60, 66}, {66, 60}, {100, 91}, {91, 100}, {200, 219}};
+    for (auto &length : lengths)
+    {
+        StdVec<Real> sequence_a = randomScalarSequence(length.first);
+        StdVec<Real> sequence_b = randomScalarSequence(length.second);
+        EXPECT_DOUBLE_EQ(bandedDTWDistance(sequence_a, sequence_b), referenceDTWDistance(sequence_a, sequence_b))
+            << "lengths " << length.first << " and " << length.second;
+    }
+}
+
+TEST(test_dynamic_time_warping, single_point_sequence)
+{
+    for (int b_length : {1, 2, 3, 7})
+    {
+        StdVec<Real> sequence_a = randomScalarSequence(1);
+        StdVec<Real> sequence_b = randomScalarSequence(b_length);
+        EXPECT_DOUBLE_EQ(bandedDTWDistance(sequence_a, sequence_b), referenceDTWDistance(sequence_a, sequence_b))
+            << "length " << b_length;
+    }
+}
+
+TEST(test_dynamic_time_warping, vector_sequence)
+{
+    for (int k = 0; k != 200; ++k)
+    {
+        int a_length = 1 + random_engine() % 60;
+        int b_length = SMAX(1, (int)std::lround(a_length * (0.9 + 0.2 * random_unit(random_engine))));
+        StdVec<Vecd> sequence_a = randomVectorSequence(a_length);
+        StdVec<Vecd> sequence_b = randomVectorSequence(b_length);
+        EXPECT_DOUBLE_EQ(bandedDTWDistance(sequence_a, sequence_b), referenceDTWDistance(sequence_a, sequence_b))
+            << "lengths " << a_length << " and " << b_length;
+    }
+}